@@ -0,0 +1,257 @@
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench.h"
+
+/* Colors */
+#define RESET "\033[0m"
+#define GREEN "\033[0;32m"
+#define PURPLE "\033[0;35m"
+#define CYAN "\033[0;36m"
+#define YELLOW "\033[0;33m"
+
+#define BOLD "\e[1m"
+
+static inline uint64_t
+get_ns(void)
+{
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+    abort();
+  }
+  return ts.tv_sec * UINT64_C(1000000000) + ts.tv_nsec;
+}
+
+bool
+bench_run(struct bench_state* state)
+{
+  const uint64_t now = get_ns();
+
+  if (state->iteration > state->warmup) {
+    state->samples[state->iteration - state->warmup - 1] =
+      now - state->start - state->paused;
+  }
+  if (state->iteration++ == state->warmup + state->repetitions) {
+    return false;
+  }
+  state->paused = 0;
+  state->start = get_ns();
+  return true;
+}
+
+void
+bench_pause(struct bench_state* state)
+{
+  state->pause_start = get_ns();
+}
+
+void
+bench_resume(struct bench_state* state)
+{
+  state->paused += get_ns() - state->pause_start;
+}
+
+/**
+ * Statistics of a benchmark (ns by operation).
+ */
+struct bench_result
+{
+  double min;
+  double median;
+  double p99;
+  double mean;
+};
+
+static int
+cmp_u64(const void* a, const void* b)
+{
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+static void
+get_result(const struct bench_state* state, struct bench_result* res)
+{
+  const uint32_t nr = state->repetitions;
+  const double batch = state->batch;
+  double sum = 0;
+
+  qsort(state->samples, nr, sizeof(uint64_t), cmp_u64);
+  for (uint32_t i = 0; i < nr; ++i) {
+    sum += state->samples[i];
+  }
+  /* nearest rank */
+  uint32_t p99 = (99 * nr + 99) / 100;
+  res->min = state->samples[0] / batch;
+  res->median = state->samples[nr / 2] / batch;
+  res->p99 = state->samples[p99 - 1] / batch;
+  res->mean = sum / nr / batch;
+}
+
+struct options
+{
+  const char* json;
+  uint32_t warmup;
+  uint32_t repetitions; /* 0: from the benchmark */
+  const char* section;
+  const char* name;
+};
+
+enum
+{
+  CASE_JSON,
+  CASE_WARMUP,
+  CASE_REPETITIONS,
+};
+
+static struct option long_options[] = {
+  { "json", required_argument, 0, 0 },
+  { "warmup", required_argument, 0, 0 },
+  { "repetitions", required_argument, 0, 0 },
+  { 0, 0, 0, 0 },
+};
+
+static void
+options_parse(int argc, char** argv, struct options* opts)
+{
+  opts->json = NULL;
+  opts->warmup = BENCH_WARMUP;
+  opts->repetitions = 0;
+  opts->section = NULL;
+  opts->name = NULL;
+
+  while (true) {
+    int option_index = 0;
+    int c = getopt_long(argc, argv, "", long_options, &option_index);
+    if (c == -1) {
+      break;
+    }
+    switch (option_index) {
+      case CASE_JSON:
+        opts->json = optarg;
+        break;
+      case CASE_WARMUP:
+        opts->warmup = atoi(optarg);
+        break;
+      case CASE_REPETITIONS:
+        opts->repetitions = atoi(optarg);
+        break;
+    }
+  }
+  if (optind < argc) {
+    opts->section = argv[optind];
+  }
+  if (optind + 1 < argc) {
+    opts->name = argv[optind + 1];
+  }
+}
+
+static bool
+is_selected(const struct options* opts, const struct bench* b)
+{
+  return (opts->section == NULL || strcmp(opts->section, b->section) == 0) &&
+         (opts->name == NULL || strcmp(opts->name, b->name) == 0);
+}
+
+static void
+do_bench(const struct options* opts,
+         const struct bench* b,
+         struct bench_result* res)
+{
+  struct bench_state state = {
+    .batch = b->batch,
+    .warmup = opts->warmup,
+    .repetitions = opts->repetitions,
+  };
+
+  if (state.repetitions == 0) {
+    state.repetitions = b->repetitions != 0 ? b->repetitions : BENCH_REPETITIONS;
+  }
+  state.samples = calloc(state.repetitions, sizeof(uint64_t));
+
+  printf(YELLOW " [bench] " PURPLE "(%s)" RESET BOLD " %s" RESET,
+         b->section,
+         b->name);
+  fflush(stdout);
+  b->bench_f(&state);
+  get_result(&state, res);
+  printf(" min:%.1fns median:%.1fns p99:%.1fns mean:%.1fns"
+         " (%u x %lu)\n",
+         res->min,
+         res->median,
+         res->p99,
+         res->mean,
+         state.repetitions,
+         state.batch);
+  free(state.samples);
+}
+
+static void
+json_bench(FILE* file,
+           const struct bench* b,
+           const struct bench_result* res,
+           bool first)
+{
+  fprintf(file,
+          "%s    {\"name\": \"%s/%s\", \"batch\": %lu,"
+          " \"min_ns\": %.3f, \"median_ns\": %.3f,"
+          " \"p99_ns\": %.3f, \"mean_ns\": %.3f}",
+          first ? "" : ",\n",
+          b->section,
+          b->name,
+          b->batch,
+          res->min,
+          res->median,
+          res->p99,
+          res->mean);
+}
+
+int
+run_bench_suite(const struct bench_suite* bs, int argc, char** argv)
+{
+  struct options opts;
+  struct bench_result res;
+  FILE* json = NULL;
+  bool first = true;
+
+  options_parse(argc, argv, &opts);
+  if (opts.json != NULL) {
+    json = fopen(opts.json, "w");
+    if (json == NULL) {
+      perror("fopen");
+      return -1;
+    }
+    fprintf(json,
+            "{\n  \"suite\": \"%s\",\n  \"warmup\": %u,\n"
+            "  \"benchmarks\": [\n",
+            bs->name,
+            opts.warmup);
+  }
+
+  printf(CYAN "[start bench suite] " BOLD "%s\n" RESET, bs->name);
+  const uint64_t start = get_ns();
+  for (const struct bench* b = &bs->benchs[0]; b != &bs->benchs[bs->nr_bench];
+       ++b) {
+    if (is_selected(&opts, b) == false) {
+      continue;
+    }
+    do_bench(&opts, b, &res);
+    if (json != NULL) {
+      json_bench(json, b, &res, first);
+      first = false;
+    }
+  }
+  const uint64_t end = (get_ns() - start) / 1000000;
+  printf(CYAN "[end bench suite] " GREEN "OK" RESET " (%lums)\n", end);
+
+  if (json != NULL) {
+    fprintf(json, "\n  ]\n}\n");
+    fclose(json);
+  }
+  return 0;
+}
@@ -0,0 +1,116 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Microbenchmarks: each benchmark runs @c warmup repetitions not
+ * measured, then @c repetitions measured repetitions of @c batch
+ * operations. The time by operation is reported (min, median, p99, mean)
+ * on the console and optionally in a JSON file (--json).
+ *
+ * Usage: bench [--json path] [--warmup n] [--repetitions n] [section [name]]
+ */
+
+/* Default number of repetitions (warmup excluded). */
+#define BENCH_REPETITIONS 20
+#define BENCH_WARMUP 2
+
+/**
+ * State of a running benchmark.
+ * Should use helpers bench_run, bench_pause and bench_resume.
+ */
+struct bench_state
+{
+  /* Number of operations by repetition */
+  uint64_t batch;
+  uint32_t warmup;
+  uint32_t repetitions;
+  /* Current repetition (warmup included) */
+  uint32_t iteration;
+  uint64_t start;
+  uint64_t paused;
+  uint64_t pause_start;
+  /* Time of each repetition measured (ns) */
+  uint64_t* samples;
+};
+
+/* Declare a benchmark. */
+#define BENCH_F(section, name)                                                 \
+  static void bench_##section##_##name(struct bench_state* state)
+
+/* clang-format off */
+/* Add a benchmark to the suite (batch: operations by repetition,
+   repetitions: 0 for the default). */
+#define BENCH(section, name, batch, repetitions)             \
+  {                                                          \
+    #section, #name, bench_ ## section ## _ ## name,         \
+    batch, repetitions                                       \
+  }
+/* clang-format on */
+
+/**
+ * Structure used to declare a benchmark.
+ * Should use helper BENCH.
+ */
+struct bench
+{
+  char* section;
+  char* name;
+  void (*bench_f)(struct bench_state*);
+  uint64_t batch;
+  uint32_t repetitions;
+};
+
+/**
+ * Structure used to declare a benchmark suite.
+ * Should use helper BENCH_SUITE.
+ */
+struct bench_suite
+{
+  char* name;
+  uint32_t nr_bench;
+  const struct bench* benchs;
+};
+
+/* Run the benchmarks of a suite (filtered by the command line). */
+int
+run_bench_suite(const struct bench_suite* bs, int argc, char** argv);
+
+/**
+ * Start the next repetition, the previous one is measured.
+ * Return false when all the repetitions are done:
+ *
+ *   while (bench_run(state)) {
+ *     for (uint64_t i = 0; i < state->batch; ++i) { ... }
+ *   }
+ */
+bool
+bench_run(struct bench_state* state);
+
+/* Exclude the time between bench_pause and bench_resume (setup). */
+void
+bench_pause(struct bench_state* state);
+
+void
+bench_resume(struct bench_state* state);
+
+/* Declare a benchmark suite. */
+#define BENCH_SUITE(name)                                                      \
+  const static struct bench_suite name##_bench_suite = {                       \
+    #name,                                                                     \
+    sizeof(name##_benchs) / sizeof(struct bench),                              \
+    name##_benchs,                                                             \
+  };                                                                           \
+  int main(int argc, char** argv)                                              \
+  {                                                                            \
+    return run_bench_suite(&name##_bench_suite, argc, argv);                   \
+  }
+
+/* Prevent the compiler to remove the computation of a value. */
+#define BENCH_KEEP(VALUE) __asm__ volatile("" : : "g"(VALUE) : "memory")
+
+#endif /* !__BENCH_H__ */
@@ -0,0 +1,71 @@
+#include <stdlib.h>
+
+#include "nerdle.h"
+#include "bench.h"
+
+/* Number of equations by repetition */
+#define NR_EQ 1024
+
+/**
+ * Unpack NR_EQ equations of size 8, evenly spaced in the dictionary.
+ */
+static struct equation* get_equations(void)
+{
+  struct nerdle *nerdle = nerdle_create(8, 0);
+  struct equation *eqs = calloc(NR_EQ, sizeof(struct equation));
+
+  nerdle->verbose = false;
+  nerdle_generate_equations(nerdle);
+  for (uint32_t i = 0; i < NR_EQ; ++i) {
+    uint64_t j = i * (nerdle->candidates.nr / NR_EQ);
+    equation_unpack(nerdle->candidates.eqs[j], &eqs[i], 8);
+  }
+  nerdle_destroy(nerdle);
+  return eqs;
+}
+
+BENCH_F(equation, check_equality)
+{
+  struct equation *eqs = get_equations();
+
+  while (bench_run(state)) {
+    for (uint32_t i = 0; i < NR_EQ; ++i) {
+      BENCH_KEEP(equation_check_equality(&eqs[i]));
+    }
+  }
+  free(eqs);
+}
+
+BENCH_F(equation, add_symbol)
+{
+  struct equation *eqs = get_equations();
+
+  while (bench_run(state)) {
+    for (uint32_t i = 0; i < NR_EQ; ++i) {
+      for (uint32_t pos = 1; pos < 8; ++pos) {
+        BENCH_KEEP(equation_add_symbol(&eqs[i], eqs[i].symbols[pos], pos));
+      }
+    }
+  }
+  free(eqs);
+}
+
+BENCH_F(equation, get_variance)
+{
+  struct equation *eqs = get_equations();
+
+  while (bench_run(state)) {
+    for (uint32_t i = 0; i < NR_EQ; ++i) {
+      BENCH_KEEP(equation_get_variance(&eqs[i]));
+    }
+  }
+  free(eqs);
+}
+
+const static struct bench equation_benchs[] = {
+  BENCH(equation, check_equality, NR_EQ, 0),
+  BENCH(equation, add_symbol, NR_EQ * 7, 0),
+  BENCH(equation, get_variance, NR_EQ, 0),
+};
+
+BENCH_SUITE(equation);
@@ -0,0 +1,165 @@
+#include "nerdle.h"
+#include "feedback.h"
+#include "bench.h"
+
+static void bench_generate(struct bench_state *state, uint32_t sz, bool generic)
+{
+  while (bench_run(state)) {
+    struct nerdle *nerdle = nerdle_create(sz, 0);
+    nerdle->verbose = false;
+    if (generic == true) {
+      nerdle_set_generic_kernels(nerdle);
+    }
+    nerdle_generate_equations(nerdle);
+    bench_pause(state);
+    nerdle_destroy(nerdle);
+    bench_resume(state);
+  }
+}
+
+#define BENCH_GENERATE(SZ)                      \
+  BENCH_F(nerdle, generate_##SZ)                \
+  {                                             \
+    bench_generate(state, SZ, false);           \
+  }
+
+BENCH_GENERATE(5)
+BENCH_GENERATE(6)
+BENCH_GENERATE(7)
+BENCH_GENERATE(8)
+BENCH_GENERATE(9)
+
+#undef BENCH_GENERATE
+
+BENCH_F(nerdle, generate_generic_8)
+{
+  bench_generate(state, 8, true);
+}
+
+/**
+ * All the equations of size 8.
+ */
+static struct nerdle* get_dictionary(void)
+{
+  struct nerdle *nerdle = nerdle_create(8, 0);
+  nerdle->verbose = false;
+  nerdle_generate_equations(nerdle);
+  return nerdle;
+}
+
+/**
+ * Game of size 8 after the feedback of a first guess: the first and the
+ * last equations of the dictionary with the answer in the middle.
+ */
+static struct nerdle* get_round(const struct nerdle *dict, uint32_t nr_guess)
+{
+  const struct candidates *c = &dict->candidates;
+  uint64_t guesses[] = { c->eqs[0], c->eqs[c->nr - 1] };
+  uint64_t answer = c->eqs[c->nr / 2];
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  struct nerdle *nerdle = nerdle_create(8, 0);
+  nerdle->verbose = false;
+  nerdle->strategy = dict->strategy;
+  nerdle_set_equations(nerdle, c->eqs, c->nr);
+  for (uint32_t g = 0; g < nr_guess; ++g) {
+    equation_unpack(guesses[g], &eq, 8);
+    feedback_get_status(feedback_pattern(guesses[g], answer, 8), 8, status);
+    nerdle_update_feedback(nerdle, &eq, status);
+  }
+  return nerdle;
+}
+
+BENCH_F(nerdle, check_candidates)
+{
+  struct nerdle *dict = get_dictionary();
+
+  while (bench_run(state)) {
+    bench_pause(state);
+    struct nerdle *nerdle = get_round(dict, 1);
+    bench_resume(state);
+    nerdle_check_candidates(nerdle);
+    bench_pause(state);
+    nerdle_destroy(nerdle);
+    bench_resume(state);
+  }
+  nerdle_destroy(dict);
+}
+
+/**
+ * Regenerate the candidates respecting the status of a round
+ * (the candidates exhausted).
+ */
+BENCH_F(nerdle, regenerate)
+{
+  struct nerdle *dict = get_dictionary();
+
+  while (bench_run(state)) {
+    bench_pause(state);
+    struct nerdle *nerdle = get_round(dict, 2);
+    nerdle->candidates.nr = 0;
+    bench_resume(state);
+    nerdle_generate_equations(nerdle);
+    bench_pause(state);
+    nerdle_destroy(nerdle);
+    bench_resume(state);
+  }
+  nerdle_destroy(dict);
+}
+
+static void bench_find_best(struct bench_state *state, enum strategy strategy,
+                            uint32_t nr_guess)
+{
+  struct nerdle *dict = get_dictionary();
+  struct equation eq;
+
+  dict->strategy = strategy;
+  while (bench_run(state)) {
+    bench_pause(state);
+    struct nerdle *nerdle = get_round(dict, nr_guess);
+    bench_resume(state);
+    nerdle_find_best_equation(nerdle, &eq);
+    bench_pause(state);
+    nerdle_destroy(nerdle);
+    bench_resume(state);
+  }
+  nerdle_destroy(dict);
+}
+
+BENCH_F(nerdle, find_best_variance)
+{
+  bench_find_best(state, STRATEGY_VARIANCE, 0);
+}
+
+BENCH_F(nerdle, find_best_entropy)
+{
+  bench_find_best(state, STRATEGY_ENTROPY, 0);
+}
+
+BENCH_F(nerdle, find_best_partition)
+{
+  bench_find_best(state, STRATEGY_PARTITION, 0);
+}
+
+BENCH_F(nerdle, find_best_entropy_round_2)
+{
+  bench_find_best(state, STRATEGY_ENTROPY, 1);
+}
+
+const static struct bench nerdle_benchs[] = {
+  BENCH(nerdle, generate_5, 1, 0),
+  BENCH(nerdle, generate_6, 1, 0),
+  BENCH(nerdle, generate_7, 1, 0),
+  BENCH(nerdle, generate_8, 1, 10),
+  BENCH(nerdle, generate_9, 1, 5),
+  BENCH(nerdle, generate_generic_8, 1, 10),
+  BENCH(nerdle, check_candidates, 1, 0),
+  BENCH(nerdle, regenerate, 1, 10),
+  BENCH(nerdle, find_best_variance, 1, 0),
+  BENCH(nerdle, find_best_entropy, 1, 10),
+  BENCH(nerdle, find_best_partition, 1, 10),
+  BENCH(nerdle, find_best_entropy_round_2, 1, 0),
+};
+
+BENCH_SUITE(nerdle);
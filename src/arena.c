@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+#define ARENA_ALIGN 16
+
+struct arena_chunk {
+  struct arena_chunk *next;
+  size_t sz;     /* bytes of data */
+  size_t offset; /* bytes of data used */
+  _Alignas(ARENA_ALIGN) char data[];
+};
+
+void arena_init(struct arena *arena, size_t chunk_sz)
+{
+  memset(arena, 0, sizeof(*arena));
+  arena->chunk_sz = chunk_sz != 0 ? chunk_sz : ARENA_CHUNK_SZ;
+}
+
+void arena_release(struct arena *arena)
+{
+  struct arena_chunk *chunk = arena->first;
+
+  while (chunk != NULL) {
+    struct arena_chunk *next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+  arena->first = NULL;
+  arena->current = NULL;
+  arena->used = 0;
+  arena->reserved = 0;
+}
+
+/**
+ * Get a chunk with room for @c sz bytes after the current chunk: the
+ * next free chunk if large enough, otherwise a new chunk inserted.
+ */
+static struct arena_chunk* arena_next_chunk(struct arena *arena, size_t sz)
+{
+  struct arena_chunk *current = arena->current;
+  struct arena_chunk *next = current != NULL ? current->next : arena->first;
+
+  if (next != NULL && next->sz >= sz) {
+    next->offset = 0;
+    return next;
+  }
+
+  size_t chunk_sz = sz > arena->chunk_sz ? sz : arena->chunk_sz;
+  struct arena_chunk *chunk = malloc(sizeof(*chunk) + chunk_sz);
+  chunk->sz = chunk_sz;
+  chunk->offset = 0;
+  chunk->next = next;
+  if (current != NULL) {
+    current->next = chunk;
+  } else {
+    arena->first = chunk;
+  }
+  arena->reserved += chunk_sz;
+  return chunk;
+}
+
+void* arena_alloc(struct arena *arena, size_t sz)
+{
+  struct arena_chunk *chunk = arena->current;
+
+  sz = (sz + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+  if (chunk == NULL || chunk->sz - chunk->offset < sz) {
+    chunk = arena_next_chunk(arena, sz);
+    arena->current = chunk;
+  }
+
+  void *ptr = chunk->data + chunk->offset;
+  chunk->offset += sz;
+  arena->used += sz;
+  if (arena->used > arena->high) {
+    arena->high = arena->used;
+  }
+  return ptr;
+}
+
+void* arena_calloc(struct arena *arena, size_t sz)
+{
+  return memset(arena_alloc(arena, sz), 0, sz);
+}
+
+struct arena_mark arena_get_mark(const struct arena *arena)
+{
+  struct arena_mark mark = {
+    .chunk = arena->current,
+    .offset = arena->current != NULL ? arena->current->offset : 0,
+    .used = arena->used,
+  };
+  return mark;
+}
+
+void arena_rewind(struct arena *arena, struct arena_mark mark)
+{
+  arena->current = mark.chunk;
+  if (mark.chunk != NULL) {
+    mark.chunk->offset = mark.offset;
+  }
+  arena->used = mark.used;
+}
+
+void arena_reset(struct arena *arena)
+{
+  struct arena_mark mark = { NULL, 0, 0 };
+  arena_rewind(arena, mark);
+}
+
+void arena_dump(const struct arena *arena, const char *name)
+{
+  printf("[nerdle] arena %s: high-water %.1fKB, reserved %.1fKB\n",
+         name, arena->high / 1024.0, arena->reserved / 1024.0);
+}
@@ -0,0 +1,104 @@
+#ifndef __ARENA__
+#define __ARENA__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Bump allocator: the allocations are carved in chunks and never freed
+ * one by one, the arena is released (or reset, or rewound to a mark) at
+ * once. Not thread-safe: one arena by game or by thread.
+ * The chunks are kept on reset and rewind, so an arena reused round
+ * after round reaches its high-water mark and stops allocating.
+ */
+
+/**
+ * Default size of a chunk (an allocation above has its own chunk).
+ */
+#define ARENA_CHUNK_SZ (64 * 1024)
+
+struct arena_chunk;
+
+struct arena {
+  /* Size of a new chunk */
+  size_t chunk_sz;
+  /* Chunks: first and current (the following ones are free) */
+  struct arena_chunk *first;
+  struct arena_chunk *current;
+  /* Bytes allocated (used), maximum since the initialization (high)
+     and bytes of the chunks (reserved) */
+  size_t used;
+  size_t high;
+  size_t reserved;
+};
+
+/**
+ * Position of an arena to rewind to (@c arena_rewind).
+ */
+struct arena_mark {
+  struct arena_chunk *chunk;
+  size_t offset;
+  size_t used;
+};
+
+/**
+ * Initialize an arena (no chunk allocated before the first allocation).
+ *
+ * @param arena arena handle.
+ * @param chunk_sz size of a chunk (0: @c ARENA_CHUNK_SZ).
+ */
+void arena_init(struct arena *arena, size_t chunk_sz);
+
+/**
+ * Release all the chunks of an arena.
+ *
+ * @param arena arena handle.
+ */
+void arena_release(struct arena *arena);
+
+/**
+ * Allocate from an arena (aligned on 16 bytes, not zeroed).
+ *
+ * @param arena arena handle.
+ * @param sz size of the allocation.
+ * @return allocation (valid until the arena is reset or rewound before).
+ */
+void* arena_alloc(struct arena *arena, size_t sz);
+
+/**
+ * Same as @c arena_alloc, zeroed.
+ */
+void* arena_calloc(struct arena *arena, size_t sz);
+
+/**
+ * Get the current position of an arena.
+ *
+ * @param arena arena handle.
+ * @return mark.
+ */
+struct arena_mark arena_get_mark(const struct arena *arena);
+
+/**
+ * Free the allocations done after a mark (the chunks are kept).
+ *
+ * @param arena arena handle.
+ * @param mark mark previously returned by @c arena_get_mark.
+ */
+void arena_rewind(struct arena *arena, struct arena_mark mark);
+
+/**
+ * Free all the allocations (the chunks are kept).
+ *
+ * @param arena arena handle.
+ */
+void arena_reset(struct arena *arena);
+
+/**
+ * Dump the high-water mark and the bytes reserved of an arena.
+ *
+ * @param arena arena handle.
+ * @param name name of the arena.
+ */
+void arena_dump(const struct arena *arena, const char *name);
+
+#endif /* !__ARENA__ */
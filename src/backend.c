@@ -0,0 +1,40 @@
+#include <stdlib.h>
+
+#include "backend.h"
+
+struct backend* backend_create(const struct backend_ops *ops,
+                               const struct backend_config *config)
+{
+  void *ctx = ops->create(config);
+  if (ctx == NULL) {
+    return NULL;
+  }
+
+  struct backend *backend = calloc(1, sizeof(*backend));
+  backend->ops = ops;
+  backend->ctx = ctx;
+  return backend;
+}
+
+void backend_destroy(struct backend *backend)
+{
+  backend->ops->destroy(backend->ctx);
+  free(backend);
+}
+
+bool backend_start(struct backend *backend, uint32_t sz)
+{
+  return backend->ops->start(backend->ctx, sz);
+}
+
+bool backend_submit(struct backend *backend, uint32_t round,
+                    const struct equation *eq)
+{
+  return backend->ops->submit(backend->ctx, round, eq);
+}
+
+bool backend_read_feedback(struct backend *backend, uint32_t round,
+                           uint32_t sz, enum status *status)
+{
+  return backend->ops->read_feedback(backend->ctx, round, sz, status);
+}
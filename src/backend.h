@@ -0,0 +1,103 @@
+#ifndef __BACKEND__
+#define __BACKEND__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rules.h"
+#include "equation.h"
+
+/**
+ * Configuration of a backend (each backend uses its own fields).
+ */
+struct backend_config {
+  /* local: "unix:<path>" (socket of a server), "fd:<n>" (connected file
+     descriptor) or the path of the server executable to spawn */
+  const char *arg;
+  /* x11: keyboard emulation (@c interface_set_keyboard) */
+  uint32_t key_delay;
+  bool verify_input;
+};
+
+/**
+ * Game backend: where the equations are submitted and the feedback read.
+ */
+struct backend_ops {
+  const char *name;
+  /* Return the context of the backend, NULL if error */
+  void* (*create)(const struct backend_config *config);
+  /* Start a game of size sz */
+  bool (*start)(void *ctx, uint32_t sz);
+  /* Submit the equation of a round */
+  bool (*submit)(void *ctx, uint32_t round, const struct equation *eq);
+  /* Read the status of each location of the equation submitted */
+  bool (*read_feedback)(void *ctx, uint32_t round, uint32_t sz,
+                        enum status *status);
+  void (*destroy)(void *ctx);
+};
+
+struct backend {
+  const struct backend_ops *ops;
+  void *ctx;
+};
+
+/**
+ * Backend of the mock server (@c nerdle-server), line protocol.
+ */
+extern const struct backend_ops backend_local_ops;
+
+/**
+ * Backend of the site (X11 screen capture and keyboard emulation).
+ */
+extern const struct backend_ops backend_x11_ops;
+
+/**
+ * Create a backend.
+ *
+ * @param ops operations of the backend.
+ * @param config configuration.
+ * @return backend handle allocated, NULL if error.
+ */
+struct backend* backend_create(const struct backend_ops *ops,
+                               const struct backend_config *config);
+
+/**
+ * Destroy a backend previously allocated from @c backend_create.
+ *
+ * @param backend backend handle.
+ */
+void backend_destroy(struct backend *backend);
+
+/**
+ * Start a game.
+ *
+ * @param backend backend handle.
+ * @param sz size of the equation.
+ * @return true if OK, otherwise false.
+ */
+bool backend_start(struct backend *backend, uint32_t sz);
+
+/**
+ * Submit the equation of a round.
+ *
+ * @param backend backend handle.
+ * @param round number of the round.
+ * @param eq equation to submit.
+ * @return true if OK, otherwise false.
+ */
+bool backend_submit(struct backend *backend, uint32_t round,
+                    const struct equation *eq);
+
+/**
+ * Read the feedback of the equation submitted.
+ *
+ * @param backend backend handle.
+ * @param round number of the round.
+ * @param sz size of the equation.
+ * @param status status of each location output.
+ * @return true if OK, false if no feedback (error or end of game).
+ */
+bool backend_read_feedback(struct backend *backend, uint32_t round,
+                           uint32_t sz, enum status *status);
+
+#endif /* !__BACKEND__ */
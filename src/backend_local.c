@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "backend.h"
+#include "feedback.h"
+#include "utils.h"
+
+/**
+ * Client of the mock server (@c server_session).
+ */
+struct local {
+  FILE *in;
+  FILE *out;
+  pid_t pid; /* server spawned, 0 if none */
+  char *line;
+  size_t line_sz;
+};
+
+static int local_connect(const char *path)
+{
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    return -1;
+  }
+  strcpy(addr.sun_path, path);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1) {
+    return -1;
+  }
+  if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == -1) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * Spawn the server, its input and output connected to a socket pair.
+ */
+static int local_spawn(const char *path, pid_t *pid)
+{
+  int sv[2];
+
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1) {
+    return -1;
+  }
+  *pid = fork();
+  if (*pid == -1) {
+    close(sv[0]);
+    close(sv[1]);
+    return -1;
+  }
+  if (*pid == 0) {
+    close(sv[0]);
+    dup2(sv[1], STDIN_FILENO);
+    dup2(sv[1], STDOUT_FILENO);
+    close(sv[1]);
+    execl(path, path, (char*)NULL);
+    _exit(127);
+  }
+  close(sv[1]);
+  return sv[0];
+}
+
+static void* local_create(const struct backend_config *config)
+{
+  struct local *local = calloc(1, sizeof(*local));
+  const char *arg = config->arg != NULL ? config->arg : "nerdle-server";
+  int fd;
+
+  if (strncmp(arg, "unix:", 5) == 0) {
+    fd = local_connect(arg + 5);
+  } else if (strncmp(arg, "fd:", 3) == 0) {
+    fd = atoi(arg + 3);
+  } else {
+    fd = local_spawn(arg, &local->pid);
+  }
+  if (fd < 0) {
+    printf("[nerdle] cannot connect to the server '%s'\n", arg);
+    free(local);
+    return NULL;
+  }
+
+  /* the server can quit before the client */
+  signal(SIGPIPE, SIG_IGN);
+  local->in = fdopen(fd, "r");
+  local->out = fdopen(dup(fd), "w");
+  return local;
+}
+
+/**
+ * Read an answer of the server (without the end of line), NULL if error.
+ */
+static const char* local_read_line(struct local *local)
+{
+  ssize_t len = getline(&local->line, &local->line_sz, local->in);
+  if (len <= 0) {
+    return NULL;
+  }
+  if (local->line[len - 1] == '\n') {
+    local->line[len - 1] = '\0';
+  }
+  return local->line;
+}
+
+static bool local_start(void *ctx, uint32_t sz)
+{
+  struct local *local = ctx;
+
+  fprintf(local->out, "START %u\n", sz);
+  if (fflush(local->out) != 0) {
+    return false;
+  }
+  const char *answer = local_read_line(local);
+  return answer != NULL && strcmp(answer, "OK") == 0;
+}
+
+static bool local_submit(void *ctx, uint32_t round, const struct equation *eq)
+{
+  struct local *local = ctx;
+  char str[LIMIT_MAX_EQ_SZ];
+
+  (void)round;
+  utils_eq_to_str(eq, str, eq->sz);
+  fprintf(local->out, "GUESS %.*s\n", eq->sz, str);
+  return fflush(local->out) == 0;
+}
+
+static bool local_read_feedback(void *ctx, uint32_t round, uint32_t sz,
+                                enum status *status)
+{
+  struct local *local = ctx;
+
+  (void)round;
+  const char *answer = local_read_line(local);
+  if (answer == NULL || strncmp(answer, "FEEDBACK ", 9) != 0 ||
+      strlen(answer + 9) != sz) {
+    return false;
+  }
+  return feedback_from_str(answer + 9, sz, status);
+}
+
+static void local_destroy(void *ctx)
+{
+  struct local *local = ctx;
+
+  fprintf(local->out, "QUIT\n");
+  fclose(local->out);
+  fclose(local->in);
+  if (local->pid != 0) {
+    waitpid(local->pid, NULL, 0);
+  }
+  free(local->line);
+  free(local);
+}
+
+const struct backend_ops backend_local_ops = {
+  .name = "local",
+  .create = local_create,
+  .start = local_start,
+  .submit = local_submit,
+  .read_feedback = local_read_feedback,
+  .destroy = local_destroy,
+};
@@ -0,0 +1,46 @@
+#include <stdlib.h>
+
+#include "backend.h"
+#include "interface.h"
+
+static void* x11_create(const struct backend_config *config)
+{
+  interface_t *in = interface_create();
+  if (in != NULL) {
+    interface_set_keyboard(in, config->key_delay, config->verify_input);
+  }
+  return in;
+}
+
+static bool x11_start(void *ctx, uint32_t sz)
+{
+  (void)sz;
+  interface_start(ctx);
+  return true;
+}
+
+static bool x11_submit(void *ctx, uint32_t round, const struct equation *eq)
+{
+  interface_write(ctx, round, eq);
+  return true;
+}
+
+static bool x11_read_feedback(void *ctx, uint32_t round, uint32_t sz,
+                              enum status *status)
+{
+  return interface_get_status(ctx, round, sz, status);
+}
+
+static void x11_destroy(void *ctx)
+{
+  interface_destroy(ctx);
+}
+
+const struct backend_ops backend_x11_ops = {
+  .name = "x11",
+  .create = x11_create,
+  .start = x11_start,
+  .submit = x11_submit,
+  .read_feedback = x11_read_feedback,
+  .destroy = x11_destroy,
+};
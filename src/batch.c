@@ -0,0 +1,99 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "batch.h"
+#include "feedback.h"
+
+/**
+ * Update the status of a game from the feedback of a guess.
+ */
+static void batch_feedback(struct nerdle *nerdle, uint64_t guess, uint32_t pattern)
+{
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  equation_unpack(guess, &eq, nerdle->sz);
+  feedback_get_status(pattern, nerdle->sz, status);
+  nerdle_update_feedback(nerdle, &eq, status);
+}
+
+static void batch_continue(struct nerdle *nerdle, struct batch_game *game)
+{
+  struct equation eq;
+
+  for (uint32_t i = 0; i < game->nr_guess; ++i) {
+    batch_feedback(nerdle, game->guesses[i], game->patterns[i]);
+  }
+  /* an inconsistent transcript has no candidate */
+  nerdle_check_candidates(nerdle);
+  game->found = nerdle->view.nr_alive > 0;
+  if (game->found == true) {
+    nerdle_find_best_equation(nerdle, &eq);
+    game->next = equation_pack(&eq);
+  }
+}
+
+struct pool {
+  const struct nerdle *model;
+  const struct table *table;
+  struct batch_game *games;
+  uint64_t nr;
+  uint64_t next; /* next game to solve */
+};
+
+static void* batch_worker(void *arg)
+{
+  struct pool *pool = arg;
+  const struct nerdle *model = pool->model;
+  uint64_t i;
+
+  while ((i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->nr) {
+    struct nerdle *nerdle = nerdle_create(model->sz, 0);
+    nerdle->strategy = model->strategy;
+    nerdle->sample = model->sample;
+    nerdle->depth = model->depth;
+    nerdle->budget = model->budget;
+    nerdle->cache = model->cache;
+    nerdle->decisions = model->decisions;
+    nerdle->verbose = false;
+    nerdle_set_table(nerdle, pool->table);
+
+    struct batch_game *game = &pool->games[i];
+    if (game->nr_guess == 0) {
+      sim_run(nerdle, &game->game);
+    } else {
+      batch_continue(nerdle, game);
+    }
+
+    nerdle_destroy(nerdle);
+  }
+  return NULL;
+}
+
+void batch_solve(const struct nerdle *model, struct batch_game *games,
+                 uint64_t nr, uint32_t nr_job)
+{
+  struct table *table = table_create(model->sz, model->candidates.eqs,
+                                     model->candidates.nr);
+  struct pool pool = { model, table, games, nr, 0 };
+
+  if (nr_job == 0) {
+    nr_job = 1;
+  }
+  pthread_t *threads = calloc(nr_job, sizeof(*threads));
+
+  uint32_t nr_created = 0;
+  while (nr_created < nr_job &&
+         pthread_create(&threads[nr_created], NULL, batch_worker, &pool) == 0) {
+    ++nr_created;
+  }
+  /* no thread created: serial */
+  if (nr_created == 0) {
+    batch_worker(&pool);
+  }
+  for (uint32_t i = 0; i < nr_created; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+  table_destroy(table);
+}
@@ -0,0 +1,45 @@
+#ifndef __BATCH__
+#define __BATCH__
+
+#include <stdint.h>
+
+#include "nerdle.h"
+#include "sim.h"
+
+/**
+ * Batch of games solved concurrently in one process. The equations of a
+ * dictionary are shared (@c table): each game holds only its constraint
+ * state and a view of the dictionary (@c nerdle_set_table).
+ */
+
+/**
+ * Game of a batch: a hidden equation to find (@c nr_guess is 0),
+ * or the transcript of the first rounds to continue.
+ */
+struct batch_game {
+  /* Hidden equation (game.answer) and game played */
+  struct sim_game game;
+  /* Transcript: guesses and feedback patterns (@c feedback_pattern) */
+  uint32_t nr_guess;
+  uint64_t guesses[SIM_MAX_ROUND];
+  uint32_t patterns[SIM_MAX_ROUND];
+  /* Next guess of a transcript, false if no candidate */
+  bool found;
+  uint64_t next;
+};
+
+/**
+ * Solve the games of a batch on a pool of threads.
+ * The solver is configured as @c model (size, strategy, sample, search
+ * and its transposition table, decisions, shared by the games, one thread
+ * by game), the dictionary is the candidates of @c model.
+ *
+ * @param model nerdle handle with all the candidates (not modified).
+ * @param games games of the batch.
+ * @param nr number of games.
+ * @param nr_job number of threads.
+ */
+void batch_solve(const struct nerdle *model, struct batch_game *games,
+                 uint64_t nr, uint32_t nr_job);
+
+#endif /* !__BATCH__ */
@@ -1,312 +1,147 @@
-#include <assert.h>
-#include <stdlib.h>
-
 #include "equation.h"
 
 /**
- * Type of a node.
- */
-enum node_type {
-  NODE_OPERATOR,
-  NODE_OPERAND,
-};
-
-/**
- * Element of the list.
- */
-struct node {
-  enum node_type type;
-  uint32_t value;
-  struct node *next;
-  struct node *prev;
-};
-
-/**
- * Structure used to reduce an equation and check the equality.
- */
-struct list {
-  struct node *head;
-  struct node *tail;
-  uint32_t nr; /* number of nodes */
-};
-
-/**
- * Create a new node.
- */
-static struct node* node_new(enum node_type type, uint32_t value)
-{
-  struct node *node = calloc(1, sizeof(*node));
-  node->type = type;
-  node->value = value;
-  return node;
-}
-
-/**
- * Insert a node at the tail of the list.
- */
-static void list_insert_tail(struct list *list, struct node *node)
-{
-  if (list->head == NULL) {
-    list->head = node;
-  }
-  if (list->tail != NULL) {
-    list->tail->next = node;
-    node->prev = list->tail;
-  }
-  list->tail = node;
-}
-
-/**
- * Add a new element to the list.
- */
-static void list_add(struct list *list, enum node_type type, uint32_t value)
-{
-  struct node *node = node_new(type, value);
-  list_insert_tail(list, node);
-  ++list->nr;
-}
-
-/**
- * Clean the list.
- */
-static void list_free(struct list *list)
-{
-  struct node *current = list->head;
-
-  while (current != NULL) {
-    struct node *to_free = current;
-    current = current->next;
-    free(to_free);
-  }
-  free(list);
-}
-
-#define SYMBOL_IS_OPERAND(SYMBOL) \
-  (SYMBOL >= SYMBOL_0 && SYMBOL <= SYMBOL_9)
-
-/**
- * An an operand node to the list.
- * Operand can be defined by multiple smbols.
- */
-static uint32_t list_add_operand(struct equation *eq,
-                                 struct list *list,
-                                 uint32_t i)
-{
-  enum symbol symbol = eq->symbols[i];
-  uint32_t value = 0;
-
-  do {
-    value *= 10;
-    value += symbol;
-    if (i + 1 == eq->sz ||
-        SYMBOL_IS_OPERAND(eq->symbols[i + 1]) == false) {
-      break;
-    }
-    symbol = eq->symbols[++i];
-  } while (true);
-
-  list_add(list, NODE_OPERAND, value);
-  return i;
-}
-
-/**
- * Convert an equation to a list of nodes.
+ * The evaluation is an operator-precedence parse where the operator stack
+ * is bounded: at most one pending additive operator ('+', '-') and one
+ * pending multiplicative operator ('*', '/'). The operand stack is reduced
+ * to the fields of @c struct evaluation, so nothing is allocated.
+ *
+ * Reduction order is the same as the historical list reducer:
+ *   1. chains of '/' (12/2/3 -> 2)
+ *   2. '*' between the results of the chains
+ *   3. '-' and '+' (modulo 2^32, so the order between both is free)
  */
-static struct list* list_convert(struct equation *eq)
-{
-  struct list *list = calloc(1, sizeof(*list));
 
-  for (uint32_t i = 0; i < eq->sz; ++i) {
-    if (SYMBOL_IS_OPERAND(eq->symbols[i])) {
-      i = list_add_operand(eq, list, i);
-    } else {
-      list_add(list, NODE_OPERATOR, eq->symbols[i]);
-    }
-  }
-  return list;
-}
+#define NO_OPERATOR SYMBOL_END
 
-/**
- * + Div by 0 is forbidden.
- * + Only allows integer division.
- */
-static bool check_div(struct node *node,
-                      struct node *left,
-                      struct node *right)
+void equation_eval_init(struct evaluation *ev)
 {
-  if (node->value != SYMBOL_DIV) {
-    return true;
-  }
-  if (right->value == 0) {
-    return false;
-  }
-  if ((left->value / right->value) * right->value != left->value) {
-    return false;
-  }
-  return true;
+  ev->left = 0;
+  ev->sum = 0;
+  ev->product = 1;
+  ev->quotient = 0;
+  ev->operand = 0;
+  ev->add = SYMBOL_PLUS;
+  ev->mul = NO_OPERATOR;
+  ev->nr_op = 0;
+  ev->equal = false;
+  ev->digit = false;
+  ev->error = false;
 }
 
 /**
- * Calculate the operation.
+ * Reduce the operand just read with the pending multiplicative operator.
+ *  + Div by 0 is forbidden.
+ *  + Only allows integer division.
  */
-static uint32_t calculate(enum symbol operator, uint32_t v1, uint32_t v2)
+static bool eval_reduce_operand(struct evaluation *ev)
 {
-  switch (operator) {
+  switch (ev->mul) {
     case SYMBOL_DIV:
-      return v1 / v2;
+      if (ev->operand == 0 || ev->quotient % ev->operand != 0) {
+        return false;
+      }
+      ev->quotient /= ev->operand;
+      break;
     case SYMBOL_MULT:
-      return v1 * v2;
-    case SYMBOL_MINUS:
-      return v1 - v2;
-    case SYMBOL_PLUS:
-      return v1 + v2;
+      ev->product *= ev->quotient;
+      ev->quotient = ev->operand;
+      break;
     default:
-      ;
+      ev->product = 1;
+      ev->quotient = ev->operand;
   };
-  assert(!"cannot calculate unknown operator");
+  ev->operand = 0;
+  ev->mul = NO_OPERATOR;
+  return true;
 }
 
 /**
- * Join the previous and next nodes to the midle one.
- * from: N_X <--> N_left <--> N_midle <--> N_right <--> N_Y>
- * to: N_X <--> N_midle <--> N_Y
+ * Reduce the current term with the pending additive operator.
  */
-static void nodes_join(struct list *list,
-                       struct node *left,
-                       struct node *midle,
-                       struct node *right)
+static void eval_reduce_term(struct evaluation *ev)
 {
-  midle->prev = left->prev;
-  midle->next = right->next;
-
-  if (left->prev != NULL) {
-    left->prev->next = midle;
-  } else {
-    list->head = midle;
-  }
+  uint32_t term = ev->product * ev->quotient;
 
-  if (right->next != NULL) {
-    right->next->prev = midle;
+  if (ev->add == SYMBOL_MINUS) {
+    ev->sum -= term;
   } else {
-    list->tail = midle;
+    ev->sum += term;
   }
+  ev->add = SYMBOL_PLUS;
 }
 
-/**
- * Merge three nodes of type:
- *  + left: operand
- *  + right: operand
- *  + operator
- */
-static bool nodes_merge(struct list *list,
-                        struct node *left,
-                        struct node *operator,
-                        struct node *right)
+bool equation_eval_push(struct evaluation *ev, enum symbol symbol)
 {
-  if (check_div(operator, left, right) == false) {
+  if (ev->error == true) {
     return false;
   }
 
-  nodes_join(list, left, operator, right);
-
-  operator->value = calculate(operator->value, left->value, right->value);
-  operator->type = NODE_OPERAND;
-
-  free(left);
-  free(right);
-  list->nr -= 2;
-  return true;
-}
+  if (symbol <= SYMBOL_9) {
+    ev->operand = ev->operand * 10 + symbol;
+    ev->digit = true;
+    return true;
+  }
 
-/**
- * Reduce a specified operator.
- *
- * + div: 6/2 -> 3
- * + plus: 12+2 -> 14
- * + ...
- */
-static bool reduce_operator(struct list *list, enum symbol operator)
-{
-  struct node *node = list->head;
+  /* An operator needs an operand on its left. */
+  if (ev->digit == false || eval_reduce_operand(ev) == false) {
+    ev->error = true;
+    return false;
+  }
+  ev->digit = false;
 
-  while (node != NULL) {
-    if (node->type == NODE_OPERATOR && node->value == operator) {
-      struct node *left = node->prev;
-      struct node *right = node->next;
-      if (left == NULL || left->type != NODE_OPERAND ||
-          right == NULL || right->type != NODE_OPERAND) {
-        return false;
-      }
-      if (nodes_merge(list, left, node, right) == false) {
+  switch (symbol) {
+    case SYMBOL_MULT:
+    case SYMBOL_DIV:
+      ev->mul = symbol;
+      break;
+    case SYMBOL_PLUS:
+    case SYMBOL_MINUS:
+      eval_reduce_term(ev);
+      ev->add = symbol;
+      break;
+    case SYMBOL_EQ:
+      if (ev->equal == true) {
+        ev->error = true;
         return false;
       }
-    }
-    node = node->next;
-  }
+      eval_reduce_term(ev);
+      ev->left = ev->sum;
+      ev->sum = 0;
+      ev->equal = true;
+      break;
+    default:
+      ev->error = true;
+      return false;
+  };
+  ++ev->nr_op;
   return true;
 }
 
-/**
- * Reduce an equation to a form: <operand = operand>.
- *
- *  + 12+6/2=42+1 -> 15=43
- *  + 1+1+1=1+1+1 -> 3=3
- *
- *  1. reduce '/'
- *  2. reduce '*'
- *  3. reduce '-'
- *  4. reduce '+'
- */
-static bool reduce(struct list *list)
+bool equation_eval_end(struct evaluation *ev)
 {
-  if (reduce_operator(list, SYMBOL_DIV) == false) {
-    return false;
-  }
-  if (reduce_operator(list, SYMBOL_MULT) == false) {
-    return false;
-  }
-  if (reduce_operator(list, SYMBOL_MINUS) == false) {
-    return false;
-  }
-  if (reduce_operator(list, SYMBOL_PLUS) == false) {
+  if (ev->error == true || ev->digit == false ||
+      eval_reduce_operand(ev) == false) {
+    ev->error = true;
     return false;
   }
+  eval_reduce_term(ev);
+  ev->digit = false;
   return true;
 }
 
-/**
- * Check validity of an equation of type: <operand = operand>.
- */
-static bool check_result(struct list *list)
+bool equation_check_equality(struct equation *eq)
 {
-  if (list->nr != 3) {
-    return false;
-  }
+  struct evaluation ev;
 
-  struct node *left = list->head; /* left operand */
-  struct node *right = list->tail; /* right operand */
-  struct node *operator = list->head->next;
-
-  /* check types */
-  if (left->type != NODE_OPERAND ||
-      right->type != NODE_OPERAND ||
-      operator->type != NODE_OPERATOR) {
-    return false;
+  equation_eval_init(&ev);
+  for (uint32_t i = 0; i < eq->sz; ++i) {
+    if (equation_eval_push(&ev, eq->symbols[i]) == false) {
+      return false;
+    }
   }
-
-  /* check result */
-  if (operator->value != SYMBOL_EQ || left->value != right->value) {
+  if (equation_eval_end(&ev) == false) {
     return false;
   }
-
-  return true;
-}
-
-bool equation_check_equality(struct equation *eq)
-{
-  struct list *list = list_convert(eq);
-  reduce(list);
-  bool ret = check_result(list);
-  list_free(list);
-  return ret;
+  return ev.equal == true && ev.left == ev.sum;
 }
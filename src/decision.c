@@ -0,0 +1,161 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "decision.h"
+
+/* Maximal number of entries probed from the slot of a key */
+#define DECISION_MAX_PROBE 16
+
+static size_t decision_map_sz(uint32_t nr_bit)
+{
+  return sizeof(struct decision_header) +
+    (sizeof(struct decision_entry) << nr_bit);
+}
+
+/**
+ * Check the header of decisions mapped against a configuration.
+ */
+static bool decision_check(const struct decision_header *header,
+                           const struct decision_header *config)
+{
+  return header->magic == DECISION_MAGIC &&
+    header->version == DECISION_VERSION &&
+    header->sz == config->sz &&
+    header->strategy == config->strategy &&
+    header->sample == config->sample &&
+    header->depth == config->depth &&
+    header->limit == config->limit &&
+    header->nr_bit == config->nr_bit &&
+    header->nr_eq == config->nr_eq &&
+    header->checksum == config->checksum &&
+    header->budget == config->budget;
+}
+
+struct decisions* decision_open(const char *path,
+                                const struct decision_header *config)
+{
+  struct stat st;
+  size_t map_sz = decision_map_sz(config->nr_bit);
+
+  int fd = open(path, O_RDWR | O_CREAT, 0644);
+  if (fd == -1 || fstat(fd, &st) == -1) {
+    printf("[nerdle] cannot open the decisions '%s'\n", path);
+    if (fd != -1) {
+      close(fd);
+    }
+    return NULL;
+  }
+  if (flock(fd, LOCK_EX | LOCK_NB) == -1) {
+    printf("[nerdle] decisions '%s' used by another process\n", path);
+    close(fd);
+    return NULL;
+  }
+
+  bool reset = (size_t)st.st_size != map_sz;
+  if (reset == true && (ftruncate(fd, 0) == -1 || ftruncate(fd, map_sz) == -1)) {
+    printf("[nerdle] cannot resize the decisions '%s'\n", path);
+    close(fd);
+    return NULL;
+  }
+
+  void *map = mmap(NULL, map_sz, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    close(fd);
+    printf("[nerdle] cannot map the decisions '%s'\n", path);
+    return NULL;
+  }
+
+  struct decisions *decisions = calloc(1, sizeof(*decisions));
+  pthread_mutex_init(&decisions->lock, NULL);
+  decisions->fd = fd;
+  decisions->header = map;
+  decisions->entries = (struct decision_entry*)(decisions->header + 1);
+  decisions->map_sz = map_sz;
+
+  if (reset == false && decision_check(decisions->header, config) == false) {
+    printf("[nerdle] decisions '%s' of another configuration, reset\n", path);
+    reset = true;
+    memset(decisions->entries, 0, map_sz - sizeof(*decisions->header));
+  }
+  if (reset == true) {
+    *decisions->header = *config;
+    decisions->header->magic = DECISION_MAGIC;
+    decisions->header->version = DECISION_VERSION;
+    decisions->header->nr = 0;
+  }
+  return decisions;
+}
+
+void decision_close(struct decisions *decisions)
+{
+  pthread_mutex_destroy(&decisions->lock);
+  munmap(decisions->header, decisions->map_sz);
+  close(decisions->fd);
+  free(decisions);
+}
+
+/**
+ * Find the entry of a key, or the empty entry where to store it.
+ * Return NULL if the probed entries are used by other keys.
+ */
+static struct decision_entry* decision_find(struct decisions *decisions,
+                                            uint64_t key)
+{
+  uint64_t mask = (1ULL << decisions->header->nr_bit) - 1;
+
+  for (uint64_t i = 0; i < DECISION_MAX_PROBE; ++i) {
+    struct decision_entry *entry = &decisions->entries[(key + i) & mask];
+    if (entry->key == key || entry->key == 0) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+bool decision_get(struct decisions *decisions, uint64_t key, uint64_t *guess)
+{
+  bool found = false;
+
+  key |= 1; /* 0: empty */
+  pthread_mutex_lock(&decisions->lock);
+  struct decision_entry *entry = decision_find(decisions, key);
+  if (entry != NULL && entry->key == key) {
+    *guess = entry->guess;
+    found = true;
+    ++decisions->nr_hit;
+  } else {
+    ++decisions->nr_miss;
+  }
+  pthread_mutex_unlock(&decisions->lock);
+  return found;
+}
+
+void decision_put(struct decisions *decisions, uint64_t key, uint64_t guess)
+{
+  key |= 1; /* 0: empty */
+  pthread_mutex_lock(&decisions->lock);
+  struct decision_entry *entry = decision_find(decisions, key);
+  if (entry != NULL) {
+    if (entry->key == 0) {
+      ++decisions->header->nr;
+    }
+    entry->guess = guess;
+    entry->key = key;
+  }
+  pthread_mutex_unlock(&decisions->lock);
+}
+
+void decision_dump(const struct decisions *decisions)
+{
+  uint64_t nr = decisions->nr_hit + decisions->nr_miss;
+
+  printf("[nerdle] decisions: %lu stored, %lu hits, %lu misses (%.1f%%)\n",
+         decisions->header->nr, decisions->nr_hit, decisions->nr_miss,
+         nr > 0 ? 100.0 * decisions->nr_hit / nr : 0);
+}
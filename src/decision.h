@@ -0,0 +1,113 @@
+#ifndef __DECISION__
+#define __DECISION__
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Persistent cache of the decisions of the solver, stored on disk and
+ * mapped in memory (read-write, shared): the next guess by history of
+ * the game (guesses and feedbacks received, @c nerdle_update_feedback).
+ * The decisions only depend on the history for a configuration of the
+ * solver (header), so the file is reused by the following games and
+ * runs, and reset if the configuration differs. The file is locked
+ * (@c flock) while mapped: one process at a time, the threads of the
+ * process share it.
+ *   + header (@c struct decision_header).
+ *   + open addressing hash table (@c struct decision_entry).
+ */
+
+#define DECISION_MAGIC 0x4344524e /* "NRDC" */
+#define DECISION_VERSION 2
+
+/**
+ * Default log2 of the number of entries of a file.
+ */
+#define DECISION_DEFAULT_BIT 20
+
+struct decision_header {
+  uint32_t magic;
+  uint32_t version;
+  /* Configuration of the solver */
+  uint32_t sz;
+  uint32_t strategy;
+  uint32_t sample;
+  uint32_t depth;
+  uint32_t limit;
+  uint32_t nr_bit;   /* log2 of the number of entries */
+  uint64_t nr_eq;    /* candidates at start (0: generated on demand) */
+  uint64_t checksum; /* @c dict_checksum of the candidates at start */
+  double budget;     /* time budget by move in seconds (0: no limit) */
+  /* Number of entries used */
+  uint64_t nr;
+};
+
+struct decision_entry {
+  uint64_t key;   /* hash of the history, 0: empty */
+  uint64_t guess; /* next guess (equation packed) */
+};
+
+/**
+ * Decisions mapped in memory, shared by the games (thread-safe).
+ */
+struct decisions {
+  pthread_mutex_t lock;
+  int fd; /* locked while mapped */
+  struct decision_header *header;
+  struct decision_entry *entries;
+  size_t map_sz;
+  uint64_t nr_hit;
+  uint64_t nr_miss;
+};
+
+/**
+ * Map the decisions of a configuration, the file is created (or reset)
+ * if missing (or of another configuration). Fail if the file is used by
+ * another process.
+ * @warning decisions have to be closed.
+ *
+ * @param path path of the file.
+ * @param config configuration expected (@c magic, @c version and @c nr
+ * ignored).
+ * @return decisions handle if OK, otherwise return @c NULL.
+ */
+struct decisions* decision_open(const char *path,
+                                const struct decision_header *config);
+
+/**
+ * Unmap and unlock decisions previously opened with @c decision_open
+ * (the file is kept).
+ *
+ * @param decisions decisions handle.
+ */
+void decision_close(struct decisions *decisions);
+
+/**
+ * Get the next guess of a history.
+ *
+ * @param decisions decisions handle.
+ * @param key hash of the history.
+ * @param guess next guess output (equation packed).
+ * @return true if found, otherwise false.
+ */
+bool decision_get(struct decisions *decisions, uint64_t key, uint64_t *guess);
+
+/**
+ * Store the next guess of a history (dropped if the table is full).
+ *
+ * @param decisions decisions handle.
+ * @param key hash of the history.
+ * @param guess next guess (equation packed).
+ */
+void decision_put(struct decisions *decisions, uint64_t key, uint64_t guess);
+
+/**
+ * Dump the number of decisions stored, hits and misses.
+ *
+ * @param decisions decisions handle.
+ */
+void decision_dump(const struct decisions *decisions);
+
+#endif /* !__DECISION__ */
@@ -0,0 +1,145 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dict.h"
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+/**
+ * Continue a checksum with equations.
+ */
+static uint64_t dict_checksum_update(uint64_t checksum, const uint64_t *eqs,
+                                     uint64_t nr)
+{
+  for (uint64_t i = 0; i < nr; ++i) {
+    checksum ^= eqs[i];
+    checksum *= FNV_PRIME;
+  }
+  return checksum;
+}
+
+uint64_t dict_checksum(const uint64_t *eqs, uint64_t nr)
+{
+  return dict_checksum_update(FNV_OFFSET, eqs, nr);
+}
+
+bool dict_writer_open(struct dict_writer *writer, const char *path, uint32_t sz)
+{
+  memset(writer, 0, sizeof(*writer));
+  writer->header.magic = DICT_MAGIC;
+  writer->header.version = DICT_VERSION;
+  writer->header.sz = sz;
+  writer->header.checksum = FNV_OFFSET;
+
+  writer->file = fopen(path, "wb");
+  if (writer->file == NULL) {
+    printf("[nerdle] cannot create the dictionary '%s'\n", path);
+    return false;
+  }
+  /* room of the header, written at the end */
+  writer->error = fwrite(&writer->header, sizeof(writer->header), 1,
+                         writer->file) != 1;
+  return true;
+}
+
+bool dict_writer_add(struct dict_writer *writer, const uint64_t *eqs, uint64_t nr)
+{
+  if (writer->error == false && fwrite(eqs, sizeof(*eqs), nr, writer->file) != nr) {
+    writer->error = true;
+  }
+  writer->header.nr += nr;
+  writer->header.checksum = dict_checksum_update(writer->header.checksum, eqs, nr);
+  return writer->error == false;
+}
+
+bool dict_writer_close(struct dict_writer *writer, const char *path)
+{
+  bool ret = writer->error == false &&
+    fseek(writer->file, 0, SEEK_SET) == 0 &&
+    fwrite(&writer->header, sizeof(writer->header), 1, writer->file) == 1;
+  if (fclose(writer->file) != 0) {
+    ret = false;
+  }
+  if (ret == false) {
+    printf("[nerdle] cannot write the dictionary '%s'\n", path);
+  }
+  return ret;
+}
+
+bool dict_write(const char *path, uint32_t sz,
+                const uint64_t *eqs, uint64_t nr)
+{
+  struct dict_writer writer;
+
+  if (dict_writer_open(&writer, path, sz) == false) {
+    return false;
+  }
+  dict_writer_add(&writer, eqs, nr);
+  return dict_writer_close(&writer, path);
+}
+
+/**
+ * Check the header and the size of a dictionary mapped.
+ */
+static bool dict_check(const struct dict *dict)
+{
+  const struct dict_header *header = dict->header;
+
+  if (dict->map_sz < sizeof(*header) ||
+      header->magic != DICT_MAGIC ||
+      header->version != DICT_VERSION) {
+    return false;
+  }
+  return (dict->map_sz - sizeof(*header)) / sizeof(uint64_t) == header->nr;
+}
+
+bool dict_verify(const struct dict *dict)
+{
+  return dict_checksum(dict->eqs, dict->header->nr) == dict->header->checksum;
+}
+
+struct dict* dict_open(const char *path)
+{
+  struct stat st;
+
+  int fd = open(path, O_RDONLY);
+  if (fd == -1) {
+    printf("[nerdle] cannot open the dictionary '%s'\n", path);
+    return NULL;
+  }
+  if (fstat(fd, &st) == -1) {
+    close(fd);
+    return NULL;
+  }
+
+  void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    printf("[nerdle] cannot map the dictionary '%s'\n", path);
+    return NULL;
+  }
+
+  struct dict *dict = calloc(1, sizeof(*dict));
+  dict->header = map;
+  dict->eqs = (const uint64_t*)(dict->header + 1);
+  dict->map_sz = st.st_size;
+
+  if (dict_check(dict) == false) {
+    printf("[nerdle] invalid dictionary '%s'\n", path);
+    dict_close(dict);
+    return NULL;
+  }
+  return dict;
+}
+
+void dict_close(struct dict *dict)
+{
+  munmap((void*)dict->header, dict->map_sz);
+  free(dict);
+}
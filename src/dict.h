@@ -0,0 +1,121 @@
+#ifndef __DICT__
+#define __DICT__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Dictionary of all the valid equations of a size, stored on disk:
+ *   + header (@c struct dict_header).
+ *   + equations packed (@c equation_pack), one uint64_t by equation.
+ */
+
+#define DICT_MAGIC 0x4c44524e /* "NRDL" */
+#define DICT_VERSION 1
+
+struct dict_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t sz;       /* size of the equations */
+  uint32_t reserved;
+  uint64_t nr;       /* number of equations */
+  uint64_t checksum; /* @c dict_checksum of the equations */
+};
+
+/**
+ * Dictionary mapped in memory (read-only).
+ */
+struct dict {
+  const struct dict_header *header;
+  const uint64_t *eqs;
+  size_t map_sz;
+};
+
+/**
+ * Compute the checksum (FNV-1a) of a list of equations packed.
+ *
+ * @param eqs equations packed.
+ * @param nr number of equations.
+ * @return checksum.
+ */
+uint64_t dict_checksum(const uint64_t *eqs, uint64_t nr);
+
+/**
+ * Write a dictionary.
+ *
+ * @param path path of the file.
+ * @param sz size of the equations.
+ * @param eqs equations packed.
+ * @param nr number of equations.
+ * @return true if OK, otherwise false.
+ */
+bool dict_write(const char *path, uint32_t sz,
+                const uint64_t *eqs, uint64_t nr);
+
+/**
+ * Dictionary written by chunks of equations (not all in memory).
+ */
+struct dict_writer {
+  FILE *file;
+  struct dict_header header;
+  bool error;
+};
+
+/**
+ * Start to write a dictionary (the header is written by
+ * @c dict_writer_close).
+ *
+ * @param writer writer handle.
+ * @param path path of the file.
+ * @param sz size of the equations.
+ * @return true if OK, otherwise false.
+ */
+bool dict_writer_open(struct dict_writer *writer, const char *path, uint32_t sz);
+
+/**
+ * Write a chunk of equations, after the previous ones.
+ *
+ * @param writer writer handle.
+ * @param eqs equations packed.
+ * @param nr number of equations.
+ * @return true if OK, otherwise false.
+ */
+bool dict_writer_add(struct dict_writer *writer, const uint64_t *eqs, uint64_t nr);
+
+/**
+ * Write the header (number of equations and checksum) and close the file.
+ *
+ * @param writer writer handle.
+ * @param path path of the file.
+ * @return true if OK, otherwise false.
+ */
+bool dict_writer_close(struct dict_writer *writer, const char *path);
+
+/**
+ * Map a dictionary (read-only, shared) and check its header and size.
+ * The equations are not read (@c dict_verify).
+ * @warning dictionary has to be closed.
+ *
+ * @param path path of the file.
+ * @return dictionary handle if OK, otherwise return @c NULL.
+ */
+struct dict* dict_open(const char *path);
+
+/**
+ * Check the checksum of the equations of a dictionary (reading them all).
+ *
+ * @param dict dictionary handle.
+ * @return true if OK, otherwise false.
+ */
+bool dict_verify(const struct dict *dict);
+
+/**
+ * Unmap a dictionary previously opened with @c dict_open.
+ *
+ * @param dict dictionary handle.
+ */
+void dict_close(struct dict *dict);
+
+#endif /* !__DICT__ */
@@ -68,3 +68,31 @@ uint32_t equation_get_variance(const struct equation *eq)
 
   return variance;
 }
+
+uint64_t equation_pack(const struct equation *eq)
+{
+  uint64_t packed = 0;
+
+  for (uint32_t i = 0; i < eq->sz; ++i) {
+    packed |= (uint64_t)eq->symbols[i] << (4 * i);
+  }
+  return packed;
+}
+
+void equation_unpack(uint64_t packed, struct equation *eq, uint32_t sz)
+{
+  for (uint32_t i = 0; i < sz; ++i) {
+    eq->symbols[i] = equation_packed_symbol(packed, i);
+  }
+  eq->sz = sz;
+}
+
+uint32_t equation_packed_get_variance(uint64_t packed, uint32_t sz)
+{
+  uint32_t once = 0;
+
+  for (uint32_t i = 0; i < sz; ++i) {
+    once |= 1 << equation_packed_symbol(packed, i);
+  }
+  return __builtin_popcount(once);
+}
@@ -59,6 +59,53 @@ bool equation_add_symbol(struct equation *eq,
  */
 bool equation_check_semantic(struct equation *eq);
 
+/**
+ * State of an incremental evaluation of an equation.
+ * Symbols are pushed one by one, the left-hand side is reduced
+ * when the symbol '=' is pushed.
+ */
+struct evaluation {
+  uint32_t left;     /* value of the left-hand side (once '=' is pushed) */
+  uint32_t sum;      /* sum of the terms reduced of the current side */
+  uint32_t product;  /* product of the factors reduced of the current term */
+  uint32_t quotient; /* current factor (chain of divisions) */
+  uint32_t operand;  /* operand being read */
+  enum symbol add;   /* pending additive operator */
+  enum symbol mul;   /* pending multiplicative operator */
+  uint32_t nr_op;    /* number of operators pushed */
+  bool equal;        /* symbol '=' pushed */
+  bool digit;        /* last symbol pushed is a digit */
+  bool error;        /* evaluation failed */
+};
+
+/**
+ * Initialize an incremental evaluation.
+ *
+ * @param ev evaluation handle.
+ */
+void equation_eval_init(struct evaluation *ev);
+
+/**
+ * Push the next symbol of an equation.
+ * Fail if:
+ *   + an operator does not follow an operand.
+ *   + a division is by 0 or is not an integer division.
+ *   + the symbol '=' is pushed twice.
+ *
+ * @param ev evaluation handle.
+ * @param symbol symbol to push.
+ * @return true if the evaluation can go on, otherwise false.
+ */
+bool equation_eval_push(struct evaluation *ev, enum symbol symbol);
+
+/**
+ * End the evaluation: reduce the current side in @c ev->sum.
+ *
+ * @param ev evaluation handle.
+ * @return true if the current side is valid, otherwise false.
+ */
+bool equation_eval_end(struct evaluation *ev);
+
 /**
  * Check if equality of the equation is right.
  *  + 1 + 12 = 13: OK
@@ -71,4 +118,35 @@ bool equation_check_equality(struct equation *eq);
 
 uint32_t equation_get_variance(const struct equation *eq);
 
+/**
+ * Pack an equation on 64 bits: 4 bits by symbol,
+ * the symbol of the position i is at the bits [4i, 4i + 4).
+ *
+ * @param eq equation to pack.
+ * @return equation packed.
+ */
+uint64_t equation_pack(const struct equation *eq);
+
+/**
+ * Unpack an equation previously packed with @c equation_pack.
+ *
+ * @param packed equation packed.
+ * @param eq output equation.
+ * @param sz size of the equation.
+ */
+void equation_unpack(uint64_t packed, struct equation *eq, uint32_t sz);
+
+/**
+ * Get the symbol at a position of an equation packed.
+ */
+static inline enum symbol equation_packed_symbol(uint64_t packed, uint32_t i)
+{
+  return (packed >> (4 * i)) & 0xf;
+}
+
+/**
+ * Same as @c equation_get_variance for an equation packed.
+ */
+uint32_t equation_packed_get_variance(uint64_t packed, uint32_t sz);
+
 #endif /* !__EQUATION__ */
@@ -0,0 +1,84 @@
+#include "feedback.h"
+#include "equation.h"
+
+uint32_t feedback_nr_pattern(uint32_t sz)
+{
+  uint32_t nr = 1;
+
+  for (uint32_t i = 0; i < sz; ++i) {
+    nr *= 3;
+  }
+  return nr;
+}
+
+uint32_t feedback_pattern(uint64_t guess, uint64_t answer, uint32_t sz)
+{
+  uint8_t remaining[16] = { 0 };
+  enum status status[LIMIT_MAX_EQ_SZ];
+
+  for (uint32_t i = 0; i < sz; ++i) {
+    enum symbol g = equation_packed_symbol(guess, i);
+    enum symbol a = equation_packed_symbol(answer, i);
+    if (g == a) {
+      status[i] = RIGHT;
+    } else {
+      status[i] = DISCARDED;
+      ++remaining[a];
+    }
+  }
+
+  for (uint32_t i = 0; i < sz; ++i) {
+    enum symbol g = equation_packed_symbol(guess, i);
+    if (status[i] == DISCARDED && remaining[g] > 0) {
+      --remaining[g];
+      status[i] = WRONG;
+    }
+  }
+
+  return feedback_from_status(status, sz);
+}
+
+void feedback_get_status(uint32_t pattern, uint32_t sz, enum status *status)
+{
+  for (uint32_t i = 0; i < sz; ++i) {
+    status[i] = DISCARDED + pattern % 3;
+    pattern /= 3;
+  }
+}
+
+uint32_t feedback_from_status(const enum status *status, uint32_t sz)
+{
+  uint32_t pattern = 0;
+
+  for (uint32_t i = sz; i > 0; --i) {
+    pattern = pattern * 3 + (status[i - 1] - DISCARDED);
+  }
+  return pattern;
+}
+
+void feedback_to_str(const enum status *status, uint32_t sz, char *str)
+{
+  for (uint32_t i = 0; i < sz; ++i) {
+    str[i] = status[i] == RIGHT ? 'R' : status[i] == WRONG ? 'W' : 'D';
+  }
+}
+
+bool feedback_from_str(const char *str, uint32_t sz, enum status *status)
+{
+  for (uint32_t i = 0; i < sz; ++i) {
+    switch (str[i]) {
+      case 'R':
+        status[i] = RIGHT;
+        break;
+      case 'W':
+        status[i] = WRONG;
+        break;
+      case 'D':
+        status[i] = DISCARDED;
+        break;
+      default:
+        return false;
+    };
+  }
+  return true;
+}
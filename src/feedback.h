@@ -0,0 +1,78 @@
+#ifndef __FEEDBACK__
+#define __FEEDBACK__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rules.h"
+
+/**
+ * Feedback of a guess: the status of each location, coded as a pattern
+ * in base 3 (digit i for the location i):
+ *   + 0: DISCARDED
+ *   + 1: WRONG
+ *   + 2: RIGHT
+ */
+
+/**
+ * Number of patterns for an equation of size sz (3^sz).
+ *
+ * @param sz size of the equation.
+ * @return number of patterns.
+ */
+uint32_t feedback_nr_pattern(uint32_t sz);
+
+/**
+ * Compute the feedback of a guess knowing the answer.
+ * Duplicated symbols follow the rules of the game:
+ *   1. locations with the right symbol are RIGHT.
+ *   2. from left to right, the other locations are WRONG while the
+ *      answer has occurrences of the symbol not matched yet,
+ *      then DISCARDED.
+ *
+ * @param guess equation packed guessed.
+ * @param answer equation packed to guess.
+ * @param sz size of the equations.
+ * @return pattern of the feedback.
+ */
+uint32_t feedback_pattern(uint64_t guess, uint64_t answer, uint32_t sz);
+
+/**
+ * Convert a pattern to the status of each location.
+ *
+ * @param pattern pattern of the feedback.
+ * @param sz size of the equation.
+ * @param status output status (sz locations).
+ */
+void feedback_get_status(uint32_t pattern, uint32_t sz, enum status *status);
+
+/**
+ * Convert the status of each location to a pattern.
+ *
+ * @param status status (sz locations).
+ * @param sz size of the equation.
+ * @return pattern of the feedback.
+ */
+uint32_t feedback_from_status(const enum status *status, uint32_t sz);
+
+/**
+ * Convert the status of each location to a string:
+ * 'R' (right), 'W' (wrong position), 'D' (discarded).
+ *
+ * @param status status (sz locations).
+ * @param sz size of the equation.
+ * @param str output string (sz characters, not terminated).
+ */
+void feedback_to_str(const enum status *status, uint32_t sz, char *str);
+
+/**
+ * Convert a string from @c feedback_to_str to the status of each location.
+ *
+ * @param str string (at least sz characters).
+ * @param sz size of the equation.
+ * @param status output status (sz locations).
+ * @return true if OK, false if a character is invalid.
+ */
+bool feedback_from_str(const char *str, uint32_t sz, enum status *status);
+
+#endif /* !__FEEDBACK__ */
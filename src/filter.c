@@ -0,0 +1,43 @@
+#include "filter.h"
+
+#define NIBBLES_1 0x1111111111111111ULL
+
+/**
+ * Count the occurrences of a symbol in an equation packed.
+ */
+static uint32_t count_symbol(uint64_t eq, enum symbol symbol, uint32_t sz)
+{
+  /* nibble i is 0 if the symbol is at the position i */
+  uint64_t x = eq ^ (NIBBLES_1 * symbol);
+
+  /* bit 4i is set if the symbol is not at the position i */
+  x |= x >> 1;
+  x |= x >> 2;
+  x &= NIBBLES_1 & ((1ULL << (4 * sz)) - 1);
+  return sz - __builtin_popcountll(x);
+}
+
+static bool check_counts(const struct constraints *constraints, uint64_t eq)
+{
+  for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+    if (constraints->min[s] == 0 && constraints->max[s] >= constraints->sz) {
+      continue;
+    }
+    uint32_t count = count_symbol(eq, s, constraints->sz);
+    if (count < constraints->min[s] || count > constraints->max[s]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool filter_check(const struct constraints *constraints, uint64_t eq)
+{
+  for (uint32_t i = 0; i < constraints->sz; ++i) {
+    enum symbol symbol = equation_packed_symbol(eq, i);
+    if (((constraints->allowed[i] >> symbol) & 1) == 0) {
+      return false;
+    }
+  }
+  return check_counts(constraints, eq);
+}
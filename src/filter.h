@@ -0,0 +1,30 @@
+#ifndef __FILTER__
+#define __FILTER__
+
+#include <stdint.h>
+
+#include "equation.h"
+
+/**
+ * Constraints on the candidates, compiled from the status of a round.
+ */
+struct constraints {
+  /* Size of the equation */
+  uint32_t sz;
+  /* Symbols allowed by position (bit i: symbol i) */
+  uint16_t allowed[LIMIT_MAX_EQ_SZ];
+  /* Bounds of the number of occurrences by symbol */
+  uint8_t min[SYMBOL_END];
+  uint8_t max[SYMBOL_END];
+};
+
+/**
+ * Check if an equation packed respects the constraints.
+ *
+ * @param constraints constraints handle.
+ * @param eq equation packed.
+ * @return true if respected, otherwise false.
+ */
+bool filter_check(const struct constraints *constraints, uint64_t eq);
+
+#endif /* !__FILTER__ */
@@ -3,6 +3,13 @@
 
 #include <string.h>
 
+#include "opening.h"
+
+/**
+ * First equations chosen by hand, for the sizes without an opening
+ * searched offline (@c opening_get).
+ */
+
 #define D SYMBOL_DIV
 #define X SYMBOL_MULT
 #define P SYMBOL_PLUS
@@ -57,6 +64,12 @@ static const enum symbol first_eq_12[] = {
 
 static inline void nerdle_set_first_equation(struct nerdle *nerdle, struct equation *eq)
 {
+  const struct opening *opening = opening_get(nerdle->sz);
+  if (opening != NULL) {
+    equation_unpack(opening->first, eq, nerdle->sz);
+    return;
+  }
+
   switch (nerdle->sz) {
 #define CASE_SET_EQ(SZ, SYMBOLS)                                \
     case SZ:                                                    \
@@ -0,0 +1,302 @@
+/**
+ * Kernel of the generation of the equations.
+ * warning: template include, included by nerdle.c once by size and once
+ * runtime-generic (testing), with:
+ *  + KERNEL_SZ: size of the equations, a constant or the size of the
+ *    local @c nerdle (generic).
+ *  + KERNEL_SUFFIX: suffix of the names of the functions of the kernel.
+ * With a constant size, the bounds of the loops and of the rooms are
+ * folded by the compiler.
+ */
+
+#define KERNEL_CAT_(NAME, SUFFIX) NAME##_##SUFFIX
+#define KERNEL_CAT(NAME, SUFFIX) KERNEL_CAT_(NAME, SUFFIX)
+#define KERNEL(NAME) KERNEL_CAT(NAME, KERNEL_SUFFIX)
+
+/* the nerdle handle is not read by all the kernels of a constant size */
+#define KERNEL_NERDLE __attribute__((unused)) struct nerdle *nerdle
+
+/**
+ * Check if the symbol can start a branch at the position, knowing
+ * the equation needs at least: '=' and one digit for the result, and
+ * one operator on the left-hand side.
+ *  + operator: an operand, '=' and the result follow.
+ *  + '=': the result follows.
+ *  + digit: '=' follows, or an operator if there is none yet.
+ */
+static inline bool KERNEL(nerdle_check_room)(KERNEL_NERDLE,
+                                             const struct evaluation *ev,
+                                             enum symbol symbol,
+                                             uint32_t position)
+{
+  uint32_t room = KERNEL_SZ - position;
+
+  if (symbol == SYMBOL_EQ) {
+    return ev->nr_op > 0 && room >= 2;
+  }
+  if (symbol > SYMBOL_9) {
+    return room >= 4;
+  }
+  return room >= (ev->nr_op > 0 ? 3 : 5);
+}
+
+/**
+ * Derive the result (right-hand side) of the equation from the value of
+ * the left-hand side. The result fills exactly the locations from the
+ * position to the end of the equation and cannot start by '0'.
+ */
+static bool KERNEL(nerdle_derive_result)(KERNEL_NERDLE,
+                                         struct equation *eq,
+                                         uint32_t value,
+                                         uint32_t position)
+{
+  for (uint32_t pos = KERNEL_SZ; pos > position; --pos) {
+    enum symbol symbol = value % 10;
+    if (nerdle_check_symbol(nerdle, symbol, pos - 1) == false) {
+      return false;
+    }
+    eq->symbols[pos - 1] = symbol;
+    value /= 10;
+  }
+  return value == 0 && eq->symbols[position] != SYMBOL_0;
+}
+
+/**
+ * Check if the left-hand side can still end with a value fitting the
+ * result: for each split of the remaining locations between the
+ * left-hand side and the result, the lower bound has to fit.
+ */
+static inline bool KERNEL(nerdle_check_result_length)(KERNEL_NERDLE,
+                                                      const struct evaluation *ev,
+                                                      uint32_t position)
+{
+  uint32_t room = KERNEL_SZ - position;
+  int64_t max = 10;
+
+  /* nr: symbols left for the left-hand side, '=' and the result follow. */
+  for (uint32_t nr = room - 2; nr != UINT32_MAX; --nr, max *= 10) {
+    int64_t bound;
+    if (nerdle_lower_bound(ev, nr, &bound) == false || bound < max) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Add the symbol at the position of the left-hand side and push it
+ * to the evaluation. Same as @c equation_add_symbol without the check
+ * of a second '=': the result is derived right after the first one.
+ */
+static inline bool KERNEL(nerdle_generate_symbol)(KERNEL_NERDLE,
+                                                  struct equation *eq,
+                                                  struct evaluation *ev,
+                                                  enum symbol symbol,
+                                                  uint32_t position)
+{
+  if (nerdle_check_symbol(nerdle, symbol, position) == false ||
+      KERNEL(nerdle_check_room)(nerdle, ev, symbol, position) == false) {
+    return false;
+  }
+  enum symbol last = eq->symbols[position - 1];
+  if (last > SYMBOL_9 && (symbol > SYMBOL_9 || symbol == SYMBOL_0)) {
+    return false;
+  }
+  eq->symbols[position] = symbol;
+  if (equation_eval_push(ev, symbol) == false) {
+    return false;
+  }
+  return symbol == SYMBOL_EQ ||
+    KERNEL(nerdle_check_result_length)(nerdle, ev, position + 1);
+}
+
+/**
+ * Same as @c equation_pack.
+ */
+static inline uint64_t KERNEL(nerdle_pack)(KERNEL_NERDLE,
+                                           const struct equation *eq)
+{
+  uint64_t packed = 0;
+
+  for (uint32_t i = 0; i < KERNEL_SZ; ++i) {
+    packed |= (uint64_t)eq->symbols[i] << (4 * i);
+  }
+  return packed;
+}
+
+/**
+ * Count the symbol placed at the position (@c generation with counts).
+ * The symbol has to stay within its maximal number of occurrences, the
+ * symbols still required have to fit in the locations left, and the
+ * operators required have to be placed before '=' (the result is only
+ * digits).
+ * Return false if the branch cannot respect the bounds.
+ */
+static inline bool KERNEL(nerdle_count_push)(struct generation *gen,
+                                             enum symbol symbol,
+                                             uint32_t position)
+{
+  const struct nerdle *nerdle = gen->nerdle;
+  uint32_t need = gen->need;
+
+  if (gen->count[symbol] >= nerdle->max[symbol]) {
+    return false;
+  }
+  if (gen->count[symbol] < nerdle->min[symbol]) {
+    --need;
+  }
+  if (need > KERNEL_SZ - position - 1) {
+    return false;
+  }
+  ++gen->count[symbol];
+  if (symbol == SYMBOL_EQ) {
+    for (enum symbol s = SYMBOL_PLUS; s < SYMBOL_END; ++s) {
+      if (gen->count[s] < nerdle->min[s]) {
+        --gen->count[symbol];
+        return false;
+      }
+    }
+  }
+  gen->need = need;
+  return true;
+}
+
+/**
+ * Uncount the symbol when leaving its branch.
+ */
+static inline void KERNEL(nerdle_count_pop)(struct generation *gen,
+                                            enum symbol symbol)
+{
+  if (--gen->count[symbol] < gen->nerdle->min[symbol]) {
+    ++gen->need;
+  }
+}
+
+/**
+ * Check the bounds of the number of occurrences with the digits of the
+ * result derived from the position (the left-hand side is counted).
+ */
+static inline bool KERNEL(nerdle_check_counts)(const struct generation *gen,
+                                               const struct equation *eq,
+                                               uint32_t position)
+{
+  const struct nerdle *nerdle = gen->nerdle;
+  uint8_t count[SYMBOL_END];
+
+  memcpy(count, gen->count, sizeof(count));
+  for (uint32_t pos = position; pos < KERNEL_SZ; ++pos) {
+    ++count[eq->symbols[pos]];
+  }
+  for (enum symbol s = SYMBOL_0; s <= SYMBOL_9; ++s) {
+    if (count[s] < nerdle->min[s] || count[s] > nerdle->max[s]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool KERNEL(nerdle_generate_equations_rec)(struct generation *gen,
+                                                  struct equation *eq,
+                                                  const struct evaluation *ev,
+                                                  uint32_t position);
+
+/**
+ * Generate the rest of the branch of the symbol placed at the position:
+ * the next symbols, or the result after '='.
+ * Return false when the visitor stops the generation.
+ */
+static inline bool KERNEL(nerdle_generate_next)(struct generation *gen,
+                                                struct equation *eq,
+                                                const struct evaluation *ev,
+                                                enum symbol symbol,
+                                                uint32_t position)
+{
+  struct nerdle *nerdle = gen->nerdle;
+
+  if (symbol != SYMBOL_EQ) {
+    return KERNEL(nerdle_generate_equations_rec)(gen, eq, ev, position + 1);
+  }
+  if (KERNEL(nerdle_derive_result)(nerdle, eq, ev->left, position + 1) == false ||
+      (gen->counts == true &&
+       KERNEL(nerdle_check_counts)(gen, eq, position + 1) == false)) {
+    return true;
+  }
+  return generation_add(gen, KERNEL(nerdle_pack)(nerdle, eq));
+}
+
+/**
+ * Generate the branch of the symbol at the position.
+ * Return false when the visitor stops the generation.
+ */
+static inline bool KERNEL(nerdle_generate_branch)(struct generation *gen,
+                                                  struct equation *eq,
+                                                  const struct evaluation *ev,
+                                                  enum symbol symbol,
+                                                  uint32_t position)
+{
+  struct nerdle *nerdle = gen->nerdle;
+  struct evaluation next = *ev;
+
+  if (KERNEL(nerdle_generate_symbol)(nerdle, eq, &next, symbol, position) == false) {
+    return true;
+  }
+  if (gen->counts == false) {
+    return KERNEL(nerdle_generate_next)(gen, eq, &next, symbol, position);
+  }
+  if (KERNEL(nerdle_count_push)(gen, symbol, position) == false) {
+    return true;
+  }
+  bool ret = KERNEL(nerdle_generate_next)(gen, eq, &next, symbol, position);
+  KERNEL(nerdle_count_pop)(gen, symbol);
+  return ret;
+}
+
+static bool KERNEL(nerdle_generate_equations_rec)(struct generation *gen,
+                                                  struct equation *eq,
+                                                  const struct evaluation *ev,
+                                                  uint32_t position)
+{
+  for (uint32_t i = SYMBOL_0; i < SYMBOL_END; ++i) {
+    if (KERNEL(nerdle_generate_branch)(gen, eq, ev, i, position) == false) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Generate the top branch @c branch.
+ * Return false when the visitor stops the generation.
+ */
+static bool KERNEL(nerdle_generate_top_branch)(struct generation *gen,
+                                               uint32_t branch)
+{
+  struct nerdle *nerdle = gen->nerdle;
+  struct equation eq = { .sz = KERNEL_SZ };
+  struct evaluation ev;
+  enum symbol first = SYMBOL_1 + branch / SYMBOL_END;
+  enum symbol second = branch % SYMBOL_END;
+
+  if (nerdle_check_symbol(nerdle, first, 0) == false) {
+    return true;
+  }
+  if (gen->counts == true) {
+    memset(gen->count, 0, sizeof(gen->count));
+    gen->need = 0;
+    for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+      gen->need += nerdle->min[s];
+    }
+    if (KERNEL(nerdle_count_push)(gen, first, 0) == false) {
+      return true;
+    }
+  }
+  eq.symbols[0] = first;
+  equation_eval_init(&ev);
+  equation_eval_push(&ev, first);
+  return KERNEL(nerdle_generate_branch)(gen, &eq, &ev, second, 1);
+}
+
+#undef KERNEL_NERDLE
+#undef KERNEL
+#undef KERNEL_CAT
+#undef KERNEL_CAT_
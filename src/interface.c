@@ -2,14 +2,23 @@
 #include <X11/X.h>
 #include <X11/Xutil.h>
 #include <X11/extensions/XTest.h>
+#include <X11/extensions/XShm.h>
+#ifdef HAVE_XDAMAGE
+# include <X11/extensions/Xdamage.h>
+#endif
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
+#include <poll.h>
 #include <unistd.h>
 #include <assert.h>
 
 #include "equation.h"
 #include "interface.h"
+#include "utils.h"
 
 struct coord {
   int x;
@@ -58,6 +67,29 @@ static const struct color c_right = { 87, 172, 120 };
 static const struct color c_wrong = { 233, 198, 1 };
 static const struct color c_discarded = { 162, 162, 162 };
 
+/**
+ * Decoding of the pixels of the images captured: masks of the channels
+ * for TrueColor visuals, otherwise a copy of the colormap.
+ */
+struct pixel_format {
+  bool true_color;
+  unsigned long mask[3]; /* red, green, blue */
+  int shift[3];
+  unsigned long max[3];
+  struct color *colormap;
+  unsigned nr_colormap;
+};
+
+/**
+ * Region of the screen captured.
+ */
+struct roi {
+  int x;
+  int y;
+  unsigned width;
+  unsigned height;
+};
+
 /**
  * Use x11 as the interface with the site.
  */
@@ -67,9 +99,27 @@ struct interface {
   Window win;
   int screen;
   Colormap map;
-  XImage *image;
   unsigned width;
   unsigned height;
+  struct pixel_format format;
+  /* Capture: ZPixmap image of the region of interest, in a shared
+     memory segment (MIT-SHM) if the extension is available. */
+  XImage *image;
+  struct roi roi;
+  bool shm_available;
+  bool shm_attached;
+  XShmSegmentInfo shm;
+#ifdef HAVE_XDAMAGE
+  /* Notification of the changes of the screen */
+  bool damage_available;
+  int damage_event;
+  Damage damage;
+#endif
+  /* Keyboard: delay between two key events (ms), verify the line typed */
+  uint32_t key_delay;
+  bool key_verify;
+  /* Time for the last round to settle (us) */
+  uint64_t settle_time;
   /* Properties */
   struct coord first; /* Left-up location of the grid. */
   uint32_t width_loc_sz;
@@ -78,12 +128,158 @@ struct interface {
   uint32_t height_space_sz;
 };
 
+static void capture_release(struct interface *in)
+{
+  if (in->shm_attached == true) {
+    XShmDetach(in->display, &in->shm);
+    XSync(in->display, False);
+    shmdt(in->shm.shmaddr);
+    in->shm_attached = false;
+    in->image->data = NULL; /* not allocated by Xlib */
+  }
+  if (in->image != NULL) {
+    XDestroyImage(in->image);
+    in->image = NULL;
+  }
+}
+
+/**
+ * Allocate the shared image of the region of interest.
+ * Return false if MIT-SHM cannot be used (XGetImage instead).
+ */
+static bool capture_shm_create(struct interface *in)
+{
+  Visual *visual = DefaultVisual(in->display, in->screen);
+  int depth = DefaultDepth(in->display, in->screen);
+
+  in->image = XShmCreateImage(in->display, visual, depth, ZPixmap, NULL,
+                              &in->shm, in->roi.width, in->roi.height);
+  if (in->image == NULL) {
+    return false;
+  }
+
+  in->shm.shmid = shmget(IPC_PRIVATE,
+                         in->image->bytes_per_line * in->image->height,
+                         IPC_CREAT | 0600);
+  if (in->shm.shmid == -1) {
+    XDestroyImage(in->image);
+    in->image = NULL;
+    return false;
+  }
+  in->shm.shmaddr = in->image->data = shmat(in->shm.shmid, NULL, 0);
+  /* the segment is freed when detached by the X server and the bot */
+  shmctl(in->shm.shmid, IPC_RMID, NULL);
+  if (in->shm.shmaddr == (char*)-1) {
+    in->image->data = NULL;
+    XDestroyImage(in->image);
+    in->image = NULL;
+    return false;
+  }
+  in->shm.readOnly = False;
+  if (XShmAttach(in->display, &in->shm) == False) {
+    shmdt(in->shm.shmaddr);
+    in->image->data = NULL;
+    XDestroyImage(in->image);
+    in->image = NULL;
+    return false;
+  }
+  XSync(in->display, False);
+  in->shm_attached = true;
+  return true;
+}
+
+/**
+ * Capture only the region of interest from now (clipped to the screen).
+ */
+static void capture_set_roi(struct interface *in, int x, int y,
+                            unsigned width, unsigned height)
+{
+  capture_release(in);
+
+  if (x < 0) {
+    x = 0;
+  }
+  if (y < 0) {
+    y = 0;
+  }
+  if (x + width > in->width) {
+    width = in->width - x;
+  }
+  if (y + height > in->height) {
+    height = in->height - y;
+  }
+  in->roi.x = x;
+  in->roi.y = y;
+  in->roi.width = width;
+  in->roi.height = height;
+
+  if (in->shm_available == true && capture_shm_create(in) == false) {
+    printf("[nerdle] MIT-SHM not usable, fallback on XGetImage\n");
+    in->shm_available = false;
+  }
+  printf("[nerdle] capture %u x %u at (%d, %d)%s\n", width, height, x, y,
+         in->shm_available == true ? " (MIT-SHM)" : "");
+}
+
+#ifdef HAVE_XDAMAGE
+
+static void damage_init(struct interface *in)
+{
+  int error_base;
+
+  in->damage_available = XDamageQueryExtension(in->display, &in->damage_event,
+                                               &error_base);
+  if (in->damage_available == true) {
+    in->damage = XDamageCreate(in->display, in->win,
+                               XDamageReportRawRectangles);
+  }
+  printf("[nerdle] round end detection: %s\n",
+         in->damage_available == true ? "XDamage" : "polling");
+}
+
+#endif /* HAVE_XDAMAGE */
+
+static void pixel_format_init(struct interface *in)
+{
+  Visual *visual = DefaultVisual(in->display, in->screen);
+  struct pixel_format *format = &in->format;
+
+  if (visual->class == TrueColor) {
+    format->true_color = true;
+    format->mask[0] = visual->red_mask;
+    format->mask[1] = visual->green_mask;
+    format->mask[2] = visual->blue_mask;
+    for (uint32_t c = 0; c < 3; ++c) {
+      format->shift[c] = __builtin_ctzl(format->mask[c]);
+      format->max[c] = format->mask[c] >> format->shift[c];
+    }
+    return;
+  }
+
+  /* one round-trip for all the entries of the colormap */
+  format->true_color = false;
+  format->nr_colormap = visual->map_entries;
+  format->colormap = calloc(format->nr_colormap, sizeof(struct color));
+  XColor *xcolors = calloc(format->nr_colormap, sizeof(XColor));
+  for (unsigned i = 0; i < format->nr_colormap; ++i) {
+    xcolors[i].pixel = i;
+  }
+  XQueryColors(in->display, in->map, xcolors, format->nr_colormap);
+  for (unsigned i = 0; i < format->nr_colormap; ++i) {
+    format->colormap[i].r = xcolors[i].red / 256;
+    format->colormap[i].g = xcolors[i].green / 256;
+    format->colormap[i].b = xcolors[i].blue / 256;
+  }
+  free(xcolors);
+}
+
 struct interface* interface_create(void)
 {
   struct interface *in = calloc(1, sizeof(*in));
 
   in->display = XOpenDisplay(NULL);
   if (in->display == NULL) {
+    free(in);
     return NULL;
   }
 
@@ -92,20 +288,44 @@ struct interface* interface_create(void)
   in->map = DefaultColormap(in->display, in->screen);
   in->width = DisplayWidth(in->display, in->screen);
   in->height = DisplayHeight(in->display, in->screen);
+  in->shm_available = XShmQueryExtension(in->display);
+  in->key_delay = INTERFACE_KEY_DELAY;
+  in->key_verify = true;
+  pixel_format_init(in);
   printf("[nerdle] bot started...\n");
   printf("[nerdle] screen size: %d x %d\n", in->width, in->height);
 
+  /* full screen until the grid is found */
+  capture_set_roi(in, 0, 0, in->width, in->height);
   return in;
 }
 
+void interface_destroy(struct interface *in)
+{
+#ifdef HAVE_XDAMAGE
+  if (in->damage_available == true) {
+    XDamageDestroy(in->display, in->damage);
+  }
+#endif
+  capture_release(in);
+  free(in->format.colormap);
+  XCloseDisplay(in->display);
+  free(in);
+}
+
 static void image_refresh(struct interface *in)
 {
+  if (in->shm_attached == true) {
+    XShmGetImage(in->display, in->win, in->image,
+                 in->roi.x, in->roi.y, AllPlanes);
+    return;
+  }
   if (in->image != NULL) {
-    XFree(in->image);
+    XDestroyImage(in->image);
   }
-  in->image = XGetImage(in->display, in->win, 0, 0,
-                        in->width, in->height,
-                        AllPlanes, XYPixmap);
+  in->image = XGetImage(in->display, in->win, in->roi.x, in->roi.y,
+                        in->roi.width, in->roi.height,
+                        AllPlanes, ZPixmap);
 }
 
 static void set_mouse_coordinates(struct interface *in, struct coord *coord)
@@ -118,16 +338,39 @@ static void set_mouse_coordinates(struct interface *in, struct coord *coord)
         	&coord->x, &coord->y, &childx, &childy, &mask);
 }
 
+/**
+ * Read a pixel of the image captured, without request to the X server.
+ */
+static unsigned long get_pixel(const XImage *image, int x, int y)
+{
+  /* 32 bits pixels in the byte order of the host: direct access */
+  if (image->bits_per_pixel == 32 &&
+      image->byte_order == (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ?
+                            LSBFirst : MSBFirst)) {
+    const char *line = image->data + y * image->bytes_per_line;
+    return ((const uint32_t*)line)[x];
+  }
+  return XGetPixel((XImage*)image, x, y);
+}
+
 static void get_color_pixel(struct interface *in, int x, int y, struct color *color)
 {
-  XColor xcolor;
+  const struct pixel_format *format = &in->format;
 
-  xcolor.pixel = XGetPixel(in->image, x, y);
-  XQueryColor(in->display, in->map, &xcolor);
+  /* screen coordinates to image coordinates */
+  unsigned long pixel = get_pixel(in->image, x - in->roi.x, y - in->roi.y);
 
-  color->r = xcolor.red / 256;
-  color->g = xcolor.green / 256;
-  color->b = xcolor.blue / 256;
+  if (format->true_color == true) {
+    int *channels[3] = { &color->r, &color->g, &color->b };
+    for (uint32_t c = 0; c < 3; ++c) {
+      unsigned long v = (pixel & format->mask[c]) >> format->shift[c];
+      *channels[c] = format->max[c] == 255 ? v : v * 255 / format->max[c];
+    }
+  } else if (pixel < format->nr_colormap) {
+    *color = format->colormap[pixel];
+  } else {
+    color->r = color->g = color->b = 0;
+  }
 }
 
 static bool find_h_inc(struct interface *in, struct coord *from,
@@ -252,53 +495,14 @@ void interface_start(struct interface *in)
   set_start_coord(in, &start);
   set_horizontal_properties(in, &start);
   set_vertical_properties(in, &start);
-}
-
-static void press_key(struct interface *in, KeyCode keycode)
-{
-#define WAITING_TIME 30000 /* ms */
-  XTestFakeKeyEvent(in->display, keycode, true, 0);
-  XFlush(in->display);
-  usleep(WAITING_TIME);
-  XTestFakeKeyEvent(in->display, keycode, false, 0);
-  XFlush(in->display);
-#undef WAITING_TIME
-}
-
-void interface_write(struct interface *in, struct equation *eq)
-{
-  KeyCode keycode;
-
-#define CASE_KEYCODE(SYMBOL, KEYCODE)           \
-  case SYMBOL:                                  \
-    keycode = KEYCODE;                          \
-    break
-
-  for (uint32_t i = 0; i < eq->sz; ++i) {
-    switch (eq->symbols[i]) {
-      CASE_KEYCODE(SYMBOL_PLUS, 86);
-      CASE_KEYCODE(SYMBOL_MINUS, 82);
-      CASE_KEYCODE(SYMBOL_DIV, 106);
-      CASE_KEYCODE(SYMBOL_MULT, 63);
-      CASE_KEYCODE(SYMBOL_EQ, 21);
-      CASE_KEYCODE(SYMBOL_1, 10);
-      CASE_KEYCODE(SYMBOL_2, 11);
-      CASE_KEYCODE(SYMBOL_3, 12);
-      CASE_KEYCODE(SYMBOL_4, 13);
-      CASE_KEYCODE(SYMBOL_5, 14);
-      CASE_KEYCODE(SYMBOL_6, 15);
-      CASE_KEYCODE(SYMBOL_7, 16);
-      CASE_KEYCODE(SYMBOL_8, 17);
-      CASE_KEYCODE(SYMBOL_9, 18);
-      CASE_KEYCODE(SYMBOL_0, 19);
-      case SYMBOL_END:
-        return;
-    };
-    press_key(in, keycode);
-  }
-  press_key(in, 36); // return
 
-#undef CASE_KEYCODE
+  /* bounding box of the grid (largest equation, all the rounds) */
+  capture_set_roi(in, in->first.x, in->first.y,
+                  (in->width_loc_sz + in->width_space_sz) * LIMIT_MAX_EQ_SZ,
+                  (in->height_loc_sz + in->height_space_sz) * MAX_NR_ROUND);
+#ifdef HAVE_XDAMAGE
+  damage_init(in);
+#endif
 }
 
 /**
@@ -320,36 +524,6 @@ static void get_location(struct interface *in, uint32_t round,
 
 #undef MARGIN
 
-/**
- * Wait end of a round.
- * Return true if timeout
- */
-static bool interface_wait_round_end(struct interface *in, uint32_t round, uint32_t sz)
-{
-  struct coord coord;
-  struct color color = { 0, 0, 0 };
-  uint32_t tot = 0;
-
-#define TIMEOUT 100000 /* 1 sec */
-#define WAITING_TIME 20000 /* ms */
-  while (color_approx_eq(&color, &c_right) == false &&
-         color_approx_eq(&color, &c_wrong) == false &&
-         color_approx_eq(&color, &c_discarded) == false) {
-    image_refresh(in);
-    /* last location of the last grid of the line `round` */
-    get_location(in, round, sz - 1, &coord);
-    get_color_pixel(in, coord.x, coord.y, &color);
-    usleep(WAITING_TIME);
-    tot += WAITING_TIME;
-    if (tot >= TIMEOUT) {
-      return true;
-    }
-  }
-  return false;
-#undef WAITING_TIME
-#undef TIMEOUT_WIN
-}
-
 static enum status status_map_from_colors(struct color *color)
 {
   if (color_approx_eq(color, &c_right) == true) {
@@ -364,50 +538,245 @@ static enum status status_map_from_colors(struct color *color)
   return UNKNOWN;
 }
 
-static void status_dump(enum status status)
+/**
+ * Read the status of the locations of the line `round` from the image.
+ * Return true if all the locations have a known status.
+ */
+static bool read_row(struct interface *in, uint32_t round, uint32_t sz,
+                     enum status *status)
 {
-  switch (status) {
-    case RIGHT:
-      printf("\033[0;32mO");
-      break;
-    case WRONG:
-      printf("\033[0;33mX");
-      break;
-    case DISCARDED:
-      printf("_");
+  struct coord loc;
+  struct color color;
+  bool known = true;
+
+  for (uint32_t i = 0; i < sz; ++i) {
+    get_location(in, round, i, &loc);
+    get_color_pixel(in, loc.x, loc.y, &color);
+    status[i] = status_map_from_colors(&color);
+    known &= status[i] != UNKNOWN;
+  }
+  return known;
+}
+
+#define SETTLE_TIME 17000 /* us without change once known: one frame (60Hz) */
+#define TIMEOUT 5000000 /* us */
+#define POLL_MIN 1000 /* us */
+#define POLL_MAX 32000 /* us */
+
+#ifdef HAVE_XDAMAGE
+
+/**
+ * Wait a damage of the screen intersecting the line (at most @c timeout us).
+ * Return true if the line is damaged.
+ */
+static bool damage_wait(struct interface *in, int y, unsigned height,
+                        uint64_t timeout)
+{
+  const uint64_t deadline = utils_now_us() + timeout;
+  bool damaged = false;
+  XEvent ev;
+
+  while (true) {
+    while (XPending(in->display) > 0) {
+      XNextEvent(in->display, &ev);
+      if (ev.type != in->damage_event + XDamageNotify) {
+        continue;
+      }
+      const XRectangle *area = &((XDamageNotifyEvent*)&ev)->area;
+      if (area->y < y + (int)height && y < area->y + area->height) {
+        damaged = true;
+      }
+    }
+    uint64_t now = utils_now_us();
+    if (damaged == true || now >= deadline) {
+      return damaged;
+    }
+    struct pollfd pfd = { ConnectionNumber(in->display), POLLIN, 0 };
+    poll(&pfd, 1, (deadline - now + 999) / 1000);
+  }
+}
+
+#endif /* HAVE_XDAMAGE */
+
+/**
+ * Wait until all the locations of the line `round` have a known status
+ * (the last tile turned), and the line is not changed for a frame
+ * (SETTLE_TIME): with XDamage, the first interval without damage of the
+ * line once known ends the wait, otherwise the line is polled with an
+ * adaptive backoff (reset on change) until unchanged for SETTLE_TIME.
+ * Return true if timeout
+ */
+static bool interface_wait_round_end(struct interface *in, uint32_t round, uint32_t sz)
+{
+  enum status prev[LIMIT_MAX_EQ_SZ];
+  enum status status[LIMIT_MAX_EQ_SZ];
+  bool prev_known = false;
+  uint64_t delay = POLL_MIN;
+  const uint64_t start = utils_now_us();
+  uint64_t last_change = start;
+
+  while (true) {
+    image_refresh(in);
+    bool known = read_row(in, round, sz, status);
+    uint64_t now = utils_now_us();
+
+    if (known == false || prev_known == false ||
+        memcmp(prev, status, sz * sizeof(enum status)) != 0) {
+      last_change = now;
+      delay = POLL_MIN;
+    } else if (now - last_change >= SETTLE_TIME) {
       break;
+    }
+    memcpy(prev, status, sz * sizeof(enum status));
+    prev_known = known;
+
+    if (now - start >= TIMEOUT) {
+      return true;
+    }
+
+#ifdef HAVE_XDAMAGE
+    if (in->damage_available == true) {
+      struct coord loc;
+      get_location(in, round, 0, &loc);
+      /* known: settled if not damaged for a frame, otherwise wait a
+         change (bounded by POLL_MAX * 4 if the damages are not
+         reported) */
+      uint64_t timeout = known == true ? SETTLE_TIME : POLL_MAX * 4;
+      if (damage_wait(in, loc.y, in->height_loc_sz, timeout) == false &&
+          known == true) {
+        break;
+      }
+      continue;
+    }
+#endif
+    usleep(delay);
+    if (delay * 2 <= POLL_MAX) {
+      delay *= 2;
+    }
+  }
+
+  in->settle_time = last_change - start;
+  printf("[nerdle] round settled in %.1fms\n", in->settle_time / 1e3);
+  return false;
+}
+
+#undef SETTLE_TIME
+#undef TIMEOUT
+#undef POLL_MIN
+#undef POLL_MAX
+
+uint64_t interface_get_settle_time(const struct interface *in)
+{
+  return in->settle_time;
+}
+
+/**
+ * Keyboard emulation: the key events of an equation are queued with a
+ * delay before each key pressed (applied by the X server, the key is
+ * released at once) and flushed once.
+ */
+#define KEY_DELAY_MAX 100 /* ms */
+#define KEYCODE_RETURN 36
+#define KEYCODE_BACKSPACE 22
+
+static void queue_key(struct interface *in, KeyCode keycode)
+{
+  XTestFakeKeyEvent(in->display, keycode, true, in->key_delay);
+  XTestFakeKeyEvent(in->display, keycode, false, 0);
+}
+
+static KeyCode get_keycode(enum symbol symbol)
+{
+  switch (symbol) {
+    case SYMBOL_PLUS: return 86;
+    case SYMBOL_MINUS: return 82;
+    case SYMBOL_DIV: return 106;
+    case SYMBOL_MULT: return 63;
+    case SYMBOL_EQ: return 21;
+    case SYMBOL_0: return 19;
     default:
-      assert(!"location name not found...");
+      /* SYMBOL_1 to SYMBOL_9 */
+      return 9 + symbol;
   };
-  printf("\033[0m");
 }
 
-bool interface_get_status(struct nerdle *nerdle,
-                          struct interface *in,
-                          uint32_t round,
-                          const struct equation *eq)
+/**
+ * Wait until all the locations of the line `round` are filled.
+ * Only the tiles not empty are checked, not the symbols typed (the
+ * symbols are not read from the screen).
+ * Return false if timeout.
+ */
+static bool wait_row_typed(struct interface *in, uint32_t round, uint32_t sz)
 {
+#define TYPED_TIMEOUT 500000 /* us */
+#define TYPED_POLL 2000 /* us */
   struct coord loc;
   struct color color;
-  enum status status;
+  const uint64_t start = utils_now_us();
 
-  if (interface_wait_round_end(in, round, nerdle->sz) == true) {
-    return true;
-  }
-
-  printf("[nerdle] [");
-  for (uint32_t i = 0; i < eq->sz; ++i) {
-    get_location(in, round, i, &loc);
-    get_color_pixel(in, loc.x, loc.y, &color);
-    status = status_map_from_colors(&color);
-    if (status == UNKNOWN) {
-      printf("......]\n");
+  XSync(in->display, False);
+  while (utils_now_us() - start < TYPED_TIMEOUT + (uint64_t)in->key_delay * 2000 * sz) {
+    bool filled = true;
+    image_refresh(in);
+    for (uint32_t i = 0; i < sz && filled == true; ++i) {
+      get_location(in, round, i, &loc);
+      get_color_pixel(in, loc.x, loc.y, &color);
+      filled = color_approx_eq(&color, &c_empty) == false;
+    }
+    if (filled == true) {
       return true;
     }
-    status_dump(status);
-    nerdle_update_status(nerdle, status, eq, i);
+    usleep(TYPED_POLL);
   }
-  printf("] ");
-  printf("\n");
   return false;
+#undef TYPED_TIMEOUT
+#undef TYPED_POLL
+}
+
+void interface_set_keyboard(struct interface *in, uint32_t delay, bool verify)
+{
+  in->key_delay = delay;
+  in->key_verify = verify;
+}
+
+void interface_write(struct interface *in, uint32_t round, const struct equation *eq)
+{
+  while (true) {
+    for (uint32_t i = 0; i < eq->sz; ++i) {
+      queue_key(in, get_keycode(eq->symbols[i]));
+    }
+    if (in->key_verify == false) {
+      break;
+    }
+
+    /* verify the line before submitting: faster next time if typed,
+       otherwise erase it and slower */
+    XFlush(in->display);
+    if (wait_row_typed(in, round, eq->sz) == true) {
+      if (in->key_delay > 0) {
+        in->key_delay = in->key_delay * 3 / 4;
+      }
+      break;
+    }
+    if (in->key_delay >= KEY_DELAY_MAX) {
+      printf("[nerdle] equation not typed (key delay:%ums)\n", in->key_delay);
+      break;
+    }
+    for (uint32_t i = 0; i < eq->sz; ++i) {
+      queue_key(in, KEYCODE_BACKSPACE);
+    }
+    in->key_delay = in->key_delay == 0 ? 1 : in->key_delay * 2;
+    printf("[nerdle] equation not typed, key delay: %ums\n", in->key_delay);
+  }
+  queue_key(in, KEYCODE_RETURN);
+  XFlush(in->display);
+}
+
+bool interface_get_status(struct interface *in, uint32_t round, uint32_t sz,
+                          enum status *status)
+{
+  if (interface_wait_round_end(in, round, sz) == true) {
+    return false;
+  }
+  return read_row(in, round, sz, status);
 }
@@ -2,8 +2,15 @@
 #define __INTERFACE__
 
 #include <stdbool.h>
+#include <stdint.h>
 
-#include "nerdle.h"
+#include "rules.h"
+#include "equation.h"
+
+/**
+ * Default delay before each key pressed (ms).
+ */
+#define INTERFACE_KEY_DELAY 30
 
 /**
  * Opaque structure used as an interface with the game on the site.
@@ -18,34 +25,63 @@ typedef struct interface interface_t;
  */
 interface_t* interface_create(void);
 
+/**
+ * Destroy an interface previously allocated from @c interface_create.
+ *
+ * @param in interface handle.
+ */
+void interface_destroy(interface_t *in);
+
 /**
  * Start the interface.
- * Set the properties of the grid.
+ * Set the properties of the grid, then only the grid is captured.
  *
  * @param in interface handle.
  */
 void interface_start(interface_t *in);
 
 /**
- * Write (keyboard emulation) an equation.
+ * Configure the keyboard emulation.
+ * With @c verify (default), the line is checked before submitting the
+ * equation and the delay is tuned: decreased while the equations are
+ * typed, increased (and the line typed again) otherwise. Only the tiles
+ * filled are checked, not the symbols typed.
  *
  * @param in interface handle.
+ * @param delay delay before each key pressed (ms).
+ * @param verify verify the line typed.
+ */
+void interface_set_keyboard(interface_t *in, uint32_t delay, bool verify);
+
+/**
+ * Write (keyboard emulation) an equation and submit it.
+ * The key events are queued and sent at once.
+ *
+ * @param in interface handle.
+ * @param round number of the round.
  * @param eq equation to write.
  */
-void interface_write(interface_t *in, struct equation *eq);
+void interface_write(interface_t *in, uint32_t round, const struct equation *eq);
 
 /**
  * At the end of a round, get the status of all locations.
  *
- * @param nerdle nerdle handle.
  * @param in interface handle.
  * @param round number of the round.
- * @param eq equation to evaluate.
- * @return true if win, otherwise return false.
+ * @param sz size of the equation.
+ * @param status status of each location output.
+ * @return true if read, false if timeout or unknown status (end of game).
+ */
+bool interface_get_status(interface_t *in, uint32_t round, uint32_t sz,
+                          enum status *status);
+
+/**
+ * Time for the last round to settle: from the submission of the
+ * equation to the last change of the status of the locations.
+ *
+ * @param in interface handle.
+ * @return settle time (us).
  */
-bool interface_get_status(struct nerdle *nerdle,
-                          struct interface *in,
-                          uint32_t round,
-                          const struct equation *eq);
+uint64_t interface_get_settle_time(const interface_t *in);
 
 #endif /* !__INTERFACE__ */
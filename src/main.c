@@ -1,17 +1,33 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <getopt.h>
 
 #include "nerdle.h"
 #include "utils.h"
+#include "backend.h"
+#include "feedback.h"
 #include "interface.h"
 #include "first_equations.h"
+#include "opening.h"
 
 /**
  * This bot plays on the following URL: https://wordleplay.com/fr/nerdle
  *
  * You have to guess the hidden math equation in 6 tries and the color of the tiles changes
  * to show how close you are. To start playing, enter any mathematical valid equation.
+ *
+ * The game is played through a backend (--backend): the site with X11 (x11,
+ * default if built with X11) or the mock server nerdle-server (local,
+ * --server: see @c backend_config). A backend unknown or not built is an
+ * error.
+ *
+ * The default strategy is the strategy of the openings searched offline
+ * (@c opening_get) if any for the size, so that the second guess is read
+ * from the opening.
+ *
+ * The decisions of the games are stored on disk (--decisions), a round
+ * already played is read instead of being searched again.
  */
 
 static void dump_equation(const struct equation *eq)
@@ -21,25 +37,122 @@ static void dump_equation(const struct equation *eq)
   printf("[nerdle] equation: %.*s\n", eq->sz, str);
 }
 
+static void dump_feedback(const enum status *status, uint32_t sz)
+{
+  printf("[nerdle] [");
+  for (uint32_t i = 0; i < sz; ++i) {
+    switch (status[i]) {
+      case RIGHT:
+        printf("\033[0;32mO");
+        break;
+      case WRONG:
+        printf("\033[0;33mX");
+        break;
+      default:
+        printf("_");
+    };
+    printf("\033[0m");
+  }
+  printf("]\n");
+}
+
+/**
+ * Backends built (x11 only with X11).
+ */
+static const struct backend_ops *backends[] = {
+#ifdef HAVE_X11
+  &backend_x11_ops,
+#endif
+  &backend_local_ops,
+};
+
+/**
+ * Get a backend built by name, NULL if unknown.
+ */
+static const struct backend_ops* get_backend(const char *name)
+{
+  for (uint32_t i = 0; i < sizeof(backends) / sizeof(backends[0]); ++i) {
+    if (strcmp(backends[i]->name, name) == 0) {
+      return backends[i];
+    }
+  }
+  return NULL;
+}
+
 enum {
   CASE_SIZE,
   CASE_LIMIT,
+  CASE_DICT,
+  CASE_THREADS,
+  CASE_STRATEGY,
+  CASE_SAMPLE,
+  CASE_DEPTH,
+  CASE_BUDGET,
+  CASE_DECISIONS,
+  CASE_KEY_DELAY,
+  CASE_VERIFY_INPUT,
+  CASE_NO_VERIFY_INPUT,
+  CASE_BACKEND,
+  CASE_SERVER,
+  CASE_LIST_BEST_VARIANCE,
 };
 
 static struct option long_options[] = {
   { "size", required_argument, 0, 0 },
   { "limit", required_argument, 0, 0 },
+  { "dict", required_argument, 0, 0 },
+  { "threads", required_argument, 0, 0 },
+  { "strategy", required_argument, 0, 0 },
+  { "sample", required_argument, 0, 0 },
+  { "depth", required_argument, 0, 0 },
+  { "budget", required_argument, 0, 0 },
+  { "decisions", required_argument, 0, 0 },
+  { "key-delay", required_argument, 0, 0 },
+  { "verify-input", no_argument, 0, 0 },
+  { "no-verify-input", no_argument, 0, 0 },
+  { "backend", required_argument, 0, 0 },
+  { "server", required_argument, 0, 0 },
+  { "list-best-variance", no_argument, 0, 0 },
+  { 0, 0, 0, 0 },
 };
 
 struct options {
   uint32_t sz;
   uint32_t limit;
+  const char *dict;
+  uint32_t nr_thread;
+  enum strategy strategy; /* default: the strategy of the opening */
+  bool has_strategy;
+  uint32_t sample;
+  uint32_t depth;
+  uint32_t budget; /* ms */
+  const char *decisions; /* NULL: none */
+  uint32_t key_delay;
+  bool verify_input;
+  const struct backend_ops *backend; /* NULL: unknown */
+  const char *backend_name;
+  const char *server;
+  bool list_best_variance;
 };
 
 static void options_parse(int argc, char **argv, struct options *opts)
 {
   opts->sz = DEFAULT_SIZE;
   opts->limit = 0;
+  opts->dict = NULL;
+  opts->nr_thread = 1;
+  opts->strategy = STRATEGY_VARIANCE;
+  opts->has_strategy = false;
+  opts->sample = DEFAULT_SAMPLE;
+  opts->depth = 0;
+  opts->budget = 0;
+  opts->decisions = NULL;
+  opts->key_delay = INTERFACE_KEY_DELAY;
+  opts->verify_input = true;
+  opts->backend = backends[0];
+  opts->backend_name = opts->backend->name;
+  opts->server = NULL;
+  opts->list_best_variance = false;
 
   while (true) {
     int option_index = 0;
@@ -54,8 +167,55 @@ static void options_parse(int argc, char **argv, struct options *opts)
       case CASE_LIMIT:
         opts->limit = atoi(optarg);
         break;
+      case CASE_DICT:
+        opts->dict = optarg;
+        break;
+      case CASE_THREADS:
+        opts->nr_thread = atoi(optarg);
+        break;
+      case CASE_STRATEGY:
+        opts->strategy = score_parse_strategy(optarg);
+        opts->has_strategy = true;
+        break;
+      case CASE_SAMPLE:
+        opts->sample = atoi(optarg);
+        break;
+      case CASE_DEPTH:
+        opts->depth = atoi(optarg);
+        break;
+      case CASE_BUDGET:
+        opts->budget = atoi(optarg);
+        break;
+      case CASE_DECISIONS:
+        opts->decisions = optarg;
+        break;
+      case CASE_KEY_DELAY:
+        opts->key_delay = atoi(optarg);
+        break;
+      case CASE_VERIFY_INPUT:
+        opts->verify_input = true;
+        break;
+      case CASE_NO_VERIFY_INPUT:
+        opts->verify_input = false;
+        break;
+      case CASE_BACKEND:
+        opts->backend = get_backend(optarg);
+        opts->backend_name = optarg;
+        break;
+      case CASE_SERVER:
+        opts->server = optarg;
+        break;
+      case CASE_LIST_BEST_VARIANCE:
+        opts->list_best_variance = true;
+        break;
     }
   }
+
+  /* the second guesses of the opening are read with its strategy */
+  const struct opening *opening = opening_get(opts->sz);
+  if (opts->has_strategy == false && opening != NULL) {
+    opts->strategy = opening->strategy;
+  }
 }
 
 int main(int argc, char **argv)
@@ -63,33 +223,87 @@ int main(int argc, char **argv)
   struct options opts;
 
   options_parse(argc, argv, &opts);
+  if (opts.backend == NULL) {
+    printf("[nerdle] unknown backend '%s' (or not built)\n", opts.backend_name);
+    return 1;
+  }
 
   printf("[nerdle] sz:%u\n", opts.sz);
   struct nerdle *nerdle = nerdle_create(opts.sz, opts.limit);
+  nerdle->nr_thread = opts.nr_thread;
+  nerdle->strategy = opts.strategy;
+  nerdle->sample = opts.sample;
+  nerdle->depth = opts.depth;
+  nerdle->budget = opts.budget / 1000.0;
+  if (opts.dict != NULL && nerdle_load_equations(nerdle, opts.dict) == false) {
+    nerdle_destroy(nerdle);
+    return 1;
+  }
 
-  nerdle_generate_best_variance_equations(nerdle);
-  return 0;
+  if (opts.list_best_variance == true) {
+    nerdle_generate_best_variance_equations(nerdle);
+    nerdle_destroy(nerdle);
+    return 0;
+  }
 
-  interface_t *in = interface_create();
-  struct equation eq;
+  struct decisions *decisions = NULL;
+  if (opts.decisions != NULL &&
+      (decisions = nerdle_open_decisions(nerdle, opts.decisions)) == NULL) {
+    nerdle_destroy(nerdle);
+    return 1;
+  }
+
+  struct backend_config config = {
+    .arg = opts.server,
+    .key_delay = opts.key_delay,
+    .verify_input = opts.verify_input,
+  };
+  struct backend *backend = backend_create(opts.backend, &config);
+  if (backend == NULL || backend_start(backend, opts.sz) == false) {
+    printf("[nerdle] backend '%s' not started\n", opts.backend->name);
+    if (backend != NULL) {
+      backend_destroy(backend);
+    }
+    nerdle_destroy(nerdle);
+    if (decisions != NULL) {
+      decision_close(decisions);
+    }
+    return 1;
+  }
 
-  interface_start(in);
+  struct equation eq;
+  enum status status[LIMIT_MAX_EQ_SZ];
+  uint32_t win = feedback_nr_pattern(opts.sz) - 1;
 
   nerdle_set_first_equation(nerdle, &eq);
 
   for (uint32_t round = 0; round < MAX_NR_ROUND; ++round) {
     printf("[nerdle] -------------------------- {round:%u}\n", round);
     dump_equation(&eq);
-    interface_write(in, &eq);
-    if (interface_get_status(nerdle, in, round, &eq) == true) {
+    double start = utils_now();
+    if (backend_submit(backend, round, &eq) == false ||
+        backend_read_feedback(backend, round, opts.sz, status) == false) {
+      printf("[nerdle] no feedback, end of the game\n");
+      break;
+    }
+    printf("[nerdle] round latency: %.3fms\n", (utils_now() - start) * 1e3);
+    dump_feedback(status, opts.sz);
+    if (feedback_from_status(status, opts.sz) == win) {
       printf("[nerdle] WIN !\n");
       break;
     }
+    nerdle_update_feedback(nerdle, &eq, status);
     nerdle_dump_status(nerdle);
     nerdle_find_best_equation(nerdle, &eq);
   }
 
-  free(in);
+  backend_destroy(backend);
+  arena_dump(&nerdle->arena, "game");
+  arena_dump(&nerdle->scratch, "scratch");
   nerdle_destroy(nerdle);
+  if (decisions != NULL) {
+    decision_dump(decisions);
+    decision_close(decisions);
+  }
   return 0;
 }
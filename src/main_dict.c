@@ -0,0 +1,121 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <getopt.h>
+
+#include "nerdle.h"
+#include "dict.h"
+
+/**
+ * Offline generation of the dictionaries of equations:
+ * one file `nerdle_<size>.dict` by size of equation.
+ * With one thread (default), the equations are written by chunks while
+ * enumerated, never all in memory; with more threads (--threads), they
+ * are generated in parallel in memory, then written.
+ */
+
+enum {
+  CASE_SIZE,
+  CASE_OUTPUT,
+  CASE_THREADS,
+};
+
+static struct option long_options[] = {
+  { "size", required_argument, 0, 0 },
+  { "output", required_argument, 0, 0 },
+  { "threads", required_argument, 0, 0 },
+  { 0, 0, 0, 0 },
+};
+
+struct options {
+  uint32_t sz; /* 0: all the sizes */
+  const char *output;
+  uint32_t nr_thread;
+};
+
+static void options_parse(int argc, char **argv, struct options *opts)
+{
+  opts->sz = 0;
+  opts->output = ".";
+  opts->nr_thread = 1;
+
+  while (true) {
+    int option_index = 0;
+    int c = getopt_long(argc, argv, "", long_options, &option_index);
+    if (c == -1) {
+      break;
+    }
+    switch (option_index) {
+      case CASE_SIZE:
+        opts->sz = atoi(optarg);
+        break;
+      case CASE_OUTPUT:
+        opts->output = optarg;
+        break;
+      case CASE_THREADS:
+        opts->nr_thread = atoi(optarg);
+        break;
+    }
+  }
+}
+
+/**
+ * Visitor writing the equations enumerated to the dictionary.
+ */
+static bool write_visitor(void *arg, const uint64_t *eqs, uint64_t nr)
+{
+  return dict_writer_add(arg, eqs, nr);
+}
+
+/**
+ * Number of equations of a chunk written.
+ */
+#define NR_CHUNK 4096
+
+static bool generate_dict(uint32_t sz, const struct options *opts)
+{
+  char path[4096];
+  struct dict_writer writer;
+  struct nerdle *nerdle = nerdle_create(sz, 0);
+  nerdle->verbose = false;
+  nerdle->nr_thread = opts->nr_thread;
+
+  snprintf(path, sizeof(path), "%s/nerdle_%u.dict", opts->output, sz);
+  if (dict_writer_open(&writer, path, sz) == false) {
+    nerdle_destroy(nerdle);
+    return false;
+  }
+  if (nerdle->nr_thread > 1) {
+    /* parallel: the equations of the branches are in memory */
+    nerdle_generate_equations(nerdle);
+    dict_writer_add(&writer, nerdle->candidates.eqs, nerdle->candidates.nr);
+  } else {
+    uint64_t *chunk = malloc(NR_CHUNK * sizeof(uint64_t));
+    nerdle_enumerate_equations(nerdle, chunk, NR_CHUNK, write_visitor, &writer);
+    free(chunk);
+  }
+  uint64_t nr = writer.header.nr;
+  bool ret = dict_writer_close(&writer, path);
+  if (ret == true) {
+    printf("[nerdle] dictionary '%s': %lu equations\n", path, nr);
+  }
+
+  nerdle_destroy(nerdle);
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  struct options opts;
+
+  options_parse(argc, argv, &opts);
+
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= LIMIT_MAX_EQ_SZ; ++sz) {
+    if (opts.sz != 0 && opts.sz != sz) {
+      continue;
+    }
+    if (generate_dict(sz, &opts) == false) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,208 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "nerdle.h"
+#include "feedback.h"
+#include "utils.h"
+
+/**
+ * Offline search of the openings (src/openings.h, @c opening_get):
+ * for each size, the first guess among all the equations minimizing the
+ * cost of the strategy against all the equations (--sample: guesses
+ * and answers sampled, for the large sizes), then the second guess for
+ * each feedback pattern of the first guess, as the solver would find it
+ * online (same strategy and sample).
+ */
+
+enum {
+  CASE_SIZE,
+  CASE_OUTPUT,
+  CASE_THREADS,
+  CASE_STRATEGY,
+  CASE_SAMPLE,
+};
+
+static struct option long_options[] = {
+  { "size", required_argument, 0, 0 },
+  { "output", required_argument, 0, 0 },
+  { "threads", required_argument, 0, 0 },
+  { "strategy", required_argument, 0, 0 },
+  { "sample", required_argument, 0, 0 },
+  { 0, 0, 0, 0 },
+};
+
+struct options {
+  bool sizes[LIMIT_MAX_EQ_SZ + 1]; /* none: all the sizes */
+  const char *output; /* NULL: stdout */
+  uint32_t nr_thread;
+  enum strategy strategy;
+  uint32_t sample; /* first guess */
+};
+
+static void options_parse(int argc, char **argv, struct options *opts)
+{
+  bool all = true;
+
+  memset(opts->sizes, 0, sizeof(opts->sizes));
+  opts->output = NULL;
+  opts->nr_thread = 1;
+  opts->strategy = STRATEGY_PARTITION;
+  opts->sample = 0;
+
+  while (true) {
+    int option_index = 0;
+    int c = getopt_long(argc, argv, "", long_options, &option_index);
+    if (c == -1) {
+      break;
+    }
+    switch (option_index) {
+      case CASE_SIZE: {
+        uint32_t sz = atoi(optarg);
+        if (sz >= LIMIT_MIN_EQ_SZ && sz <= LIMIT_MAX_EQ_SZ) {
+          opts->sizes[sz] = true;
+          all = false;
+        }
+        break;
+      }
+      case CASE_OUTPUT:
+        opts->output = optarg;
+        break;
+      case CASE_THREADS:
+        opts->nr_thread = atoi(optarg);
+        break;
+      case CASE_STRATEGY:
+        opts->strategy = score_parse_strategy(optarg);
+        break;
+      case CASE_SAMPLE:
+        opts->sample = atoi(optarg);
+        break;
+    }
+  }
+
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; all == true && sz <= LIMIT_MAX_EQ_SZ; ++sz) {
+    opts->sizes[sz] = true;
+  }
+}
+
+static const char *strategy_names[] = {
+  [STRATEGY_VARIANCE] = "STRATEGY_VARIANCE",
+  [STRATEGY_ENTROPY] = "STRATEGY_ENTROPY",
+  [STRATEGY_PARTITION] = "STRATEGY_PARTITION",
+};
+
+static void dump_eq(FILE *out, uint64_t packed, uint32_t sz)
+{
+  char str[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  equation_unpack(packed, &eq, sz);
+  utils_eq_to_str(&eq, str, sz);
+  fprintf(out, "%.*s", sz, str);
+}
+
+/**
+ * Search the opening of a size and write its second guesses.
+ * Return the first guess.
+ */
+static uint64_t search_opening(uint32_t sz, const struct options *opts,
+                               FILE *out, uint64_t *nr_eq, uint32_t *nr_second)
+{
+  struct nerdle *nerdle = nerdle_create(sz, 0);
+  nerdle->nr_thread = opts->nr_thread;
+  nerdle->verbose = false;
+  nerdle_generate_equations(nerdle);
+  const uint64_t *eqs = nerdle->candidates.eqs;
+  uint64_t nr = nerdle->candidates.nr;
+
+  uint64_t first = eqs[score_best_guess(eqs, nr, sz, opts->strategy,
+                                        opts->sample, opts->nr_thread)];
+  printf("[nerdle] size %u: %lu equations, first guess ", sz, nr);
+  dump_eq(stdout, first, sz);
+  printf("\n");
+
+  /* the equations by pattern, in order */
+  uint32_t nr_pattern = feedback_nr_pattern(sz);
+  uint64_t *offsets = calloc(nr_pattern + 1, sizeof(uint64_t));
+  uint64_t *sorted = malloc(nr * sizeof(uint64_t));
+  uint32_t *patterns = malloc(nr * sizeof(uint32_t));
+  for (uint64_t i = 0; i < nr; ++i) {
+    patterns[i] = feedback_pattern(first, eqs[i], sz);
+    ++offsets[patterns[i] + 1];
+  }
+  for (uint32_t p = 0; p < nr_pattern; ++p) {
+    offsets[p + 1] += offsets[p];
+  }
+  for (uint64_t i = 0; i < nr; ++i) {
+    sorted[offsets[patterns[i]]++] = eqs[i];
+  }
+  /* offsets[p] is now the end of the pattern p */
+
+  fprintf(out, "static const struct opening_second openings_second_%u[] = {\n", sz);
+  *nr_second = 0;
+  for (uint32_t p = 0; p < nr_pattern - 1; ++p) {
+    uint64_t begin = p > 0 ? offsets[p - 1] : 0;
+    uint64_t n = offsets[p] - begin;
+    if (n == 0) {
+      continue;
+    }
+    const uint64_t *cands = &sorted[begin];
+    uint64_t second = cands[score_best_guess(cands, n, sz, opts->strategy,
+                                             DEFAULT_SAMPLE, opts->nr_thread)];
+    fprintf(out, "  { %u, 0x%lxULL },\n", p, second);
+    ++*nr_second;
+  }
+  fprintf(out, "};\n\n");
+
+  free(patterns);
+  free(sorted);
+  free(offsets);
+  *nr_eq = nr;
+  nerdle_destroy(nerdle);
+  return first;
+}
+
+int main(int argc, char **argv)
+{
+  struct options opts;
+  uint64_t first[LIMIT_MAX_EQ_SZ + 1] = { 0 };
+  uint64_t nr_eq[LIMIT_MAX_EQ_SZ + 1] = { 0 };
+  uint32_t nr_second[LIMIT_MAX_EQ_SZ + 1] = { 0 };
+
+  options_parse(argc, argv, &opts);
+
+  FILE *out = stdout;
+  if (opts.output != NULL && (out = fopen(opts.output, "w")) == NULL) {
+    printf("[nerdle] cannot open '%s'\n", opts.output);
+    return 1;
+  }
+
+  fprintf(out, "/* Generated by nerdle-openings (sample of the first guess: %u),"
+          " do not edit. */\n", opts.sample);
+  fprintf(out, "#ifndef __OPENINGS__\n#define __OPENINGS__\n\n");
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= LIMIT_MAX_EQ_SZ; ++sz) {
+    if (opts.sizes[sz] == true) {
+      first[sz] = search_opening(sz, &opts, out, &nr_eq[sz], &nr_second[sz]);
+    }
+  }
+
+  fprintf(out, "static const struct opening openings[LIMIT_MAX_EQ_SZ + 1] = {\n");
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= LIMIT_MAX_EQ_SZ; ++sz) {
+    if (first[sz] == 0) {
+      continue;
+    }
+    fprintf(out, "  /* ");
+    dump_eq(out, first[sz], sz);
+    fprintf(out, " */\n");
+    fprintf(out, "  [%u] = { %s, %u, %lu, 0x%lxULL, openings_second_%u, %u },\n",
+            sz, strategy_names[opts.strategy], DEFAULT_SAMPLE, nr_eq[sz],
+            first[sz], sz, nr_second[sz]);
+  }
+  fprintf(out, "};\n\n#endif /* !__OPENINGS__ */\n");
+
+  if (out != stdout) {
+    fclose(out);
+  }
+  return 0;
+}
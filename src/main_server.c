@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "server.h"
+
+/**
+ * Mock of the Nerdle site for the local backend (@c backend_local_ops):
+ * one session on the standard input/output, or one session by
+ * connection on a UNIX socket (--socket), served concurrently.
+ */
+
+enum {
+  CASE_SOCKET,
+  CASE_SEED,
+};
+
+static struct option long_options[] = {
+  { "socket", required_argument, 0, 0 },
+  { "seed", required_argument, 0, 0 },
+  { 0, 0, 0, 0 },
+};
+
+struct options {
+  const char *socket; /* NULL: standard input/output */
+  uint32_t seed;
+};
+
+static void options_parse(int argc, char **argv, struct options *opts)
+{
+  opts->socket = NULL;
+  opts->seed = 0;
+
+  while (true) {
+    int option_index = 0;
+    int c = getopt_long(argc, argv, "", long_options, &option_index);
+    if (c == -1) {
+      break;
+    }
+    switch (option_index) {
+      case CASE_SOCKET:
+        opts->socket = optarg;
+        break;
+      case CASE_SEED:
+        opts->seed = atoi(optarg);
+        break;
+    }
+  }
+}
+
+struct connection {
+  struct server *server;
+  int fd;
+};
+
+static void* connection_worker(void *arg)
+{
+  struct connection *conn = arg;
+  server_session(conn->server, conn->fd, conn->fd);
+  free(conn);
+  return NULL;
+}
+
+static int serve_socket(struct server *server, const char *path)
+{
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    printf("[nerdle] socket path too long '%s'\n", path);
+    return 1;
+  }
+  strcpy(addr.sun_path, path);
+  unlink(path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1 ||
+      bind(fd, (struct sockaddr*)&addr, sizeof(addr)) == -1 ||
+      listen(fd, SOMAXCONN) == -1) {
+    perror("[nerdle] socket");
+    return 1;
+  }
+  printf("[nerdle] server listening on '%s'\n", path);
+
+  while (true) {
+    int client = accept(fd, NULL, NULL);
+    if (client == -1) {
+      perror("[nerdle] accept");
+      continue;
+    }
+    struct connection *conn = malloc(sizeof(*conn));
+    conn->server = server;
+    conn->fd = client;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, connection_worker, conn) != 0) {
+      close(client);
+      free(conn);
+      continue;
+    }
+    pthread_detach(thread);
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  struct options opts;
+  struct server server;
+  int ret = 0;
+
+  options_parse(argc, argv, &opts);
+  server_init(&server, opts.seed);
+
+  if (opts.socket != NULL) {
+    ret = serve_socket(&server, opts.socket);
+  } else {
+    server_session(&server, STDIN_FILENO, STDOUT_FILENO);
+  }
+
+  server_release(&server);
+  return ret;
+}
@@ -0,0 +1,339 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "nerdle.h"
+#include "sim.h"
+#include "batch.h"
+#include "feedback.h"
+#include "utils.h"
+
+/**
+ * Headless simulation: the solver plays against a hidden equation
+ * (--answer) or against every equation of the size (sweep), then the
+ * histogram of the guesses, the failure rate and the latency by round
+ * are dumped.
+ *
+ * Lookahead search (--depth <rounds>, --budget <ms by move>): the games
+ * share a transposition table.
+ *
+ * Persistent decisions (--decisions <file>): the next guess by history
+ * of the game is stored on miss and read by the following games and runs
+ * of the same configuration.
+ *
+ * Batch mode (--batch <file>, --jobs <threads>): one game by line, solved
+ * concurrently. A line is a hidden equation, or a transcript of the
+ * first rounds "<equation>:<feedback> ..." (feedback: R, W or D by
+ * location) for which the next guess is dumped.
+ */
+
+enum {
+  CASE_SIZE,
+  CASE_LIMIT,
+  CASE_DICT,
+  CASE_THREADS,
+  CASE_STRATEGY,
+  CASE_SAMPLE,
+  CASE_DEPTH,
+  CASE_BUDGET,
+  CASE_DECISIONS,
+  CASE_ANSWER,
+  CASE_ANSWERS,
+  CASE_BATCH,
+  CASE_JOBS,
+};
+
+static struct option long_options[] = {
+  { "size", required_argument, 0, 0 },
+  { "limit", required_argument, 0, 0 },
+  { "dict", required_argument, 0, 0 },
+  { "threads", required_argument, 0, 0 },
+  { "strategy", required_argument, 0, 0 },
+  { "sample", required_argument, 0, 0 },
+  { "depth", required_argument, 0, 0 },
+  { "budget", required_argument, 0, 0 },
+  { "decisions", required_argument, 0, 0 },
+  { "answer", required_argument, 0, 0 },
+  { "answers", required_argument, 0, 0 },
+  { "batch", required_argument, 0, 0 },
+  { "jobs", required_argument, 0, 0 },
+  { 0, 0, 0, 0 },
+};
+
+struct options {
+  uint32_t sz;
+  uint32_t limit;
+  const char *dict;
+  uint32_t nr_thread;
+  enum strategy strategy;
+  uint32_t sample;
+  uint32_t depth;
+  uint32_t budget; /* ms */
+  const char *decisions; /* NULL: none */
+  const char *answer; /* NULL: sweep */
+  uint64_t nr_answer; /* answers of the sweep, evenly spaced (0: all) */
+  const char *batch;
+  uint32_t nr_job;
+};
+
+static void options_parse(int argc, char **argv, struct options *opts)
+{
+  opts->sz = DEFAULT_SIZE;
+  opts->limit = 0;
+  opts->dict = NULL;
+  opts->nr_thread = 1;
+  opts->strategy = STRATEGY_VARIANCE;
+  opts->sample = DEFAULT_SAMPLE;
+  opts->depth = 0;
+  opts->budget = 0;
+  opts->decisions = NULL;
+  opts->answer = NULL;
+  opts->nr_answer = 0;
+  opts->batch = NULL;
+  opts->nr_job = 1;
+
+  while (true) {
+    int option_index = 0;
+    int c = getopt_long(argc, argv, "", long_options, &option_index);
+    if (c == -1) {
+      break;
+    }
+    switch (option_index) {
+      case CASE_SIZE:
+        opts->sz = atoi(optarg);
+        break;
+      case CASE_LIMIT:
+        opts->limit = atoi(optarg);
+        break;
+      case CASE_DICT:
+        opts->dict = optarg;
+        break;
+      case CASE_THREADS:
+        opts->nr_thread = atoi(optarg);
+        break;
+      case CASE_STRATEGY:
+        opts->strategy = score_parse_strategy(optarg);
+        break;
+      case CASE_SAMPLE:
+        opts->sample = atoi(optarg);
+        break;
+      case CASE_DEPTH:
+        opts->depth = atoi(optarg);
+        break;
+      case CASE_BUDGET:
+        opts->budget = atoi(optarg);
+        break;
+      case CASE_DECISIONS:
+        opts->decisions = optarg;
+        break;
+      case CASE_ANSWER:
+        opts->answer = optarg;
+        break;
+      case CASE_ANSWERS:
+        opts->nr_answer = strtoull(optarg, NULL, 10);
+        break;
+      case CASE_BATCH:
+        opts->batch = optarg;
+        break;
+      case CASE_JOBS:
+        opts->nr_job = atoi(optarg);
+        break;
+    }
+  }
+}
+
+/**
+ * Destroy the nerdle, its transposition table and its decisions.
+ */
+static void release(struct nerdle *nerdle)
+{
+  struct decisions *decisions = nerdle->decisions;
+
+  if (nerdle->cache != NULL) {
+    search_cache_dump(nerdle->cache);
+    search_cache_destroy(nerdle->cache);
+  }
+  nerdle_destroy(nerdle);
+  if (decisions != NULL) {
+    decision_dump(decisions);
+    decision_close(decisions);
+  }
+}
+
+static void dump_game(const struct sim_game *game, uint32_t sz)
+{
+  struct equation eq;
+  char str[LIMIT_MAX_EQ_SZ];
+
+  equation_unpack(game->answer, &eq, sz);
+  utils_eq_to_str(&eq, str, sz);
+  printf("[nerdle] answer %.*s: %s in %u rounds\n", sz, str,
+         game->won == true ? "won" : "lost", game->nr_round);
+}
+
+static uint64_t pack_str(const char *str, uint32_t sz)
+{
+  struct equation eq = { .sz = sz };
+  utils_str_to_eq(str, &eq, sz);
+  return equation_pack(&eq);
+}
+
+/**
+ * Parse a line of a batch: hidden equation or transcript.
+ */
+static bool parse_game(char *line, uint32_t sz, struct batch_game *game)
+{
+  char *saveptr = NULL;
+  enum status status[LIMIT_MAX_EQ_SZ];
+
+  memset(game, 0, sizeof(*game));
+  for (char *tok = strtok_r(line, " \t\n", &saveptr); tok != NULL;
+       tok = strtok_r(NULL, " \t\n", &saveptr)) {
+    char *feedback = strchr(tok, ':');
+    if (feedback == NULL) {
+      if (strlen(tok) != sz || game->nr_guess != 0) {
+        return false;
+      }
+      game->game.answer = pack_str(tok, sz);
+      return true;
+    }
+    if (feedback - tok != sz || strlen(feedback + 1) != sz ||
+        game->nr_guess == SIM_MAX_ROUND ||
+        feedback_from_str(feedback + 1, sz, status) == false) {
+      return false;
+    }
+    game->guesses[game->nr_guess] = pack_str(tok, sz);
+    game->patterns[game->nr_guess++] = feedback_from_status(status, sz);
+  }
+  return game->nr_guess != 0;
+}
+
+static int run_batch(const struct nerdle *nerdle, const struct options *opts)
+{
+  FILE *file = fopen(opts->batch, "r");
+  if (file == NULL) {
+    perror("[nerdle] batch");
+    return 1;
+  }
+
+  struct batch_game *games = NULL;
+  uint64_t nr = 0;
+  uint64_t nr_line = 0;
+  char *line = NULL;
+  size_t line_sz = 0;
+  while (getline(&line, &line_sz, file) > 0) {
+    ++nr_line;
+    if (line[0] == '\n' || line[0] == '#') {
+      continue;
+    }
+    games = realloc(games, (nr + 1) * sizeof(*games));
+    if (parse_game(line, opts->sz, &games[nr]) == false) {
+      printf("[nerdle] batch: invalid line %lu\n", nr_line);
+      continue;
+    }
+    ++nr;
+  }
+  free(line);
+  fclose(file);
+
+  printf("[nerdle] batch: %lu games, %u jobs\n", nr, opts->nr_job);
+  batch_solve(nerdle, games, nr, opts->nr_job);
+
+  struct sim_stats stats;
+  memset(&stats, 0, sizeof(stats));
+  for (uint64_t i = 0; i < nr; ++i) {
+    const struct batch_game *game = &games[i];
+    if (game->nr_guess == 0) {
+      sim_stats_add(&stats, &game->game);
+      continue;
+    }
+    struct equation eq;
+    char str[LIMIT_MAX_EQ_SZ];
+    equation_unpack(game->next, &eq, opts->sz);
+    utils_eq_to_str(&eq, str, opts->sz);
+    printf("[nerdle] game %lu: next %.*s\n", i,
+           game->found == true ? opts->sz : 4,
+           game->found == true ? str : "none");
+  }
+  if (stats.nr_game != 0) {
+    sim_stats_dump(&stats);
+  }
+
+  free(games);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  struct options opts;
+  struct sim_stats stats;
+  struct sim_game game;
+
+  options_parse(argc, argv, &opts);
+  if (opts.sz < LIMIT_MIN_EQ_SZ || opts.sz > LIMIT_MAX_EQ_SZ ||
+      (opts.answer != NULL && strlen(opts.answer) != opts.sz)) {
+    printf("[nerdle] invalid size %u\n", opts.sz);
+    return 1;
+  }
+
+  struct nerdle *nerdle = nerdle_create(opts.sz, opts.limit);
+  nerdle->nr_thread = opts.nr_thread;
+  nerdle->strategy = opts.strategy;
+  nerdle->sample = opts.sample;
+  nerdle->depth = opts.depth;
+  nerdle->budget = opts.budget / 1000.0;
+  if (opts.dict != NULL) {
+    if (nerdle_load_equations(nerdle, opts.dict) == false) {
+      nerdle_destroy(nerdle);
+      return 1;
+    }
+  } else {
+    nerdle_generate_equations(nerdle);
+  }
+  /* the games share the results of the search */
+  if (opts.depth > 0) {
+    nerdle->cache = search_cache_create(SEARCH_CACHE_BIT);
+  }
+  if (opts.decisions != NULL &&
+      nerdle_open_decisions(nerdle, opts.decisions) == NULL) {
+    release(nerdle);
+    return 1;
+  }
+
+  if (opts.batch != NULL) {
+    int ret = run_batch(nerdle, &opts);
+    release(nerdle);
+    return ret;
+  }
+
+  /* the games share the table of the candidates */
+  nerdle_get_table(nerdle);
+  memset(&stats, 0, sizeof(stats));
+  if (opts.answer != NULL) {
+    struct equation eq = { .sz = opts.sz };
+    utils_str_to_eq(opts.answer, &eq, opts.sz);
+    game.answer = equation_pack(&eq);
+    sim_play(nerdle, &game);
+    sim_stats_add(&stats, &game);
+    dump_game(&game, opts.sz);
+  } else {
+    uint64_t nr = nerdle->candidates.nr;
+    uint64_t step = 1;
+    if (opts.nr_answer != 0 && opts.nr_answer < nr) {
+      step = nr / opts.nr_answer;
+    }
+    for (uint64_t i = 0; i < nr; i += step) {
+      game.answer = nerdle->candidates.eqs[i];
+      sim_play(nerdle, &game);
+      sim_stats_add(&stats, &game);
+      if (game.won == false || game.nr_round > MAX_NR_ROUND) {
+        dump_game(&game, opts.sz);
+      }
+    }
+  }
+  sim_stats_dump(&stats);
+
+  release(nerdle);
+  return 0;
+}
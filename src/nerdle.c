@@ -2,9 +2,15 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <pthread.h>
 
 #include "nerdle.h"
 #include "utils.h"
+#include "dict.h"
+#include "feedback.h"
+#include "opening.h"
+
+static const struct kernels* nerdle_get_kernels(uint32_t sz);
 
 struct nerdle* nerdle_create(uint32_t sz, uint32_t limit)
 {
@@ -13,12 +19,23 @@ struct nerdle* nerdle_create(uint32_t sz, uint32_t limit)
 
   assert(sz >= LIMIT_MIN_EQ_SZ && sz <= LIMIT_MAX_EQ_SZ);
 
-  struct nerdle *nerdle = calloc(1, sizeof(*nerdle));
+  struct arena arena;
+  arena_init(&arena, 0);
+  struct nerdle *nerdle = arena_calloc(&arena, sizeof(*nerdle));
+  nerdle->arena = arena;
+  arena_init(&nerdle->scratch, 0);
   nerdle->sz = sz;
   nerdle->limit = limit;
+  nerdle->nr_thread = 1;
+  nerdle->strategy = STRATEGY_VARIANCE;
+  nerdle->sample = DEFAULT_SAMPLE;
+  nerdle->verbose = true;
+  nerdle->kernels = nerdle_get_kernels(sz);
 
   for (s = 0; s < SYMBOL_END; ++s) {
     nerdle->status[s] = UNKNOWN;
+    nerdle->min[s] = 0;
+    nerdle->max[s] = sz;
   }
   for (p = 0; p < LIMIT_MAX_EQ_SZ; ++p) {
     nerdle->right[p] = SYMBOL_END;
@@ -30,43 +47,94 @@ struct nerdle* nerdle_create(uint32_t sz, uint32_t limit)
   return nerdle;
 }
 
-void nerdle_destroy(struct nerdle *nerdle)
+/**
+ * Drop the table and the view (the candidates changed),
+ * the bitset of the view stays in the arena of the game.
+ */
+static void nerdle_reset_table(struct nerdle *nerdle)
 {
-  struct candidate *candidate = nerdle->candidates;
+  if (nerdle->table == NULL) {
+    return;
+  }
+  view_release(&nerdle->view);
+  if (nerdle->own_table == true) {
+    table_destroy((struct table*)nerdle->table);
+  }
+  nerdle->table = NULL;
+  nerdle->own_table = false;
+}
 
-  while (candidate != NULL) {
-    struct candidate *next = candidate->next;
-    free(candidate);
-    candidate = next;
+/**
+ * Build the table of the candidates if needed, all the candidates alive.
+ */
+static void nerdle_build_table(struct nerdle *nerdle)
+{
+  if (nerdle->table != NULL) {
+    return;
   }
-  free(nerdle);
+  nerdle->table = table_create(nerdle->sz, nerdle->candidates.eqs,
+                               nerdle->candidates.nr);
+  nerdle->own_table = true;
+  view_init_arena(&nerdle->view, nerdle->table, &nerdle->arena);
 }
 
-static struct candidate* nerdle_candidate_new(struct equation *eq)
+void nerdle_destroy(struct nerdle *nerdle)
 {
-  struct candidate *candidate = calloc(1, sizeof(*candidate));
-  candidate->eq = *eq;
-  return candidate;
+  struct arena arena = nerdle->arena;
+
+  nerdle_reset_table(nerdle);
+  if (nerdle->candidates.max != 0) {
+    free(nerdle->candidates.eqs);
+  }
+  if (nerdle->dict != NULL) {
+    dict_close(nerdle->dict);
+  }
+  arena_release(&nerdle->scratch);
+  /* the nerdle is in its arena */
+  arena_release(&arena);
 }
 
-static void nerdle_candidate_insert_head(struct nerdle *nerdle, struct candidate *candidate)
+/**
+ * Initial number of candidates allocated.
+ */
+#define NR_CANDIDATE_MIN 1024
+
+/**
+ * Allocate room for at least @c nr candidates.
+ */
+static void candidates_reserve(struct candidates *candidates, uint64_t nr)
 {
-  candidate->next = nerdle->candidates;
-  if (nerdle->candidates != NULL) {
-    nerdle->candidates->prev = candidate;
+  if (nr <= candidates->max) {
+    return;
+  }
+  if (candidates->max == 0) {
+    /* the equations of a dictionary are not copied */
+    candidates->eqs = NULL;
+    candidates->max = NR_CANDIDATE_MIN;
   }
-  nerdle->candidates = candidate;
+  while (candidates->max < nr) {
+    candidates->max *= 2;
+  }
+  candidates->eqs = realloc(candidates->eqs, candidates->max * sizeof(uint64_t));
+  assert(candidates->eqs != NULL);
 }
 
-static bool nerdle_candidate_add(struct nerdle *nerdle, struct equation *eq)
+/**
+ * Append equations packed to the candidates, up to the limit.
+ * Return false when the limit is reached.
+ */
+static bool candidates_append(struct candidates *candidates,
+                              const uint64_t *eqs, uint64_t nr, uint32_t limit)
 {
-  struct candidate *candidate = nerdle_candidate_new(eq);
-  nerdle_candidate_insert_head(nerdle, candidate);
-  ++nerdle->nr_candidate;
-  if (nerdle->limit != 0 && nerdle->nr_candidate == nerdle->limit) {
-    return false;
+  if (limit != 0 && candidates->nr + nr >= limit) {
+    nr = candidates->nr < limit ? limit - candidates->nr : 0;
   }
-  return true;
+  if (nr > 0) {
+    candidates_reserve(candidates, candidates->nr + nr);
+    memcpy(&candidates->eqs[candidates->nr], eqs, nr * sizeof(uint64_t));
+    candidates->nr += nr;
+  }
+  return limit == 0 || candidates->nr < limit;
 }
 
 /**
@@ -74,7 +142,7 @@ static bool nerdle_candidate_add(struct nerdle *nerdle, struct equation *eq)
  *  + Not discarded.
  *  + At the right position if needed.
  */
-static bool nerdle_check_symbol(struct nerdle *nerdle, enum symbol symbol, uint32_t pos)
+static bool nerdle_check_symbol(const struct nerdle *nerdle, enum symbol symbol, uint32_t pos)
 {
   if (nerdle->status[symbol] == DISCARDED) {
     return false;
@@ -89,28 +157,58 @@ static bool nerdle_check_symbol(struct nerdle *nerdle, enum symbol symbol, uint3
   return true;
 }
 
-void nerdle_update_status(struct nerdle *nerdle, enum status status,
-                          const struct equation *eq, uint32_t pos)
+void nerdle_update_feedback(struct nerdle *nerdle, const struct equation *eq,
+                            const enum status *status)
 {
-  enum symbol symbol = eq->symbols[pos];
+  uint8_t colored[SYMBOL_END] = { 0 };
+  bool discarded[SYMBOL_END] = { false };
 
-  switch (status) {
-    case DISCARDED:
-      if (nerdle->status[symbol] == UNKNOWN) {
-        nerdle->status[symbol] = DISCARDED;
-      }
-      break;
-    case WRONG:
-      nerdle->status[symbol] = WRONG;
-      nerdle->wrong[pos][symbol] = true;
-      break;
-    case RIGHT:
-      nerdle->status[symbol] = RIGHT;
-      nerdle->right[pos] = symbol;
-      break;
-    default:
-      ;
+  if (nerdle->nr_feedback++ == 0) {
+    nerdle->first_guess = equation_pack(eq);
+    nerdle->first_pattern = feedback_from_status(status, nerdle->sz);
+  }
+  uint64_t history[3] = {
+    nerdle->history, equation_pack(eq), feedback_from_status(status, nerdle->sz),
   };
+  nerdle->history = dict_checksum(history, 3);
+
+  for (uint32_t pos = 0; pos < nerdle->sz; ++pos) {
+    enum symbol symbol = eq->symbols[pos];
+    switch (status[pos]) {
+      case DISCARDED:
+        discarded[symbol] = true;
+        nerdle->wrong[pos][symbol] = true;
+        break;
+      case WRONG:
+        ++colored[symbol];
+        nerdle->wrong[pos][symbol] = true;
+        if (nerdle->status[symbol] != RIGHT) {
+          nerdle->status[symbol] = WRONG;
+        }
+        break;
+      case RIGHT:
+        ++colored[symbol];
+        nerdle->right[pos] = symbol;
+        nerdle->status[symbol] = RIGHT;
+        break;
+      default:
+        ;
+    };
+  }
+
+  /* The symbol is at least as many times as its locations colored,
+     exactly as many times if one of its locations is DISCARDED. */
+  for (enum symbol symbol = 0; symbol < SYMBOL_END; ++symbol) {
+    if (colored[symbol] > nerdle->min[symbol]) {
+      nerdle->min[symbol] = colored[symbol];
+    }
+    if (discarded[symbol] == true && colored[symbol] < nerdle->max[symbol]) {
+      nerdle->max[symbol] = colored[symbol];
+    }
+    if (nerdle->max[symbol] == 0) {
+      nerdle->status[symbol] = DISCARDED;
+    }
+  }
 }
 
 static char symbol_to_char(enum symbol symbol)
@@ -175,6 +273,18 @@ static void dump_status_wrong(const struct nerdle *nerdle)
   printf("]\n");
 }
 
+static void dump_status_counts(const struct nerdle *nerdle)
+{
+  printf("[nerdle] counts [");
+  for (enum symbol symbol = 0; symbol < SYMBOL_END; ++symbol) {
+    if (nerdle->min[symbol] != 0 || nerdle->max[symbol] != nerdle->sz) {
+      printf("{%c:%u-%u}, ", symbol_to_char(symbol),
+             nerdle->min[symbol], nerdle->max[symbol]);
+    }
+  }
+  printf("]\n");
+}
+
 static void dump_status_discarded(const struct nerdle *nerdle)
 {
   printf("[nerdle] discarded [");
@@ -191,163 +301,602 @@ void nerdle_dump_status(const struct nerdle *nerdle)
   dump_status_status(nerdle);
   dump_status_right(nerdle);
   dump_status_wrong(nerdle);
+  dump_status_counts(nerdle);
   dump_status_discarded(nerdle);
 }
 
-static bool nerdle_generate_equations_rec(struct nerdle *nerdle,
-                                          struct equation *eq,
-                                          uint32_t position)
+
+/**
+ * Lower bound of the left-hand side value after @c nr more symbols.
+ * Within an equation, operands are too small to overflow, the value
+ * is real (signed). The bound relies on:
+ *  + a chain of divisions is an integer >= 1.
+ *  + nr symbols cannot shrink an operand by more than 10^(nr - 1).
+ *  + nr symbols cannot subtract more than 10^(nr - 1).
+ * Return false if there is no bound (the current term is subtracted).
+ */
+static bool nerdle_lower_bound(const struct evaluation *ev, uint32_t nr,
+                               int64_t *bound)
 {
-  if (position == nerdle->sz) {
-    if (equation_check_semantic(eq) == true &&  equation_check_equality(eq) == true) {
-      if (nerdle_candidate_add(nerdle, eq) == false) {
-        return false;
-      }
+  static const int64_t pow10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,
+    100000000, 1000000000, 10000000000,
+  };
+  int64_t shrink = nr > 0 ? pow10[nr - 1] : 1;
+  int64_t term;
+
+  if (ev->add == SYMBOL_MINUS) {
+    if (ev->digit == true || ev->mul != SYMBOL_END) {
+      return false;
     }
+    /* The next term and the rest are subtracted. */
+    *bound = (int32_t)ev->sum - pow10[nr];
     return true;
   }
 
-  for (uint32_t i = SYMBOL_0; i < SYMBOL_END; ++i) {
-    if (nerdle_check_symbol(nerdle, i, position) == false) {
-      continue;
-    }
-    if (equation_add_symbol(eq, i, position) == true) {
-      if (nerdle_generate_equations_rec(nerdle, eq, position + 1) == false) {
-        return false;
-      }
-    }
+  int64_t chain = ev->digit == true ? ev->operand / shrink : 1;
+  if (chain == 0) {
+    chain = 1;
   }
+  switch (ev->mul) {
+    case SYMBOL_DIV:
+      term = ev->product;
+      break;
+    case SYMBOL_MULT:
+      term = (int64_t)ev->product * ev->quotient * chain;
+      break;
+    default:
+      term = chain;
+  };
 
+  *bound = (int32_t)ev->sum + term - (nr > 1 ? shrink : 0);
   return true;
 }
-
-void nerdle_generate_equations(struct nerdle *nerdle)
+/**
+ * Context of a generation: the equations are written to a chunk,
+ * visited when full (@c nerdle_visitor_t).
+ * With bounds of the number of occurrences (a regeneration during a
+ * game), the symbols placed are counted along the branch and @c need
+ * symbols are still required by the lower bounds.
+ */
+struct generation {
+  struct nerdle *nerdle;
+  uint64_t *chunk;
+  uint64_t nr;
+  uint64_t max;
+  nerdle_visitor_t visit;
+  void *arg;
+  bool counts;
+  uint8_t count[SYMBOL_END];
+  uint32_t need;
+};
+
+static void generation_init(struct generation *gen, struct nerdle *nerdle,
+                            uint64_t *chunk, uint64_t max,
+                            nerdle_visitor_t visit, void *arg)
 {
-  struct equation eq = { .sz = nerdle->sz };
-
-  /* Optimization: only try the branchs starting [1-9]
-     Reducing the number of initial branches of the tree */
-  for (uint32_t i = SYMBOL_1; i <= SYMBOL_9; ++i) {
-    eq.symbols[0] = i;
-    if (nerdle_check_symbol(nerdle, i, 0) == false) {
-      continue;
-    }
-    if (nerdle_generate_equations_rec(nerdle, &eq, 1) == false) {
-      break;
+  memset(gen, 0, sizeof(*gen));
+  gen->nerdle = nerdle;
+  gen->chunk = chunk;
+  gen->max = max;
+  gen->visit = visit;
+  gen->arg = arg;
+  for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+    if (nerdle->min[s] != 0 || nerdle->max[s] < nerdle->sz) {
+      gen->counts = true;
     }
   }
-  printf("[nerdle] generate %lu equations (limit:%u)\n",
-         nerdle->nr_candidate, nerdle->limit);
 }
 
-static void nerdle_generate_best_variance_equations_rec(struct nerdle *nerdle,
-                                                        struct equation *eq,
-                                                        uint32_t position)
+/**
+ * Visit the equations of the chunk.
+ * Return false when the visitor stops the generation.
+ */
+static bool generation_flush(struct generation *gen)
 {
-  if (position == nerdle->sz) {
-    if (equation_check_semantic(eq) == true &&  equation_check_equality(eq) == true) {
+  uint64_t nr = gen->nr;
 
-      if (equation_get_variance(eq) == nerdle->sz) {
-        char str[LIMIT_MAX_EQ_SZ];
-        utils_eq_to_str(eq, str, nerdle->sz);
-        printf("%.*s\n", nerdle->sz, str);
-      }
-    }
+  gen->nr = 0;
+  return nr == 0 || gen->visit(gen->arg, gen->chunk, nr);
+}
+
+/**
+ * Add an equation packed to the chunk.
+ * Return false when the visitor stops the generation.
+ */
+static inline bool generation_add(struct generation *gen, uint64_t eq)
+{
+  gen->chunk[gen->nr++] = eq;
+  return gen->nr < gen->max || generation_flush(gen);
+}
+
+/**
+ * Optimization: only try the branchs starting [1-9]
+ * Reducing the number of initial branches of the tree.
+ * The top branches are indexed by their first two symbols.
+ */
+#define NR_TOP_BRANCH ((SYMBOL_9 - SYMBOL_1 + 1) * SYMBOL_END)
+
+/* warning: template include, one kernel by size */
+#define KERNEL_SZ 5
+#define KERNEL_SUFFIX 5
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 6
+#define KERNEL_SUFFIX 6
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 7
+#define KERNEL_SUFFIX 7
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 8
+#define KERNEL_SUFFIX 8
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 9
+#define KERNEL_SUFFIX 9
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 10
+#define KERNEL_SUFFIX 10
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 11
+#define KERNEL_SUFFIX 11
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ 12
+#define KERNEL_SUFFIX 12
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+#define KERNEL_SZ (nerdle->sz)
+#define KERNEL_SUFFIX generic
+#include "generate_kernel.h"
+#undef KERNEL_SUFFIX
+#undef KERNEL_SZ
+
+/**
+ * Kernels specialized for a size (@c nerdle_create).
+ */
+struct kernels {
+  bool (*generate_top_branch)(struct generation *gen, uint32_t branch);
+};
+
+static const struct kernels kernels[LIMIT_MAX_EQ_SZ + 1] = {
+  [5] = { nerdle_generate_top_branch_5 },
+  [6] = { nerdle_generate_top_branch_6 },
+  [7] = { nerdle_generate_top_branch_7 },
+  [8] = { nerdle_generate_top_branch_8 },
+  [9] = { nerdle_generate_top_branch_9 },
+  [10] = { nerdle_generate_top_branch_10 },
+  [11] = { nerdle_generate_top_branch_11 },
+  [12] = { nerdle_generate_top_branch_12 },
+};
+
+static const struct kernels kernels_generic = {
+  nerdle_generate_top_branch_generic,
+};
+
+static const struct kernels* nerdle_get_kernels(uint32_t sz)
+{
+  return &kernels[sz];
+}
+
+void nerdle_set_generic_kernels(struct nerdle *nerdle)
+{
+  nerdle->kernels = &kernels_generic;
+}
+
+/**
+ * Number of equations of a chunk of a generation.
+ */
+#define NR_CHUNK 1024
+
+/**
+ * Visitor appending the equations to candidates (@c candidates_append).
+ */
+struct appender {
+  struct candidates *candidates;
+  uint32_t limit;
+};
+
+static bool nerdle_append_visitor(void *arg, const uint64_t *eqs, uint64_t nr)
+{
+  struct appender *appender = arg;
+  return candidates_append(appender->candidates, eqs, nr, appender->limit);
+}
+
+/**
+ * Worker of a parallel generation.
+ * Each top branch is generated in its own array of candidates, up to the
+ * limit, and no more branch is scheduled once the branches generated in
+ * order reach the limit.
+ */
+struct worker {
+  struct nerdle *nerdle;
+  struct candidates *branches;
+  uint32_t next; /* next top branch to generate */
+  pthread_mutex_t lock;
+  bool done[NR_TOP_BRANCH];
+  uint32_t nr_merged; /* first branches generated */
+  uint64_t nr;        /* equations of the first branches generated */
+};
+
+/**
+ * Mark a top branch as generated, and stop the scheduling if the first
+ * branches generated reach the limit.
+ */
+static void nerdle_generate_done(struct worker *worker, uint32_t branch)
+{
+  uint32_t limit = worker->nerdle->limit;
+
+  if (limit == 0) {
     return;
   }
+  pthread_mutex_lock(&worker->lock);
+  worker->done[branch] = true;
+  while (worker->nr_merged < NR_TOP_BRANCH &&
+         worker->done[worker->nr_merged] == true) {
+    worker->nr += worker->branches[worker->nr_merged++].nr;
+  }
+  if (worker->nr >= limit) {
+    __atomic_store_n(&worker->next, NR_TOP_BRANCH, __ATOMIC_RELAXED);
+  }
+  pthread_mutex_unlock(&worker->lock);
+}
+
+static void* nerdle_generate_worker(void *arg)
+{
+  struct worker *worker = arg;
+  uint64_t chunk[NR_CHUNK];
+  uint32_t branch;
+
+  while ((branch = __atomic_fetch_add(&worker->next, 1, __ATOMIC_RELAXED))
+         < NR_TOP_BRANCH) {
+    struct appender appender = { &worker->branches[branch],
+                                 worker->nerdle->limit };
+    struct generation gen;
+    generation_init(&gen, worker->nerdle, chunk, NR_CHUNK,
+                    nerdle_append_visitor, &appender);
+    worker->nerdle->kernels->generate_top_branch(&gen, branch);
+    generation_flush(&gen);
+    nerdle_generate_done(worker, branch);
+  }
+  return NULL;
+}
+
+static void nerdle_generate_parallel(struct nerdle *nerdle)
+{
+  struct candidates branches[NR_TOP_BRANCH] = {};
+  struct worker worker = { .nerdle = nerdle, .branches = branches };
+  pthread_t *threads = calloc(nerdle->nr_thread, sizeof(*threads));
+
+  pthread_mutex_init(&worker.lock, NULL);
+
+  uint32_t nr_created = 0;
+  while (nr_created < nerdle->nr_thread &&
+         pthread_create(&threads[nr_created], NULL, nerdle_generate_worker,
+                        &worker) == 0) {
+    ++nr_created;
+  }
+  /* no thread created: serial */
+  if (nr_created == 0) {
+    nerdle_generate_worker(&worker);
+  }
+  for (uint32_t i = 0; i < nr_created; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+  pthread_mutex_destroy(&worker.lock);
+
+  /* Merge the branches in order, up to the limit. */
+  for (uint32_t i = 0; i < NR_TOP_BRANCH; ++i) {
+    candidates_append(&nerdle->candidates, branches[i].eqs, branches[i].nr,
+                      nerdle->limit);
+    free(branches[i].eqs);
+  }
+}
+
+bool nerdle_enumerate_equations(struct nerdle *nerdle, uint64_t *chunk,
+                                uint64_t nr_chunk, nerdle_visitor_t visit,
+                                void *arg)
+{
+  struct generation gen;
 
-  for (uint32_t i = SYMBOL_0; i < SYMBOL_END; ++i) {
-    if (nerdle_check_symbol(nerdle, i, position) == false) {
-      continue;
+  assert(nr_chunk > 0);
+  generation_init(&gen, nerdle, chunk, nr_chunk, visit, arg);
+  for (uint32_t i = 0; i < NR_TOP_BRANCH; ++i) {
+    if (nerdle->kernels->generate_top_branch(&gen, i) == false) {
+      return false;
     }
-    if (equation_add_symbol(eq, i, position) == true) {
-      nerdle_generate_best_variance_equations_rec(nerdle, eq, position + 1);
+  }
+  return generation_flush(&gen);
+}
+
+void nerdle_generate_equations(struct nerdle *nerdle)
+{
+  nerdle_reset_table(nerdle);
+  if (nerdle->nr_thread > 1) {
+    nerdle_generate_parallel(nerdle);
+  } else {
+    struct appender appender = { &nerdle->candidates, nerdle->limit };
+    uint64_t chunk[NR_CHUNK];
+    nerdle_enumerate_equations(nerdle, chunk, NR_CHUNK,
+                               nerdle_append_visitor, &appender);
+  }
+  if (nerdle->nr_feedback == 0) {
+    nerdle->nr_dict = nerdle->candidates.nr;
+  }
+  if (nerdle->verbose == true) {
+    printf("[nerdle] generate %lu equations (limit:%u, threads:%u)\n",
+           nerdle->candidates.nr, nerdle->limit, nerdle->nr_thread);
+  }
+}
+
+/**
+ * Visitor printing the equations of the best variance.
+ */
+static bool nerdle_best_variance_visitor(void *arg, const uint64_t *eqs,
+                                         uint64_t nr)
+{
+  const struct nerdle *nerdle = arg;
+  struct equation eq;
+  char str[LIMIT_MAX_EQ_SZ];
+
+  for (uint64_t i = 0; i < nr; ++i) {
+    if (equation_packed_get_variance(eqs[i], nerdle->sz) == nerdle->sz) {
+      equation_unpack(eqs[i], &eq, nerdle->sz);
+      utils_eq_to_str(&eq, str, nerdle->sz);
+      printf("%.*s\n", nerdle->sz, str);
     }
   }
+  return true;
 }
 
 void nerdle_generate_best_variance_equations(struct nerdle *nerdle)
 {
-  struct equation eq = { .sz = nerdle->sz };
+  uint64_t chunk[NR_CHUNK];
 
-  for (uint32_t i = SYMBOL_1; i <= SYMBOL_9; ++i) {
-    eq.symbols[0] = i;
-    if (nerdle_check_symbol(nerdle, i, 0) == false) {
-      continue;
-    }
-    nerdle_generate_best_variance_equations_rec(nerdle, &eq, 1);
+  nerdle_enumerate_equations(nerdle, chunk, NR_CHUNK,
+                             nerdle_best_variance_visitor, nerdle);
+}
+
+void nerdle_set_equations(struct nerdle *nerdle, const uint64_t *eqs, uint64_t nr)
+{
+  if (nerdle->limit != 0 && nr > nerdle->limit) {
+    nr = nerdle->limit;
+  }
+  nerdle_reset_table(nerdle);
+  candidates_reserve(&nerdle->candidates, nr);
+  memcpy(nerdle->candidates.eqs, eqs, nr * sizeof(uint64_t));
+  nerdle->candidates.nr = nr;
+  nerdle->nr_dict = nr;
+}
+
+void nerdle_set_table(struct nerdle *nerdle, const struct table *table)
+{
+  assert(table->sz == nerdle->sz);
+  nerdle_reset_table(nerdle);
+  nerdle->table = table;
+  nerdle->nr_dict = table->nr;
+  view_init_arena(&nerdle->view, table, &nerdle->arena);
+}
+
+const struct table* nerdle_get_table(struct nerdle *nerdle)
+{
+  nerdle_build_table(nerdle);
+  return nerdle->table;
+}
+
+bool nerdle_load_equations(struct nerdle *nerdle, const char *path)
+{
+  struct dict *dict = dict_open(path);
+  if (dict == NULL) {
+    return false;
+  }
+  if (dict->header->sz != nerdle->sz) {
+    printf("[nerdle] dictionary '%s' of size %u (expected:%u)\n",
+           path, dict->header->sz, nerdle->sz);
+    dict_close(dict);
+    return false;
   }
+
+  uint64_t nr = dict->header->nr;
+  if (nerdle->limit != 0 && nr > nerdle->limit) {
+    nr = nerdle->limit;
+  }
+  nerdle_reset_table(nerdle);
+  if (nerdle->candidates.max != 0) {
+    free(nerdle->candidates.eqs);
+  }
+  if (nerdle->dict != NULL) {
+    dict_close(nerdle->dict);
+  }
+  nerdle->dict = dict;
+  nerdle->candidates.eqs = (uint64_t*)dict->eqs;
+  nerdle->candidates.nr = nr;
+  nerdle->candidates.max = 0;
+  nerdle->nr_dict = nr;
+
+  if (nerdle->verbose == true) {
+    printf("[nerdle] load %lu equations (limit:%u)\n",
+           nerdle->candidates.nr, nerdle->limit);
+  }
+  return true;
 }
 
 /* warning: singleton include */
 #include "first_equations.h"
 
+void nerdle_get_constraints(const struct nerdle *nerdle,
+                            struct constraints *constraints)
+{
+  memset(constraints, 0, sizeof(*constraints));
+  constraints->sz = nerdle->sz;
+
+  for (uint32_t pos = 0; pos < nerdle->sz; ++pos) {
+    for (enum symbol symbol = 0; symbol < SYMBOL_END; ++symbol) {
+      if (nerdle_check_symbol(nerdle, symbol, pos) == true) {
+        constraints->allowed[pos] |= 1 << symbol;
+      }
+    }
+  }
+
+  /* A symbol is at least as many times as its right positions. */
+  memcpy(constraints->min, nerdle->min, sizeof(constraints->min));
+  memcpy(constraints->max, nerdle->max, sizeof(constraints->max));
+  uint8_t nr_right[SYMBOL_END] = { 0 };
+  for (uint32_t pos = 0; pos < nerdle->sz; ++pos) {
+    enum symbol symbol = nerdle->right[pos];
+    if (symbol != SYMBOL_END && ++nr_right[symbol] > constraints->min[symbol]) {
+      constraints->min[symbol] = nr_right[symbol];
+    }
+  }
+}
+
+void nerdle_check_candidates(struct nerdle *nerdle)
+{
+  struct constraints constraints;
+
+  nerdle_build_table(nerdle);
+  uint64_t nr_candidate_before = nerdle->view.nr_alive;
+  nerdle_get_constraints(nerdle, &constraints);
+  view_filter(&nerdle->view, &constraints);
+  if (nerdle->verbose == true) {
+    printf("[nerdle] remove %lu candidates, %lu candidates remaining\n",
+           nr_candidate_before - nerdle->view.nr_alive, nerdle->view.nr_alive);
+  }
+}
+
 /**
- * Remove a candidate from the list of candidate.
+ * Get the number of equations of the dictionary of the game, generated
+ * on demand: all the equations of the size (@c opening_get).
  */
-static void remove_candidate(struct nerdle *nerdle, struct candidate *candidate)
+static uint64_t nerdle_get_nr_dict(const struct nerdle *nerdle)
 {
-  if (candidate->prev == NULL) { /* head */
-    nerdle->candidates = candidate->next;
-  } else {
-    candidate->prev->next = candidate->next;
-  }
-  if (candidate->next != NULL) {
-    candidate->next->prev = candidate->prev;
+  const struct opening *opening = opening_get(nerdle->sz);
+
+  if (nerdle->nr_dict == 0 && nerdle->limit == 0 && opening != NULL) {
+    return opening->nr_eq;
   }
-  free(candidate);
-  --nerdle->nr_candidate;
+  return nerdle->nr_dict;
 }
 
 /**
- * Check if a candidate doesn't respect the status, in this case remove it
- * from the lsit of candidate.
+ * Find the second guess of the opening among the candidates alive.
+ * Return false if not applicable.
  */
-static struct candidate*
-check_candidate(struct nerdle *nerdle, struct candidate *candidate)
-{
-  for (unsigned i = 0; i < nerdle->sz; ++i) {
-    if (nerdle_check_symbol(nerdle, candidate->eq.symbols[i], i) == false) {
-      struct candidate *next = candidate->next;
-      remove_candidate(nerdle, candidate);
-      return next;
+static bool nerdle_find_opening(const struct nerdle *nerdle,
+                                const uint64_t *eqs, uint64_t nr,
+                                uint64_t *index)
+{
+  const struct opening *opening = opening_get(nerdle->sz);
+  uint64_t second;
+
+  if (nerdle->nr_feedback != 1 || opening == NULL ||
+      opening->strategy != nerdle->strategy ||
+      opening->sample != nerdle->sample ||
+      nerdle_get_nr_dict(nerdle) != opening->nr_eq ||
+      opening->first != nerdle->first_guess ||
+      opening_get_second(opening, nerdle->first_pattern, &second) == false) {
+    return false;
+  }
+  for (uint64_t i = 0; i < nr; ++i) {
+    if (eqs[i] == second) {
+      *index = i;
+      return true;
     }
   }
-  return candidate->next;
+  return false;
 }
 
-void nerdle_check_candidates(struct nerdle *nerdle)
+struct decisions* nerdle_open_decisions(struct nerdle *nerdle, const char *path)
 {
-  uint64_t nr_candidate_before = nerdle->nr_candidate;
-  struct candidate *candidate = nerdle->candidates;
-  while (candidate != NULL) {
-    candidate = check_candidate(nerdle, candidate);
+  struct decision_header config = {
+    .sz = nerdle->sz,
+    .strategy = nerdle->strategy,
+    .sample = nerdle->sample,
+    .depth = nerdle->depth,
+    .limit = nerdle->limit,
+    .nr_bit = DECISION_DEFAULT_BIT,
+    .budget = nerdle->budget,
+  };
+
+  if (nerdle->table != NULL) {
+    config.nr_eq = nerdle->table->nr;
+    config.checksum = dict_checksum(nerdle->table->eqs, nerdle->table->nr);
+  } else {
+    config.nr_eq = nerdle->candidates.nr;
+    config.checksum = dict_checksum(nerdle->candidates.eqs, nerdle->candidates.nr);
   }
-  printf("[nerdle] remove %lu candidates, %lu candidates remaining\n",
-         nr_candidate_before - nerdle->nr_candidate, nerdle->nr_candidate);
+  nerdle->decisions = decision_open(path, &config);
+  return nerdle->decisions;
 }
 
 void nerdle_find_best_equation(struct nerdle *nerdle, struct equation *eq)
 {
+  uint64_t guess;
+
+  if (nerdle->decisions != NULL &&
+      decision_get(nerdle->decisions, nerdle->history, &guess) == true) {
+    if (nerdle->verbose == true) {
+      printf("[nerdle] decision stored\n");
+    }
+    equation_unpack(guess, eq, nerdle->sz);
+    return;
+  }
+
   nerdle_check_candidates(nerdle);
-  if (nerdle->nr_candidate == 0) {
+  if (nerdle->view.nr_alive == 0) {
+    /* regenerate the candidates respecting the status */
+    nerdle->candidates.nr = 0;
     nerdle_generate_equations(nerdle);
+    nerdle_build_table(nerdle);
   }
-  assert(nerdle->nr_candidate > 0);
-
-  struct candidate *candidate = nerdle->candidates;
-  struct candidate *best_candidate = candidate;
-  unsigned best_variance = 0;
-
-  while (candidate != NULL) {
-    unsigned variance = equation_get_variance(&candidate->eq);
-    if (variance > best_variance) {
-      best_variance = variance;
-      best_candidate = candidate;
-    }
-    candidate = candidate->next;
+  assert(nerdle->view.nr_alive > 0);
+
+  arena_reset(&nerdle->scratch);
+  uint64_t *eqs = arena_alloc(&nerdle->scratch,
+                              nerdle->view.nr_alive * sizeof(uint64_t));
+  uint64_t nr = view_get_equations(&nerdle->view, eqs);
+  uint64_t best;
+  if (nerdle_find_opening(nerdle, eqs, nr, &best) == true) {
+    /* searched offline */
+  } else if (nerdle->depth > 0 && nr <= SEARCH_MAX_CANDIDATES) {
+    struct search search = {
+      .sz = nerdle->sz,
+      .depth = nerdle->depth,
+      .width = SEARCH_DEFAULT_WIDTH,
+      .budget = nerdle->budget,
+      .cache = nerdle->cache,
+      .scratch = &nerdle->scratch,
+    };
+    best = search_best_guess(&search, eqs, nr, NULL);
+  } else {
+    best = score_best_guess(eqs, nr, nerdle->sz, nerdle->strategy,
+                            nerdle->sample, nerdle->nr_thread);
   }
 
-  memcpy(eq, &best_candidate->eq, sizeof(struct equation));
-  remove_candidate(nerdle, best_candidate);
+  equation_unpack(eqs[best], eq, nerdle->sz);
+  if (nerdle->decisions != NULL) {
+    decision_put(nerdle->decisions, nerdle->history, eqs[best]);
+  }
+  view_remove_nth(&nerdle->view, best);
 }
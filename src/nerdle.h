@@ -4,26 +4,79 @@
 #include <stdint.h>
 
 #include "rules.h"
+#include "arena.h"
 #include "equation.h"
+#include "filter.h"
+#include "score.h"
+#include "table.h"
+#include "view.h"
+#include "search.h"
+#include "decision.h"
 
-struct candidate {
-  struct equation eq;
-  struct candidate *next;
-  struct candidate *prev;
+/**
+ * Array of equations packed (@c equation_pack).
+ */
+struct candidates {
+  uint64_t *eqs;
+  uint64_t nr;
+  uint64_t max; /* allocated (0: not owned, mapped from a dictionary) */
 };
 
+struct kernels;
+struct dict;
+
 struct nerdle {
   /* Size of the equation */
   uint32_t sz;
   /* Limit the number of candidates generated (performance issue) */
   uint32_t limit;
+  /* Number of threads used to generate and score the equations (default: 1) */
+  uint32_t nr_thread;
+  /* Strategy of selection of the next equation (default: variance) */
+  enum strategy strategy;
+  /* Maximal number of candidates scored by round (0: all) */
+  uint32_t sample;
+  /* Lookahead search (@c search_best_guess): depth (0: greedy, default),
+     time budget by move in seconds and transposition table (not owned) */
+  uint32_t depth;
+  double budget;
+  struct search_cache *cache;
+  /* Persistent decisions by history, consulted first (not owned) */
+  struct decisions *decisions;
+  /* Print the progress of the rounds (default: true) */
+  bool verbose;
+  /* Kernels of the generation specialized for the size */
+  const struct kernels *kernels;
   /* Status */
   enum status status[SYMBOL_END];
   enum symbol right[LIMIT_MAX_EQ_SZ];
   bool wrong[LIMIT_MAX_EQ_SZ][SYMBOL_END];
-  /* List of candidates */
-  struct candidate *candidates;
-  uint64_t nr_candidate;
+  /* Bounds of the number of occurrences by symbol */
+  uint8_t min[SYMBOL_END];
+  uint8_t max[SYMBOL_END];
+  /* Feedbacks received, the first one (@c opening_get_second) */
+  uint32_t nr_feedback;
+  uint64_t first_guess;
+  uint32_t first_pattern;
+  /* Hash of the guesses and feedbacks received (@c decision_get) */
+  uint64_t history;
+  /* Equations generated or loaded (never filtered) */
+  struct candidates candidates;
+  /* Dictionary mapped, the candidates until they are generated again */
+  struct dict *dict;
+  /* Number of equations of the dictionary of the game: candidates set
+     or generated before the first feedback (0: generated on demand) */
+  uint64_t nr_dict;
+  /* Table of the equations (built on demand from the candidates,
+     or shared by @c nerdle_set_table) and candidates alive */
+  const struct table *table;
+  bool own_table;
+  struct view view;
+  /* Memory of the game (the nerdle itself and the bitsets of the view),
+     released by @c nerdle_destroy, and scratch memory of a round
+     (reset by @c nerdle_find_best_equation) */
+  struct arena arena;
+  struct arena scratch;
 };
 
 /**
@@ -43,12 +96,106 @@ struct nerdle* nerdle_create(uint32_t sz, uint32_t limit);
 void nerdle_destroy(struct nerdle *nerdle);
 
 /**
- * Generate all the equations.
+ * Use the runtime-generic kernels of the generation instead of the
+ * kernels specialized for the size (testing the equivalence).
+ *
+ * @param nerdle nerdle handle.
+ */
+void nerdle_set_generic_kernels(struct nerdle *nerdle);
+
+/**
+ * Generate all the equations respecting the status (all the equations
+ * before the first feedback): the branches are pruned by the positions,
+ * the symbols discarded and the bounds of the number of occurrences.
+ * With more than one thread, the tree of the equations is split on
+ * the first two symbols and the branches are generated in parallel,
+ * the order of the equations is the same as with one thread.
  *
  * @param nerdle nerdle handle.
  */
 void nerdle_generate_equations(struct nerdle *nerdle);
 
+/**
+ * Visitor of the equations enumerated (@c nerdle_enumerate_equations).
+ *
+ * @param arg argument of the enumeration.
+ * @param eqs chunk of equations packed.
+ * @param nr number of equations of the chunk.
+ * @return true to continue, false to stop the enumeration.
+ */
+typedef bool (*nerdle_visitor_t)(void *arg, const uint64_t *eqs, uint64_t nr);
+
+/**
+ * Enumerate the equations respecting the status, in the order of
+ * @c nerdle_generate_equations, without storing them: the equations are
+ * written to a chunk visited when full, then the last chunk.
+ * The limit and the threads are not applied.
+ *
+ * @param nerdle nerdle handle.
+ * @param chunk chunk of the equations (caller buffer).
+ * @param nr_chunk number of equations of the chunk.
+ * @param visit visitor of the chunks.
+ * @param arg argument of the visitor.
+ * @return true if all the equations are visited, false if stopped.
+ */
+bool nerdle_enumerate_equations(struct nerdle *nerdle, uint64_t *chunk,
+                                uint64_t nr_chunk, nerdle_visitor_t visit,
+                                void *arg);
+
+/**
+ * Load all the equations from a dictionary
+ * previously written by @c nerdle-dict.
+ * The dictionary stays mapped (read-only, shared by the processes) until
+ * the nerdle is destroyed: the candidates and the table are the equations
+ * of the file, not copied.
+ *
+ * @param nerdle nerdle handle.
+ * @param path path of the dictionary.
+ * @return true if OK, otherwise false.
+ */
+bool nerdle_load_equations(struct nerdle *nerdle, const char *path);
+
+/**
+ * Set the candidates from an array of equations packed
+ * (a shared dictionary for example).
+ *
+ * @param nerdle nerdle handle.
+ * @param eqs equations packed (copied).
+ * @param nr number of equations.
+ */
+void nerdle_set_equations(struct nerdle *nerdle, const uint64_t *eqs, uint64_t nr);
+
+/**
+ * Set the candidates from a table shared by several games
+ * (not copied, outlive the nerdle; the limit is not applied).
+ *
+ * @param nerdle nerdle handle.
+ * @param table table of the equations.
+ */
+void nerdle_set_table(struct nerdle *nerdle, const struct table *table);
+
+/**
+ * Get the table of the candidates, built if needed
+ * (to be shared by several games: @c nerdle_set_table).
+ *
+ * @param nerdle nerdle handle.
+ * @return table of the candidates.
+ */
+const struct table* nerdle_get_table(struct nerdle *nerdle);
+
+/**
+ * Open the persistent decisions of the configuration of the nerdle
+ * (size, strategy, sample, depth, limit and candidates set at this point)
+ * and consult them in @c nerdle_find_best_equation.
+ * @warning decisions have to be closed (@c decision_close), after the
+ * nerdle and the games sharing them.
+ *
+ * @param nerdle nerdle handle.
+ * @param path path of the file.
+ * @return decisions handle if OK, otherwise return @c NULL.
+ */
+struct decisions* nerdle_open_decisions(struct nerdle *nerdle, const char *path);
+
 /**
  * Set the first equation.
  *
@@ -57,8 +204,19 @@ void nerdle_generate_equations(struct nerdle *nerdle);
  */
 /* void nerdle_set_first_equation(struct nerdle *nerdle, struct equation *eq); */
 
+/**
+ * Compile the status [right/discarded/wrong_position] to constraints.
+ *
+ * @param nerdle nerdle handle.
+ * @param constraints constraints output.
+ */
+void nerdle_get_constraints(const struct nerdle *nerdle,
+                            struct constraints *constraints);
+
 /**
  * Remove all candidates not respecting the status [right/discarded/wrong_position].
+ * Only the view of the candidates alive is updated (@c view_filter),
+ * the equations are kept.
  *
  * @param nerdle nerdle handle.
  */
@@ -66,7 +224,14 @@ void nerdle_check_candidates(struct nerdle *nerdle);
 
 /**
  * Find the best equations in the list of candidates.
- * Best is based on the variance of the symbols.
+ * Best is based on the strategy of the nerdle (@c score_best_guess).
+ * After the first guess of the opening of the size, the second guess
+ * is read from the opening if searched with the same strategy, sample
+ * and dictionary (all the equations of the size, loaded or generated
+ * on demand, @c opening_get_second). With a depth of search and
+ * few enough candidates, the best is searched ahead (@c search_best_guess).
+ * With decisions, the best of the history is read if stored (without
+ * checking the candidates), otherwise stored.
  *
  * @param nerdle nerdle handle.
  * @param eq best equation output.
@@ -74,15 +239,15 @@ void nerdle_check_candidates(struct nerdle *nerdle);
 void nerdle_find_best_equation(struct nerdle *nerdle, struct equation *eq);
 
 /**
- * Update the status of a location of the equation.
+ * Update the status from the feedback of an equation guessed:
+ * right/wrong locations and number of occurrences of the symbols.
  *
  * @param nerdle nerdle handle.
- * @param status status to set.
- * @param eq equation to update.
- * @param i index of the location.
+ * @param eq equation guessed.
+ * @param status status of each location of the equation.
  */
-void nerdle_update_status(struct nerdle *nerdle, enum status status,
-                          const struct equation *eq, uint32_t i);
+void nerdle_update_feedback(struct nerdle *nerdle, const struct equation *eq,
+                            const enum status *status);
 
 /**
  * Dump the status of a round.
@@ -91,6 +256,12 @@ void nerdle_update_status(struct nerdle *nerdle, enum status status,
  */
 void nerdle_dump_status(const struct nerdle *nerdle);
 
+/**
+ * Print the equations of the best variance (distinct symbols)
+ * respecting the status (@c nerdle_enumerate_equations).
+ *
+ * @param nerdle nerdle handle.
+ */
 void nerdle_generate_best_variance_equations(struct nerdle *nerdle);
 
 #endif /* !__NERDLE__ */
@@ -0,0 +1,34 @@
+#include <stddef.h>
+
+#include "opening.h"
+/* warning: singleton include (generated) */
+#include "openings.h"
+
+const struct opening* opening_get(uint32_t sz)
+{
+  if (sz > LIMIT_MAX_EQ_SZ || openings[sz].first == 0) {
+    return NULL;
+  }
+  return &openings[sz];
+}
+
+bool opening_get_second(const struct opening *opening, uint32_t pattern,
+                        uint64_t *eq)
+{
+  uint32_t lo = 0;
+  uint32_t hi = opening->nr_second;
+
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (opening->second[mid].pattern < pattern) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == opening->nr_second || opening->second[lo].pattern != pattern) {
+    return false;
+  }
+  *eq = opening->second[lo].eq;
+  return true;
+}
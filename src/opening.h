@@ -0,0 +1,56 @@
+#ifndef __OPENING__
+#define __OPENING__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rules.h"
+#include "score.h"
+
+/**
+ * Openings searched offline by @c nerdle-openings (src/openings.h,
+ * generated): the first guess of a size and the second guess by
+ * feedback pattern of the first guess.
+ */
+
+/**
+ * Second guess after a feedback pattern of the first guess.
+ */
+struct opening_second {
+  uint32_t pattern;
+  uint64_t eq;
+};
+
+struct opening {
+  /* Strategy and sample of the second guesses (@c score_best_guess) */
+  enum strategy strategy;
+  uint32_t sample;
+  /* Number of equations of the dictionary searched */
+  uint64_t nr_eq;
+  /* First guess (equation packed) */
+  uint64_t first;
+  /* Second guesses, sorted by pattern */
+  const struct opening_second *second;
+  uint32_t nr_second;
+};
+
+/**
+ * Get the opening of a size.
+ *
+ * @param sz size of the equation.
+ * @return opening, NULL if not searched.
+ */
+const struct opening* opening_get(uint32_t sz);
+
+/**
+ * Get the second guess after a feedback pattern of the first guess.
+ *
+ * @param opening opening handle.
+ * @param pattern feedback pattern of the first guess (@c feedback_pattern).
+ * @param eq second guess output (equation packed).
+ * @return true if found, otherwise false.
+ */
+bool opening_get_second(const struct opening *opening, uint32_t pattern,
+                        uint64_t *eq);
+
+#endif /* !__OPENING__ */
@@ -0,0 +1,9058 @@
+/* Generated by nerdle-openings (sample of the first guess: 20000), do not edit. */
+#ifndef __OPENINGS__
+#define __OPENINGS__
+
+static const struct opening_second openings_second_5[] = {
+  { 54, 0x5e2b7ULL },
+  { 55, 0x3e2d6ULL },
+  { 56, 0x6e2c3ULL },
+  { 60, 0x7e5a2ULL },
+  { 61, 0x5e3a2ULL },
+  { 62, 0x5e2a3ULL },
+  { 63, 0x1e6b7ULL },
+  { 64, 0x3e3c1ULL },
+  { 65, 0x1e2b3ULL },
+  { 69, 0x7e6a1ULL },
+  { 70, 0x3e2a1ULL },
+  { 72, 0x6e1b7ULL },
+  { 74, 0x3e1c3ULL },
+  { 78, 0x7e1a6ULL },
+  { 79, 0x3e1a2ULL },
+  { 135, 0x2e2b4ULL },
+  { 136, 0x3e4b7ULL },
+  { 141, 0x6e4a2ULL },
+  { 142, 0x7e3a4ULL },
+  { 143, 0x7e4a3ULL },
+  { 144, 0x1e4d4ULL },
+  { 145, 0x1e3b4ULL },
+  { 150, 0x5e4a1ULL },
+  { 154, 0x3e1b4ULL },
+  { 159, 0x5e1a4ULL },
+  { 216, 0x4e4b8ULL },
+  { 217, 0x4e3b7ULL },
+  { 222, 0x4e2a2ULL },
+  { 225, 0x4e4c1ULL },
+  { 232, 0x4e3a1ULL },
+  { 234, 0x4e1c4ULL },
+};
+
+static const struct opening_second openings_second_6[] = {
+  { 81, 0x11e6a5ULL },
+  { 82, 0x21e9a3ULL },
+  { 83, 0x1e5c2ULL },
+  { 84, 0x11e8a3ULL },
+  { 85, 0x1e2a8ULL },
+  { 86, 0x1e8a2ULL },
+  { 108, 0x31e7a6ULL },
+  { 109, 0x12e7c3ULL },
+  { 111, 0x51e8a7ULL },
+  { 112, 0x27e9c8ULL },
+  { 162, 0x9e6b51ULL },
+  { 163, 0x9e2b11ULL },
+  { 165, 0x8e3b11ULL },
+  { 166, 0x8e2b01ULL },
+  { 168, 0x9e9b81ULL },
+  { 180, 0x5e3d51ULL },
+  { 181, 0x5e2d01ULL },
+  { 182, 0x5e5d52ULL },
+  { 183, 0x9e9d18ULL },
+  { 184, 0x8e2d61ULL },
+  { 186, 0x6e3d81ULL },
+  { 187, 0x9e2d81ULL },
+  { 189, 0x7e3b01ULL },
+  { 190, 0x7e5b21ULL },
+  { 192, 0x7e8b51ULL },
+  { 207, 0x7e5d53ULL },
+  { 209, 0x7e3d12ULL },
+  { 210, 0x7e8d65ULL },
+  { 211, 0x9e8d27ULL },
+  { 216, 0x3e7b01ULL },
+  { 217, 0x5e7b21ULL },
+  { 219, 0x8e7b51ULL },
+  { 234, 0x5e7d53ULL },
+  { 236, 0x3e7d12ULL },
+  { 237, 0x8e7d65ULL },
+  { 324, 0x31e9a4ULL },
+  { 325, 0x21e4c3ULL },
+  { 327, 0x4e8c5ULL },
+  { 328, 0x21e8a4ULL },
+  { 351, 0x11e7a4ULL },
+  { 352, 0x24e7c6ULL },
+  { 355, 0x82e7c4ULL },
+  { 405, 0x9e4b31ULL },
+  { 408, 0x8e6b41ULL },
+  { 409, 0x8e4b21ULL },
+  { 423, 0x9e4d63ULL },
+  { 424, 0x3e4d21ULL },
+  { 425, 0x5e4d02ULL },
+  { 426, 0x8e5d04ULL },
+  { 427, 0x8e4d23ULL },
+  { 428, 0x8e3d42ULL },
+  { 429, 0x8e6d84ULL },
+  { 432, 0x7e4b11ULL },
+  { 451, 0x7e2d41ULL },
+  { 458, 0x7e4d82ULL },
+  { 459, 0x7e7b41ULL },
+  { 477, 0x7e7d94ULL },
+  { 478, 0x2e7d41ULL },
+  { 567, 0x41e9a5ULL },
+  { 568, 0x42e6c4ULL },
+  { 570, 0x41e8a6ULL },
+  { 571, 0x42e8c3ULL },
+  { 594, 0x41e7a7ULL },
+  { 595, 0x41e2c7ULL },
+  { 596, 0x41e7c2ULL },
+  { 648, 0x4e6b01ULL },
+  { 652, 0x4e8b21ULL },
+  { 666, 0x4e4d61ULL },
+  { 667, 0x4e3d21ULL },
+  { 668, 0x4e5d02ULL },
+  { 670, 0x4e8d23ULL },
+  { 702, 0x4e7b11ULL },
+};
+
+static const struct opening_second openings_second_7[] = {
+  { 81, 0x7e4d8b9ULL },
+  { 82, 0x5e97b48ULL },
+  { 83, 0x9e84b75ULL },
+  { 84, 0x9e7a4d8ULL },
+  { 85, 0x7e4a5b8ULL },
+  { 86, 0x8e7a4b5ULL },
+  { 87, 0x9e4d8a7ULL },
+  { 88, 0x7e5b4a8ULL },
+  { 89, 0x8e4b7a5ULL },
+  { 90, 0x2e28b48ULL },
+  { 91, 0x7e58b29ULL },
+  { 92, 0x8e24b05ULL },
+  { 93, 0x7e9a4b2ULL },
+  { 94, 0x2e5a5b2ULL },
+  { 95, 0x2e2a5b5ULL },
+  { 96, 0x9e2b7a4ULL },
+  { 97, 0x5e2b5a2ULL },
+  { 98, 0x7e2b4a5ULL },
+  { 99, 0x4e2c2b8ULL },
+  { 100, 0x5e5c2d2ULL },
+  { 101, 0x4e2d2b5ULL },
+  { 102, 0x8e7a2d2ULL },
+  { 103, 0x5e4a2d2ULL },
+  { 104, 0x5e2a2b5ULL },
+  { 105, 0x7e4b2a9ULL },
+  { 106, 0x5e2d2a4ULL },
+  { 107, 0x9e2a2a5ULL },
+  { 108, 0x6e88b49ULL },
+  { 109, 0x9e67b58ULL },
+  { 110, 0x6e84b45ULL },
+  { 111, 0x9e8a6d6ULL },
+  { 112, 0x5e7a8b6ULL },
+  { 113, 0x7e8a6b5ULL },
+  { 114, 0x9e6d6a8ULL },
+  { 115, 0x7e5b6a6ULL },
+  { 116, 0x7e6b8a5ULL },
+  { 117, 0x2e84d69ULL },
+  { 118, 0x8e45b26ULL },
+  { 119, 0x4e25b65ULL },
+  { 120, 0x4e6a4b2ULL },
+  { 121, 0x6e9a5b2ULL },
+  { 122, 0x2e6a9b5ULL },
+  { 123, 0x6e2b4a4ULL },
+  { 124, 0x5e2d6a2ULL },
+  { 125, 0x9e2b6a5ULL },
+  { 126, 0x6e6c2d2ULL },
+  { 127, 0x5e2d2b6ULL },
+  { 128, 0x6e4b2c5ULL },
+  { 129, 0x6e6a2b2ULL },
+  { 130, 0x6e5a2d2ULL },
+  { 131, 0x9e6a2b5ULL },
+  { 132, 0x6e2a2a2ULL },
+  { 133, 0x6e5b2a9ULL },
+  { 134, 0x6e2d2a5ULL },
+  { 135, 0x6e86b47ULL },
+  { 136, 0x9e56b47ULL },
+  { 144, 0x4e26b66ULL },
+  { 145, 0x5e26b76ULL },
+  { 162, 0x97e9b88ULL },
+  { 163, 0x97e5b48ULL },
+  { 164, 0x94e8b75ULL },
+  { 165, 0x88e9a97ULL },
+  { 166, 0x48e9a57ULL },
+  { 167, 0x95e5a45ULL },
+  { 168, 0x49e78a7ULL },
+  { 169, 0x75e84a9ULL },
+  { 170, 0x48e97a5ULL },
+  { 171, 0x48e2c24ULL },
+  { 172, 0x9e54c2ULL },
+  { 173, 0x84e2b05ULL },
+  { 174, 0x47e2a27ULL },
+  { 175, 0x29e7a58ULL },
+  { 176, 0x75e5a25ULL },
+  { 177, 0x8e87a2ULL },
+  { 178, 0x5e84a2ULL },
+  { 179, 0x28e77a5ULL },
+  { 180, 0x44e22c2ULL },
+  { 181, 0x5e52c2ULL },
+  { 186, 0x42e22a2ULL },
+  { 187, 0x72e52a2ULL },
+  { 188, 0x52e02a5ULL },
+  { 189, 0x76e7b47ULL },
+  { 190, 0x85e9b76ULL },
+  { 191, 0x64e8b45ULL },
+  { 192, 0x47e7a76ULL },
+  { 193, 0x47e9a56ULL },
+  { 194, 0x76e9a85ULL },
+  { 195, 0x77e96a8ULL },
+  { 196, 0x76e95a8ULL },
+  { 197, 0x6e55a5ULL },
+  { 198, 0x64e2d29ULL },
+  { 199, 0x85e2b06ULL },
+  { 200, 0x62e2d25ULL },
+  { 201, 0x27e8a46ULL },
+  { 202, 0x76e5a26ULL },
+  { 203, 0x65e4a25ULL },
+  { 204, 0x27e86a4ULL },
+  { 205, 0x65e45a2ULL },
+  { 206, 0x26e75a5ULL },
+  { 207, 0x69e42c4ULL },
+  { 208, 0x65e82c2ULL },
+  { 213, 0x62e42a2ULL },
+  { 216, 0x86e6b47ULL },
+  { 217, 0x97e6b58ULL },
+  { 218, 0x44e6b05ULL },
+  { 219, 0x47e6a86ULL },
+  { 220, 0x58e6a97ULL },
+  { 221, 0x65e6a05ULL },
+  { 222, 0x7e66a4ULL },
+  { 223, 0x6e65a4ULL },
+  { 225, 0x67e6b28ULL },
+  { 226, 0x65e6b26ULL },
+  { 227, 0x64e6b25ULL },
+  { 228, 0x28e6a67ULL },
+  { 229, 0x25e6a64ULL },
+  { 230, 0x85e6a25ULL },
+  { 231, 0x28e67a6ULL },
+  { 232, 0x85e65a2ULL },
+  { 235, 0x25e62c2ULL },
+  { 240, 0x82e62a2ULL },
+  { 324, 0x3e43b73ULL },
+  { 325, 0x5e83b34ULL },
+  { 326, 0x5e84b35ULL },
+  { 327, 0x8e7a3d3ULL },
+  { 328, 0x5e5a3b3ULL },
+  { 329, 0x5e3a3b5ULL },
+  { 330, 0x7e3d9a4ULL },
+  { 331, 0x5e3b5a3ULL },
+  { 332, 0x5e3b3a5ULL },
+  { 333, 0x4e32d29ULL },
+  { 334, 0x8e72b53ULL },
+  { 335, 0x9e34b25ULL },
+  { 336, 0x7e8a3b2ULL },
+  { 337, 0x4e5a3b2ULL },
+  { 338, 0x4e2a3b5ULL },
+  { 339, 0x9e2b8a3ULL },
+  { 340, 0x3e5d5a2ULL },
+  { 342, 0x4e2b2c3ULL },
+  { 343, 0x5e3b2c4ULL },
+  { 344, 0x7e3b2c5ULL },
+  { 345, 0x7e3a2c2ULL },
+  { 346, 0x5e4a2b3ULL },
+  { 348, 0x9e3c2a3ULL },
+  { 350, 0x4e3b2a5ULL },
+  { 351, 0x6e33b93ULL },
+  { 352, 0x7e65b36ULL },
+  { 353, 0x6e35b95ULL },
+  { 354, 0x6e6a3b3ULL },
+  { 355, 0x5e8a6b3ULL },
+  { 356, 0x6e4a3b5ULL },
+  { 357, 0x6e3b6a3ULL },
+  { 358, 0x6e5b8a3ULL },
+  { 359, 0x6e3b4a5ULL },
+  { 360, 0x6e23b83ULL },
+  { 361, 0x9e62b53ULL },
+  { 363, 0x4e2a3d6ULL },
+  { 364, 0x5e6a3b2ULL },
+  { 365, 0x2e3a6b5ULL },
+  { 366, 0x6e2d6a3ULL },
+  { 367, 0x5e3b6a2ULL },
+  { 368, 0x6e2b3a5ULL },
+  { 369, 0x6e3c2d4ULL },
+  { 372, 0x7e6a2b3ULL },
+  { 373, 0x6e5a2b3ULL },
+  { 374, 0x6e3a2b5ULL },
+  { 375, 0x6e3b2a7ULL },
+  { 376, 0x5e3b2a6ULL },
+  { 378, 0x3e36b66ULL },
+  { 379, 0x5e36b86ULL },
+  { 387, 0x9e36b27ULL },
+  { 388, 0x3e26b56ULL },
+  { 405, 0x97e4b38ULL },
+  { 406, 0x87e5b38ULL },
+  { 407, 0x45e3b75ULL },
+  { 408, 0x38e9a47ULL },
+  { 409, 0x38e8a57ULL },
+  { 410, 0x75e4a35ULL },
+  { 411, 0x78e48a3ULL },
+  { 412, 0x35e94a4ULL },
+  { 413, 0x35e84a5ULL },
+  { 414, 0x42e3b72ULL },
+  { 415, 0x57e3c52ULL },
+  { 416, 0x94e3b25ULL },
+  { 417, 0x28e9a37ULL },
+  { 418, 0x54e3a24ULL },
+  { 419, 0x55e3a25ULL },
+  { 420, 0x28e97a3ULL },
+  { 421, 0x25e94a3ULL },
+  { 422, 0x24e73a5ULL },
+  { 423, 0x27e42c3ULL },
+  { 424, 0x57e52c3ULL },
+  { 429, 0x32e02a3ULL },
+  { 430, 0x52e32a2ULL },
+  { 431, 0x82e32a5ULL },
+  { 432, 0x96e4b37ULL },
+  { 433, 0x86e5b37ULL },
+  { 434, 0x64e7b35ULL },
+  { 435, 0x37e4a96ULL },
+  { 436, 0x37e8a56ULL },
+  { 437, 0x95e3a65ULL },
+  { 438, 0x37e46a9ULL },
+  { 439, 0x35e74a6ULL },
+  { 440, 0x36e85a5ULL },
+  { 441, 0x87e3c62ULL },
+  { 442, 0x95e3b26ULL },
+  { 444, 0x62e3a32ULL },
+  { 445, 0x56e3a26ULL },
+  { 446, 0x26e9a35ULL },
+  { 447, 0x27e96a3ULL },
+  { 448, 0x56e36a2ULL },
+  { 450, 0x64e32c2ULL },
+  { 456, 0x62e32a3ULL },
+  { 459, 0x78e6b39ULL },
+  { 460, 0x75e6b36ULL },
+  { 461, 0x74e6b35ULL },
+  { 462, 0x39e6a78ULL },
+  { 463, 0x54e6a93ULL },
+  { 464, 0x95e6a35ULL },
+  { 465, 0x39e68a7ULL },
+  { 466, 0x95e65a3ULL },
+  { 468, 0x27e63c2ULL },
+  { 469, 0x92e6b53ULL },
+  { 471, 0x92e6a32ULL },
+  { 474, 0x24e63a6ULL },
+  { 477, 0x87e62c3ULL },
+  { 483, 0x92e62a3ULL },
+  { 648, 0x43e3b73ULL },
+  { 649, 0x83e5b34ULL },
+  { 651, 0x73e3a43ULL },
+  { 652, 0x83e5a33ULL },
+  { 654, 0x73e43a3ULL },
+  { 655, 0x83e53a3ULL },
+  { 656, 0x53e03a5ULL },
+  { 657, 0x83e2b04ULL },
+  { 658, 0x53e2b73ULL },
+  { 660, 0x23e9a32ULL },
+  { 661, 0x73e5a23ULL },
+  { 663, 0x23e03a2ULL },
+  { 664, 0x53e33a2ULL },
+  { 665, 0x73e23a5ULL },
+  { 672, 0x23e92a3ULL },
+  { 673, 0x53e82a7ULL },
+  { 674, 0x3e52a5ULL },
+  { 675, 0x63e7b34ULL },
+  { 676, 0x63e9b54ULL },
+  { 678, 0x63e3a33ULL },
+  { 681, 0x63e33a3ULL },
+  { 684, 0x43e2b63ULL },
+  { 687, 0x83e2a63ULL },
+  { 688, 0x53e9a62ULL },
+  { 690, 0x63e43a2ULL },
+  { 699, 0x33e72a6ULL },
+  { 700, 0x53e92a6ULL },
+  { 702, 0x3e6b63ULL },
+  { 703, 0x93e6b54ULL },
+  { 705, 0x63e6a03ULL },
+  { 708, 0x93e63a3ULL },
+  { 711, 0x23e6b83ULL },
+  { 714, 0x3e6a42ULL },
+  { 715, 0x53e6a92ULL },
+  { 717, 0x83e63a2ULL },
+  { 726, 0x3e62a4ULL },
+  { 727, 0x53e62a9ULL },
+  { 810, 0x7e1d1b8ULL },
+  { 811, 0x4e5b9c1ULL },
+  { 812, 0x4e1c1b5ULL },
+  { 813, 0x8e7a1c1ULL },
+  { 814, 0x5e4a1c1ULL },
+  { 815, 0x9e4a1c5ULL },
+  { 816, 0x8e7c1a1ULL },
+  { 817, 0x5e4c1a1ULL },
+  { 818, 0x5e1b1a5ULL },
+  { 819, 0x2e2d4c1ULL },
+  { 820, 0x2e5b7c1ULL },
+  { 821, 0x9e24b15ULL },
+  { 822, 0x9e2a7c1ULL },
+  { 823, 0x7e2a5c1ULL },
+  { 824, 0x7e2a1d5ULL },
+  { 825, 0x7e2b1a8ULL },
+  { 826, 0x5e2d8a1ULL },
+  { 827, 0x8e2a1a5ULL },
+  { 828, 0x2e1c2b4ULL },
+  { 829, 0x5e1c2b7ULL },
+  { 830, 0x2e1b2b5ULL },
+  { 831, 0x8e9a2b1ULL },
+  { 832, 0x7e5a2c1ULL },
+  { 833, 0x4e1a2b5ULL },
+  { 834, 0x9e4c2a1ULL },
+  { 835, 0x5e2a2a1ULL },
+  { 836, 0x7e1c2a5ULL },
+  { 837, 0x6e1d1c6ULL },
+  { 838, 0x5e1c1b6ULL },
+  { 839, 0x6e54b15ULL },
+  { 840, 0x7e1a6c1ULL },
+  { 841, 0x6e5a1c1ULL },
+  { 842, 0x6e1a1c5ULL },
+  { 843, 0x6e1a4a1ULL },
+  { 844, 0x6e5c1a1ULL },
+  { 845, 0x6e1c1a5ULL },
+  { 846, 0x2e6b8c1ULL },
+  { 847, 0x9e61b52ULL },
+  { 849, 0x8e2a1c6ULL },
+  { 850, 0x2e6a5b1ULL },
+  { 851, 0x6e2a1b5ULL },
+  { 852, 0x6e4c1a2ULL },
+  { 853, 0x5e2b6a1ULL },
+  { 855, 0x2e1b2d6ULL },
+  { 858, 0x6e7a2b1ULL },
+  { 859, 0x5e6a2b1ULL },
+  { 861, 0x8e1c2a6ULL },
+  { 863, 0x6e1b2a5ULL },
+  { 864, 0x7e16b86ULL },
+  { 865, 0x5e16b66ULL },
+  { 873, 0x9e26b17ULL },
+  { 891, 0x89e7c41ULL },
+  { 892, 0x58e5c71ULL },
+  { 893, 0x7e41c5ULL },
+  { 894, 0x8e9a17ULL },
+  { 895, 0x91e5a41ULL },
+  { 896, 0x85e7a15ULL },
+  { 897, 0x8e97a1ULL },
+  { 898, 0x95e85a1ULL },
+  { 899, 0x51e01a5ULL },
+  { 900, 0x28e2c14ULL },
+  { 901, 0x52e1c52ULL },
+  { 902, 0x25e1c25ULL },
+  { 903, 0x22e8a41ULL },
+  { 904, 0x22e7a51ULL },
+  { 905, 0x25e1a15ULL },
+  { 906, 0x22e81a4ULL },
+  { 907, 0x22e51a7ULL },
+  { 908, 0x71e21a5ULL },
+  { 909, 0x24e12c2ULL },
+  { 910, 0x52e52c1ULL },
+  { 915, 0x82e72a1ULL },
+  { 916, 0x52e42a1ULL },
+  { 918, 0x67e4c91ULL },
+  { 919, 0x46e1b56ULL },
+  { 920, 0x65e1c65ULL },
+  { 921, 0x96e8a16ULL },
+  { 922, 0x56e4a16ULL },
+  { 923, 0x65e5a15ULL },
+  { 924, 0x96e86a1ULL },
+  { 925, 0x6e95a1ULL },
+  { 926, 0x61e11a5ULL },
+  { 927, 0x61e2b81ULL },
+  { 928, 0x61e9b52ULL },
+  { 929, 0x6e21c5ULL },
+  { 930, 0x81e2a61ULL },
+  { 931, 0x62e5a12ULL },
+  { 933, 0x81e21a6ULL },
+  { 934, 0x52e91a6ULL },
+  { 942, 0x72e12a6ULL },
+  { 943, 0x62e52a1ULL },
+  { 944, 0x62e12a5ULL },
+  { 945, 0x69e61c6ULL },
+  { 946, 0x56e6b17ULL },
+  { 947, 0x54e6b15ULL },
+  { 948, 0x61e6a01ULL },
+  { 950, 0x75e6a15ULL },
+  { 951, 0x71e61a1ULL },
+  { 952, 0x75e65a1ULL },
+  { 954, 0x41e6b02ULL },
+  { 955, 0x51e6b12ULL },
+  { 957, 0x2e6a41ULL },
+  { 958, 0x52e6a91ULL },
+  { 960, 0x2e61a4ULL },
+  { 961, 0x52e61a9ULL },
+  { 963, 0x62e62c1ULL },
+  { 969, 0x72e62a1ULL },
+  { 1053, 0x3e1c1b4ULL },
+  { 1054, 0x5e3c1b8ULL },
+  { 1055, 0x8e34b15ULL },
+  { 1056, 0x4e3a1c1ULL },
+  { 1057, 0x3e5a3b1ULL },
+  { 1058, 0x8e3a1c5ULL },
+  { 1059, 0x7e3a1a3ULL },
+  { 1060, 0x5e3a1a1ULL },
+  { 1061, 0x8e3c1a5ULL },
+  { 1062, 0x2e91d83ULL },
+  { 1063, 0x3e21b51ULL },
+  { 1064, 0x3e2c1b5ULL },
+  { 1065, 0x3e1a1d2ULL },
+  { 1066, 0x5e2a3c1ULL },
+  { 1068, 0x3e2c1a1ULL },
+  { 1069, 0x5e3c1a2ULL },
+  { 1071, 0x3e1b2c2ULL },
+  { 1072, 0x5e1b2c3ULL },
+  { 1073, 0x3e1c2b5ULL },
+  { 1074, 0x3e4a2b1ULL },
+  { 1075, 0x5e3a2c1ULL },
+  { 1077, 0x3e1c2a1ULL },
+  { 1078, 0x5e1c2a3ULL },
+  { 1080, 0x3e3b6c1ULL },
+  { 1081, 0x5e13b63ULL },
+  { 1083, 0x6e3a3c1ULL },
+  { 1086, 0x6e3c1a3ULL },
+  { 1089, 0x6e2c1d3ULL },
+  { 1090, 0x6e52b13ULL },
+  { 1095, 0x6e2a3a1ULL },
+  { 1098, 0x6e1d2c3ULL },
+  { 1104, 0x6e3a2a1ULL },
+  { 1107, 0x3e16b46ULL },
+  { 1116, 0x2e16b36ULL },
+  { 1134, 0x31e3d93ULL },
+  { 1135, 0x54e3c51ULL },
+  { 1136, 0x84e3b15ULL },
+  { 1137, 0x41e3a11ULL },
+  { 1138, 0x81e5a31ULL },
+  { 1139, 0x45e3a15ULL },
+  { 1140, 0x41e31a1ULL },
+  { 1141, 0x45e35a1ULL },
+  { 1142, 0x81e31a5ULL },
+  { 1143, 0x91e4b32ULL },
+  { 1144, 0x25e4c31ULL },
+  { 1145, 0x31e4d25ULL },
+  { 1146, 0x32e9a41ULL },
+  { 1147, 0x51e3a21ULL },
+  { 1148, 0x35e2a15ULL },
+  { 1149, 0x32e91a4ULL },
+  { 1150, 0x35e25a1ULL },
+  { 1151, 0x32e81a5ULL },
+  { 1152, 0x32e32c1ULL },
+  { 1158, 0x32e22a1ULL },
+  { 1161, 0x84e3c61ULL },
+  { 1162, 0x85e3b16ULL },
+  { 1163, 0x56e31c5ULL },
+  { 1164, 0x61e3a31ULL },
+  { 1167, 0x61e31a3ULL },
+  { 1170, 0x62e2c31ULL },
+  { 1171, 0x62e5b13ULL },
+  { 1173, 0x36e2a16ULL },
+  { 1176, 0x36e26a1ULL },
+  { 1179, 0x36e12c3ULL },
+  { 1188, 0x87e6c31ULL },
+  { 1191, 0x91e6a31ULL },
+  { 1194, 0x91e61a3ULL },
+  { 1197, 0x71e6b32ULL },
+  { 1198, 0x52e6b13ULL },
+  { 1200, 0x32e6a71ULL },
+  { 1203, 0x32e61a7ULL },
+  { 1377, 0x93e31c3ULL },
+  { 1378, 0x53e53c1ULL },
+  { 1380, 0x83e7a13ULL },
+  { 1381, 0x53e4a13ULL },
+  { 1383, 0x83e73a1ULL },
+  { 1384, 0x53e43a1ULL },
+  { 1386, 0x43e2c71ULL },
+  { 1387, 0x3e2c51ULL },
+  { 1389, 0x23e1a13ULL },
+  { 1392, 0x23e13a1ULL },
+  { 1401, 0x3e92a1ULL },
+  { 1404, 0x63e1c63ULL },
+  { 1405, 0x53e1b63ULL },
+  { 1407, 0x73e1a63ULL },
+  { 1408, 0x63e5a13ULL },
+  { 1410, 0x73e13a6ULL },
+  { 1411, 0x63e53a1ULL },
+  { 1412, 0x63e13a5ULL },
+  { 1413, 0x63e3c21ULL },
+  { 1431, 0x63e63c1ULL },
+  { 1432, 0x53e6b14ULL },
+  { 1434, 0x73e6a13ULL },
+  { 1437, 0x73e63a1ULL },
+  { 1440, 0x23e61c2ULL },
+  { 1539, 0x1e7c1b8ULL },
+  { 1540, 0x1e1b5b7ULL },
+  { 1541, 0x1e4c1b5ULL },
+  { 1542, 0x1e4a4b1ULL },
+  { 1543, 0x1e5a5b1ULL },
+  { 1544, 0x1e1a5b5ULL },
+  { 1545, 0x1e4b4a1ULL },
+  { 1546, 0x1e5b5a1ULL },
+  { 1547, 0x1e5b1a5ULL },
+  { 1548, 0x1e91b02ULL },
+  { 1549, 0x1e52d52ULL },
+  { 1550, 0x1e15b25ULL },
+  { 1551, 0x1e7a8b2ULL },
+  { 1552, 0x1e4a5b2ULL },
+  { 1554, 0x1e8b7a2ULL },
+  { 1555, 0x1e5b4a2ULL },
+  { 1557, 0x1e1c2d2ULL },
+  { 1558, 0x1e5b2b8ULL },
+  { 1559, 0x1e2b2b5ULL },
+  { 1560, 0x1e2a2b1ULL },
+  { 1563, 0x1e8b2a7ULL },
+  { 1564, 0x1e5b2a4ULL },
+  { 1566, 0x1e6c1b7ULL },
+  { 1567, 0x1e5b6c1ULL },
+  { 1568, 0x1e55b65ULL },
+  { 1569, 0x1e6a6b1ULL },
+  { 1572, 0x1e6b6a1ULL },
+  { 1575, 0x1e62d62ULL },
+  { 1576, 0x1e52b62ULL },
+  { 1578, 0x1e6a7b2ULL },
+  { 1579, 0x1e5a6b2ULL },
+  { 1580, 0x1e2a6b5ULL },
+  { 1581, 0x1e7b6a2ULL },
+  { 1582, 0x1e6b5a2ULL },
+  { 1584, 0x1e2b2d6ULL },
+  { 1590, 0x1e7b2a6ULL },
+  { 1592, 0x1e6b2a5ULL },
+  { 1593, 0x1e96b07ULL },
+  { 1594, 0x1e46b56ULL },
+  { 1602, 0x1e16b26ULL },
+  { 1620, 0x11e8b91ULL },
+  { 1621, 0x11e4b51ULL },
+  { 1622, 0x11e5d55ULL },
+  { 1623, 0x19e7a48ULL },
+  { 1624, 0x15e7a44ULL },
+  { 1625, 0x15e1a05ULL },
+  { 1626, 0x19e78a4ULL },
+  { 1627, 0x15e74a4ULL },
+  { 1629, 0x12e7b82ULL },
+  { 1630, 0x12e4b52ULL },
+  { 1631, 0x15e1b25ULL },
+  { 1632, 0x18e9a27ULL },
+  { 1633, 0x15e9a24ULL },
+  { 1635, 0x18e97a2ULL },
+  { 1636, 0x15e94a2ULL },
+  { 1638, 0x12e12c1ULL },
+  { 1644, 0x12e02a1ULL },
+  { 1647, 0x16e16c1ULL },
+  { 1648, 0x16e4b56ULL },
+  { 1649, 0x15e5b65ULL },
+  { 1650, 0x17e7a46ULL },
+  { 1651, 0x18e5a67ULL },
+  { 1652, 0x16e7a45ULL },
+  { 1653, 0x17e76a4ULL },
+  { 1654, 0x16e75a4ULL },
+  { 1656, 0x16e1b26ULL },
+  { 1657, 0x12e5b62ULL },
+  { 1659, 0x17e9a26ULL },
+  { 1660, 0x12e5a61ULL },
+  { 1661, 0x16e9a25ULL },
+  { 1662, 0x17e96a2ULL },
+  { 1663, 0x16e95a2ULL },
+  { 1674, 0x11e6d66ULL },
+  { 1676, 0x15e6b75ULL },
+  { 1678, 0x18e6a57ULL },
+  { 1679, 0x16e6a55ULL },
+  { 1682, 0x16e65a5ULL },
+  { 1683, 0x12e6b72ULL },
+  { 1687, 0x12e6a51ULL },
+  { 1691, 0x12e61a5ULL },
+  { 1782, 0x1e3b1d4ULL },
+  { 1783, 0x1e53d53ULL },
+  { 1784, 0x1e35d35ULL },
+  { 1785, 0x1e3a3b1ULL },
+  { 1786, 0x1e3a5b3ULL },
+  { 1787, 0x1e3a7b5ULL },
+  { 1788, 0x1e3b3a1ULL },
+  { 1789, 0x1e5b3a3ULL },
+  { 1790, 0x1e7b3a5ULL },
+  { 1791, 0x1e2b1c3ULL },
+  { 1792, 0x1e5b3c2ULL },
+  { 1793, 0x1e25b35ULL },
+  { 1794, 0x1e2a3b2ULL },
+  { 1797, 0x1e4b3a2ULL },
+  { 1800, 0x1e3b2c2ULL },
+  { 1801, 0x1e5b2c3ULL },
+  { 1806, 0x1e3b2a2ULL },
+  { 1809, 0x1e63d63ULL },
+  { 1810, 0x1e53b63ULL },
+  { 1812, 0x1e4a6b3ULL },
+  { 1815, 0x1e6b4a3ULL },
+  { 1818, 0x1e2b3b6ULL },
+  { 1827, 0x1e3b2b6ULL },
+  { 1836, 0x1e36d36ULL },
+  { 1845, 0x1e26b36ULL },
+  { 1863, 0x19e7c31ULL },
+  { 1864, 0x15e3c71ULL },
+  { 1865, 0x15e3b45ULL },
+  { 1866, 0x18e8a37ULL },
+  { 1867, 0x15e8a34ULL },
+  { 1869, 0x18e87a3ULL },
+  { 1870, 0x15e84a3ULL },
+  { 1872, 0x12e3b42ULL },
+  { 1874, 0x15e2b35ULL },
+  { 1875, 0x12e8a31ULL },
+  { 1878, 0x14e93a2ULL },
+  { 1881, 0x18e72c3ULL },
+  { 1890, 0x16e3b46ULL },
+  { 1893, 0x17e8a36ULL },
+  { 1894, 0x14e5a63ULL },
+  { 1895, 0x16e8a35ULL },
+  { 1896, 0x17e86a3ULL },
+  { 1897, 0x16e85a3ULL },
+  { 1899, 0x16e2b36ULL },
+  { 1921, 0x14e6a53ULL },
+  { 1925, 0x14e63a5ULL },
+  { 2106, 0x13e8b93ULL },
+  { 2107, 0x13e4b53ULL },
+  { 2109, 0x13e1a03ULL },
+  { 2112, 0x13e03a1ULL },
+  { 2115, 0x13e1b23ULL },
+  { 2118, 0x13e9a22ULL },
+  { 2130, 0x13e92a2ULL },
+  { 2134, 0x13e5b63ULL },
+  { 2142, 0x13e2d26ULL },
+  { 2146, 0x13e5a62ULL },
+  { 2158, 0x13e52a6ULL },
+  { 2160, 0x13e6b73ULL },
+  { 2173, 0x13e6a52ULL },
+};
+
+static const struct opening_second openings_second_8[] = {
+  { 244, 0x594e9c55ULL },
+  { 245, 0x9e4a9d54ULL },
+  { 246, 0x595e58c7ULL },
+  { 247, 0x544e98c5ULL },
+  { 248, 0x5e08d004ULL },
+  { 250, 0x8e89d487ULL },
+  { 251, 0x5e79d584ULL },
+  { 252, 0x9e5b5d07ULL },
+  { 253, 0x9e45b9c7ULL },
+  { 254, 0x4e4b5d04ULL },
+  { 255, 0x8e7b5d57ULL },
+  { 256, 0x9e74b8c7ULL },
+  { 258, 0x9e5b7d89ULL },
+  { 259, 0x7e4b8d88ULL },
+  { 260, 0x8e4b4d84ULL },
+  { 261, 0x5e9c5b05ULL },
+  { 262, 0x9e9c5b45ULL },
+  { 263, 0x4e9c5b94ULL },
+  { 264, 0x5e9c8b77ULL },
+  { 265, 0x4e9c9b58ULL },
+  { 266, 0x8e8c4b04ULL },
+  { 267, 0x9e7c7b85ULL },
+  { 269, 0x8e8c5b84ULL },
+  { 270, 0x573e57c5ULL },
+  { 271, 0x774e9c35ULL },
+  { 272, 0x3e3d5d54ULL },
+  { 273, 0x583e77c5ULL },
+  { 274, 0x843e4c78ULL },
+  { 275, 0x803e7c44ULL },
+  { 276, 0x7e55d583ULL },
+  { 277, 0x4e59d083ULL },
+  { 278, 0x483e8c84ULL },
+  { 279, 0x3e5d03b9ULL },
+  { 280, 0x4e3b5d53ULL },
+  { 281, 0x7e3b4d04ULL },
+  { 282, 0x7e33b5c8ULL },
+  { 283, 0x9e3b7d48ULL },
+  { 284, 0x8e3b4d44ULL },
+  { 285, 0x8e3b8d88ULL },
+  { 287, 0x9e3b4d84ULL },
+  { 288, 0x9e3c7b03ULL },
+  { 289, 0x5e7c4b33ULL },
+  { 290, 0x7e9c4b34ULL },
+  { 291, 0x3e9c8b57ULL },
+  { 292, 0x3e8c4b53ULL },
+  { 293, 0x8e7c5b34ULL },
+  { 294, 0x3e7c5b83ULL },
+  { 296, 0x3e9c5b84ULL },
+  { 297, 0x5e5d3d57ULL },
+  { 298, 0x774e35c9ULL },
+  { 299, 0x5e3d3d54ULL },
+  { 300, 0x738e39c9ULL },
+  { 301, 0x4e7d3d48ULL },
+  { 305, 0x4e4d3d84ULL },
+  { 306, 0x7e3b3d03ULL },
+  { 307, 0x7e4b3d33ULL },
+  { 309, 0x8e3b3d33ULL },
+  { 311, 0x8e7b3d54ULL },
+  { 314, 0x9e7b3d84ULL },
+  { 315, 0x9e7c3b03ULL },
+  { 316, 0x7e9c3b43ULL },
+  { 318, 0x9e8c3b33ULL },
+  { 324, 0x675e69c6ULL },
+  { 325, 0x465e6c49ULL },
+  { 326, 0x6e47d444ULL },
+  { 327, 0x885e89c6ULL },
+  { 328, 0x604e85c7ULL },
+  { 329, 0x7e85d604ULL },
+  { 330, 0x6e89d885ULL },
+  { 331, 0x604e7c85ULL },
+  { 332, 0x6e08d084ULL },
+  { 333, 0x9e6b5d57ULL },
+  { 334, 0x4e9b5d56ULL },
+  { 335, 0x6e4b4d04ULL },
+  { 336, 0x8e6b5d07ULL },
+  { 337, 0x8e8b4d46ULL },
+  { 339, 0x6e5b8d88ULL },
+  { 340, 0x9e8b4d86ULL },
+  { 341, 0x6e6b4d84ULL },
+  { 342, 0x5e9c6b95ULL },
+  { 343, 0x4e9c7b76ULL },
+  { 344, 0x9e6c6b54ULL },
+  { 345, 0x9e8c7b56ULL },
+  { 346, 0x4e8c7b06ULL },
+  { 347, 0x6e8c5b64ULL },
+  { 348, 0x5e9c7b86ULL },
+  { 349, 0x4e9c6b85ULL },
+  { 350, 0x6e7c6b84ULL },
+  { 351, 0x33e5c66ULL },
+  { 352, 0x403e4c67ULL },
+  { 353, 0x63e9c04ULL },
+  { 354, 0x83e67c5ULL },
+  { 355, 0x435e98c6ULL },
+  { 356, 0x6e38d894ULL },
+  { 357, 0x5e67d083ULL },
+  { 358, 0x843e6c85ULL },
+  { 359, 0x633e7c84ULL },
+  { 360, 0x3e9b5d06ULL },
+  { 361, 0x4e3b9d36ULL },
+  { 362, 0x6e3b5d54ULL },
+  { 363, 0x8e3b6d66ULL },
+  { 364, 0x5e34b8c6ULL },
+  { 368, 0x5e3b6d84ULL },
+  { 369, 0x9e6c9b36ULL },
+  { 370, 0x6e6c4b03ULL },
+  { 371, 0x7e6c6b34ULL },
+  { 372, 0x5e8c6b35ULL },
+  { 373, 0x8e7c4b63ULL },
+  { 375, 0x8e6c5b83ULL },
+  { 376, 0x6e8c4b83ULL },
+  { 378, 0x563e37c5ULL },
+  { 379, 0x4e3d3d63ULL },
+  { 381, 0x873e36c6ULL },
+  { 382, 0x894e38c6ULL },
+  { 387, 0x6e5b3d33ULL },
+  { 388, 0x6e4b3d03ULL },
+  { 389, 0x9e6b3d54ULL },
+  { 391, 0x8e4b3d63ULL },
+  { 396, 0x6e9c3b33ULL },
+  { 399, 0x6e8c3b03ULL },
+  { 406, 0x9e46d675ULL },
+  { 407, 0x7e56d554ULL },
+  { 409, 0x8e86d445ULL },
+  { 410, 0x6e86d804ULL },
+  { 411, 0x9e56d585ULL },
+  { 413, 0x8e06d084ULL },
+  { 417, 0x7e56b9c8ULL },
+  { 418, 0x4e06b8c8ULL },
+  { 432, 0x5e06d003ULL },
+  { 433, 0x5e96d543ULL },
+  { 435, 0x6e36d873ULL },
+  { 436, 0x5e86d043ULL },
+  { 439, 0x6e46d483ULL },
+  { 440, 0x7e96d384ULL },
+  { 441, 0x3e06b9c7ULL },
+  { 444, 0x9e36b9c8ULL },
+  { 486, 0x5e9c5a5ULL },
+  { 487, 0x45e9c5a9ULL },
+  { 488, 0x54e9d504ULL },
+  { 489, 0x97e9c8a7ULL },
+  { 490, 0x4e8c4a8ULL },
+  { 491, 0x89e85a04ULL },
+  { 493, 0x48e7d885ULL },
+  { 494, 0x79e5d584ULL },
+  { 496, 0x95e4b9c7ULL },
+  { 498, 0x85e5b9c7ULL },
+  { 499, 0x94e7b8c7ULL },
+  { 505, 0x55e44b99ULL },
+  { 508, 0x54e44b98ULL },
+  { 511, 0x84e04b88ULL },
+  { 513, 0x3e3c9a3ULL },
+  { 514, 0x94e7d343ULL },
+  { 515, 0x39e35a04ULL },
+  { 516, 0x59e85a73ULL },
+  { 517, 0x38e84a53ULL },
+  { 518, 0x78e34a44ULL },
+  { 519, 0x77e5d583ULL },
+  { 520, 0x59e4d083ULL },
+  { 521, 0x39e54a84ULL },
+  { 522, 0x3e5b7c5ULL },
+  { 523, 0x33e3b4c9ULL },
+  { 524, 0x33e3b9c4ULL },
+  { 525, 0x73e3b8c5ULL },
+  { 531, 0x73e35b09ULL },
+  { 532, 0x44e35b79ULL },
+  { 534, 0x83e55b39ULL },
+  { 535, 0x84e54b39ULL },
+  { 537, 0x83e05b88ULL },
+  { 538, 0x54e34b88ULL },
+  { 540, 0x7e73a33ULL },
+  { 541, 0x37e93a43ULL },
+  { 542, 0x77e43a34ULL },
+  { 543, 0x39e83a55ULL },
+  { 544, 0x48e43a05ULL },
+  { 545, 0x48e93a54ULL },
+  { 546, 0x57e73a83ULL },
+  { 548, 0x38e53a84ULL },
+  { 558, 0x73e33b07ULL },
+  { 559, 0x95e43b39ULL },
+  { 561, 0x93e83b77ULL },
+  { 562, 0x94e43b38ULL },
+  { 564, 0x85e03b88ULL },
+  { 565, 0x45e43b88ULL },
+  { 567, 0x95e9c6a5ULL },
+  { 568, 0x69e4c4c6ULL },
+  { 569, 0x59e94a64ULL },
+  { 570, 0x56e9a8c7ULL },
+  { 571, 0x49e7d856ULL },
+  { 572, 0x46e7d844ULL },
+  { 573, 0x56e9d585ULL },
+  { 574, 0x67e9d486ULL },
+  { 575, 0x69e5d084ULL },
+  { 576, 0x65e7b9c7ULL },
+  { 577, 0x94e5b9c6ULL },
+  { 579, 0x76e5b9c8ULL },
+  { 580, 0x4e8b8c6ULL },
+  { 586, 0x64e94b59ULL },
+  { 589, 0x64e04b68ULL },
+  { 594, 0x36e9a9c6ULL },
+  { 595, 0x9e45a63ULL },
+  { 596, 0x69e35a34ULL },
+  { 597, 0x83e8a6c5ULL },
+  { 598, 0x68e74a93ULL },
+  { 599, 0x63e8c4a4ULL },
+  { 600, 0x67e5d083ULL },
+  { 601, 0x69e4d483ULL },
+  { 602, 0x96e7d384ULL },
+  { 603, 0x6e3b9c7ULL },
+  { 604, 0x64e3b7c7ULL },
+  { 606, 0x93e9b8c6ULL },
+  { 607, 0x54e3b8c6ULL },
+  { 612, 0x63e75b39ULL },
+  { 613, 0x63e45b09ULL },
+  { 615, 0x63e05b68ULL },
+  { 616, 0x93e74b68ULL },
+  { 618, 0x83e06b89ULL },
+  { 619, 0x43e46b89ULL },
+  { 621, 0x39e73a65ULL },
+  { 622, 0x7e43a63ULL },
+  { 623, 0x67e33a34ULL },
+  { 624, 0x86e53a33ULL },
+  { 625, 0x86e43a43ULL },
+  { 626, 0x68e93a74ULL },
+  { 627, 0x86e03a83ULL },
+  { 629, 0x68e83a84ULL },
+  { 639, 0x65e73b39ULL },
+  { 640, 0x63e43b07ULL },
+  { 642, 0x83e83b67ULL },
+  { 643, 0x94e73b68ULL },
+  { 645, 0x83e03b86ULL },
+  { 646, 0x43e43b86ULL },
+  { 648, 0x95e6c9a5ULL },
+  { 649, 0x69e64a05ULL },
+  { 650, 0x69e65a04ULL },
+  { 651, 0x87e6a9c8ULL },
+  { 652, 0x45e6c8a6ULL },
+  { 653, 0x86e6d804ULL },
+  { 654, 0x89e6d885ULL },
+  { 656, 0x8e6d084ULL },
+  { 657, 0x75e6b9c7ULL },
+  { 660, 0x5e6b8c7ULL },
+  { 661, 0x84e6b9c6ULL },
+  { 667, 0x44e64b09ULL },
+  { 670, 0x4e64b68ULL },
+  { 675, 0x93e6c6a3ULL },
+  { 676, 0x45e6c3c3ULL },
+  { 677, 0x39e64a74ULL },
+  { 678, 0x36e6d873ULL },
+  { 679, 0x85e6d843ULL },
+  { 680, 0x37e6d834ULL },
+  { 682, 0x46e6d483ULL },
+  { 684, 0x3e6b6c6ULL },
+  { 685, 0x34e6b7c7ULL },
+  { 686, 0x3e6b9c4ULL },
+  { 688, 0x43e6b8c5ULL },
+  { 693, 0x73e65b39ULL },
+  { 694, 0x3e64b67ULL },
+  { 696, 0x3e65b68ULL },
+  { 697, 0x43e64b08ULL },
+  { 702, 0x96e63a33ULL },
+  { 703, 0x7e63a43ULL },
+  { 704, 0x67e63a04ULL },
+  { 705, 0x68e63a05ULL },
+  { 707, 0x8e63a44ULL },
+  { 709, 0x47e63a83ULL },
+  { 710, 0x48e63a84ULL },
+  { 720, 0x33e63b96ULL },
+  { 721, 0x43e63b07ULL },
+  { 723, 0x5e63b68ULL },
+  { 724, 0x83e63b47ULL },
+  { 972, 0x7e71d911ULL },
+  { 973, 0x401e59a9ULL },
+  { 974, 0x9e1c5d54ULL },
+  { 975, 0x9e19d918ULL },
+  { 976, 0x8e5d04c1ULL },
+  { 977, 0x8e1c5d04ULL },
+  { 978, 0x7e5a9d81ULL },
+  { 979, 0x4e54d081ULL },
+  { 980, 0x7e1a8d84ULL },
+  { 981, 0x9e7b11a5ULL },
+  { 982, 0x4e7b11c1ULL },
+  { 983, 0x9e11b5c4ULL },
+  { 984, 0x8e8b51a1ULL },
+  { 985, 0x4e8a11b7ULL },
+  { 986, 0x8e1b5d54ULL },
+  { 987, 0x9e9b1c81ULL },
+  { 989, 0x5e1b8d84ULL },
+  { 990, 0x9e5a7b11ULL },
+  { 991, 0x9e1b4b41ULL },
+  { 992, 0x5e9c4b14ULL },
+  { 993, 0x8e1c9b71ULL },
+  { 994, 0x8e4b5b71ULL },
+  { 995, 0x9e8c4b14ULL },
+  { 996, 0x9e8b1b81ULL },
+  { 997, 0x9e5b4b81ULL },
+  { 999, 0x531e9c51ULL },
+  { 1000, 0x3e74d141ULL },
+  { 1001, 0x7e95d314ULL },
+  { 1002, 0x5e9d81a3ULL },
+  { 1003, 0x4e73d841ULL },
+  { 1004, 0x5e38d514ULL },
+  { 1005, 0x3e1a9d81ULL },
+  { 1008, 0x5e31a9b1ULL },
+  { 1009, 0x4e11b5c3ULL },
+  { 1010, 0x3e31b4c4ULL },
+  { 1011, 0x8e5b01a3ULL },
+  { 1012, 0x9e41a8b3ULL },
+  { 1013, 0x9e31a8b4ULL },
+  { 1017, 0x5e3a9b11ULL },
+  { 1018, 0x1e3c4b31ULL },
+  { 1020, 0x8e5c1b31ULL },
+  { 1021, 0x4e1b8b31ULL },
+  { 1023, 0x8e3b7b81ULL },
+  { 1026, 0x951e35c3ULL },
+  { 1027, 0x9e4a3d51ULL },
+  { 1028, 0x141e3c74ULL },
+  { 1029, 0x8e3a3d51ULL },
+  { 1030, 0x401e31c8ULL },
+  { 1032, 0x7e1a3d81ULL },
+  { 1033, 0x471e3c85ULL },
+  { 1034, 0x441e3c84ULL },
+  { 1035, 0x5e9b3a11ULL },
+  { 1036, 0x9e4b3a01ULL },
+  { 1038, 0x8e5b3a01ULL },
+  { 1039, 0x9e8b3a41ULL },
+  { 1040, 0x9e8b31a4ULL },
+  { 1041, 0x5e1b3d81ULL },
+  { 1044, 0x9e3b3b51ULL },
+  { 1045, 0x1e4c3b31ULL },
+  { 1047, 0x8e1c3b11ULL },
+  { 1048, 0x8e3b3b41ULL },
+  { 1050, 0x8e7b3b81ULL },
+  { 1053, 0x501e99a6ULL },
+  { 1054, 0x6e1c9d45ULL },
+  { 1055, 0x461e4c14ULL },
+  { 1056, 0x8e7d1d65ULL },
+  { 1057, 0x8e6d84c1ULL },
+  { 1058, 0x6e8d61a4ULL },
+  { 1059, 0x801e6c81ULL },
+  { 1060, 0x4e1a6d81ULL },
+  { 1061, 0x8e6d1d84ULL },
+  { 1062, 0x6e9b01a5ULL },
+  { 1063, 0x4e9a11b6ULL },
+  { 1064, 0x6e1b7d94ULL },
+  { 1065, 0x6e8a11b9ULL },
+  { 1066, 0x1e8d04b6ULL },
+  { 1067, 0x8e6b01a4ULL },
+  { 1070, 0x7e1b6d84ULL },
+  { 1071, 0x9e1c6b51ULL },
+  { 1072, 0x6e1b7b41ULL },
+  { 1073, 0x6e7c5b14ULL },
+  { 1074, 0x8e1c8b61ULL },
+  { 1075, 0x6e8c1b41ULL },
+  { 1076, 0x1e8c6b94ULL },
+  { 1077, 0x7e6b5b81ULL },
+  { 1078, 0x8e6b4b81ULL },
+  { 1080, 0x6e5d1d03ULL },
+  { 1081, 0x9e4d1d63ULL },
+  { 1082, 0x631e43c4ULL },
+  { 1083, 0x681e6c13ULL },
+  { 1084, 0x3e64d831ULL },
+  { 1086, 0x6e3d1d81ULL },
+  { 1089, 0x7e11b3c6ULL },
+  { 1090, 0x4e1b6d03ULL },
+  { 1092, 0x6e11a8b3ULL },
+  { 1093, 0x8e1b4d63ULL },
+  { 1098, 0x6e1b6b31ULL },
+  { 1099, 0x6e3b4b31ULL },
+  { 1100, 0x1e7c6b34ULL },
+  { 1101, 0x5e3b8b61ULL },
+  { 1104, 0x9e3b6b81ULL },
+  { 1105, 0x6e3c4b81ULL },
+  { 1107, 0x9e7d36c1ULL },
+  { 1108, 0x144e36c7ULL },
+  { 1110, 0x981e36c3ULL },
+  { 1112, 0x831e3c64ULL },
+  { 1113, 0x6e1c3d81ULL },
+  { 1116, 0x7e6b3a01ULL },
+  { 1119, 0x8e6b3a11ULL },
+  { 1125, 0x6e6b3b51ULL },
+  { 1126, 0x6e4b3b31ULL },
+  { 1128, 0x8e5b3b61ULL },
+  { 1131, 0x9e6b3b81ULL },
+  { 1132, 0x6e4c3b81ULL },
+  { 1135, 0x9e16d945ULL },
+  { 1136, 0x6e96d414ULL },
+  { 1142, 0x8e16d884ULL },
+  { 1161, 0x5e16d503ULL },
+  { 1163, 0x7e36d144ULL },
+  { 1164, 0x3e66d891ULL },
+  { 1167, 0x3e16d381ULL },
+  { 1173, 0x3e16b8c8ULL },
+  { 1215, 0x7e95a11ULL },
+  { 1216, 0x47e91a55ULL },
+  { 1217, 0x19e74a44ULL },
+  { 1218, 0x89e11a78ULL },
+  { 1219, 0x59e11a48ULL },
+  { 1220, 0x95e81a14ULL },
+  { 1221, 0x79e97a81ULL },
+  { 1222, 0x54e4d081ULL },
+  { 1223, 0x85e01a84ULL },
+  { 1224, 0x99e1b001ULL },
+  { 1225, 0x44e1b9c5ULL },
+  { 1227, 0x55e1b8c7ULL },
+  { 1228, 0x84e1b7c7ULL },
+  { 1233, 0x95e11b07ULL },
+  { 1234, 0x74e44b19ULL },
+  { 1236, 0x97e01b98ULL },
+  { 1237, 0x47e11b58ULL },
+  { 1239, 0x87e01b88ULL },
+  { 1240, 0x74e11b85ULL },
+  { 1242, 0x93e3d711ULL },
+  { 1243, 0x15e41a73ULL },
+  { 1244, 0x75e31a44ULL },
+  { 1245, 0x17e85a31ULL },
+  { 1246, 0x48e37a11ULL },
+  { 1247, 0x38e5d514ULL },
+  { 1248, 0x19e37a81ULL },
+  { 1249, 0x84e01a83ULL },
+  { 1250, 0x19e34a84ULL },
+  { 1251, 0x79e3b001ULL },
+  { 1252, 0x43e1b7c5ULL },
+  { 1253, 0x53e1b9c4ULL },
+  { 1254, 0x93e1b8c5ULL },
+  { 1255, 0x13e1b4c8ULL },
+  { 1256, 0x13e1b8c4ULL },
+  { 1260, 0x77e31b09ULL },
+  { 1261, 0x44e31b75ULL },
+  { 1262, 0x33e11b44ULL },
+  { 1263, 0x83e35b19ULL },
+  { 1264, 0x34e14b48ULL },
+  { 1265, 0x83e11b94ULL },
+  { 1266, 0x57e31b88ULL },
+  { 1267, 0x54e31b85ULL },
+  { 1268, 0x83e01b84ULL },
+  { 1269, 0x5e93a11ULL },
+  { 1270, 0x35e93a41ULL },
+  { 1271, 0x47e33a14ULL },
+  { 1272, 0x88e13a75ULL },
+  { 1273, 0x58e43a15ULL },
+  { 1274, 0x87e73a14ULL },
+  { 1275, 0x35e53a81ULL },
+  { 1276, 0x84e03a81ULL },
+  { 1277, 0x97e13a84ULL },
+  { 1287, 0x93e13b07ULL },
+  { 1288, 0x44e13b57ULL },
+  { 1290, 0x85e13b98ULL },
+  { 1291, 0x84e13b97ULL },
+  { 1293, 0x75e13b88ULL },
+  { 1294, 0x74e13b87ULL },
+  { 1296, 0x19e51a67ULL },
+  { 1297, 0x56e94a61ULL },
+  { 1298, 0x16e51a64ULL },
+  { 1299, 0x68e11a57ULL },
+  { 1300, 0x47e85a61ULL },
+  { 1301, 0x78e14a64ULL },
+  { 1302, 0x67e85a81ULL },
+  { 1303, 0x56e74a81ULL },
+  { 1304, 0x56e71a84ULL },
+  { 1305, 0x69e9b501ULL },
+  { 1306, 0x14e1b7c6ULL },
+  { 1308, 0x89e8b601ULL },
+  { 1309, 0x74e1b8c6ULL },
+  { 1314, 0x67e51b19ULL },
+  { 1315, 0x15e41b56ULL },
+  { 1317, 0x86e11b97ULL },
+  { 1318, 0x74e81b56ULL },
+  { 1320, 0x85e01b86ULL },
+  { 1321, 0x45e41b86ULL },
+  { 1323, 0x33e5d561ULL },
+  { 1324, 0x76e45a31ULL },
+  { 1325, 0x36e7d144ULL },
+  { 1326, 0x68e37a31ULL },
+  { 1327, 0x38e96a41ULL },
+  { 1328, 0x16e81a34ULL },
+  { 1329, 0x36e3d981ULL },
+  { 1330, 0x16e34a81ULL },
+  { 1331, 0x16e31a84ULL },
+  { 1332, 0x53e1b6c6ULL },
+  { 1335, 0x36e1b8c8ULL },
+  { 1341, 0x66e31b97ULL },
+  { 1342, 0x35e41b76ULL },
+  { 1343, 0x53e11b64ULL },
+  { 1344, 0x37e31b68ULL },
+  { 1345, 0x34e81b16ULL },
+  { 1347, 0x55e31b86ULL },
+  { 1350, 0x66e53a13ULL },
+  { 1351, 0x56e43a13ULL },
+  { 1352, 0x67e53a14ULL },
+  { 1353, 0x89e73a16ULL },
+  { 1354, 0x45e83a61ULL },
+  { 1355, 0x18e53a64ULL },
+  { 1356, 0x96e13a83ULL },
+  { 1368, 0x53e13b66ULL },
+  { 1369, 0x43e13b56ULL },
+  { 1371, 0x83e13b96ULL },
+  { 1372, 0x64e53b18ULL },
+  { 1374, 0x73e13b86ULL },
+  { 1377, 0x17e61a55ULL },
+  { 1378, 0x75e64a11ULL },
+  { 1379, 0x96e6d414ULL },
+  { 1380, 0x69e68a01ULL },
+  { 1381, 0x84e6c8c1ULL },
+  { 1382, 0x78e64a14ULL },
+  { 1384, 0x47e65a81ULL },
+  { 1385, 0x18e6d684ULL },
+  { 1386, 0x59e6b101ULL },
+  { 1387, 0x49e6b001ULL },
+  { 1390, 0x89e6b401ULL },
+  { 1395, 0x15e61b76ULL },
+  { 1396, 0x14e61b75ULL },
+  { 1398, 0x56e61b18ULL },
+  { 1399, 0x84e61b46ULL },
+  { 1404, 0x96e65a31ULL },
+  { 1405, 0x95e64a31ULL },
+  { 1406, 0x95e61a34ULL },
+  { 1407, 0x98e67a31ULL },
+  { 1408, 0x18e64a53ULL },
+  { 1410, 0x3e6d081ULL },
+  { 1411, 0x43e61a81ULL },
+  { 1413, 0x79e6b301ULL },
+  { 1422, 0x36e61b97ULL },
+  { 1423, 0x43e61b05ULL },
+  { 1424, 0x3e61b64ULL },
+  { 1425, 0x76e61b38ULL },
+  { 1426, 0x83e61b45ULL },
+  { 1431, 0x55e63a91ULL },
+  { 1432, 0x64e63a01ULL },
+  { 1433, 0x77e63a14ULL },
+  { 1434, 0x78e63a15ULL },
+  { 1436, 0x18e63a54ULL },
+  { 1438, 0x45e63a81ULL },
+  { 1449, 0x13e63b76ULL },
+  { 1450, 0x14e63b77ULL },
+  { 1452, 0x15e63b78ULL },
+  { 1453, 0x54e63b18ULL },
+  { 1701, 0x911e7c71ULL },
+  { 1704, 0x18e9c09ULL },
+  { 1705, 0x815e7c47ULL },
+  { 1728, 0x711e9c31ULL },
+  { 1729, 0x314e7c95ULL },
+  { 1730, 0x513e7c54ULL },
+  { 1732, 0x411e83c3ULL },
+  { 1755, 0x111e3c73ULL },
+  { 1759, 0x514e38c5ULL },
+  { 1762, 0x411e3c83ULL },
+  { 1783, 0x411e6c91ULL },
+  { 1784, 0x414e9c64ULL },
+  { 1785, 0x15e58c6ULL },
+  { 1788, 0x616e7c88ULL },
+  { 1809, 0x513e5c36ULL },
+  { 1810, 0x613e4c97ULL },
+  { 1811, 0x613e97c4ULL },
+  { 1812, 0x813e6c35ULL },
+  { 1836, 0x513e36c5ULL },
+  { 1839, 0x813e35c6ULL },
+  { 1944, 0x91e9d171ULL },
+  { 1945, 0x41e5a1c9ULL },
+  { 1946, 0x71e1a4c4ULL },
+  { 1947, 0x71e9a1c8ULL },
+  { 1948, 0x91e8a4a7ULL },
+  { 1949, 0x71e8a5a4ULL },
+  { 1953, 0x11e1b5a7ULL },
+  { 1954, 0x1e9a4b5ULL },
+  { 1955, 0x51e1b4c4ULL },
+  { 1956, 0x51e8a1b8ULL },
+  { 1957, 0x41e1b8a7ULL },
+  { 1958, 0x11e1b8a4ULL },
+  { 1962, 0x91e15b07ULL },
+  { 1963, 0x91e55b47ULL },
+  { 1965, 0x91e07b98ULL },
+  { 1966, 0x41e17b58ULL },
+  { 1968, 0x81e07b88ULL },
+  { 1969, 0x41e47b88ULL },
+  { 1971, 0x11e3a5a3ULL },
+  { 1972, 0x51e3c4a3ULL },
+  { 1973, 0x31e1a3c4ULL },
+  { 1974, 0x11e3c1a8ULL },
+  { 1975, 0x51e4a3a8ULL },
+  { 1976, 0x31e8a1a4ULL },
+  { 1980, 0x31e1b5a9ULL },
+  { 1981, 0x41e1b5c3ULL },
+  { 1982, 0x31e3b4c4ULL },
+  { 1983, 0x91e5b3c8ULL },
+  { 1984, 0x41e3b9a8ULL },
+  { 1989, 0x71e35b07ULL },
+  { 1990, 0x91e45b37ULL },
+  { 1992, 0x81e35b17ULL },
+  { 1993, 0x31e17b48ULL },
+  { 1995, 0x51e37b88ULL },
+  { 1996, 0x51e34b85ULL },
+  { 2016, 0x91e13b05ULL },
+  { 2017, 0x91e43b35ULL },
+  { 2018, 0x31e13b44ULL },
+  { 2019, 0x81e53b35ULL },
+  { 2021, 0x81e13b94ULL },
+  { 2022, 0x91e93b85ULL },
+  { 2024, 0x81e03b84ULL },
+  { 2025, 0x51e9a1c6ULL },
+  { 2026, 0x41e1a6a7ULL },
+  { 2027, 0x61e1d4c4ULL },
+  { 2028, 0x61e8a7a1ULL },
+  { 2029, 0x41e8a6c1ULL },
+  { 2030, 0x61e8a4a4ULL },
+  { 2034, 0x1e9a5b6ULL },
+  { 2035, 0x41e9a1b6ULL },
+  { 2036, 0x91e5b6c4ULL },
+  { 2037, 0x61e1b9a8ULL },
+  { 2038, 0x1e4b8a6ULL },
+  { 2039, 0x61e8b6c4ULL },
+  { 2043, 0x61e57b19ULL },
+  { 2044, 0x71e44b16ULL },
+  { 2046, 0x81e16b97ULL },
+  { 2047, 0x71e84b56ULL },
+  { 2049, 0x81e05b86ULL },
+  { 2050, 0x91e94b86ULL },
+  { 2052, 0x91e1a3c6ULL },
+  { 2053, 0x31e4a6a3ULL },
+  { 2054, 0x61e9a3a4ULL },
+  { 2055, 0x61e3d6c8ULL },
+  { 2056, 0x81e4c3a6ULL },
+  { 2061, 0x71e1b6c3ULL },
+  { 2062, 0x41e4b6c3ULL },
+  { 2064, 0x31e1b8a6ULL },
+  { 2070, 0x61e35b96ULL },
+  { 2071, 0x31e45b76ULL },
+  { 2073, 0x31e86b18ULL },
+  { 2074, 0x81e34b16ULL },
+  { 2076, 0x51e35b86ULL },
+  { 2097, 0x61e93b55ULL },
+  { 2098, 0x61e43b05ULL },
+  { 2099, 0x51e13b64ULL },
+  { 2100, 0x81e83b65ULL },
+  { 2101, 0x61e83b45ULL },
+  { 2106, 0x11e6a5c1ULL },
+  { 2107, 0x91e6d411ULL },
+  { 2108, 0x1e6c1a4ULL },
+  { 2109, 0x91e6a8a5ULL },
+  { 2110, 0x41e6a8c1ULL },
+  { 2111, 0x81e6a8a4ULL },
+  { 2115, 0x1e6b9a7ULL },
+  { 2116, 0x41e6b4c5ULL },
+  { 2117, 0x1e6b4c4ULL },
+  { 2118, 0x1e6b8a8ULL },
+  { 2119, 0x81e6b4c6ULL },
+  { 2120, 0x81e6b6c4ULL },
+  { 2124, 0x11e65b76ULL },
+  { 2125, 0x11e64b75ULL },
+  { 2127, 0x51e66b18ULL },
+  { 2128, 0x81e64b46ULL },
+  { 2133, 0x31e6a7c1ULL },
+  { 2134, 0x31e6a4a3ULL },
+  { 2135, 0x31e6a3a4ULL },
+  { 2136, 0x81e6c3c1ULL },
+  { 2137, 0x81e6a4c3ULL },
+  { 2138, 0x81e6a3c4ULL },
+  { 2142, 0x51e6b7c3ULL },
+  { 2145, 0x31e6a1b8ULL },
+  { 2151, 0x31e65b96ULL },
+  { 2152, 0x31e64b95ULL },
+  { 2154, 0x71e66b38ULL },
+  { 2155, 0x81e61b43ULL },
+  { 2178, 0x51e63b15ULL },
+  { 2179, 0x41e63b05ULL },
+  { 2180, 0x1e63b64ULL },
+  { 2182, 0x81e63b45ULL },
+  { 2430, 0x522e9c52ULL },
+  { 2431, 0x492e24c7ULL },
+  { 2432, 0x4e2d5d04ULL },
+  { 2433, 0x8e7d82c2ULL },
+  { 2434, 0x802e4c25ULL },
+  { 2435, 0x8e5d02a4ULL },
+  { 2436, 0x7e2d2d82ULL },
+  { 2437, 0x7e04d082ULL },
+  { 2438, 0x42e5c84ULL },
+  { 2439, 0x5e5b2d02ULL },
+  { 2440, 0x7e4b2d22ULL },
+  { 2441, 0x9e2b4d44ULL },
+  { 2442, 0x7e2b8d27ULL },
+  { 2443, 0x4e5b8d27ULL },
+  { 2444, 0x8e2b4d04ULL },
+  { 2445, 0x9e5b2d82ULL },
+  { 2446, 0x5e2b4d82ULL },
+  { 2447, 0x4e2b8d84ULL },
+  { 2448, 0x7e9c2b52ULL },
+  { 2449, 0x9e4c4b52ULL },
+  { 2450, 0x7e7c5b24ULL },
+  { 2451, 0x9e8b8b52ULL },
+  { 2452, 0x8e8b4b02ULL },
+  { 2455, 0x8e5c4b82ULL },
+  { 2457, 0x372e7c93ULL },
+  { 2458, 0x4e3d2d42ULL },
+  { 2459, 0x9e3a7d24ULL },
+  { 2460, 0x9e5a8d23ULL },
+  { 2461, 0x4e38d233ULL },
+  { 2462, 0x823e28c4ULL },
+  { 2463, 0x8e53d082ULL },
+  { 2464, 0x3e49d282ULL },
+  { 2465, 0x8e3d2d84ULL },
+  { 2466, 0x9e7b2d23ULL },
+  { 2467, 0x3e5b4d23ULL },
+  { 2468, 0x3e3b7d24ULL },
+  { 2469, 0x8e7b2d03ULL },
+  { 2470, 0x9e8b2d43ULL },
+  { 2471, 0x3e2b8d04ULL },
+  { 2473, 0x4e3b4d82ULL },
+  { 2475, 0x9e7c2b32ULL },
+  { 2476, 0x3e4c5b32ULL },
+  { 2478, 0x8e3c8b23ULL },
+  { 2479, 0x8e3c4b02ULL },
+  { 2481, 0x3e5c5b82ULL },
+  { 2482, 0x4e3c8b82ULL },
+  { 2484, 0x972e39c3ULL },
+  { 2485, 0x4e2d3d42ULL },
+  { 2486, 0x7e2d3d24ULL },
+  { 2487, 0x8e3d3d27ULL },
+  { 2488, 0x942e38c3ULL },
+  { 2491, 0x432e3c87ULL },
+  { 2492, 0x8e2d3d84ULL },
+  { 2493, 0x7e2b3d72ULL },
+  { 2494, 0x5e3b3d42ULL },
+  { 2495, 0x9e5b3d24ULL },
+  { 2496, 0x8e2b3d03ULL },
+  { 2502, 0x5e5c3b02ULL },
+  { 2503, 0x9e5c3b42ULL },
+  { 2505, 0x9e8b3b02ULL },
+  { 2506, 0x8e4c3b02ULL },
+  { 2508, 0x7e7c3b82ULL },
+  { 2509, 0x4e8c3b82ULL },
+  { 2511, 0x6e2a5d02ULL },
+  { 2512, 0x652e4c46ULL },
+  { 2513, 0x62e56c4ULL },
+  { 2514, 0x802e8c62ULL },
+  { 2515, 0x862e4c76ULL },
+  { 2516, 0x6e28d294ULL },
+  { 2517, 0x5e65d082ULL },
+  { 2518, 0x6e74d282ULL },
+  { 2519, 0x6e4d2d84ULL },
+  { 2520, 0x9e62b5c7ULL },
+  { 2521, 0x6e42b6c5ULL },
+  { 2522, 0x6e2b5d04ULL },
+  { 2523, 0x5e2b8d65ULL },
+  { 2524, 0x6e2b8d46ULL },
+  { 2525, 0x6e62b8c4ULL },
+  { 2526, 0x8e6b2d82ULL },
+  { 2528, 0x6e2b6d84ULL },
+  { 2529, 0x9e7b6b22ULL },
+  { 2530, 0x6e4c4b22ULL },
+  { 2531, 0x6e9c4b24ULL },
+  { 2532, 0x8e6c2b02ULL },
+  { 2533, 0x4e8c6b25ULL },
+  { 2536, 0x4e6c4b82ULL },
+  { 2538, 0x702e96c3ULL },
+  { 2539, 0x402e6c43ULL },
+  { 2540, 0x6e27d234ULL },
+  { 2541, 0x822e83c6ULL },
+  { 2542, 0x462e88c3ULL },
+  { 2543, 0x633e8c24ULL },
+  { 2544, 0x8e63d882ULL },
+  { 2547, 0x3e9d72b6ULL },
+  { 2548, 0x6e2b4d23ULL },
+  { 2549, 0x4e3b6d24ULL },
+  { 2550, 0x6e3b8d27ULL },
+  { 2551, 0x3e8d42b6ULL },
+  { 2556, 0x5e3c6b32ULL },
+  { 2557, 0x4e3c6b22ULL },
+  { 2559, 0x9e8b6b32ULL },
+  { 2560, 0x8e6c4b23ULL },
+  { 2565, 0x702e3c96ULL },
+  { 2566, 0x6e4d3d27ULL },
+  { 2568, 0x852e3c68ULL },
+  { 2569, 0x852e34c6ULL },
+  { 2572, 0x402e3c86ULL },
+  { 2574, 0x6e3b3d72ULL },
+  { 2575, 0x6e2b3d42ULL },
+  { 2579, 0x8e6b3d24ULL },
+  { 2583, 0x5e6c3b32ULL },
+  { 2584, 0x4e6c3b22ULL },
+  { 2586, 0x8e6c3b62ULL },
+  { 2593, 0x4e46d652ULL },
+  { 2594, 0x6e76d204ULL },
+  { 2595, 0x8e56d025ULL },
+  { 2596, 0x4e26d842ULL },
+  { 2597, 0x8e26d694ULL },
+  { 2619, 0x3e96d702ULL },
+  { 2620, 0x4e36d252ULL },
+  { 2621, 0x7e26d434ULL },
+  { 2623, 0x3e86d402ULL },
+  { 2673, 0x97e25a72ULL },
+  { 2674, 0x97e42a55ULL },
+  { 2675, 0x79e55a24ULL },
+  { 2676, 0x85e8c7a2ULL },
+  { 2677, 0x47e8c9a2ULL },
+  { 2678, 0x9e84a24ULL },
+  { 2679, 0x75e5d582ULL },
+  { 2680, 0x4e7d082ULL },
+  { 2681, 0x57e72a84ULL },
+  { 2682, 0x2e5b5c5ULL },
+  { 2683, 0x74e2b7c7ULL },
+  { 2684, 0x92e7b9c4ULL },
+  { 2685, 0x82e7b7c5ULL },
+  { 2686, 0x82e4b4c8ULL },
+  { 2687, 0x82e4b8c4ULL },
+  { 2691, 0x75e22b97ULL },
+  { 2692, 0x55e42b97ULL },
+  { 2693, 0x52e42b94ULL },
+  { 2694, 0x82e72b55ULL },
+  { 2695, 0x94e82b77ULL },
+  { 2697, 0x85e02b87ULL },
+  { 2698, 0x45e42b87ULL },
+  { 2699, 0x82e02b84ULL },
+  { 2700, 0x59e37a22ULL },
+  { 2701, 0x75e32a43ULL },
+  { 2702, 0x32e3a5c4ULL },
+  { 2703, 0x89e32a57ULL },
+  { 2704, 0x88e4d253ULL },
+  { 2705, 0x43e2a8c4ULL },
+  { 2706, 0x53e8d082ULL },
+  { 2707, 0x49e3d282ULL },
+  { 2708, 0x37e52a84ULL },
+  { 2709, 0x52e2b9c3ULL },
+  { 2710, 0x42e3b9c3ULL },
+  { 2711, 0x52e3b7c4ULL },
+  { 2712, 0x83e2b8c5ULL },
+  { 2713, 0x92e3b4c8ULL },
+  { 2714, 0x92e3b8c4ULL },
+  { 2718, 0x32e07b39ULL },
+  { 2719, 0x32e94b27ULL },
+  { 2720, 0x32e02b34ULL },
+  { 2721, 0x53e25b78ULL },
+  { 2722, 0x84e52b37ULL },
+  { 2724, 0x53e32b85ULL },
+  { 2725, 0x43e42b85ULL },
+  { 2726, 0x52e32b84ULL },
+  { 2727, 0x55e53a02ULL },
+  { 2728, 0x45e43a02ULL },
+  { 2729, 0x77e53a24ULL },
+  { 2730, 0x58e33a25ULL },
+  { 2731, 0x85e43a42ULL },
+  { 2732, 0x8e83a24ULL },
+  { 2733, 0x85e03a82ULL },
+  { 2735, 0x8e23a84ULL },
+  { 2745, 0x75e53b29ULL },
+  { 2746, 0x52e43b95ULL },
+  { 2748, 0x55e23b78ULL },
+  { 2749, 0x83e43b27ULL },
+  { 2751, 0x82e03b85ULL },
+  { 2752, 0x42e43b85ULL },
+  { 2754, 0x65e9c6a2ULL },
+  { 2755, 0x69e42a27ULL },
+  { 2756, 0x69e25a44ULL },
+  { 2757, 0x89e27a62ULL },
+  { 2758, 0x88e42a46ULL },
+  { 2759, 0x46e2c8c4ULL },
+  { 2760, 0x65e82a82ULL },
+  { 2761, 0x86e04a82ULL },
+  { 2762, 0x86e02a84ULL },
+  { 2763, 0x62e9b7c5ULL },
+  { 2764, 0x62e4b6c5ULL },
+  { 2765, 0x2e4b6c4ULL },
+  { 2766, 0x82e2b6c5ULL },
+  { 2767, 0x64e2b8c6ULL },
+  { 2772, 0x96e72b69ULL },
+  { 2773, 0x45e24b69ULL },
+  { 2774, 0x62e02b64ULL },
+  { 2775, 0x95e72b68ULL },
+  { 2776, 0x46e02b48ULL },
+  { 2778, 0x67e22b89ULL },
+  { 2779, 0x84e02b86ULL },
+  { 2780, 0x62e22b84ULL },
+  { 2781, 0x95e32a63ULL },
+  { 2782, 0x36e42a93ULL },
+  { 2783, 0x66e32a34ULL },
+  { 2784, 0x58e22a36ULL },
+  { 2785, 0x78e36a42ULL },
+  { 2786, 0x86e52a34ULL },
+  { 2787, 0x39e56a82ULL },
+  { 2790, 0x72e3b6c5ULL },
+  { 2791, 0x43e2b6c6ULL },
+  { 2799, 0x72e36b09ULL },
+  { 2800, 0x93e42b36ULL },
+  { 2801, 0x32e32b64ULL },
+  { 2802, 0x56e82b39ULL },
+  { 2803, 0x83e42b26ULL },
+  { 2805, 0x56e32b88ULL },
+  { 2806, 0x54e32b86ULL },
+  { 2808, 0x96e73a23ULL },
+  { 2809, 0x36e43a92ULL },
+  { 2810, 0x67e43a24ULL },
+  { 2811, 0x56e83a72ULL },
+  { 2812, 0x68e43a25ULL },
+  { 2813, 0x87e23a64ULL },
+  { 2814, 0x56e73a82ULL },
+  { 2826, 0x72e33b06ULL },
+  { 2827, 0x92e43b36ULL },
+  { 2829, 0x72e83b56ULL },
+  { 2830, 0x82e43b26ULL },
+  { 2832, 0x92e93b86ULL },
+  { 2833, 0x64e23b87ULL },
+  { 2835, 0x65e6c9a2ULL },
+  { 2836, 0x64e62a02ULL },
+  { 2837, 0x76e6d204ULL },
+  { 2838, 0x87e65a22ULL },
+  { 2839, 0x84e62a22ULL },
+  { 2840, 0x86e62a24ULL },
+  { 2841, 0x79e6d285ULL },
+  { 2842, 0x45e62a82ULL },
+  { 2843, 0x47e62a84ULL },
+  { 2844, 0x92e6b7c5ULL },
+  { 2845, 0x42e6b6c5ULL },
+  { 2848, 0x62e6b4c8ULL },
+  { 2849, 0x62e6b8c4ULL },
+  { 2853, 0x92e62b55ULL },
+  { 2854, 0x4e62b66ULL },
+  { 2855, 0x2e62b64ULL },
+  { 2856, 0x65e62b28ULL },
+  { 2857, 0x82e62b45ULL },
+  { 2862, 0x97e65a32ULL },
+  { 2863, 0x6e62a43ULL },
+  { 2864, 0x96e62a34ULL },
+  { 2865, 0x38e65a72ULL },
+  { 2866, 0x34e6d852ULL },
+  { 2869, 0x46e62a83ULL },
+  { 2880, 0x33e62b95ULL },
+  { 2881, 0x43e62b06ULL },
+  { 2882, 0x32e62b94ULL },
+  { 2883, 0x75e62b38ULL },
+  { 2884, 0x83e62b46ULL },
+  { 2889, 0x65e63a02ULL },
+  { 2890, 0x6e63a42ULL },
+  { 2892, 0x85e63a22ULL },
+  { 2894, 0x87e63a24ULL },
+  { 2896, 0x46e63a82ULL },
+  { 2907, 0x32e63b95ULL },
+  { 2908, 0x42e63b06ULL },
+  { 2911, 0x82e63b46ULL },
+  { 3159, 0x501e5c12ULL },
+  { 3160, 0x401e25c2ULL },
+  { 3161, 0x7e7d12a4ULL },
+  { 3162, 0x981e9c12ULL },
+  { 3163, 0x881e49c2ULL },
+  { 3164, 0x5e28d014ULL },
+  { 3165, 0x9e2d1d81ULL },
+  { 3166, 0x7e1c4d82ULL },
+  { 3168, 0x5e7b01a2ULL },
+  { 3169, 0x4e4d21b7ULL },
+  { 3170, 0x1e9d72b4ULL },
+  { 3171, 0x8e5b11a2ULL },
+  { 3172, 0x8e4b21c1ULL },
+  { 3173, 0x8e8b21a4ULL },
+  { 3174, 0x8e1b2d81ULL },
+  { 3175, 0x5e4b2d81ULL },
+  { 3177, 0x1e2c7b51ULL },
+  { 3178, 0x7e2c4b51ULL },
+  { 3180, 0x8e2a5b11ULL },
+  { 3181, 0x8e4a8b21ULL },
+  { 3183, 0x9e7b2b81ULL },
+  { 3184, 0x4e7c2b81ULL },
+  { 3186, 0x3e1d7d12ULL },
+  { 3187, 0x3e14d321ULL },
+  { 3188, 0x21e03c4ULL },
+  { 3189, 0x8e3a2d01ULL },
+  { 3190, 0x8e1c4d23ULL },
+  { 3191, 0x823e8c14ULL },
+  { 3192, 0x3e3d2d81ULL },
+  { 3193, 0x8e32d481ULL },
+  { 3195, 0x9e3b01a2ULL },
+  { 3196, 0x1e3d42b9ULL },
+  { 3198, 0x3e21b7a8ULL },
+  { 3199, 0x4e3d21b8ULL },
+  { 3201, 0x3e1b7d82ULL },
+  { 3204, 0x9e3c2b51ULL },
+  { 3205, 0x5e4c2b31ULL },
+  { 3207, 0x3e1b8b21ULL },
+  { 3208, 0x8e3c2b41ULL },
+  { 3210, 0x1e3c9b82ULL },
+  { 3213, 0x9e1c3d72ULL },
+  { 3214, 0x4e1c3d21ULL },
+  { 3215, 0x321e3c14ULL },
+  { 3216, 0x8e2c3d21ULL },
+  { 3217, 0x8e1c3d42ULL },
+  { 3219, 0x8e2a3d81ULL },
+  { 3222, 0x3e1b3d21ULL },
+  { 3223, 0x4e3b3d12ULL },
+  { 3225, 0x8e7b3a21ULL },
+  { 3229, 0x4e2b3d81ULL },
+  { 3231, 0x9e1c3b21ULL },
+  { 3232, 0x4e2c3b01ULL },
+  { 3234, 0x8e1b3b21ULL },
+  { 3235, 0x8e2c3b41ULL },
+  { 3237, 0x1e9c3b82ULL },
+  { 3240, 0x621e6c12ULL },
+  { 3241, 0x6e4d42c1ULL },
+  { 3242, 0x6e7d1d24ULL },
+  { 3243, 0x821e8c61ULL },
+  { 3244, 0x461e28c2ULL },
+  { 3245, 0x861e4c24ULL },
+  { 3246, 0x621e7c81ULL },
+  { 3249, 0x6e6b21c1ULL },
+  { 3250, 0x1e6b2d41ULL },
+  { 3251, 0x6e1b6d24ULL },
+  { 3252, 0x8e6b21a2ULL },
+  { 3253, 0x1e6d24b8ULL },
+  { 3255, 0x1e2b6d81ULL },
+  { 3256, 0x6e1b4d82ULL },
+  { 3258, 0x9e2b6b71ULL },
+  { 3259, 0x6e4b2b21ULL },
+  { 3261, 0x8e7b6b12ULL },
+  { 3262, 0x8e4c2b61ULL },
+  { 3264, 0x6e6c2b81ULL },
+  { 3267, 0x6e25d213ULL },
+  { 3268, 0x6e4d21a3ULL },
+  { 3270, 0x631e86c2ULL },
+  { 3273, 0x631e2c86ULL },
+  { 3276, 0x6e9b21a3ULL },
+  { 3277, 0x3e1b6d42ULL },
+  { 3278, 0x3e12b6c4ULL },
+  { 3282, 0x6e3b2d81ULL },
+  { 3285, 0x6e3b2b11ULL },
+  { 3294, 0x6e2a3d21ULL },
+  { 3295, 0x641e37c2ULL },
+  { 3296, 0x621e3c24ULL },
+  { 3297, 0x661e38c2ULL },
+  { 3303, 0x9e6b3a21ULL },
+  { 3312, 0x6e2b3b11ULL },
+  { 3321, 0x9e96d126ULL },
+  { 3322, 0x4e16d442ULL },
+  { 3323, 0x7e16d724ULL },
+  { 3324, 0x9e86d216ULL },
+  { 3325, 0x8e46d215ULL },
+  { 3330, 0x1e26b9c7ULL },
+  { 3348, 0x3e76d102ULL },
+  { 3349, 0x3e46d291ULL },
+  { 3354, 0x3e26d681ULL },
+  { 3402, 0x15e2d201ULL },
+  { 3403, 0x4e12a91ULL },
+  { 3404, 0x7e12a94ULL },
+  { 3405, 0x7e81a25ULL },
+  { 3406, 0x84e4d291ULL },
+  { 3407, 0x82e7c1c4ULL },
+  { 3408, 0x7e25a81ULL },
+  { 3409, 0x54e72a81ULL },
+  { 3411, 0x79e5b201ULL },
+  { 3412, 0x42e1b5c5ULL },
+  { 3413, 0x72e1b7c4ULL },
+  { 3414, 0x89e2b001ULL },
+  { 3415, 0x89e4b201ULL },
+  { 3420, 0x92e12b05ULL },
+  { 3421, 0x47e12b59ULL },
+  { 3422, 0x72e41b14ULL },
+  { 3423, 0x95e12b08ULL },
+  { 3424, 0x85e41b27ULL },
+  { 3425, 0x82e71b54ULL },
+  { 3426, 0x75e12b87ULL },
+  { 3428, 0x72e12b84ULL },
+  { 3429, 0x52e31a21ULL },
+  { 3430, 0x43e31a12ULL },
+  { 3431, 0x35e21a14ULL },
+  { 3432, 0x93e82a11ULL },
+  { 3433, 0x13e8d842ULL },
+  { 3434, 0x38e24a14ULL },
+  { 3435, 0x83e01a82ULL },
+  { 3436, 0x14e32a81ULL },
+  { 3437, 0x17e32a84ULL },
+  { 3438, 0x99e3b201ULL },
+  { 3441, 0x32e1b8c3ULL },
+  { 3447, 0x12e27b39ULL },
+  { 3448, 0x32e17b49ULL },
+  { 3449, 0x32e91b24ULL },
+  { 3450, 0x83e12b95ULL },
+  { 3451, 0x84e32b17ULL },
+  { 3452, 0x82e31b14ULL },
+  { 3453, 0x73e12b85ULL },
+  { 3454, 0x42e41b83ULL },
+  { 3456, 0x35e23a12ULL },
+  { 3457, 0x54e33a21ULL },
+  { 3458, 0x37e23a14ULL },
+  { 3459, 0x85e73a12ULL },
+  { 3461, 0x18e93a24ULL },
+  { 3462, 0x5e23a81ULL },
+  { 3474, 0x12e03b15ULL },
+  { 3475, 0x32e13b45ULL },
+  { 3477, 0x82e13b95ULL },
+  { 3478, 0x94e23b18ULL },
+  { 3480, 0x72e13b85ULL },
+  { 3483, 0x77e51a26ULL },
+  { 3484, 0x66e45a21ULL },
+  { 3485, 0x56e42a14ULL },
+  { 3486, 0x88e72a16ULL },
+  { 3487, 0x68e47a21ULL },
+  { 3488, 0x86e72a14ULL },
+  { 3489, 0x8e26a81ULL },
+  { 3490, 0x64e82a81ULL },
+  { 3491, 0x6e21a84ULL },
+  { 3492, 0x92e1b6c5ULL },
+  { 3501, 0x55e12b67ULL },
+  { 3502, 0x54e12b66ULL },
+  { 3503, 0x62e51b14ULL },
+  { 3504, 0x16e02b18ULL },
+  { 3505, 0x86e41b28ULL },
+  { 3506, 0x62e81b44ULL },
+  { 3507, 0x76e12b88ULL },
+  { 3508, 0x74e12b86ULL },
+  { 3510, 0x36e15a21ULL },
+  { 3511, 0x36e24a12ULL },
+  { 3512, 0x36e22a14ULL },
+  { 3513, 0x83e22a61ULL },
+  { 3514, 0x48e36a12ULL },
+  { 3516, 0x19e36a82ULL },
+  { 3519, 0x62e1b9c3ULL },
+  { 3520, 0x32e1b4c6ULL },
+  { 3521, 0x32e1b6c4ULL },
+  { 3528, 0x12e51b63ULL },
+  { 3529, 0x34e12b46ULL },
+  { 3530, 0x62e71b34ULL },
+  { 3531, 0x96e31b28ULL },
+  { 3532, 0x36e12b48ULL },
+  { 3534, 0x62e21b83ULL },
+  { 3536, 0x63e21b84ULL },
+  { 3537, 0x6e93a12ULL },
+  { 3538, 0x64e43a21ULL },
+  { 3540, 0x16e83a32ULL },
+  { 3541, 0x84e23a61ULL },
+  { 3543, 0x16e33a82ULL },
+  { 3555, 0x92e13b06ULL },
+  { 3556, 0x72e43b16ULL },
+  { 3558, 0x82e33b16ULL },
+  { 3564, 0x19e62a56ULL },
+  { 3565, 0x54e62a91ULL },
+  { 3566, 0x17e6d624ULL },
+  { 3567, 0x87e66a21ULL },
+  { 3568, 0x85e64a21ULL },
+  { 3569, 0x85e61a24ULL },
+  { 3571, 0x44e62a81ULL },
+  { 3573, 0x69e6b201ULL },
+  { 3582, 0x52e62b15ULL },
+  { 3583, 0x64e61b26ULL },
+  { 3584, 0x52e61b14ULL },
+  { 3585, 0x16e62b78ULL },
+  { 3587, 0x82e61b44ULL },
+  { 3591, 0x53e6d012ULL },
+  { 3592, 0x34e62a71ULL },
+  { 3594, 0x83e62a21ULL },
+  { 3595, 0x84e61a23ULL },
+  { 3600, 0x12e6b9c3ULL },
+  { 3609, 0x2e61b63ULL },
+  { 3611, 0x72e61b34ULL },
+  { 3618, 0x75e63a12ULL },
+  { 3622, 0x84e63a21ULL },
+  { 3636, 0x12e63b75ULL },
+  { 3888, 0x11e5c22ULL },
+  { 3889, 0x411e75c2ULL },
+  { 3890, 0x12e5c24ULL },
+  { 3891, 0x811e95c2ULL },
+  { 3892, 0x14e28c5ULL },
+  { 3915, 0x12e7c03ULL },
+  { 3917, 0x512e5c34ULL },
+  { 3942, 0x912e37c3ULL },
+  { 3943, 0x512e34c5ULL },
+  { 3970, 0x612e9c42ULL },
+  { 3971, 0x611e92c4ULL },
+  { 3972, 0x612e8c72ULL },
+  { 3973, 0x614e8c25ULL },
+  { 3975, 0x611e2c85ULL },
+  { 3996, 0x12e6c53ULL },
+  { 4023, 0x612e3c27ULL },
+  { 4131, 0x51e1a2c7ULL },
+  { 4132, 0x51e7a4c2ULL },
+  { 4133, 0x11e2a5a4ULL },
+  { 4134, 0x71e1a2c8ULL },
+  { 4135, 0x41e8a4a2ULL },
+  { 4136, 0x41e8a2a4ULL },
+  { 4140, 0x11e7b9c2ULL },
+  { 4141, 0x41e2b9a7ULL },
+  { 4142, 0x11e2b9a4ULL },
+  { 4143, 0x51e2b9a8ULL },
+  { 4144, 0x41e2b8c2ULL },
+  { 4145, 0x1e2b8a4ULL },
+  { 4149, 0x71e57b29ULL },
+  { 4150, 0x51e41b92ULL },
+  { 4151, 0x71e42b14ULL },
+  { 4152, 0x71e27b98ULL },
+  { 4153, 0x81e45b27ULL },
+  { 4154, 0x81e72b54ULL },
+  { 4155, 0x81e01b82ULL },
+  { 4156, 0x41e41b82ULL },
+  { 4157, 0x91e92b84ULL },
+  { 4158, 0x31e5c2a3ULL },
+  { 4159, 0x41e3c4a2ULL },
+  { 4160, 0x31e7a2a4ULL },
+  { 4161, 0x31e8a3a2ULL },
+  { 4162, 0x41e8a3c2ULL },
+  { 4167, 0x51e3b9c2ULL },
+  { 4168, 0x1e2b4c3ULL },
+  { 4169, 0x1e2b3c4ULL },
+  { 4170, 0x31e2b8a7ULL },
+  { 4176, 0x71e51b23ULL },
+  { 4177, 0x11e32b43ULL },
+  { 4178, 0x91e32b24ULL },
+  { 4179, 0x81e12b93ULL },
+  { 4180, 0x81e41b23ULL },
+  { 4181, 0x81e32b14ULL },
+  { 4182, 0x51e31b82ULL },
+  { 4183, 0x41e42b83ULL },
+  { 4203, 0x91e23b15ULL },
+  { 4205, 0x31e23b54ULL },
+  { 4206, 0x81e23b05ULL },
+  { 4207, 0x81e43b25ULL },
+  { 4212, 0x71e2c6a5ULL },
+  { 4213, 0x41e2c6a2ULL },
+  { 4214, 0x61e2c6a4ULL },
+  { 4215, 0x61e8d821ULL },
+  { 4216, 0x61e8a4c2ULL },
+  { 4217, 0x61e8a2c4ULL },
+  { 4221, 0x11e1b6c2ULL },
+  { 4230, 0x11e15b26ULL },
+  { 4231, 0x71e54b26ULL },
+  { 4232, 0x61e92b54ULL },
+  { 4233, 0x81e26b08ULL },
+  { 4234, 0x81e46b28ULL },
+  { 4235, 0x61e82b44ULL },
+  { 4236, 0x61e26b87ULL },
+  { 4237, 0x61e24b85ULL },
+  { 4239, 0x31e2c6a1ULL },
+  { 4248, 0x61e2b6c3ULL },
+  { 4257, 0x11e52b63ULL },
+  { 4258, 0x91e34b26ULL },
+  { 4259, 0x61e72b34ULL },
+  { 4260, 0x91e36b28ULL },
+  { 4263, 0x61e22b83ULL },
+  { 4286, 0x41e23b64ULL },
+  { 4292, 0x61e23b84ULL },
+  { 4293, 0x51e6a7a2ULL },
+  { 4294, 0x41e6c2a2ULL },
+  { 4295, 0x61e6c2a4ULL },
+  { 4296, 0x61e6a8a2ULL },
+  { 4302, 0x1e6a2b6ULL },
+  { 4305, 0x1e6b8c2ULL },
+  { 4311, 0x61e65b27ULL },
+  { 4312, 0x61e64b26ULL },
+  { 4313, 0x51e62b14ULL },
+  { 4314, 0x61e66b28ULL },
+  { 4316, 0x81e62b44ULL },
+  { 4320, 0x31e6c2a1ULL },
+  { 4329, 0x31e6a2b9ULL },
+  { 4338, 0x31e61b92ULL },
+  { 4340, 0x71e62b34ULL },
+  { 4365, 0x61e63b25ULL },
+  { 4617, 0x2e5d2d02ULL },
+  { 4618, 0x2e9d4d27ULL },
+  { 4619, 0x2e5d4d04ULL },
+  { 4620, 0x2e8d5d08ULL },
+  { 4621, 0x295e8c47ULL },
+  { 4623, 0x2e7d2d82ULL },
+  { 4626, 0x2e9d72b5ULL },
+  { 4627, 0x2e4b9d45ULL },
+  { 4628, 0x2e4b7d24ULL },
+  { 4629, 0x2e07b9c8ULL },
+  { 4630, 0x2e4d42b8ULL },
+  { 4631, 0x2e8b4d04ULL },
+  { 4632, 0x2e2b7d82ULL },
+  { 4633, 0x2e5b4d82ULL },
+  { 4634, 0x2e4b8d84ULL },
+  { 4635, 0x2e9c2b02ULL },
+  { 4636, 0x2e5c4b22ULL },
+  { 4637, 0x2e9c5b74ULL },
+  { 4639, 0x2e9c8b47ULL },
+  { 4640, 0x2e8c5b24ULL },
+  { 4641, 0x2e8c7b85ULL },
+  { 4644, 0x2e3d5d03ULL },
+  { 4645, 0x2e4d4d23ULL },
+  { 4646, 0x2e3d7d24ULL },
+  { 4647, 0x232e8c92ULL },
+  { 4648, 0x253e44c8ULL },
+  { 4649, 0x253e8c44ULL },
+  { 4651, 0x243e9c83ULL },
+  { 4652, 0x234e9c84ULL },
+  { 4653, 0x2e5b5d53ULL },
+  { 4654, 0x2e34b9c5ULL },
+  { 4655, 0x2e3b9d54ULL },
+  { 4656, 0x2e22b8c3ULL },
+  { 4657, 0x2e03b4c8ULL },
+  { 4658, 0x2e3b8d04ULL },
+  { 4662, 0x2e3c7b32ULL },
+  { 4663, 0x2e7c4b03ULL },
+  { 4665, 0x2e9c9b38ULL },
+  { 4666, 0x2e8c4b43ULL },
+  { 4669, 0x2e9c4b83ULL },
+  { 4671, 0x2e5d3d03ULL },
+  { 4672, 0x2e4d3d42ULL },
+  { 4673, 0x2e7d3d24ULL },
+  { 4675, 0x252e3c48ULL },
+  { 4676, 0x233e38c4ULL },
+  { 4679, 0x2e8d3d84ULL },
+  { 4680, 0x2e7b3d72ULL },
+  { 4683, 0x2e8b3d03ULL },
+  { 4689, 0x2e7c3b32ULL },
+  { 4698, 0x2e5d6d06ULL },
+  { 4699, 0x204e6c76ULL },
+  { 4700, 0x252e6c24ULL },
+  { 4701, 0x255e8c96ULL },
+  { 4702, 0x294e6c28ULL },
+  { 4703, 0x282e6c74ULL },
+  { 4705, 0x272e4c86ULL },
+  { 4706, 0x2e6d4d84ULL },
+  { 4707, 0x2e9b6d66ULL },
+  { 4708, 0x2e6d42b6ULL },
+  { 4709, 0x2e6b5d04ULL },
+  { 4710, 0x2e5b8d65ULL },
+  { 4711, 0x2e6b8d46ULL },
+  { 4715, 0x2e6b6d84ULL },
+  { 4716, 0x2e9c6b65ULL },
+  { 4717, 0x2e6c4b62ULL },
+  { 4718, 0x2e7c6b44ULL },
+  { 4719, 0x2e8c6b05ULL },
+  { 4725, 0x273e6c26ULL },
+  { 4726, 0x243e6c75ULL },
+  { 4727, 0x223e7c64ULL },
+  { 4728, 0x236e8c97ULL },
+  { 4734, 0x2e2b9d63ULL },
+  { 4735, 0x2e6b4d23ULL },
+  { 4737, 0x2e8d23b6ULL },
+  { 4743, 0x2e3c6b02ULL },
+  { 4746, 0x2e3c8b62ULL },
+  { 4749, 0x2e6c6b83ULL },
+  { 4752, 0x2e6d3d63ULL },
+  { 4754, 0x252e36c4ULL },
+  { 4761, 0x2e9d36b9ULL },
+  { 4762, 0x2e6b3d42ULL },
+  { 4770, 0x2e6c3b02ULL },
+  { 4773, 0x2e8c3b62ULL },
+  { 4791, 0x2e26b8c8ULL },
+  { 4860, 0x25e7a9c5ULL },
+  { 4861, 0x22e5c4a2ULL },
+  { 4862, 0x22e2c9a4ULL },
+  { 4863, 0x22e9a8a5ULL },
+  { 4864, 0x25e82a42ULL },
+  { 4865, 0x28e24a04ULL },
+  { 4867, 0x27e4d882ULL },
+  { 4868, 0x27e42a84ULL },
+  { 4869, 0x27e9b9c9ULL },
+  { 4870, 0x24e7b7c7ULL },
+  { 4873, 0x25e4b8c7ULL },
+  { 4878, 0x25e52b77ULL },
+  { 4879, 0x25e22b47ULL },
+  { 4880, 0x22e02b24ULL },
+  { 4881, 0x22e82b05ULL },
+  { 4882, 0x24e82b07ULL },
+  { 4887, 0x22e7a5c3ULL },
+  { 4888, 0x24e7c3c2ULL },
+  { 4889, 0x23e7c4a4ULL },
+  { 4890, 0x27e3c8c3ULL },
+  { 4891, 0x24e9d873ULL },
+  { 4893, 0x23e9d882ULL },
+  { 4894, 0x28e44a83ULL },
+  { 4896, 0x22e5b9c3ULL },
+  { 4897, 0x24e3b9c5ULL },
+  { 4898, 0x23e4b9c4ULL },
+  { 4899, 0x22e2b8c3ULL },
+  { 4905, 0x23e52b75ULL },
+  { 4906, 0x23e54b77ULL },
+  { 4907, 0x22e32b54ULL },
+  { 4908, 0x23e55b78ULL },
+  { 4909, 0x23e84b08ULL },
+  { 4914, 0x27e93a33ULL },
+  { 4916, 0x27e23a04ULL },
+  { 4917, 0x28e23a05ULL },
+  { 4918, 0x27e83a43ULL },
+  { 4919, 0x28e93a34ULL },
+  { 4921, 0x27e43a83ULL },
+  { 4922, 0x28e43a84ULL },
+  { 4932, 0x22e53b75ULL },
+  { 4933, 0x22e23b45ULL },
+  { 4935, 0x25e53b78ULL },
+  { 4936, 0x24e83b08ULL },
+  { 4941, 0x29e72a56ULL },
+  { 4942, 0x26e24a02ULL },
+  { 4943, 0x26e22a04ULL },
+  { 4944, 0x22e2c8a6ULL },
+  { 4945, 0x26e4d842ULL },
+  { 4946, 0x25e9d864ULL },
+  { 4948, 0x29e46a82ULL },
+  { 4950, 0x25e2b9c6ULL },
+  { 4951, 0x22e2b4c6ULL },
+  { 4952, 0x22e2b6c4ULL },
+  { 4953, 0x22e8b6c5ULL },
+  { 4960, 0x25e44b69ULL },
+  { 4961, 0x22e42b64ULL },
+  { 4962, 0x26e52b78ULL },
+  { 4963, 0x26e22b48ULL },
+  { 4968, 0x29e96a32ULL },
+  { 4969, 0x25e7d463ULL },
+  { 4970, 0x26e7d434ULL },
+  { 4971, 0x23e8d652ULL },
+  { 4972, 0x28e3d642ULL },
+  { 4973, 0x23e8a6c4ULL },
+  { 4975, 0x26e42a83ULL },
+  { 4978, 0x23e4b6c6ULL },
+  { 4986, 0x23e56b79ULL },
+  { 4987, 0x22e34b56ULL },
+  { 4989, 0x23e82b06ULL },
+  { 4990, 0x23e45b68ULL },
+  { 4995, 0x26e23a03ULL },
+  { 4999, 0x26e83a42ULL },
+  { 5002, 0x26e43a82ULL },
+  { 5013, 0x23e53b76ULL },
+  { 5014, 0x23e23b46ULL },
+  { 5016, 0x22e83b06ULL },
+  { 5017, 0x25e43b68ULL },
+  { 5022, 0x25e62a62ULL },
+  { 5023, 0x24e6c6a6ULL },
+  { 5024, 0x27e62a64ULL },
+  { 5025, 0x22e6a8c2ULL },
+  { 5027, 0x28e6d294ULL },
+  { 5032, 0x22e6b4c7ULL },
+  { 5033, 0x22e6b7c4ULL },
+  { 5035, 0x24e6b8c6ULL },
+  { 5046, 0x25e62b87ULL },
+  { 5047, 0x24e62b86ULL },
+  { 5048, 0x22e62b84ULL },
+  { 5049, 0x23e6c5a2ULL },
+  { 5050, 0x27e6c4c3ULL },
+  { 5051, 0x27e6d234ULL },
+  { 5053, 0x28e64a63ULL },
+  { 5073, 0x23e62b85ULL },
+  { 5074, 0x23e64b87ULL },
+  { 5076, 0x26e63a62ULL },
+  { 5081, 0x28e63a64ULL },
+  { 5100, 0x22e63b85ULL },
+  { 5101, 0x24e63b87ULL },
+  { 5346, 0x2e1c5d01ULL },
+  { 5347, 0x2e75d411ULL },
+  { 5349, 0x251e8c91ULL },
+  { 5350, 0x201e8a49ULL },
+  { 5351, 0x201e89a4ULL },
+  { 5352, 0x2e9d1d81ULL },
+  { 5353, 0x2e29d481ULL },
+  { 5354, 0x291e4c84ULL },
+  { 5355, 0x2e01b7a5ULL },
+  { 5356, 0x2e4a11b9ULL },
+  { 5357, 0x2e7d41b4ULL },
+  { 5358, 0x2e5a11b8ULL },
+  { 5359, 0x2e41b8c2ULL },
+  { 5360, 0x2e01b8a4ULL },
+  { 5361, 0x2e7b2d81ULL },
+  { 5364, 0x2e7b1b01ULL },
+  { 5365, 0x2e5b4b11ULL },
+  { 5367, 0x2e8c1b01ULL },
+  { 5368, 0x2e8b4b41ULL },
+  { 5370, 0x2e8c2b81ULL },
+  { 5371, 0x2e4c4b81ULL },
+  { 5373, 0x201e99a3ULL },
+  { 5374, 0x231e4c33ULL },
+  { 5375, 0x271e4c34ULL },
+  { 5378, 0x251e83c4ULL },
+  { 5380, 0x251e4c83ULL },
+  { 5382, 0x2e01b9a3ULL },
+  { 5383, 0x2e01b4c3ULL },
+  { 5384, 0x2e01b3c4ULL },
+  { 5385, 0x2e31b8a7ULL },
+  { 5391, 0x2e9b2b31ULL },
+  { 5392, 0x2e7b4b31ULL },
+  { 5394, 0x2e3b8b31ULL },
+  { 5400, 0x201e3a99ULL },
+  { 5401, 0x201e3c43ULL },
+  { 5402, 0x231e3c44ULL },
+  { 5406, 0x2e3d3d81ULL },
+  { 5409, 0x2e2b3d21ULL },
+  { 5412, 0x2e8a31b7ULL },
+  { 5416, 0x2e4b3d81ULL },
+  { 5418, 0x2e5b3b01ULL },
+  { 5419, 0x2e9b3b41ULL },
+  { 5421, 0x2e8b3b31ULL },
+  { 5427, 0x201e6c71ULL },
+  { 5428, 0x2e4d2d61ULL },
+  { 5430, 0x281e7c62ULL },
+  { 5431, 0x2e28d461ULL },
+  { 5433, 0x261e9c81ULL },
+  { 5436, 0x2e6a01b6ULL },
+  { 5437, 0x2e2b4d61ULL },
+  { 5438, 0x2e6d21b4ULL },
+  { 5439, 0x2e21b8a6ULL },
+  { 5441, 0x2e8d61b4ULL },
+  { 5442, 0x2e1b6d81ULL },
+  { 5445, 0x2e7b6b51ULL },
+  { 5446, 0x2e6b4b21ULL },
+  { 5448, 0x2e8b6b61ULL },
+  { 5454, 0x231e6c22ULL },
+  { 5455, 0x2e37d641ULL },
+  { 5457, 0x2e38d661ULL },
+  { 5460, 0x2e39d681ULL },
+  { 5463, 0x2e61b6c3ULL },
+  { 5472, 0x2e3b6b11ULL },
+  { 5482, 0x261e3c45ULL },
+  { 5490, 0x2e9a31b6ULL },
+  { 5499, 0x2e6b3b11ULL },
+  { 5508, 0x2e06d021ULL },
+  { 5509, 0x2e26d421ULL },
+  { 5512, 0x2e46d821ULL },
+  { 5517, 0x2e16b9c7ULL },
+  { 5535, 0x2e36d621ULL },
+  { 5536, 0x2e76d431ULL },
+  { 5538, 0x2e86d631ULL },
+  { 5589, 0x27e75a51ULL },
+  { 5590, 0x22e7d451ULL },
+  { 5591, 0x25e21a04ULL },
+  { 5592, 0x22e9d891ULL },
+  { 5593, 0x27e85a41ULL },
+  { 5594, 0x28e5d014ULL },
+  { 5596, 0x29e2d481ULL },
+  { 5598, 0x29e9b101ULL },
+  { 5601, 0x29e8b001ULL },
+  { 5607, 0x22e92b15ULL },
+  { 5608, 0x24e01b25ULL },
+  { 5609, 0x22e91b14ULL },
+  { 5610, 0x25e92b18ULL },
+  { 5611, 0x27e21b48ULL },
+  { 5612, 0x22e81b04ULL },
+  { 5616, 0x23e31a91ULL },
+  { 5617, 0x24e92a31ULL },
+  { 5619, 0x28e15a13ULL },
+  { 5620, 0x23e8c4c1ULL },
+  { 5621, 0x23e8c1c4ULL },
+  { 5623, 0x23e41a81ULL },
+  { 5634, 0x22e15b37ULL },
+  { 5635, 0x24e11b35ULL },
+  { 5636, 0x23e31b54ULL },
+  { 5637, 0x23e15b38ULL },
+  { 5638, 0x23e94b18ULL },
+  { 5643, 0x25e93a31ULL },
+  { 5644, 0x24e23a01ULL },
+  { 5645, 0x27e13a14ULL },
+  { 5646, 0x28e13a15ULL },
+  { 5647, 0x25e83a41ULL },
+  { 5650, 0x25e43a81ULL },
+  { 5661, 0x22e13b35ULL },
+  { 5662, 0x24e13b37ULL },
+  { 5664, 0x25e13b38ULL },
+  { 5665, 0x24e93b18ULL },
+  { 5670, 0x26e25a01ULL },
+  { 5671, 0x24e7c6c1ULL },
+  { 5672, 0x26e71a54ULL },
+  { 5673, 0x28e76a51ULL },
+  { 5674, 0x26e84a41ULL },
+  { 5675, 0x25e8d614ULL },
+  { 5677, 0x26e44a81ULL },
+  { 5678, 0x26e41a84ULL },
+  { 5679, 0x26e1b9c7ULL },
+  { 5688, 0x26e51b77ULL },
+  { 5689, 0x24e41b65ULL },
+  { 5691, 0x26e81b08ULL },
+  { 5692, 0x27e41b68ULL },
+  { 5697, 0x25e3d651ULL },
+  { 5698, 0x24e3d621ULL },
+  { 5699, 0x26e91a34ULL },
+  { 5700, 0x28e96a31ULL },
+  { 5703, 0x26e3d681ULL },
+  { 5715, 0x25e11b36ULL },
+  { 5716, 0x22e41b63ULL },
+  { 5717, 0x23e41b64ULL },
+  { 5718, 0x26e12b38ULL },
+  { 5724, 0x26e13a13ULL },
+  { 5742, 0x22e93b16ULL },
+  { 5751, 0x27e65a61ULL },
+  { 5752, 0x24e6c7c1ULL },
+  { 5753, 0x26e61a64ULL },
+  { 5754, 0x28e66a61ULL },
+  { 5775, 0x26e61b87ULL },
+  { 5776, 0x24e61b85ULL },
+  { 5778, 0x22e6d231ULL },
+  { 5802, 0x22e61b83ULL },
+  { 5804, 0x23e61b84ULL },
+  { 5805, 0x25e63a61ULL },
+  { 6078, 0x217e8c98ULL },
+  { 6079, 0x211e8c41ULL },
+  { 6080, 0x211e82c4ULL },
+  { 6082, 0x211e4c82ULL },
+  { 6103, 0x212e4c35ULL },
+  { 6105, 0x213e8c93ULL },
+  { 6107, 0x213e87c4ULL },
+  { 6109, 0x213e4c87ULL },
+  { 6131, 0x212e35c4ULL },
+  { 6156, 0x211e7c61ULL },
+  { 6159, 0x216e86c9ULL },
+  { 6160, 0x215e8c46ULL },
+  { 6162, 0x216e9c86ULL },
+  { 6183, 0x213e6c25ULL },
+  { 6318, 0x21e2a2c5ULL },
+  { 6319, 0x21e7a4a1ULL },
+  { 6320, 0x21e7a1a4ULL },
+  { 6321, 0x21e8a2a2ULL },
+  { 6322, 0x21e8a4c1ULL },
+  { 6323, 0x21e8c1a4ULL },
+  { 6327, 0x21e9a2b5ULL },
+  { 6328, 0x21e4b9a7ULL },
+  { 6329, 0x21e1b9a4ULL },
+  { 6330, 0x21e1b5a8ULL },
+  { 6331, 0x21e4b8c2ULL },
+  { 6332, 0x21e8b5c4ULL },
+  { 6336, 0x21e51b72ULL },
+  { 6337, 0x21e21b42ULL },
+  { 6338, 0x21e92b14ULL },
+  { 6339, 0x21e57b78ULL },
+  { 6340, 0x21e27b48ULL },
+  { 6341, 0x21e82b04ULL },
+  { 6345, 0x21e9c1a3ULL },
+  { 6346, 0x21e4c1c3ULL },
+  { 6347, 0x21e3c1c4ULL },
+  { 6348, 0x21e3a8a1ULL },
+  { 6354, 0x21e3b5c3ULL },
+  { 6357, 0x21e3b8a7ULL },
+  { 6363, 0x21e31b52ULL },
+  { 6364, 0x21e14b35ULL },
+  { 6366, 0x21e17b38ULL },
+  { 6390, 0x21e93b15ULL },
+  { 6392, 0x21e33b54ULL },
+  { 6393, 0x21e83b05ULL },
+  { 6399, 0x21e1d6c2ULL },
+  { 6400, 0x21e4a6a2ULL },
+  { 6401, 0x21e2a6a4ULL },
+  { 6403, 0x21e4d8c6ULL },
+  { 6408, 0x21e1b7a6ULL },
+  { 6411, 0x21e2b8a6ULL },
+  { 6417, 0x21e75b96ULL },
+  { 6418, 0x21e25b46ULL },
+  { 6420, 0x21e86b08ULL },
+  { 6421, 0x21e47b68ULL },
+  { 6426, 0x21e3a6a3ULL },
+  { 6435, 0x21e3b9a6ULL },
+  { 6444, 0x21e15b36ULL },
+  { 6445, 0x21e42b63ULL },
+  { 6473, 0x21e43b64ULL },
+  { 6480, 0x21e6a6c1ULL },
+  { 6481, 0x21e6a4a2ULL },
+  { 6482, 0x21e6a2a4ULL },
+  { 6484, 0x21e6c4d8ULL },
+  { 6489, 0x21e6b9c2ULL },
+  { 6492, 0x21e6a2b8ULL },
+  { 6504, 0x21e66b87ULL },
+  { 6505, 0x21e64b85ULL },
+  { 6507, 0x21e6a3c2ULL },
+  { 6516, 0x21e6b6c3ULL },
+  { 6531, 0x21e62b83ULL },
+};
+
+static const struct opening_second openings_second_9[] = {
+  { 2187, 0x55e8d88c5ULL },
+  { 2188, 0x8e6d69c5ULL },
+  { 2189, 0x69e5d08c6ULL },
+  { 2190, 0x99e5a9a58ULL },
+  { 2191, 0x69e5a6a58ULL },
+  { 2192, 0x96e5d5a86ULL },
+  { 2193, 0x99e9a58a5ULL },
+  { 2194, 0x96e6a55a8ULL },
+  { 2195, 0x96e5a85a6ULL },
+  { 2196, 0x99e33c03ULL },
+  { 2197, 0x36e8d65c9ULL },
+  { 2198, 0x65e8c9d36ULL },
+  { 2199, 0x39e8c5a35ULL },
+  { 2200, 0x56e3c9a83ULL },
+  { 2201, 0x36e3d9a06ULL },
+  { 2202, 0x39e3a58a5ULL },
+  { 2203, 0x86e6a95a3ULL },
+  { 2204, 0x59e6a38a6ULL },
+  { 2205, 0x909e3c303ULL },
+  { 2206, 0x56e3d93c5ULL },
+  { 2207, 0x6e3d03c6ULL },
+  { 2208, 0x89e38a3c5ULL },
+  { 2209, 0x56e83a3c9ULL },
+  { 2210, 0x89e08a3c6ULL },
+  { 2211, 0x5e9a83a3ULL },
+  { 2212, 0x65e9a93a8ULL },
+  { 2213, 0x86e95a3a6ULL },
+  { 2214, 0x7e7d89c5ULL },
+  { 2215, 0x675e8c9c8ULL },
+  { 2216, 0x87e5d56c6ULL },
+  { 2217, 0x508e7a897ULL },
+  { 2218, 0x867e9a957ULL },
+  { 2219, 0x776e9a866ULL },
+  { 2220, 0x79e5a58a7ULL },
+  { 2221, 0x67e7a06a9ULL },
+  { 2222, 0x97e5a86a6ULL },
+  { 2223, 0x57e3d57c3ULL },
+  { 2224, 0x36e7d36c7ULL },
+  { 2225, 0x633e8c7c6ULL },
+  { 2226, 0x39e5c3a87ULL },
+  { 2227, 0x58e3c3a67ULL },
+  { 2228, 0x77e8a3a66ULL },
+  { 2229, 0x58e9a37a3ULL },
+  { 2230, 0x87e6a96a3ULL },
+  { 2231, 0x37e8a95a6ULL },
+  { 2232, 0x77e3d33c7ULL },
+  { 2233, 0x76e76c3d3ULL },
+  { 2234, 0x87e3d93c6ULL },
+  { 2235, 0x37e07a3d9ULL },
+  { 2236, 0x87e36a3c5ULL },
+  { 2237, 0x39e57a3c6ULL },
+  { 2238, 0x593e883a7ULL },
+  { 2239, 0x773e963a8ULL },
+  { 2240, 0x77e86a3a6ULL },
+  { 2241, 0x7e5c7d89ULL },
+  { 2242, 0x65e7d7c65ULL },
+  { 2243, 0x66e7d77c6ULL },
+  { 2244, 0x98e7a7a57ULL },
+  { 2245, 0x98e6a7a67ULL },
+  { 2246, 0x97e5a7a76ULL },
+  { 2247, 0x9e5a77a8ULL },
+  { 2248, 0x586e876a7ULL },
+  { 2249, 0x87e5a76a6ULL },
+  { 2250, 0x75e3d75c3ULL },
+  { 2251, 0x3e6c7d53ULL },
+  { 2252, 0x36e7d7c36ULL },
+  { 2253, 0x95e3c7a83ULL },
+  { 2254, 0x57e6c7a33ULL },
+  { 2255, 0x78e3c7a66ULL },
+  { 2256, 0x37e9a75a7ULL },
+  { 2257, 0x38e9a76a7ULL },
+  { 2258, 0x68e3a77a6ULL },
+  { 2265, 0x583e873a7ULL },
+  { 2266, 0x383e673a7ULL },
+  { 2267, 0x673e073a6ULL },
+  { 2268, 0x998e9b809ULL },
+  { 2269, 0x65e8c5b69ULL },
+  { 2270, 0x956e9b866ULL },
+  { 2271, 0x98e8a9b09ULL },
+  { 2272, 0x69e6a5b59ULL },
+  { 2273, 0x56e8a9b66ULL },
+  { 2277, 0x53e9c5b08ULL },
+  { 2278, 0x35e6c6b98ULL },
+  { 2279, 0x35e5c3b86ULL },
+  { 2280, 0x58e3a8b09ULL },
+  { 2281, 0x63e6a8b83ULL },
+  { 2282, 0x85e3a8b36ULL },
+  { 2286, 0x898e5b309ULL },
+  { 2287, 0x853e5b363ULL },
+  { 2288, 0x895e5b306ULL },
+  { 2289, 0x9e88a3b5ULL },
+  { 2290, 0x36e85a3b8ULL },
+  { 2291, 0x65e35a3b6ULL },
+  { 2295, 0x897e7b508ULL },
+  { 2296, 0x869e7b579ULL },
+  { 2297, 0x966e8b776ULL },
+  { 2298, 0x98e78a5b7ULL },
+  { 2299, 0x67e6a5b57ULL },
+  { 2300, 0x56e7a9b76ULL },
+  { 2304, 0x33e5c9b87ULL },
+  { 2305, 0x36e5c3b87ULL },
+  { 2306, 0x376e3b676ULL },
+  { 2307, 0x38e9a3b77ULL },
+  { 2308, 0x67e3a6b97ULL },
+  { 2309, 0x76e7a3b36ULL },
+  { 2313, 0x897e5b308ULL },
+  { 2314, 0x797e6b308ULL },
+  { 2315, 0x766e6b376ULL },
+  { 2316, 0x38e97a3b7ULL },
+  { 2317, 0x96e56a3b7ULL },
+  { 2318, 0x67e37a3b6ULL },
+  { 2322, 0x97e7d7b08ULL },
+  { 2323, 0x65e6c7b89ULL },
+  { 2324, 0x66e7d7b76ULL },
+  { 2325, 0x78e9a7b58ULL },
+  { 2326, 0x97e6a7b08ULL },
+  { 2327, 0x66e8a7b56ULL },
+  { 2331, 0x73e3c7b85ULL },
+  { 2332, 0x63e7c7b58ULL },
+  { 2333, 0x93e3c7b06ULL },
+  { 2334, 0x97e3a7b38ULL },
+  { 2335, 0x63e7a7b63ULL },
+  { 2336, 0x95e3a7b36ULL },
+  { 2349, 0x58e8b5b89ULL },
+  { 2350, 0x86e6b6b08ULL },
+  { 2351, 0x55e8b6b96ULL },
+  { 2352, 0x95e8b9a85ULL },
+  { 2353, 0x69e5b6a59ULL },
+  { 2354, 0x86e6b9a56ULL },
+  { 2355, 0x58e9b98a5ULL },
+  { 2356, 0x6e8b95a9ULL },
+  { 2357, 0x96e5b86a6ULL },
+  { 2358, 0x98e3b3b59ULL },
+  { 2359, 0x93e6b8b35ULL },
+  { 2360, 0x6e3b3b66ULL },
+  { 2361, 0x9e3b8a58ULL },
+  { 2362, 0x65e3b6a35ULL },
+  { 2363, 0x66e3b6a36ULL },
+  { 2364, 0x88e5b09a3ULL },
+  { 2365, 0x36e3b85a8ULL },
+  { 2366, 0x35e9b65a6ULL },
+  { 2367, 0x58e5b03c3ULL },
+  { 2368, 0x99e6b53c3ULL },
+  { 2373, 0x3e8b53a3ULL },
+  { 2374, 0x63e6b93a3ULL },
+  { 2375, 0x93e3b63a6ULL },
+  { 2376, 0x77e5b8b09ULL },
+  { 2377, 0x56e6b8b97ULL },
+  { 2378, 0x75e5b6b86ULL },
+  { 2379, 0x78e7b9a58ULL },
+  { 2380, 0x87e6b9a57ULL },
+  { 2381, 0x76e7b8a66ULL },
+  { 2382, 0x88e7b09a5ULL },
+  { 2383, 0x76e7b96a5ULL },
+  { 2384, 0x97e7b08a6ULL },
+  { 2385, 0x97e3b3b58ULL },
+  { 2386, 0x86e3b6b77ULL },
+  { 2387, 0x85e6b3b76ULL },
+  { 2388, 0x97e7b3a38ULL },
+  { 2389, 0x67e6b9a37ULL },
+  { 2390, 0x76e5b9a36ULL },
+  { 2391, 0x38e5b97a9ULL },
+  { 2392, 0x76e5b96a3ULL },
+  { 2393, 0x67e3b37a6ULL },
+  { 2394, 0x78e3b03c3ULL },
+  { 2400, 0x73e5b93a3ULL },
+  { 2401, 0x73e7b63a8ULL },
+  { 2402, 0x73e7b83a6ULL },
+  { 2403, 0x57e5b7b78ULL },
+  { 2404, 0x68e5b7b89ULL },
+  { 2405, 0x55e5b7b76ULL },
+  { 2406, 0x98e5b7a78ULL },
+  { 2407, 0x8e6b7a97ULL },
+  { 2408, 0x95e8b7a06ULL },
+  { 2409, 0x98e5b78a7ULL },
+  { 2410, 0x96e5b76a7ULL },
+  { 2411, 0x75e6b75a6ULL },
+  { 2412, 0x95e7b7b37ULL },
+  { 2413, 0x38e6b7b69ULL },
+  { 2414, 0x35e6b7b66ULL },
+  { 2415, 0x38e3b7a97ULL },
+  { 2416, 0x73e6b7a63ULL },
+  { 2417, 0x76e3b7a36ULL },
+  { 2418, 0x38e3b77a9ULL },
+  { 2419, 0x76e3b76a3ULL },
+  { 2420, 0x7e3b76a6ULL },
+  { 2427, 0x93e3b73a5ULL },
+  { 2428, 0x83e6b73a7ULL },
+  { 2429, 0x83e5b73a6ULL },
+  { 2430, 0x4e9d54c8ULL },
+  { 2431, 0x4e6d84c5ULL },
+  { 2432, 0x4e5c8d46ULL },
+  { 2433, 0x458e5a948ULL },
+  { 2434, 0x49e6c8a64ULL },
+  { 2435, 0x456e8a646ULL },
+  { 2436, 0x405e994a5ULL },
+  { 2437, 0x66e8a45a4ULL },
+  { 2438, 0x6e5a94a6ULL },
+  { 2439, 0x8e3d84c5ULL },
+  { 2440, 0x86e3d6c43ULL },
+  { 2441, 0x54e3c4d06ULL },
+  { 2442, 0x348e9a438ULL },
+  { 2443, 0x46e3a8a35ULL },
+  { 2444, 0x446e5a936ULL },
+  { 2445, 0x448e938a5ULL },
+  { 2446, 0x66e3a45a9ULL },
+  { 2447, 0x85e3a94a6ULL },
+  { 2448, 0x84e5d03c8ULL },
+  { 2449, 0x84e3d63c4ULL },
+  { 2450, 0x68e34c3d6ULL },
+  { 2451, 0x84e93a3c3ULL },
+  { 2452, 0x84e63a3c4ULL },
+  { 2453, 0x66e84a3c6ULL },
+  { 2454, 0x84e5a93a4ULL },
+  { 2455, 0x64e3a53a8ULL },
+  { 2456, 0x44e5a33a6ULL },
+  { 2457, 0x405e9c8c7ULL },
+  { 2458, 0x65e7d89c4ULL },
+  { 2459, 0x48e7c5d06ULL },
+  { 2460, 0x457e9a547ULL },
+  { 2461, 0x774e9a864ULL },
+  { 2462, 0x77e5a8a46ULL },
+  { 2463, 0x9e8a47a8ULL },
+  { 2464, 0x57e7a46a4ULL },
+  { 2465, 0x95e74a6a6ULL },
+  { 2466, 0x57e3d54c5ULL },
+  { 2467, 0x63e7d36c4ULL },
+  { 2468, 0x94e7c9d36ULL },
+  { 2469, 0x483e9a573ULL },
+  { 2470, 0x37e6c5a34ULL },
+  { 2471, 0x57e3c4a36ULL },
+  { 2472, 0x94e83a7a4ULL },
+  { 2473, 0x65e34a6a7ULL },
+  { 2474, 0x65e34a7a6ULL },
+  { 2475, 0x94e5d53c7ULL },
+  { 2476, 0x48e3d63c7ULL },
+  { 2477, 0x47e73c3d6ULL },
+  { 2478, 0x847e5a347ULL },
+  { 2479, 0x96e75a3c4ULL },
+  { 2480, 0x56e7a346ULL },
+  { 2481, 0x45e8a93a7ULL },
+  { 2482, 0x65e64a3a7ULL },
+  { 2483, 0x74e5a63a6ULL },
+  { 2484, 0x44e7d77c4ULL },
+  { 2485, 0x46e8c7d65ULL },
+  { 2486, 0x46e7d7c46ULL },
+  { 2487, 0x5e7d7a94ULL },
+  { 2488, 0x96e8a7a45ULL },
+  { 2489, 0x77e6a7a46ULL },
+  { 2490, 0x884e974a9ULL },
+  { 2491, 0x976e576a4ULL },
+  { 2492, 0x674e074a6ULL },
+  { 2493, 0x4e8c7d53ULL },
+  { 2494, 0x36e9c7d94ULL },
+  { 2495, 0x54e5c7d36ULL },
+  { 2496, 0x49e3c7a37ULL },
+  { 2497, 0x67e6c7a43ULL },
+  { 2498, 0x48e3c7a36ULL },
+  { 2499, 0x874e574a3ULL },
+  { 2500, 0x386e476a9ULL },
+  { 2501, 0x974e374a6ULL },
+  { 2508, 0x483e973a5ULL },
+  { 2509, 0x64e5a73a4ULL },
+  { 2510, 0x83e473a6ULL },
+  { 2511, 0x948e5b458ULL },
+  { 2512, 0x849e6b459ULL },
+  { 2513, 0x446e6b056ULL },
+  { 2514, 0x94e8a9b05ULL },
+  { 2515, 0x64e5a8b94ULL },
+  { 2516, 0x46e8a9b56ULL },
+  { 2520, 0x54e3d9b84ULL },
+  { 2521, 0x638e9b548ULL },
+  { 2522, 0x94e5c3b46ULL },
+  { 2523, 0x44e8a3b93ULL },
+  { 2524, 0x43e6a6b43ULL },
+  { 2525, 0x46e3a4b56ULL },
+  { 2529, 0x893e5b304ULL },
+  { 2530, 0x854e5b364ULL },
+  { 2531, 0x946e4b356ULL },
+  { 2532, 0x45e94a3b8ULL },
+  { 2533, 0x46e95a3b8ULL },
+  { 2534, 0x64e34a3b6ULL },
+  { 2538, 0x947e5b457ULL },
+  { 2539, 0x647e8b457ULL },
+  { 2540, 0x966e5b476ULL },
+  { 2541, 0x49e79a7b4ULL },
+  { 2542, 0x74e6a9b05ULL },
+  { 2543, 0x46e7a8b56ULL },
+  { 2547, 0x347e5b847ULL },
+  { 2548, 0x647e3b947ULL },
+  { 2549, 0x34e3c8b76ULL },
+  { 2550, 0x74e35a9b3ULL },
+  { 2551, 0x43e6a9b73ULL },
+  { 2552, 0x47e9a3b86ULL },
+  { 2556, 0x937e4b347ULL },
+  { 2557, 0x794e6b305ULL },
+  { 2558, 0x736e6b346ULL },
+  { 2559, 0x35e94a3b7ULL },
+  { 2560, 0x7e96a3b4ULL },
+  { 2561, 0x4e73a3b6ULL },
+  { 2565, 0x84e7c7b79ULL },
+  { 2566, 0x74e7c7b69ULL },
+  { 2567, 0x46e7d7b56ULL },
+  { 2568, 0x5e9a7b84ULL },
+  { 2569, 0x74e8a7b64ULL },
+  { 2570, 0x46e6a7b56ULL },
+  { 2574, 0x93e5c7b47ULL },
+  { 2575, 0x43e6c7b67ULL },
+  { 2576, 0x36e7d7b46ULL },
+  { 2577, 0x4e9a7b83ULL },
+  { 2578, 0x93e6a7b04ULL },
+  { 2579, 0x6e3a7b46ULL },
+  { 2592, 0x58e5b4b49ULL },
+  { 2593, 0x84e6b4b85ULL },
+  { 2594, 0x95e5b4b86ULL },
+  { 2595, 0x58e9b4a09ULL },
+  { 2596, 0x94e5b8a64ULL },
+  { 2597, 0x95e9b4a46ULL },
+  { 2598, 0x58e9b09a4ULL },
+  { 2599, 0x86e5b96a4ULL },
+  { 2600, 0x94e5b84a6ULL },
+  { 2601, 0x43e3b8b54ULL },
+  { 2602, 0x53e6b3b44ULL },
+  { 2603, 0x45e3b6b36ULL },
+  { 2604, 0x94e8b3a45ULL },
+  { 2605, 0x43e6b6a43ULL },
+  { 2606, 0x56e3b4a46ULL },
+  { 2607, 0x94e8b45a3ULL },
+  { 2608, 0x36e5b46a4ULL },
+  { 2609, 0x94e3b64a6ULL },
+  { 2610, 0x99e3b43c3ULL },
+  { 2611, 0x48e6b03c3ULL },
+  { 2616, 0x53e8b43a9ULL },
+  { 2617, 0x43e6b63a4ULL },
+  { 2618, 0x53e5b43a6ULL },
+  { 2619, 0x47e7b8b98ULL },
+  { 2620, 0x96e5b4b87ULL },
+  { 2621, 0x75e7b4b86ULL },
+  { 2622, 0x57e9b4a08ULL },
+  { 2623, 0x74e7b6a84ULL },
+  { 2624, 0x66e5b4a76ULL },
+  { 2625, 0x57e9b08a4ULL },
+  { 2626, 0x46e7b46a7ULL },
+  { 2627, 0x74e7b84a6ULL },
+  { 2628, 0x83e7b9b45ULL },
+  { 2629, 0x33e7b6b64ULL },
+  { 2630, 0x74e7b9b36ULL },
+  { 2631, 0x43e7b4a73ULL },
+  { 2632, 0x43e7b6a53ULL },
+  { 2633, 0x86e3b4a76ULL },
+  { 2634, 0x47e9b08a3ULL },
+  { 2635, 0x7e3b96a4ULL },
+  { 2636, 0x93e7b04a6ULL },
+  { 2637, 0x79e5b43c3ULL },
+  { 2643, 0x43e7b83a3ULL },
+  { 2644, 0x63e7b93a4ULL },
+  { 2645, 0x73e3b43a6ULL },
+  { 2646, 0x87e9b7b49ULL },
+  { 2647, 0x47e6b7b78ULL },
+  { 2648, 0x94e8b7b46ULL },
+  { 2649, 0x94e8b7a05ULL },
+  { 2650, 0x84e6b7a74ULL },
+  { 2651, 0x66e5b7a46ULL },
+  { 2652, 0x94e5b74a7ULL },
+  { 2653, 0x64e8b74a7ULL },
+  { 2654, 0x84e5b74a6ULL },
+  { 2655, 0x93e8b7b45ULL },
+  { 2656, 0x64e3b7b65ULL },
+  { 2657, 0x94e7b7b36ULL },
+  { 2658, 0x93e8b7a04ULL },
+  { 2659, 0x4e6b7a93ULL },
+  { 2660, 0x46e3b7a06ULL },
+  { 2661, 0x35e3b74a9ULL },
+  { 2662, 0x86e3b76a4ULL },
+  { 2663, 0x5e3b74a6ULL },
+  { 2670, 0x83e3b73a4ULL },
+  { 2671, 0x43e6b73a3ULL },
+  { 2672, 0x4e3b73a6ULL },
+  { 2673, 0x9e4d8c54ULL },
+  { 2674, 0x69e4d8c84ULL },
+  { 2675, 0x48e4d65c6ULL },
+  { 2676, 0x98e44a9c5ULL },
+  { 2677, 0x96e4c6a54ULL },
+  { 2678, 0x86e4a4a06ULL },
+  { 2679, 0x85e4a94a5ULL },
+  { 2680, 0x66e4a85a4ULL },
+  { 2681, 0x49e4a48a6ULL },
+  { 2682, 0x33e4d44c3ULL },
+  { 2683, 0x86e4d8c43ULL },
+  { 2684, 0x36e4d4c36ULL },
+  { 2685, 0x94e4c4a33ULL },
+  { 2686, 0x84e4c3a63ULL },
+  { 2687, 0x38e4c5a36ULL },
+  { 2688, 0x34e43a4a5ULL },
+  { 2689, 0x65e4a94a3ULL },
+  { 2690, 0x35e4a34a6ULL },
+  { 2691, 0x43e43c3d3ULL },
+  { 2692, 0x46e46c3d3ULL },
+  { 2693, 0x45e4d63c6ULL },
+  { 2694, 0x35e44a3c3ULL },
+  { 2695, 0x56e46a3d3ULL },
+  { 2696, 0x63e43a3d6ULL },
+  { 2697, 0x34e4a53a4ULL },
+  { 2698, 0x64e4a83a4ULL },
+  { 2699, 0x36e45a3a6ULL },
+  { 2700, 0x49e4d8c74ULL },
+  { 2701, 0x67e4d67c4ULL },
+  { 2702, 0x76e4d4c76ULL },
+  { 2703, 0x78e4a4a97ULL },
+  { 2704, 0x89e4c6a47ULL },
+  { 2705, 0x87e4a9a56ULL },
+  { 2706, 0x78e4a57a8ULL },
+  { 2707, 0x68e47a5a7ULL },
+  { 2708, 0x48e4a47a6ULL },
+  { 2709, 0x7e4d8c53ULL },
+  { 2710, 0x67e4d8c83ULL },
+  { 2712, 0x47e4c9a83ULL },
+  { 2713, 0x46e4a3a75ULL },
+  { 2714, 0x67e4c3a46ULL },
+  { 2715, 0x38e4a57a4ULL },
+  { 2716, 0x37e4a46a5ULL },
+  { 2717, 0x37e4a36a6ULL },
+  { 2718, 0x47e47c3d3ULL },
+  { 2719, 0x36e4d63c7ULL },
+  { 2721, 0x38e47a3c3ULL },
+  { 2722, 0x67e46a3c4ULL },
+  { 2723, 0x67e47a3d6ULL },
+  { 2724, 0x74e4a83a5ULL },
+  { 2725, 0x64e4a53a7ULL },
+  { 2726, 0x37e46a3a6ULL },
+  { 2727, 0x4e4c7d07ULL },
+  { 2728, 0x65e4c7d89ULL },
+  { 2730, 0x58e4c7a75ULL },
+  { 2731, 0x68e4c7a85ULL },
+  { 2732, 0x67e4a7a56ULL },
+  { 2733, 0x89e4a78a7ULL },
+  { 2734, 0x68e4a77a5ULL },
+  { 2735, 0x76e4a75a6ULL },
+  { 2738, 0x63e4c7d36ULL },
+  { 2739, 0x85e4c7a03ULL },
+  { 2740, 0x64e4a7a53ULL },
+  { 2741, 0x47e4a7a36ULL },
+  { 2742, 0x48e4a77a3ULL },
+  { 2743, 0x46e4a75a3ULL },
+  { 2751, 0x44e4a73a3ULL },
+  { 2752, 0x64e4a73a5ULL },
+  { 2753, 0x74e4a73a6ULL },
+  { 2754, 0x84e4d8b05ULL },
+  { 2755, 0x5e4c9b68ULL },
+  { 2756, 0x46e4d4b56ULL },
+  { 2757, 0x58e4a9b09ULL },
+  { 2758, 0x84e4a6b05ULL },
+  { 2759, 0x65e4a8b06ULL },
+  { 2763, 0x83e4d4b93ULL },
+  { 2764, 0x43e4c6b85ULL },
+  { 2765, 0x65e4c3b86ULL },
+  { 2766, 0x93e4a5b04ULL },
+  { 2767, 0x83e4a6b04ULL },
+  { 2768, 0x56e4a3b46ULL },
+  { 2775, 0x4e43a3b9ULL },
+  { 2776, 0x46e46a3b3ULL },
+  { 2781, 0x97e4d4b08ULL },
+  { 2782, 0x44e4c8b67ULL },
+  { 2783, 0x66e4d4b76ULL },
+  { 2784, 0x57e4a9b08ULL },
+  { 2785, 0x67e4a4b67ULL },
+  { 2786, 0x66e4a5b76ULL },
+  { 2790, 0x37e4c5b39ULL },
+  { 2791, 0x36e4c4b97ULL },
+  { 2792, 0x53e4c8b76ULL },
+  { 2793, 0x57e4a3b47ULL },
+  { 2794, 0x73e4a6b93ULL },
+  { 2795, 0x86e4a3b76ULL },
+  { 2802, 0x47e47a3b3ULL },
+  { 2803, 0x67e47a3b5ULL },
+  { 2804, 0x73e43a3b6ULL },
+  { 2808, 0x74e4c7b57ULL },
+  { 2809, 0x65e4c7b48ULL },
+  { 2810, 0x4e4c7b86ULL },
+  { 2811, 0x78e4a7b09ULL },
+  { 2812, 0x64e4a7b94ULL },
+  { 2813, 0x75e4a7b06ULL },
+  { 2817, 0x3e4c7b85ULL },
+  { 2818, 0x56e4c7b39ULL },
+  { 2819, 0x73e4c7b56ULL },
+  { 2820, 0x73e4a7b04ULL },
+  { 2821, 0x63e4a7b93ULL },
+  { 2822, 0x6e4a7b36ULL },
+  { 2835, 0x94e4b5b85ULL },
+  { 2836, 0x64e4b8b85ULL },
+  { 2837, 0x95e4b5b86ULL },
+  { 2838, 0x9e4b9a58ULL },
+  { 2839, 0x5e4b8a64ULL },
+  { 2840, 0x96e4b8a56ULL },
+  { 2841, 0x9e4b98a5ULL },
+  { 2842, 0x96e4b86a5ULL },
+  { 2843, 0x5e4b84a6ULL },
+  { 2844, 0x59e4b3c33ULL },
+  { 2845, 0x68e4b3b39ULL },
+  { 2846, 0x35e4b3b06ULL },
+  { 2847, 0x4e4b9a53ULL },
+  { 2848, 0x4e4b8a63ULL },
+  { 2849, 0x46e4b5a36ULL },
+  { 2850, 0x85e4b95a3ULL },
+  { 2851, 0x95e4b06a3ULL },
+  { 2852, 0x54e4b34a6ULL },
+  { 2853, 0x59e4b33c3ULL },
+  { 2854, 0x68e4b03c3ULL },
+  { 2859, 0x93e4b83a5ULL },
+  { 2860, 0x53e4b63a3ULL },
+  { 2861, 0x63e4b43a6ULL },
+  { 2862, 0x97e4b5b88ULL },
+  { 2863, 0x76e4b4b57ULL },
+  { 2864, 0x75e4b5b66ULL },
+  { 2865, 0x8e4b9a57ULL },
+  { 2866, 0x67e4b5a57ULL },
+  { 2867, 0x76e4b6a56ULL },
+  { 2868, 0x8e4b97a5ULL },
+  { 2869, 0x7e4b96a5ULL },
+  { 2870, 0x7e4b86a6ULL },
+  { 2871, 0x83e4b5b74ULL },
+  { 2872, 0x36e4b6b37ULL },
+  { 2873, 0x75e4b3b46ULL },
+  { 2874, 0x47e4b5a37ULL },
+  { 2875, 0x93e4b6a73ULL },
+  { 2876, 0x76e4b8a36ULL },
+  { 2877, 0x97e4b08a3ULL },
+  { 2878, 0x37e4b96a8ULL },
+  { 2879, 0x57e4b37a6ULL },
+  { 2886, 0x73e4b83a3ULL },
+  { 2887, 0x73e4b63a5ULL },
+  { 2888, 0x73e4b53a6ULL },
+  { 2889, 0x87e4b7b98ULL },
+  { 2890, 0x67e4b7b78ULL },
+  { 2891, 0x55e4b7b66ULL },
+  { 2892, 0x9e4b7a78ULL },
+  { 2893, 0x6e4b7a75ULL },
+  { 2894, 0x76e4b7a46ULL },
+  { 2895, 0x9e4b78a7ULL },
+  { 2896, 0x76e4b76a4ULL },
+  { 2897, 0x94e4b74a6ULL },
+  { 2898, 0x73e4b7b84ULL },
+  { 2899, 0x53e4b7b64ULL },
+  { 2900, 0x35e4b7b46ULL },
+  { 2901, 0x4e4b7a73ULL },
+  { 2902, 0x93e4b7a63ULL },
+  { 2903, 0x36e4b7a06ULL },
+  { 2905, 0x64e4b74a3ULL },
+  { 2913, 0x73e4b73a4ULL },
+  { 2914, 0x63e4b73a3ULL },
+  { 2915, 0x93e4b73a6ULL },
+  { 2916, 0x9e1c5c81ULL },
+  { 2917, 0x9e51c6c1ULL },
+  { 2918, 0x9e1d51c6ULL },
+  { 2919, 0x98e1a11c8ULL },
+  { 2920, 0x69e1a91c5ULL },
+  { 2921, 0x19e1a51c6ULL },
+  { 2922, 0x9e1c98a1ULL },
+  { 2923, 0x96e1c86a1ULL },
+  { 2924, 0x19e58c1a6ULL },
+  { 2925, 0x985e13c91ULL },
+  { 2926, 0x39e5c681ULL },
+  { 2927, 0x918e31c36ULL },
+  { 2928, 0x39e5a11c8ULL },
+  { 2929, 0x93e6a11c3ULL },
+  { 2930, 0x18e3a31c6ULL },
+  { 2931, 0x19e5a38a3ULL },
+  { 2932, 0x36e1a95a3ULL },
+  { 2933, 0x39e18a6a6ULL },
+  { 2934, 0x519e5c381ULL },
+  { 2935, 0x819e6c351ULL },
+  { 2936, 0x15e31d366ULL },
+  { 2937, 0x85e13a3c9ULL },
+  { 2938, 0x69e18a3c5ULL },
+  { 2939, 0x16e95a3d6ULL },
+  { 2940, 0x19e3c03a1ULL },
+  { 2941, 0x63e1d53a1ULL },
+  { 2942, 0x63e1c03a6ULL },
+  { 2943, 0x78e11d759ULL },
+  { 2944, 0x768e15c71ULL },
+  { 2945, 0x679e61c16ULL },
+  { 2946, 0x58e8a11c7ULL },
+  { 2947, 0x68e9a11c7ULL },
+  { 2948, 0x86e1c1a76ULL },
+  { 2949, 0x98e18a7a1ULL },
+  { 2950, 0x67e1a86a7ULL },
+  { 2951, 0x68e9a17a6ULL },
+  { 2952, 0x705e93c31ULL },
+  { 2953, 0x178e76c31ULL },
+  { 2954, 0x687e131c6ULL },
+  { 2955, 0x18e3a5a37ULL },
+  { 2956, 0x37e5a86c1ULL },
+  { 2957, 0x37e1c6a76ULL },
+  { 2958, 0x18e5a37a3ULL },
+  { 2959, 0x37e1a56a7ULL },
+  { 2960, 0x38e1a67a6ULL },
+  { 2961, 0x915e3c371ULL },
+  { 2962, 0x876e6c311ULL },
+  { 2963, 0x93e71d366ULL },
+  { 2964, 0x59e17a3c8ULL },
+  { 2965, 0x67e37a3c1ULL },
+  { 2966, 0x17e96a3d6ULL },
+  { 2967, 0x73e1a53a1ULL },
+  { 2968, 0x73e963a1ULL },
+  { 2969, 0x313e703a6ULL },
+  { 2970, 0x98e871c5ULL },
+  { 2971, 0x88e671c5ULL },
+  { 2972, 0x16e7d7c16ULL },
+  { 2973, 0x81e5a7d19ULL },
+  { 2974, 0x68e1c7a97ULL },
+  { 2975, 0x57e1c7a86ULL },
+  { 2976, 0x59e7a78a1ULL },
+  { 2977, 0x77e9a76a1ULL },
+  { 2978, 0x19e8a77a6ULL },
+  { 2979, 0x91e3d75c1ULL },
+  { 2980, 0x638e67c11ULL },
+  { 2981, 0x18e9c7d36ULL },
+  { 2982, 0x19e8c7a53ULL },
+  { 2983, 0x39e6c7a15ULL },
+  { 2984, 0x37e1c7a66ULL },
+  { 2985, 0x39e5a78a1ULL },
+  { 2986, 0x6e1c75a3ULL },
+  { 2987, 0x37e1c76a6ULL },
+  { 2988, 0x73e1c73c1ULL },
+  { 2989, 0x673e673c1ULL },
+  { 2991, 0x83e1a73c1ULL },
+  { 2994, 0x973e873a1ULL },
+  { 2995, 0x673e573a1ULL },
+  { 2996, 0x773e173a6ULL },
+  { 2997, 0x89e19b981ULL },
+  { 2998, 0x58e66b151ULL },
+  { 2999, 0x15e1c9b06ULL },
+  { 3000, 0x11e9a8b01ULL },
+  { 3001, 0x68e19a6b1ULL },
+  { 3002, 0x95e16a8b6ULL },
+  { 3006, 0x85e18b931ULL },
+  { 3007, 0x63e38b911ULL },
+  { 3008, 0x81e9c5b36ULL },
+  { 3009, 0x58e39a9b1ULL },
+  { 3010, 0x16e3a1b95ULL },
+  { 3011, 0x16e3a3b16ULL },
+  { 3015, 0x89e58b381ULL },
+  { 3016, 0x89e56b361ULL },
+  { 3017, 0x806e5b316ULL },
+  { 3018, 0x19e98a3b5ULL },
+  { 3019, 0x95e16a3b1ULL },
+  { 3020, 0x61e31a3b6ULL },
+  { 3024, 0x79e18b871ULL },
+  { 3025, 0x67e18b751ULL },
+  { 3026, 0x966e1b076ULL },
+  { 3027, 0x78e19a5b1ULL },
+  { 3028, 0x17e56a1b7ULL },
+  { 3029, 0x17e7a1b56ULL },
+  { 3033, 0x87e37b151ULL },
+  { 3034, 0x86e17b931ULL },
+  { 3035, 0x11e73b8c6ULL },
+  { 3036, 0x57e38a9b1ULL },
+  { 3037, 0x36e16a5b7ULL },
+  { 3038, 0x96e3a1b76ULL },
+  { 3042, 0x87e57b351ULL },
+  { 3043, 0x78e67b361ULL },
+  { 3044, 0x706e6b316ULL },
+  { 3045, 0x97e18a3b1ULL },
+  { 3046, 0x76e96a3b1ULL },
+  { 3047, 0x17e86a3b6ULL },
+  { 3051, 0x51e8c7b17ULL },
+  { 3052, 0x96e1c7b67ULL },
+  { 3053, 0x81e7c7b76ULL },
+  { 3054, 0x97e5a7b18ULL },
+  { 3055, 0x71e8a7b61ULL },
+  { 3056, 0x16e7a7b16ULL },
+  { 3060, 0x3e7d7b13ULL },
+  { 3061, 0x13e6c7b37ULL },
+  { 3062, 0x35e1c7b06ULL },
+  { 3063, 0x78e3a7b19ULL },
+  { 3064, 0x3e6a7b13ULL },
+  { 3065, 0x75e3a7b16ULL },
+  { 3078, 0x98e1b5c81ULL },
+  { 3079, 0x98e1b6c51ULL },
+  { 3080, 0x86e1b1c96ULL },
+  { 3081, 0x19e5b8a88ULL },
+  { 3082, 0x19e1b6a68ULL },
+  { 3083, 0x85e9b6a16ULL },
+  { 3084, 0x88e8b19a5ULL },
+  { 3085, 0x16e6b95a8ULL },
+  { 3086, 0x19e1b68a6ULL },
+  { 3087, 0x13e8b1c93ULL },
+  { 3088, 0x15e6b91c3ULL },
+  { 3089, 0x36e3b1d66ULL },
+  { 3090, 0x39e1b9a58ULL },
+  { 3091, 0x16e1b9a35ULL },
+  { 3092, 0x36e1b1a36ULL },
+  { 3093, 0x31e5b51a3ULL },
+  { 3094, 0x35e9b16a1ULL },
+  { 3095, 0x36e1b85a6ULL },
+  { 3096, 0x89e1b33c3ULL },
+  { 3097, 0x33e6b93c1ULL },
+  { 3102, 0x13e5b53a1ULL },
+  { 3103, 0x63e1b63a1ULL },
+  { 3104, 0x53e1b03a6ULL },
+  { 3105, 0x87e1b1c97ULL },
+  { 3106, 0x96e8b1c77ULL },
+  { 3107, 0x16e7b1c86ULL },
+  { 3108, 0x78e5b1a19ULL },
+  { 3109, 0x56e7b1a17ULL },
+  { 3110, 0x17e1b5a76ULL },
+  { 3111, 0x78e5b19a1ULL },
+  { 3112, 0x17e1b56a7ULL },
+  { 3113, 0x67e1b17a6ULL },
+  { 3114, 0x37e3b5b18ULL },
+  { 3115, 0x76e3b1c07ULL },
+  { 3116, 0x75e3b1c06ULL },
+  { 3117, 0x78e7b3a19ULL },
+  { 3118, 0x67e3b1a87ULL },
+  { 3119, 0x16e7b3a56ULL },
+  { 3120, 0x78e7b39a1ULL },
+  { 3121, 0x96e3b17a1ULL },
+  { 3122, 0x37e1b86a6ULL },
+  { 3123, 0x73e1b83c1ULL },
+  { 3124, 0x78e6b13c3ULL },
+  { 3129, 0x73e3b13a9ULL },
+  { 3130, 0x63e1b03a7ULL },
+  { 3131, 0x3e7b13a6ULL },
+  { 3132, 0x78e1b7b59ULL },
+  { 3133, 0x97e6b71c5ULL },
+  { 3134, 0x15e7b7b56ULL },
+  { 3135, 0x58e1b7a97ULL },
+  { 3136, 0x81e6b7a71ULL },
+  { 3137, 0x76e1b7a16ULL },
+  { 3138, 0x58e1b77a9ULL },
+  { 3139, 0x76e1b76a1ULL },
+  { 3140, 0x81e5b71a6ULL },
+  { 3141, 0x91e5b7b13ULL },
+  { 3142, 0x81e6b7b13ULL },
+  { 3143, 0x35e1b7b16ULL },
+  { 3144, 0x39e1b7a78ULL },
+  { 3145, 0x63e1b7a03ULL },
+  { 3146, 0x56e3b7a16ULL },
+  { 3147, 0x39e1b78a7ULL },
+  { 3148, 0x36e1b75a7ULL },
+  { 3150, 0x3e7b73c1ULL },
+  { 3151, 0x63e1b73c1ULL },
+  { 3156, 0x93e1b73a3ULL },
+  { 3159, 0x49e5c881ULL },
+  { 3160, 0x458e16c41ULL },
+  { 3161, 0x64e51d096ULL },
+  { 3162, 0x18e5a91c4ULL },
+  { 3163, 0x46e9a11c5ULL },
+  { 3164, 0x58e1a41c6ULL },
+  { 3165, 0x94e1c84a1ULL },
+  { 3166, 0x16e8a94a4ULL },
+  { 3167, 0x45e1c84a6ULL },
+  { 3168, 0x345e181c3ULL },
+  { 3169, 0x645e93c41ULL },
+  { 3170, 0x43e91d646ULL },
+  { 3171, 0x34e1c8a53ULL },
+  { 3172, 0x54e6a31c3ULL },
+  { 3173, 0x46e3d9a16ULL },
+  { 3174, 0x35e1a94a3ULL },
+  { 3175, 0x34e63a6a1ULL },
+  { 3176, 0x94e34c1a6ULL },
+  { 3177, 0x945e3c381ULL },
+  { 3178, 0x858e6c341ULL },
+  { 3179, 0x346e1c346ULL },
+  { 3180, 0x105e8a394ULL },
+  { 3181, 0x16e94a3c4ULL },
+  { 3182, 0x14e93a3d6ULL },
+  { 3183, 0x44e8a53a1ULL },
+  { 3184, 0x54e8a63a1ULL },
+  { 3185, 0x5e14a3a6ULL },
+  { 3186, 0x47e581c4ULL },
+  { 3187, 0x467e4c191ULL },
+  { 3188, 0x407e11c46ULL },
+  { 3189, 0x57e17a1c4ULL },
+  { 3190, 0x17e7a61c4ULL },
+  { 3191, 0x47e1c6a86ULL },
+  { 3192, 0x97e17a4a4ULL },
+  { 3193, 0x45e1a64a7ULL },
+  { 3194, 0x16e7a84a6ULL },
+  { 3195, 0x714e3c931ULL },
+  { 3196, 0x637e4c481ULL },
+  { 3197, 0x74e31d116ULL },
+  { 3198, 0x74e5a41c3ULL },
+  { 3199, 0x36e7a41c4ULL },
+  { 3200, 0x37e3c4a16ULL },
+  { 3201, 0x74e13a9a7ULL },
+  { 3202, 0x37e1a86a4ULL },
+  { 3203, 0x34e73c1a6ULL },
+  { 3204, 0x743e743c1ULL },
+  { 3206, 0x43e71c3d6ULL },
+  { 3207, 0x147e8a337ULL },
+  { 3208, 0x37e16a3c4ULL },
+  { 3209, 0x716e4a316ULL },
+  { 3210, 0x14e1a33a7ULL },
+  { 3211, 0x44e1a63a7ULL },
+  { 3212, 0x44e7a13a6ULL },
+  { 3213, 0x418e47c11ULL },
+  { 3214, 0x61e8c7d41ULL },
+  { 3216, 0x48e7a7c11ULL },
+  { 3217, 0x67e5c7a14ULL },
+  { 3218, 0x47e1c7a76ULL },
+  { 3219, 0x98e5c71a4ULL },
+  { 3220, 0x46e6a75a1ULL },
+  { 3221, 0x184e574a6ULL },
+  { 3222, 0x949e37c31ULL },
+  { 3225, 0x45e3a71c3ULL },
+  { 3226, 0x38e6c7a14ULL },
+  { 3227, 0x41e5a7d36ULL },
+  { 3228, 0x15e1a74a3ULL },
+  { 3229, 0x476e376a1ULL },
+  { 3230, 0x35e1c74a6ULL },
+  { 3231, 0x473e473c1ULL },
+  { 3234, 0x4e3a73c1ULL },
+  { 3235, 0x34e6a73c1ULL },
+  { 3237, 0x573e473a1ULL },
+  { 3238, 0x64e1c73a9ULL },
+  { 3239, 0x34e1c73a6ULL },
+  { 3240, 0x49e15b541ULL },
+  { 3241, 0x64e59b141ULL },
+  { 3242, 0x41e04b9c6ULL },
+  { 3243, 0x48e19a8b1ULL },
+  { 3244, 0x45e16a8b1ULL },
+  { 3245, 0x45e1a8b16ULL },
+  { 3249, 0x34e19b431ULL },
+  { 3250, 0x64e98b531ULL },
+  { 3251, 0x14e8c3b56ULL },
+  { 3252, 0x14e3a1b93ULL },
+  { 3253, 0x64e15a8b3ULL },
+  { 3254, 0x14e34a8b6ULL },
+  { 3258, 0x89e54b341ULL },
+  { 3259, 0x38e06b341ULL },
+  { 3260, 0x906e4b316ULL },
+  { 3261, 0x93e14a3b1ULL },
+  { 3262, 0x14e63a3b8ULL },
+  { 3263, 0x14e83a3b6ULL },
+  { 3267, 0x79e84b541ULL },
+  { 3268, 0x76e87b541ULL },
+  { 3269, 0x766e4b176ULL },
+  { 3270, 0x14e14a7b7ULL },
+  { 3271, 0x46e17a8b1ULL },
+  { 3272, 0x47e7a1b86ULL },
+  { 3276, 0x37e18b451ULL },
+  { 3277, 0x36e17b431ULL },
+  { 3278, 0x33e7c4b16ULL },
+  { 3279, 0x14e74a9b3ULL },
+  { 3280, 0x61e3a4b71ULL },
+  { 3281, 0x37e17a4b6ULL },
+  { 3285, 0x37e04b311ULL },
+  { 3286, 0x78e65b341ULL },
+  { 3288, 0x54e74a3b1ULL },
+  { 3289, 0x47e67a3b1ULL },
+  { 3290, 0x47e17a3b6ULL },
+  { 3294, 0x78e1c7b49ULL },
+  { 3295, 0x41e6c7b65ULL },
+  { 3296, 0x45e1c7b16ULL },
+  { 3297, 0x41e7a7b41ULL },
+  { 3298, 0x41e6a7b51ULL },
+  { 3299, 0x45e1a7b06ULL },
+  { 3303, 0x41e3c7b53ULL },
+  { 3304, 0x63e1c7b34ULL },
+  { 3305, 0x4e3c7b16ULL },
+  { 3306, 0x14e5a7b34ULL },
+  { 3307, 0x31e6a7b41ULL },
+  { 3321, 0x84e1b1c94ULL },
+  { 3322, 0x94e6b11c5ULL },
+  { 3323, 0x65e8b1c46ULL },
+  { 3324, 0x15e1b8a44ULL },
+  { 3325, 0x94e8b6a15ULL },
+  { 3326, 0x45e8b1a16ULL },
+  { 3327, 0x15e1b84a4ULL },
+  { 3328, 0x94e8b65a1ULL },
+  { 3329, 0x15e1b64a6ULL },
+  { 3330, 0x54e3b1c84ULL },
+  { 3331, 0x34e6b1c94ULL },
+  { 3332, 0x46e1b3b86ULL },
+  { 3333, 0x34e1b1a34ULL },
+  { 3334, 0x84e6b1a35ULL },
+  { 3335, 0x16e3b4a06ULL },
+  { 3336, 0x94e3b15a1ULL },
+  { 3337, 0x84e6b35a1ULL },
+  { 3338, 0x93e8b14a6ULL },
+  { 3339, 0x33e1b43c1ULL },
+  { 3345, 0x14e1b83a4ULL },
+  { 3346, 0x93e1b63a4ULL },
+  { 3347, 0x13e9b43a6ULL },
+  { 3348, 0x57e9b1c48ULL },
+  { 3349, 0x86e6b1c47ULL },
+  { 3350, 0x75e6b1b46ULL },
+  { 3351, 0x74e1b1a74ULL },
+  { 3352, 0x96e6b4a17ULL },
+  { 3353, 0x76e1b4a46ULL },
+  { 3354, 0x14e7b14a7ULL },
+  { 3355, 0x76e1b46a4ULL },
+  { 3356, 0x47e1b96a6ULL },
+  { 3357, 0x73e7b11c4ULL },
+  { 3358, 0x74e6b1c35ULL },
+  { 3359, 0x41e7b3d36ULL },
+  { 3360, 0x14e7b3a54ULL },
+  { 3361, 0x71e3b6a41ULL },
+  { 3363, 0x74e7b15a3ULL },
+  { 3364, 0x41e6b31a7ULL },
+  { 3365, 0x71e3b41a6ULL },
+  { 3372, 0x4e1b43a7ULL },
+  { 3375, 0x94e1b7b75ULL },
+  { 3376, 0x17e6b7b48ULL },
+  { 3377, 0x65e1b7b46ULL },
+  { 3378, 0x41e7b7a41ULL },
+  { 3379, 0x61e5b7a41ULL },
+  { 3380, 0x7e1b7a46ULL },
+  { 3381, 0x74e1b74a1ULL },
+  { 3382, 0x61e5b71a4ULL },
+  { 3383, 0x41e9b71a6ULL },
+  { 3384, 0x84e3b71c3ULL },
+  { 3385, 0x63e1b7b44ULL },
+  { 3387, 0x54e3b7a14ULL },
+  { 3388, 0x41e6b7a31ULL },
+  { 3390, 0x54e3b74a1ULL },
+  { 3391, 0x41e6b71a3ULL },
+  { 3393, 0x43e3b73c1ULL },
+  { 3399, 0x14e1b73a5ULL },
+  { 3402, 0x44e4c1c11ULL },
+  { 3403, 0x46e4c1c61ULL },
+  { 3404, 0x41e44d616ULL },
+  { 3405, 0x49e4a81c5ULL },
+  { 3406, 0x86e4a4c61ULL },
+  { 3407, 0x46e4c1a06ULL },
+  { 3408, 0x45e4a94a1ULL },
+  { 3409, 0x16e4a84a9ULL },
+  { 3410, 0x5e4c11a6ULL },
+  { 3411, 0x3e4d8c51ULL },
+  { 3412, 0x63e4d8c81ULL },
+  { 3413, 0x54e41d036ULL },
+  { 3414, 0x34e4c1a93ULL },
+  { 3415, 0x34e4c6a91ULL },
+  { 3416, 0x39e4c8a16ULL },
+  { 3417, 0x93e43a4a1ULL },
+  { 3418, 0x86e4a36a1ULL },
+  { 3419, 0x85e4c31a6ULL },
+  { 3420, 0x41e41c3d3ULL },
+  { 3421, 0x18e4d63c9ULL },
+  { 3423, 0x18e45a3c9ULL },
+  { 3424, 0x16e43a3c9ULL },
+  { 3425, 0x61e41a3d6ULL },
+  { 3426, 0x93e4a43a1ULL },
+  { 3427, 0x63e4a13a1ULL },
+  { 3428, 0x14e4a13a6ULL },
+  { 3429, 0x7e41c1c5ULL },
+  { 3430, 0x71e4d86c1ULL },
+  { 3431, 0x74e41d856ULL },
+  { 3432, 0x97e4a1c57ULL },
+  { 3433, 0x7e4a6c11ULL },
+  { 3434, 0x7e4c1a66ULL },
+  { 3435, 0x97e47a4a1ULL },
+  { 3436, 0x17e4a66a1ULL },
+  { 3437, 0x87e4c81a6ULL },
+  { 3438, 0x43e4d8c71ULL },
+  { 3439, 0x43e41d674ULL },
+  { 3441, 0x71e4a3d93ULL },
+  { 3442, 0x76e4a36c1ULL },
+  { 3443, 0x37e4c3a16ULL },
+  { 3444, 0x37e4c81a1ULL },
+  { 3445, 0x37e46a1a8ULL },
+  { 3450, 0x79e4a13c3ULL },
+  { 3451, 0x76e46a3c1ULL },
+  { 3453, 0x74e41c3a5ULL },
+  { 3454, 0x61e4d63a7ULL },
+  { 3457, 0x86e4c71c1ULL },
+  { 3459, 0x54e4c7a71ULL },
+  { 3460, 0x44e4c7a61ULL },
+  { 3461, 0x17e4a7a06ULL },
+  { 3462, 0x57e4c71a7ULL },
+  { 3463, 0x96e4c71a1ULL },
+  { 3464, 0x47e4c71a6ULL },
+  { 3468, 0x14e4c7a31ULL },
+  { 3469, 0x16e4c7a33ULL },
+  { 3470, 0x19e4c7a36ULL },
+  { 3471, 0x17e4c71a3ULL },
+  { 3477, 0x14e4a73c1ULL },
+  { 3483, 0x45e49b841ULL },
+  { 3484, 0x46e45b811ULL },
+  { 3485, 0x14e4c5b16ULL },
+  { 3486, 0x81e4a5b91ULL },
+  { 3487, 0x94e45a6b1ULL },
+  { 3488, 0x16e4a4b16ULL },
+  { 3492, 0x58e45b931ULL },
+  { 3493, 0x91e4c6b34ULL },
+  { 3494, 0x13e4c8b36ULL },
+  { 3495, 0x14e4a1b83ULL },
+  { 3496, 0x63e44a9b1ULL },
+  { 3497, 0x16e4a3b06ULL },
+  { 3501, 0x98e45b341ULL },
+  { 3502, 0x96e46b331ULL },
+  { 3504, 0x41e41a3b3ULL },
+  { 3505, 0x61e41a3b5ULL },
+  { 3510, 0x19e48b571ULL },
+  { 3511, 0x77e48b161ULL },
+  { 3512, 0x75e4c1b16ULL },
+  { 3513, 0x17e47a8b5ULL },
+  { 3514, 0x66e4a9b17ULL },
+  { 3515, 0x17e4a1b86ULL },
+  { 3519, 0x33e48b711ULL },
+  { 3520, 0x7e46b431ULL },
+  { 3521, 0x73e4c6b16ULL },
+  { 3522, 0x83e44a7b1ULL },
+  { 3523, 0x67e47a1b3ULL },
+  { 3524, 0x31e41a7b6ULL },
+  { 3528, 0x97e47b351ULL },
+  { 3529, 0x97e46b341ULL },
+  { 3531, 0x81e41a3b7ULL },
+  { 3533, 0x71e41a3b6ULL },
+  { 3537, 0x71e4c7b54ULL },
+  { 3538, 0x61e4c7b44ULL },
+  { 3539, 0x14e4c7b96ULL },
+  { 3540, 0x87e4a7b18ULL },
+  { 3541, 0x61e4a7b91ULL },
+  { 3542, 0x85e4a7b16ULL },
+  { 3546, 0x31e4c7b14ULL },
+  { 3547, 0x36e4c7b19ULL },
+  { 3548, 0x33e4c7b16ULL },
+  { 3549, 0x13e4a7b43ULL },
+  { 3550, 0x31e4a7b61ULL },
+  { 3564, 0x49e4b89c1ULL },
+  { 3565, 0x8e4b6c41ULL },
+  { 3566, 0x65e4b1c06ULL },
+  { 3567, 0x84e4b1a15ULL },
+  { 3568, 0x15e4b9a64ULL },
+  { 3569, 0x85e4b1a16ULL },
+  { 3570, 0x84e4b15a1ULL },
+  { 3571, 0x85e4b16a1ULL },
+  { 3572, 0x61e4b41a6ULL },
+  { 3573, 0x94e4b1c35ULL },
+  { 3574, 0x63e4b4c01ULL },
+  { 3575, 0x81e4b3d66ULL },
+  { 3576, 0x83e4b1a14ULL },
+  { 3577, 0x14e4b9a63ULL },
+  { 3578, 0x6e4b3a16ULL },
+  { 3579, 0x41e4b51a3ULL },
+  { 3580, 0x51e4b61a3ULL },
+  { 3581, 0x51e4b31a6ULL },
+  { 3582, 0x3e4b43c1ULL },
+  { 3588, 0x3e4b33a1ULL },
+  { 3589, 0x33e4b63a1ULL },
+  { 3590, 0x33e4b13a6ULL },
+  { 3591, 0x78e4b1c19ULL },
+  { 3592, 0x66e4b1c07ULL },
+  { 3593, 0x75e4b1c16ULL },
+  { 3594, 0x57e4b8a17ULL },
+  { 3595, 0x18e4b9a67ULL },
+  { 3596, 0x17e4b9a66ULL },
+  { 3597, 0x87e4b18a1ULL },
+  { 3598, 0x86e4b17a1ULL },
+  { 3599, 0x17e4b96a6ULL },
+  { 3600, 0x74e4b3c71ULL },
+  { 3601, 0x96e4b1c37ULL },
+  { 3602, 0x71e4b3d36ULL },
+  { 3603, 0x71e4b8a31ULL },
+  { 3604, 0x37e4b6a17ULL },
+  { 3606, 0x7e4b37a1ULL },
+  { 3607, 0x37e4b67a1ULL },
+  { 3608, 0x37e4b17a6ULL },
+  { 3615, 0x43e4b13a7ULL },
+  { 3618, 0x7e4b7b18ULL },
+  { 3619, 0x66e4b7c01ULL },
+  { 3620, 0x5e4b7b16ULL },
+  { 3621, 0x18e4b7a87ULL },
+  { 3622, 0x91e4b7a61ULL },
+  { 3623, 0x46e4b7a16ULL },
+  { 3624, 0x18e4b77a8ULL },
+  { 3625, 0x46e4b76a1ULL },
+  { 3626, 0x91e4b71a6ULL },
+  { 3627, 0x74e4b71c3ULL },
+  { 3628, 0x36e4b76c1ULL },
+  { 3630, 0x43e4b7a13ULL },
+  { 3631, 0x61e4b7a31ULL },
+  { 3634, 0x61e4b71a3ULL },
+  { 3636, 0x33e4b73c1ULL },
+  { 3642, 0x43e4b73a1ULL },
+  { 3645, 0x811e5d095ULL },
+  { 3646, 0x81e6c6c5ULL },
+  { 3647, 0x101e6d606ULL },
+  { 3648, 0x181e19a09ULL },
+  { 3649, 0x681e69a09ULL },
+  { 3650, 0x151e68a56ULL },
+  { 3651, 0x91e981a1ULL },
+  { 3652, 0x61e951a1ULL },
+  { 3653, 0x511e901a6ULL },
+  { 3654, 0x531e3c9c5ULL },
+  { 3655, 0x681e5d039ULL },
+  { 3656, 0x301e6d816ULL },
+  { 3657, 0x301e88a51ULL },
+  { 3658, 0x911e38a63ULL },
+  { 3659, 0x131e86a36ULL },
+  { 3660, 0x191e881a3ULL },
+  { 3661, 0x161e351a8ULL },
+  { 3662, 0x631e031a6ULL },
+  { 3663, 0x111e3d333ULL },
+  { 3664, 0x361e1c361ULL },
+  { 3665, 0x801e6c3c6ULL },
+  { 3666, 0x191e8a381ULL },
+  { 3667, 0x161e8a351ULL },
+  { 3672, 0x871e5d098ULL },
+  { 3673, 0x671e1c671ULL },
+  { 3675, 0x501e81a78ULL },
+  { 3676, 0x671e18a59ULL },
+  { 3677, 0x651e98a76ULL },
+  { 3678, 0x511e801a7ULL },
+  { 3679, 0x771e961a8ULL },
+  { 3680, 0x571e961a6ULL },
+  { 3681, 0x911e3d753ULL },
+  { 3682, 0x361e6d879ULL },
+  { 3683, 0x531e5d576ULL },
+  { 3684, 0x511e73a87ULL },
+  { 3685, 0x331e75a67ULL },
+  { 3686, 0x601e93a76ULL },
+  { 3687, 0x831e731a1ULL },
+  { 3688, 0x371e861a5ULL },
+  { 3689, 0x361e751a6ULL },
+  { 3690, 0x931e7d379ULL },
+  { 3691, 0x901e7d367ULL },
+  { 3693, 0x871e5a371ULL },
+  { 3694, 0x671e3a371ULL },
+  { 3699, 0x71e071c1ULL },
+  { 3700, 0x671e671c1ULL },
+  { 3702, 0x71e97a19ULL },
+  { 3703, 0x751e67a18ULL },
+  { 3705, 0x971e871a1ULL },
+  { 3706, 0x671e571a1ULL },
+  { 3707, 0x771e171a6ULL },
+  { 3708, 0x371e371c1ULL },
+  { 3711, 0x151e87a37ULL },
+  { 3712, 0x311e77a63ULL },
+  { 3713, 0x631e57a16ULL },
+  { 3714, 0x871e571a3ULL },
+  { 3715, 0x671e371a3ULL },
+  { 3716, 0x971e371a6ULL },
+  { 3726, 0x981e1b091ULL },
+  { 3727, 0x951e1b061ULL },
+  { 3735, 0x881e3b191ULL },
+  { 3736, 0x851e3b161ULL },
+  { 3744, 0x801e5b311ULL },
+  { 3745, 0x851e5b361ULL },
+  { 3753, 0x971e1b081ULL },
+  { 3754, 0x961e6b571ULL },
+  { 3762, 0x771e3b081ULL },
+  { 3763, 0x371e3b671ULL },
+  { 3771, 0x871e5b381ULL },
+  { 3772, 0x761e6b371ULL },
+  { 3888, 0x81e4c9c5ULL },
+  { 3889, 0x61e8c4c5ULL },
+  { 3890, 0x151e4d406ULL },
+  { 3891, 0x481e49a09ULL },
+  { 3892, 0x141e69a54ULL },
+  { 3893, 0x411e94a56ULL },
+  { 3894, 0x51e941a1ULL },
+  { 3895, 0x561e161a4ULL },
+  { 3896, 0x51e441a6ULL },
+  { 3897, 0x831e3d414ULL },
+  { 3898, 0x631e3d804ULL },
+  { 3899, 0x951e4d636ULL },
+  { 3900, 0x331e48a94ULL },
+  { 3901, 0x901e66a34ULL },
+  { 3902, 0x801e54a36ULL },
+  { 3903, 0x41e931a1ULL },
+  { 3904, 0x941e641a3ULL },
+  { 3905, 0x41e431a6ULL },
+  { 3906, 0x151e3d354ULL },
+  { 3907, 0x161e3d384ULL },
+  { 3908, 0x441e8c3c6ULL },
+  { 3909, 0x141e8a331ULL },
+  { 3910, 0x641e3a341ULL },
+  { 3915, 0x941e5d547ULL },
+  { 3916, 0x491e4d677ULL },
+  { 3917, 0x71e4d086ULL },
+  { 3918, 0x141e48a75ULL },
+  { 3919, 0x141e66a57ULL },
+  { 3920, 0x801e74a16ULL },
+  { 3921, 0x741e041a7ULL },
+  { 3922, 0x461e751a7ULL },
+  { 3923, 0x71e461a6ULL },
+  { 3924, 0x741e5d537ULL },
+  { 3925, 0x641e5d037ULL },
+  { 3926, 0x431e5d076ULL },
+  { 3927, 0x731e38a45ULL },
+  { 3928, 0x831e46a47ULL },
+  { 3929, 0x11e74a36ULL },
+  { 3930, 0x41e731a3ULL },
+  { 3931, 0x371e961a4ULL },
+  { 3932, 0x341e731a6ULL },
+  { 3933, 0x741e7c3c7ULL },
+  { 3936, 0x41e7a331ULL },
+  { 3937, 0x761e4a361ULL },
+  { 3942, 0x471e471c1ULL },
+  { 3945, 0x151e77a47ULL },
+  { 3946, 0x561e47a19ULL },
+  { 3947, 0x541e97a66ULL },
+  { 3948, 0x571e471a1ULL },
+  { 3949, 0x81e671a4ULL },
+  { 3950, 0x81e471a6ULL },
+  { 3954, 0x411e97a53ULL },
+  { 3955, 0x461e37a19ULL },
+  { 3956, 0x531e47a16ULL },
+  { 3957, 0x771e471a3ULL },
+  { 3969, 0x941e1b051ULL },
+  { 3970, 0x841e6b451ULL },
+  { 3978, 0x931e1b041ULL },
+  { 3979, 0x641e3b941ULL },
+  { 3987, 0x931e4b341ULL },
+  { 3988, 0x951e4b361ULL },
+  { 3996, 0x771e4b181ULL },
+  { 3997, 0x861e6b471ULL },
+  { 4005, 0x731e4b141ULL },
+  { 4006, 0x931e7b641ULL },
+  { 4014, 0x971e4b381ULL },
+  { 4015, 0x731e6b341ULL },
+  { 4374, 0x9e9c85d85ULL },
+  { 4375, 0x6e6c85d85ULL },
+  { 4376, 0x8e8c56d56ULL },
+  { 4377, 0x9e8a85d85ULL },
+  { 4378, 0x9e8a65d65ULL },
+  { 4379, 0x6e5a06d06ULL },
+  { 4380, 0x9e85d85a8ULL },
+  { 4381, 0x9e65d65a8ULL },
+  { 4383, 0x9e3c5d5c3ULL },
+  { 4384, 0x9e8d5d063ULL },
+  { 4385, 0x6e3d3d9c6ULL },
+  { 4386, 0x9e5a3a8d8ULL },
+  { 4387, 0x9e8a63d63ULL },
+  { 4388, 0x9e5a3a6d6ULL },
+  { 4389, 0x8e5c9d9a3ULL },
+  { 4390, 0x8e3c6d6a5ULL },
+  { 4391, 0x8e03d06a6ULL },
+  { 4392, 0x9e5d5c3c3ULL },
+  { 4393, 0x9e6d6c3c3ULL },
+  { 4394, 0x6e3d9c3d6ULL },
+  { 4395, 0x8e5a3d3c3ULL },
+  { 4396, 0x6e3a3d3c3ULL },
+  { 4397, 0x5e3d9a3d6ULL },
+  { 4398, 0x9e5a3d3a3ULL },
+  { 4399, 0x9e6c3d3a3ULL },
+  { 4400, 0x9e3d3c3a6ULL },
+  { 4401, 0x7e7c85d85ULL },
+  { 4402, 0x7e9d9d765ULL },
+  { 4403, 0x5e5c76d76ULL },
+  { 4404, 0x9e8a75d75ULL },
+  { 4405, 0x7e6a85d85ULL },
+  { 4406, 0x6e5a76d76ULL },
+  { 4407, 0x9e57d57a8ULL },
+  { 4408, 0x9e67d67a8ULL },
+  { 4409, 0x7e65d65a6ULL },
+  { 4410, 0x9e3c7d7c3ULL },
+  { 4411, 0x8e6d7d633ULL },
+  { 4412, 0x7e7c36d36ULL },
+  { 4413, 0x7e5a93d87ULL },
+  { 4414, 0x9e7a83d67ULL },
+  { 4415, 0x7e5a03d06ULL },
+  { 4416, 0x5e93d87a3ULL },
+  { 4417, 0x5e83d67a3ULL },
+  { 4418, 0x8e83d67a6ULL },
+  { 4419, 0x9e7d7c3c3ULL },
+  { 4420, 0x7e63d63c7ULL },
+  { 4422, 0x7e3a3a3d3ULL },
+  { 4423, 0x7e6a3d3d9ULL },
+  { 4424, 0x3e7d7a3d6ULL },
+  { 4425, 0x9e7d7a3a5ULL },
+  { 4426, 0x7e6d6a3a3ULL },
+  { 4427, 0x7e03d03a6ULL },
+  { 4428, 0x5e78d78c5ULL },
+  { 4429, 0x5e5c67d67ULL },
+  { 4430, 0x6e75d75c6ULL },
+  { 4431, 0x8e7a07d07ULL },
+  { 4432, 0x8e7a67d67ULL },
+  { 4434, 0x8e75d75a7ULL },
+  { 4435, 0x8e76d76a7ULL },
+  { 4436, 0x7e75d75a6ULL },
+  { 4437, 0x3e75d75c3ULL },
+  { 4438, 0x3e76d76c3ULL },
+  { 4440, 0x8e7a37d37ULL },
+  { 4441, 0x6e5a37d37ULL },
+  { 4446, 0x3e73d73c3ULL },
+  { 4448, 0x6e73d73c6ULL },
+  { 4452, 0x8e73d73a7ULL },
+  { 4453, 0x6e73d73a5ULL },
+  { 4454, 0x7e73d73a6ULL },
+  { 4455, 0x5e598b009ULL },
+  { 4456, 0x6e958b568ULL },
+  { 4457, 0x5e586b096ULL },
+  { 4458, 0x8e5a59b89ULL },
+  { 4459, 0x6e6a59b59ULL },
+  { 4460, 0x9e8a56b66ULL },
+  { 4461, 0x9e9b8a5a5ULL },
+  { 4462, 0x6e5b5b8a8ULL },
+  { 4463, 0x8e8b5a5a6ULL },
+  { 4464, 0x5e583b093ULL },
+  { 4465, 0x6e6b38b59ULL },
+  { 4466, 0x3e356b656ULL },
+  { 4467, 0x5e3a3a9b8ULL },
+  { 4468, 0x6e5a6a8b3ULL },
+  { 4469, 0x3e3d6a5b6ULL },
+  { 4470, 0x8e3b3b5a9ULL },
+  { 4471, 0x8e3a6b6a5ULL },
+  { 4472, 0x6e5b3b8a6ULL },
+  { 4473, 0x8e598b309ULL },
+  { 4474, 0x8e6d6b3c3ULL },
+  { 4475, 0x9e3b6c3d6ULL },
+  { 4476, 0x3e5b3a3b8ULL },
+  { 4477, 0x6e6a5b3b8ULL },
+  { 4478, 0x6e9a5b3d6ULL },
+  { 4479, 0x9e5b8a3a3ULL },
+  { 4480, 0x6e8b6a3a5ULL },
+  { 4481, 0x6e8b5a3a6ULL },
+  { 4482, 0x7e897b508ULL },
+  { 4483, 0x9e687b597ULL },
+  { 4484, 0x9e776b686ULL },
+  { 4485, 0x7e7a59b59ULL },
+  { 4486, 0x6e79a89b7ULL },
+  { 4487, 0x5e7a96b76ULL },
+  { 4488, 0x8e7b5a5a5ULL },
+  { 4489, 0x5e6b5b9a7ULL },
+  { 4490, 0x9e7b5a5a6ULL },
+  { 4491, 0x5e397b897ULL },
+  { 4492, 0x5e367b867ULL },
+  { 4493, 0x7e386b096ULL },
+  { 4494, 0x7e5a7a8b3ULL },
+  { 4495, 0x9e7a6a7b3ULL },
+  { 4496, 0x7e3a56b96ULL },
+  { 4497, 0x7e3a8b5a7ULL },
+  { 4498, 0x6e3b5b7a7ULL },
+  { 4499, 0x7e3b3b7a6ULL },
+  { 4500, 0x8e597b308ULL },
+  { 4501, 0x7e687b397ULL },
+  { 4502, 0x7e676b386ULL },
+  { 4503, 0x7e7b8a3b9ULL },
+  { 4504, 0x6e5b7a3b7ULL },
+  { 4505, 0x3e7b7a3b6ULL },
+  { 4506, 0x7e7b8a3a3ULL },
+  { 4507, 0x7e9b6a3a7ULL },
+  { 4508, 0x7e7b5a3a6ULL },
+  { 4509, 0x8e7b57b09ULL },
+  { 4510, 0x6e6b57b78ULL },
+  { 4511, 0x5e75d75b6ULL },
+  { 4512, 0x8e7a87b97ULL },
+  { 4513, 0x8e5a67b97ULL },
+  { 4514, 0x9e07a76b6ULL },
+  { 4518, 0x9e3b37b58ULL },
+  { 4519, 0x7e6b37b68ULL },
+  { 4521, 0x9e3a77b38ULL },
+  { 4522, 0x6e3a37b67ULL },
+  { 4523, 0x3e9a37b76ULL },
+  { 4527, 0x7e73d73b8ULL },
+  { 4528, 0x6e73d73b7ULL },
+  { 4529, 0x5e73d73b6ULL },
+  { 4530, 0x5e93a73b3ULL },
+  { 4531, 0x6e53a73b8ULL },
+  { 4532, 0x6e73a73b6ULL },
+  { 4536, 0x8e58b5b89ULL },
+  { 4537, 0x8e66b6b08ULL },
+  { 4538, 0x8e55b6b96ULL },
+  { 4539, 0x8e95b9a85ULL },
+  { 4540, 0x5e69b6a59ULL },
+  { 4541, 0x8e66b9a56ULL },
+  { 4542, 0x9e58b98a5ULL },
+  { 4543, 0x8e06b95a9ULL },
+  { 4544, 0x9e56b86a6ULL },
+  { 4545, 0x9e38b3b59ULL },
+  { 4546, 0x6e93b8b35ULL },
+  { 4547, 0x3e06b3b66ULL },
+  { 4548, 0x3e09b8a58ULL },
+  { 4549, 0x6e35b6a35ULL },
+  { 4550, 0x6e36b6a36ULL },
+  { 4551, 0x8e58b09a3ULL },
+  { 4552, 0x3e36b85a8ULL },
+  { 4553, 0x9e35b65a6ULL },
+  { 4554, 0x5e58b03c3ULL },
+  { 4555, 0x9e69b53c3ULL },
+  { 4560, 0x8e03b53a3ULL },
+  { 4561, 0x6e63b93a3ULL },
+  { 4562, 0x9e33b63a6ULL },
+  { 4563, 0x7e57b8b09ULL },
+  { 4564, 0x6e56b8b97ULL },
+  { 4565, 0x7e55b6b86ULL },
+  { 4566, 0x7e78b9a58ULL },
+  { 4567, 0x6e87b9a57ULL },
+  { 4568, 0x7e76b8a66ULL },
+  { 4569, 0x8e78b09a5ULL },
+  { 4570, 0x7e76b96a5ULL },
+  { 4571, 0x9e77b08a6ULL },
+  { 4572, 0x9e37b3b58ULL },
+  { 4573, 0x8e36b6b77ULL },
+  { 4574, 0x8e65b3b76ULL },
+  { 4575, 0x9e77b3a38ULL },
+  { 4576, 0x6e67b9a37ULL },
+  { 4577, 0x7e56b9a36ULL },
+  { 4578, 0x5e38b97a9ULL },
+  { 4579, 0x7e56b96a3ULL },
+  { 4580, 0x6e37b37a6ULL },
+  { 4581, 0x7e38b03c3ULL },
+  { 4587, 0x7e53b93a3ULL },
+  { 4588, 0x7e73b63a8ULL },
+  { 4589, 0x7e73b83a6ULL },
+  { 4590, 0x5e57b7b78ULL },
+  { 4591, 0x6e58b7b89ULL },
+  { 4592, 0x5e55b7b76ULL },
+  { 4593, 0x9e58b7a78ULL },
+  { 4594, 0x6e08b7a97ULL },
+  { 4595, 0x9e85b7a06ULL },
+  { 4596, 0x9e58b78a7ULL },
+  { 4597, 0x9e56b76a7ULL },
+  { 4598, 0x7e65b75a6ULL },
+  { 4599, 0x9e75b7b37ULL },
+  { 4600, 0x6e38b7b69ULL },
+  { 4601, 0x6e35b7b66ULL },
+  { 4602, 0x3e38b7a97ULL },
+  { 4603, 0x7e63b7a63ULL },
+  { 4604, 0x7e36b7a36ULL },
+  { 4605, 0x3e38b77a9ULL },
+  { 4606, 0x7e36b76a3ULL },
+  { 4607, 0x3e07b76a6ULL },
+  { 4614, 0x9e33b73a5ULL },
+  { 4615, 0x8e63b73a7ULL },
+  { 4616, 0x8e53b73a6ULL },
+  { 4617, 0x8e4c54d09ULL },
+  { 4618, 0x9e6d9d684ULL },
+  { 4619, 0x9e8d9d846ULL },
+  { 4620, 0x9e8a54d54ULL },
+  { 4621, 0x6e4a84d69ULL },
+  { 4622, 0x9e8a46d46ULL },
+  { 4623, 0x8e5d5c4a4ULL },
+  { 4624, 0x9e46d46a8ULL },
+  { 4626, 0x4e3d3d9c4ULL },
+  { 4627, 0x8e4c34d68ULL },
+  { 4628, 0x4e4c36d36ULL },
+  { 4629, 0x9e4a3a4d8ULL },
+  { 4630, 0x6e5a34d34ULL },
+  { 4631, 0x5e3a43d86ULL },
+  { 4632, 0x9e3a4d8a4ULL },
+  { 4633, 0x5e43d86a3ULL },
+  { 4634, 0x9e3c4d4a6ULL },
+  { 4635, 0x9e4d4c3c3ULL },
+  { 4636, 0x4e63d63c4ULL },
+  { 4637, 0x6e43d43c6ULL },
+  { 4638, 0x8e4a3a3d3ULL },
+  { 4639, 0x4e6d6a3d9ULL },
+  { 4640, 0x9e4a3a3d6ULL },
+  { 4641, 0x9e4d8c3a3ULL },
+  { 4642, 0x4e63d63a3ULL },
+  { 4643, 0x9e4d4c3a6ULL },
+  { 4644, 0x8e4c74d49ULL },
+  { 4645, 0x7e7c64d64ULL },
+  { 4646, 0x7e7c46d46ULL },
+  { 4647, 0x7e5a74d49ULL },
+  { 4648, 0x7e5a84d69ULL },
+  { 4649, 0x7e6a46d46ULL },
+  { 4650, 0x9e5c7d7a4ULL },
+  { 4651, 0x5e67d67a4ULL },
+  { 4652, 0x7e45d45a6ULL },
+  { 4653, 0x7e7c43d43ULL },
+  { 4654, 0x6e73d47c3ULL },
+  { 4656, 0x5e3a74d49ULL },
+  { 4657, 0x6e4a93d87ULL },
+  { 4658, 0x7e5a43d86ULL },
+  { 4659, 0x8e4a7d7a3ULL },
+  { 4660, 0x7e43d86a5ULL },
+  { 4661, 0x8e73d47a6ULL },
+  { 4662, 0x7e7d7d343ULL },
+  { 4665, 0x7e4a3d3c3ULL },
+  { 4668, 0x8e43d43a7ULL },
+  { 4669, 0x7e6d6c3a4ULL },
+  { 4670, 0x7e43d43a6ULL },
+  { 4671, 0x4e75d75c4ULL },
+  { 4672, 0x4e76d76c4ULL },
+  { 4674, 0x8e7a47d47ULL },
+  { 4675, 0x6e5a47d47ULL },
+  { 4677, 0x5e75d75a4ULL },
+  { 4678, 0x5e76d76a4ULL },
+  { 4680, 0x4e4c37d37ULL },
+  { 4683, 0x5e4a37d37ULL },
+  { 4684, 0x4e3a67d67ULL },
+  { 4686, 0x4e75d75a3ULL },
+  { 4687, 0x4e76d76a3ULL },
+  { 4689, 0x4e73d73c4ULL },
+  { 4695, 0x4e73d73a3ULL },
+  { 4698, 0x5e994b405ULL },
+  { 4699, 0x8e694b405ULL },
+  { 4700, 0x6e486b096ULL },
+  { 4701, 0x4e4a58b58ULL },
+  { 4702, 0x6e6a5a9b4ULL },
+  { 4703, 0x4e4b8a6b6ULL },
+  { 4704, 0x8e4a5b5a4ULL },
+  { 4705, 0x6e4a9b6a5ULL },
+  { 4706, 0x6e4b4b8a6ULL },
+  { 4707, 0x5e394b894ULL },
+  { 4708, 0x3e6b93b84ULL },
+  { 4709, 0x6e4b35b36ULL },
+  { 4710, 0x8e3a34b84ULL },
+  { 4711, 0x6e4a4a5b3ULL },
+  { 4712, 0x4e3a46b56ULL },
+  { 4713, 0x8e3b3a4a4ULL },
+  { 4714, 0x6e3a5b4a4ULL },
+  { 4715, 0x4e4b3b5a6ULL },
+  { 4716, 0x4e5b3b3c4ULL },
+  { 4717, 0x4e3d6b3b9ULL },
+  { 4718, 0x8e4b6b3c6ULL },
+  { 4719, 0x4e4a5b3b8ULL },
+  { 4720, 0x4e6a3b3b4ULL },
+  { 4721, 0x4e4b5a3b6ULL },
+  { 4722, 0x8e4a3b3a4ULL },
+  { 4723, 0x5e6b4a3a4ULL },
+  { 4724, 0x8e4d4b3a6ULL },
+  { 4725, 0x9e587b497ULL },
+  { 4726, 0x6e857b467ULL },
+  { 4727, 0x4e7b75b86ULL },
+  { 4728, 0x7e5a7a9b4ULL },
+  { 4729, 0x6e7a94b84ULL },
+  { 4730, 0x4e7a76b46ULL },
+  { 4731, 0x9e5a7b4a7ULL },
+  { 4732, 0x9e4a6b7a4ULL },
+  { 4733, 0x9e8b7a4a6ULL },
+  { 4734, 0x7e893b504ULL },
+  { 4735, 0x3e754b064ULL },
+  { 4736, 0x3e736b046ULL },
+  { 4737, 0x7e35a94b3ULL },
+  { 4738, 0x6e4a73b93ULL },
+  { 4739, 0x7e3a46b86ULL },
+  { 4740, 0x7e3b4b9a5ULL },
+  { 4741, 0x6e7b3a6a4ULL },
+  { 4742, 0x6e4b3b7a6ULL },
+  { 4743, 0x9e437b347ULL },
+  { 4744, 0x6e43d43b7ULL },
+  { 4745, 0x9e466b376ULL },
+  { 4746, 0x3e4a5b3b7ULL },
+  { 4747, 0x6e43a53b7ULL },
+  { 4748, 0x4e7b8a3b6ULL },
+  { 4749, 0x7e5a4b3a3ULL },
+  { 4750, 0x7e6b6a3a4ULL },
+  { 4751, 0x7e6b4a3a6ULL },
+  { 4752, 0x9e4b47b78ULL },
+  { 4753, 0x8e4b47b68ULL },
+  { 4755, 0x9e4a57b08ULL },
+  { 4756, 0x6e4a47b67ULL },
+  { 4757, 0x4e8a07b66ULL },
+  { 4761, 0x4e5b47b38ULL },
+  { 4762, 0x6e4b37b38ULL },
+  { 4764, 0x9e3a47b08ULL },
+  { 4765, 0x5e6a47b37ULL },
+  { 4766, 0x4e9a37b86ULL },
+  { 4770, 0x3e73d73b4ULL },
+  { 4773, 0x5e83a73b4ULL },
+  { 4774, 0x3e63a73b4ULL },
+  { 4775, 0x3e43a73b6ULL },
+  { 4779, 0x5e58b4b49ULL },
+  { 4780, 0x8e48b4b69ULL },
+  { 4781, 0x8e45b4b66ULL },
+  { 4782, 0x4e09b9a58ULL },
+  { 4783, 0x4e05b8a64ULL },
+  { 4784, 0x9e95b4a46ULL },
+  { 4785, 0x4e09b98a5ULL },
+  { 4786, 0x9e46b56a8ULL },
+  { 4787, 0x4e06b85a6ULL },
+  { 4788, 0x4e33b8b54ULL },
+  { 4789, 0x6e48b3b39ULL },
+  { 4790, 0x6e45b3b36ULL },
+  { 4791, 0x3e48b3a48ULL },
+  { 4792, 0x6e43b5a53ULL },
+  { 4793, 0x4e46b5a36ULL },
+  { 4794, 0x3e49b39a4ULL },
+  { 4795, 0x9e85b46a3ULL },
+  { 4796, 0x5e45b35a6ULL },
+  { 4797, 0x5e49b33c3ULL },
+  { 4798, 0x6e48b03c3ULL },
+  { 4803, 0x9e43b83a5ULL },
+  { 4804, 0x6e43b63a4ULL },
+  { 4805, 0x6e43b43a6ULL },
+  { 4806, 0x9e47b4b78ULL },
+  { 4807, 0x9e46b4b77ULL },
+  { 4808, 0x7e55b4b66ULL },
+  { 4809, 0x9e57b4a08ULL },
+  { 4810, 0x4e67b5a57ULL },
+  { 4811, 0x7e46b6a56ULL },
+  { 4812, 0x9e57b08a4ULL },
+  { 4813, 0x7e75b06a4ULL },
+  { 4814, 0x4e07b86a6ULL },
+  { 4815, 0x8e53b4b74ULL },
+  { 4816, 0x7e63b3b64ULL },
+  { 4817, 0x7e45b3b46ULL },
+  { 4818, 0x9e87b4a38ULL },
+  { 4819, 0x7e43b6a53ULL },
+  { 4820, 0x7e46b3a86ULL },
+  { 4821, 0x9e47b08a3ULL },
+  { 4822, 0x9e86b37a4ULL },
+  { 4823, 0x7e35b45a6ULL },
+  { 4824, 0x7e59b43c3ULL },
+  { 4830, 0x7e43b83a3ULL },
+  { 4831, 0x7e43b63a5ULL },
+  { 4832, 0x7e33b43a6ULL },
+  { 4833, 0x8e48b7b99ULL },
+  { 4834, 0x6e47b7b78ULL },
+  { 4835, 0x7e45b7b86ULL },
+  { 4836, 0x4e09b7a78ULL },
+  { 4837, 0x4e06b7a75ULL },
+  { 4838, 0x7e46b7a46ULL },
+  { 4839, 0x4e09b78a7ULL },
+  { 4840, 0x4e06b75a7ULL },
+  { 4841, 0x9e45b75a6ULL },
+  { 4842, 0x4e37b7b48ULL },
+  { 4843, 0x5e43b7b64ULL },
+  { 4844, 0x4e35b7b46ULL },
+  { 4845, 0x8e43b7a53ULL },
+  { 4846, 0x9e43b7a63ULL },
+  { 4847, 0x4e36b7a06ULL },
+  { 4848, 0x3e35b74a9ULL },
+  { 4849, 0x6e45b75a3ULL },
+  { 4850, 0x3e05b74a6ULL },
+  { 4857, 0x8e43b73a5ULL },
+  { 4858, 0x6e43b73a3ULL },
+  { 4859, 0x9e43b73a6ULL },
+  { 4860, 0x8e54d09c4ULL },
+  { 4861, 0x8e84d69c4ULL },
+  { 4862, 0x6e04d04c6ULL },
+  { 4866, 0x5e04d04a4ULL },
+  { 4867, 0x6e54d09a4ULL },
+  { 4868, 0x8e44d88a6ULL },
+  { 4869, 0x4e34d34c4ULL },
+  { 4870, 0x8e34d68c4ULL },
+  { 4871, 0x6e34d34c6ULL },
+  { 4875, 0x5e04d08a3ULL },
+  { 4876, 0x5e34d68a3ULL },
+  { 4877, 0x8e34d68a6ULL },
+  { 4887, 0x8e74d49c4ULL },
+  { 4888, 0x7e64d64c7ULL },
+  { 4893, 0x7e44d88a5ULL },
+  { 4894, 0x7e84d69a5ULL },
+  { 4895, 0x8e74d49a6ULL },
+  { 4896, 0x7e34d34c7ULL },
+  { 4897, 0x6e74d49c3ULL },
+  { 4902, 0x5e74d49a3ULL },
+  { 4903, 0x7e34d68a5ULL },
+  { 4904, 0x7e34d34a6ULL },
+  { 4914, 0x4e74d74c4ULL },
+  { 4916, 0x6e74d74c6ULL },
+  { 4920, 0x8e74d74a7ULL },
+  { 4921, 0x6e74d74a5ULL },
+  { 4922, 0x7e74d74a6ULL },
+  { 4923, 0x3e74d74c3ULL },
+  { 4929, 0x4e74d74a3ULL },
+  { 4941, 0x5e448b948ULL },
+  { 4942, 0x8e649b459ULL },
+  { 4943, 0x4e546b946ULL },
+  { 4944, 0x9e84a44b5ULL },
+  { 4945, 0x6e54a44b5ULL },
+  { 4946, 0x9e84a54b6ULL },
+  { 4950, 0x5e443b943ULL },
+  { 4951, 0x6e843b453ULL },
+  { 4952, 0x3e346b646ULL },
+  { 4953, 0x4e94a35b8ULL },
+  { 4954, 0x6e94a64b3ULL },
+  { 4955, 0x3e04a34b6ULL },
+  { 4959, 0x9e443b353ULL },
+  { 4961, 0x9e446b356ULL },
+  { 4962, 0x9e04a43b3ULL },
+  { 4963, 0x8e04a63b4ULL },
+  { 4964, 0x8e04a83b6ULL },
+  { 4968, 0x5e947b457ULL },
+  { 4969, 0x8e647b457ULL },
+  { 4970, 0x9e846b756ULL },
+  { 4971, 0x8e94a84b7ULL },
+  { 4972, 0x6e44a54b7ULL },
+  { 4973, 0x7e64a54b6ULL },
+  { 4977, 0x5e347b847ULL },
+  { 4978, 0x9e743b653ULL },
+  { 4979, 0x4e346b746ULL },
+  { 4980, 0x3e94a35b7ULL },
+  { 4981, 0x6e74a44b3ULL },
+  { 4982, 0x7e44a34b6ULL },
+  { 4986, 0x9e447b357ULL },
+  { 4987, 0x7e643b353ULL },
+  { 4988, 0x7e646b356ULL },
+  { 4989, 0x7e34a93b3ULL },
+  { 4990, 0x7e04a63b3ULL },
+  { 4991, 0x7e04a93b6ULL },
+  { 4995, 0x7e74d74b8ULL },
+  { 4996, 0x6e74d74b7ULL },
+  { 4997, 0x5e74d74b6ULL },
+  { 4998, 0x5e84a74b4ULL },
+  { 4999, 0x7e64a74b8ULL },
+  { 5000, 0x5e64a74b6ULL },
+  { 5004, 0x3e74d74b4ULL },
+  { 5007, 0x3e74a74b3ULL },
+  { 5008, 0x3e64a74b4ULL },
+  { 5009, 0x3e44a74b6ULL },
+  { 5016, 0x7e04a73b4ULL },
+  { 5017, 0x6e04a73b3ULL },
+  { 5018, 0x9e04a73b6ULL },
+  { 5022, 0x9e54b4b85ULL },
+  { 5023, 0x8e44b4b65ULL },
+  { 5024, 0x9e94b6b46ULL },
+  { 5025, 0x8e54b9a44ULL },
+  { 5026, 0x6e64b8a44ULL },
+  { 5028, 0x9e44b84a5ULL },
+  { 5029, 0x6e44b54a5ULL },
+  { 5030, 0x9e54b84a6ULL },
+  { 5031, 0x4e84b3b55ULL },
+  { 5032, 0x3e04b3b64ULL },
+  { 5033, 0x9e84b3b06ULL },
+  { 5034, 0x8e34b3a84ULL },
+  { 5035, 0x9e34b6a64ULL },
+  { 5037, 0x8e94b45a3ULL },
+  { 5038, 0x6e64b94a3ULL },
+  { 5039, 0x3e34b04a6ULL },
+  { 5046, 0x3e04b93a4ULL },
+  { 5047, 0x4e04b63a8ULL },
+  { 5048, 0x4e04b83a6ULL },
+  { 5049, 0x8e74b4b95ULL },
+  { 5050, 0x7e44b5b65ULL },
+  { 5051, 0x9e74b8b46ULL },
+  { 5052, 0x9e74b8a84ULL },
+  { 5053, 0x7e74b6a84ULL },
+  { 5055, 0x9e74b84a8ULL },
+  { 5056, 0x6e64b54a7ULL },
+  { 5057, 0x7e44b54a6ULL },
+  { 5058, 0x5e74b3b55ULL },
+  { 5059, 0x7e64b3b65ULL },
+  { 5060, 0x8e74b8b36ULL },
+  { 5061, 0x9e74b3a35ULL },
+  { 5062, 0x3e04b6a73ULL },
+  { 5064, 0x9e74b35a3ULL },
+  { 5065, 0x7e64b05a3ULL },
+  { 5066, 0x7e34b44a6ULL },
+  { 5073, 0x5e04b83a7ULL },
+  { 5074, 0x3e04b63a7ULL },
+  { 5076, 0x7e44b7b85ULL },
+  { 5077, 0x5e44b7b65ULL },
+  { 5078, 0x9e84b7b46ULL },
+  { 5079, 0x9e84b7a05ULL },
+  { 5080, 0x6e64b7a54ULL },
+  { 5082, 0x8e44b74a5ULL },
+  { 5083, 0x8e64b74a7ULL },
+  { 5084, 0x9e44b74a6ULL },
+  { 5085, 0x4e34b7b45ULL },
+  { 5086, 0x6e04b7b35ULL },
+  { 5087, 0x9e74b7b36ULL },
+  { 5088, 0x3e34b7a93ULL },
+  { 5089, 0x6e04b7a93ULL },
+  { 5091, 0x7e34b74a3ULL },
+  { 5092, 0x6e44b74a3ULL },
+  { 5100, 0x4e04b73a7ULL },
+  { 5101, 0x6e04b73a9ULL },
+  { 5102, 0x3e04b73a6ULL },
+  { 5103, 0x1e5d81d09ULL },
+  { 5104, 0x6e6d5d081ULL },
+  { 5105, 0x6e511d096ULL },
+  { 5106, 0x9e8a5d5c1ULL },
+  { 5107, 0x9e8a6d6c1ULL },
+  { 5108, 0x6e5a6d1d6ULL },
+  { 5109, 0x9e8c5d5a1ULL },
+  { 5110, 0x9e8c6d6a1ULL },
+  { 5111, 0x8e5d5a1a6ULL },
+  { 5112, 0x3e9d5d531ULL },
+  { 5113, 0x6e631d618ULL },
+  { 5114, 0x6e301d816ULL },
+  { 5115, 0x8e3c1a1c5ULL },
+  { 5116, 0x6e3d9a1c3ULL },
+  { 5117, 0x9e3c1a1c6ULL },
+  { 5118, 0x9e3a5c1a1ULL },
+  { 5119, 0x5e6d6a1a3ULL },
+  { 5120, 0x8e3d3a1a6ULL },
+  { 5121, 0x3e31d93c1ULL },
+  { 5122, 0x6e91d83c3ULL },
+  { 5123, 0x1e306d306ULL },
+  { 5124, 0x8e5c1a3c1ULL },
+  { 5125, 0x6e3c1a3c1ULL },
+  { 5126, 0x5e3c1a3d6ULL },
+  { 5127, 0x9e8c3d3a1ULL },
+  { 5128, 0x6e3d6a3a1ULL },
+  { 5129, 0x9e01d03a6ULL },
+  { 5130, 0x5e851d097ULL },
+  { 5131, 0x7e801d657ULL },
+  { 5132, 0x1e676d676ULL },
+  { 5133, 0x9e8a7d7c1ULL },
+  { 5134, 0x6e5c1a7d7ULL },
+  { 5135, 0x8e7c1a6d6ULL },
+  { 5136, 0x9e8c7d7a1ULL },
+  { 5137, 0x6e7d7c1a5ULL },
+  { 5138, 0x8e7d7a1a6ULL },
+  { 5139, 0x3e713d159ULL },
+  { 5140, 0x3e7d8d861ULL },
+  { 5141, 0x1e736d736ULL },
+  { 5142, 0x8e7a3d1d3ULL },
+  { 5143, 0x7e3d3a6c1ULL },
+  { 5144, 0x7e5a3d1d6ULL },
+  { 5145, 0x9e3d3a7a1ULL },
+  { 5146, 0x7e3d1d6a5ULL },
+  { 5147, 0x7e31d31a6ULL },
+  { 5148, 0x7e911d338ULL },
+  { 5149, 0x7e901d367ULL },
+  { 5150, 0x1e376d376ULL },
+  { 5151, 0x7e3a1a3c1ULL },
+  { 5152, 0x7e6a3d3c1ULL },
+  { 5153, 0x7e5c1a3d6ULL },
+  { 5154, 0x7e5a3d3a1ULL },
+  { 5155, 0x7e3d6c3a1ULL },
+  { 5156, 0x7e3d1d3a6ULL },
+  { 5157, 0x1e75d75c1ULL },
+  { 5158, 0x1e76d76c1ULL },
+  { 5159, 0x6e71d71c6ULL },
+  { 5160, 0x8e7a17d17ULL },
+  { 5161, 0x6e5a17d17ULL },
+  { 5163, 0x8e91d75a5ULL },
+  { 5164, 0x6e71d71a5ULL },
+  { 5165, 0x7e71d71a6ULL },
+  { 5166, 0x3e91d75c1ULL },
+  { 5173, 0x6e91d75a3ULL },
+  { 5175, 0x1e73d73c1ULL },
+  { 5184, 0x1e5c81b19ULL },
+  { 5185, 0x6e58c1b19ULL },
+  { 5186, 0x1e86c1b96ULL },
+  { 5187, 0x9e5c1a1b5ULL },
+  { 5188, 0x6e5a8c1b9ULL },
+  { 5189, 0x5e8a9c1b6ULL },
+  { 5190, 0x9e8c1b9a8ULL },
+  { 5191, 0x6e5b1a1a9ULL },
+  { 5192, 0x9e5c1b8a6ULL },
+  { 5193, 0x5e3c13b89ULL },
+  { 5194, 0x6e3c11b93ULL },
+  { 5195, 0x3e3b11d66ULL },
+  { 5196, 0x3e3d9a1b1ULL },
+  { 5197, 0x6e3a1b1b5ULL },
+  { 5198, 0x3e3a6c1b6ULL },
+  { 5199, 0x8e3a1b1a5ULL },
+  { 5200, 0x6e3a1b1a3ULL },
+  { 5201, 0x8e3b1c5a6ULL },
+  { 5202, 0x9e5b1b3c5ULL },
+  { 5203, 0x6e9c1b3c5ULL },
+  { 5204, 0x1e9b5c3d6ULL },
+  { 5205, 0x9e3a8a3b1ULL },
+  { 5206, 0x6e6a3b3c1ULL },
+  { 5207, 0x6e5a1b3d6ULL },
+  { 5208, 0x1e3d9b3a1ULL },
+  { 5209, 0x5e6c1b3a8ULL },
+  { 5210, 0x1e6b3d3a6ULL },
+  { 5211, 0x8e771b581ULL },
+  { 5212, 0x5e687b197ULL },
+  { 5213, 0x1e76c1b86ULL },
+  { 5214, 0x7e9a7c1b5ULL },
+  { 5215, 0x7e6a5b1b7ULL },
+  { 5216, 0x7e7c1a6b6ULL },
+  { 5217, 0x9e5c1b7a7ULL },
+  { 5218, 0x7e6b1a5a7ULL },
+  { 5219, 0x7e7c1b8a6ULL },
+  { 5220, 0x7e7c31b89ULL },
+  { 5221, 0x1e6c31b97ULL },
+  { 5222, 0x1e3b71d86ULL },
+  { 5223, 0x7e3a1c1b5ULL },
+  { 5224, 0x1e3b3a6b7ULL },
+  { 5225, 0x1e3b5a7b6ULL },
+  { 5226, 0x5e3c1b1a7ULL },
+  { 5227, 0x6e7b9a1a3ULL },
+  { 5228, 0x1e3b7b5a6ULL },
+  { 5229, 0x7e8b1d3c5ULL },
+  { 5230, 0x7e671b381ULL },
+  { 5231, 0x7e606b316ULL },
+  { 5232, 0x9e7c1a3b5ULL },
+  { 5233, 0x1e6b3a3b7ULL },
+  { 5234, 0x1e7b5a3b6ULL },
+  { 5235, 0x3e7c1b3a7ULL },
+  { 5236, 0x7e6b1a3a9ULL },
+  { 5237, 0x7e3b1a3a6ULL },
+  { 5238, 0x9e7b57b19ULL },
+  { 5239, 0x1e6b87b58ULL },
+  { 5240, 0x5e71d71b6ULL },
+  { 5241, 0x9e5a77b18ULL },
+  { 5242, 0x1e6a67b17ULL },
+  { 5243, 0x1e7a57b96ULL },
+  { 5247, 0x5e3b17b97ULL },
+  { 5248, 0x6e3b17b08ULL },
+  { 5249, 0x3e91d75b6ULL },
+  { 5250, 0x1e3a37b17ULL },
+  { 5251, 0x1e3a87b67ULL },
+  { 5252, 0x1e9a37b56ULL },
+  { 5259, 0x3e93a73b1ULL },
+  { 5265, 0x1e98b5c81ULL },
+  { 5266, 0x6e58b19c1ULL },
+  { 5267, 0x6e95b1c56ULL },
+  { 5268, 0x8e88b1a59ULL },
+  { 5269, 0x1e09b6a58ULL },
+  { 5270, 0x5e65b1a06ULL },
+  { 5271, 0x8e88b59a1ULL },
+  { 5272, 0x6e68b19a1ULL },
+  { 5273, 0x9e85b16a6ULL },
+  { 5274, 0x8e38b1c19ULL },
+  { 5275, 0x3e39b6c61ULL },
+  { 5276, 0x5e36b1d86ULL },
+  { 5277, 0x9e58b1a39ULL },
+  { 5278, 0x1e39b8a68ULL },
+  { 5279, 0x6e85b3a16ULL },
+  { 5280, 0x9e58b39a1ULL },
+  { 5281, 0x9e35b16a1ULL },
+  { 5282, 0x9e31b61a6ULL },
+  { 5283, 0x5e33b83c1ULL },
+  { 5284, 0x6e33b93c1ULL },
+  { 5289, 0x5e53b13a9ULL },
+  { 5290, 0x6e33b83a1ULL },
+  { 5291, 0x1e53b03a6ULL },
+  { 5292, 0x7e87b1c58ULL },
+  { 5293, 0x8e96b1c77ULL },
+  { 5294, 0x7e85b1c56ULL },
+  { 5295, 0x9e77b1a58ULL },
+  { 5296, 0x7e56b1a17ULL },
+  { 5297, 0x9e75b1a56ULL },
+  { 5298, 0x9e77b18a5ULL },
+  { 5299, 0x7e56b17a1ULL },
+  { 5300, 0x9e86b17a6ULL },
+  { 5301, 0x5e37b1c87ULL },
+  { 5302, 0x7e36b1c07ULL },
+  { 5303, 0x7e35b1c06ULL },
+  { 5304, 0x1e38b5a97ULL },
+  { 5305, 0x6e37b1a87ULL },
+  { 5306, 0x3e76b9a16ULL },
+  { 5307, 0x7e78b39a1ULL },
+  { 5308, 0x6e37b17a8ULL },
+  { 5309, 0x1e37b86a6ULL },
+  { 5310, 0x1e73b83c1ULL },
+  { 5311, 0x7e68b13c3ULL },
+  { 5316, 0x5e33b13a7ULL },
+  { 5317, 0x7e03b63a1ULL },
+  { 5318, 0x7e03b13a6ULL },
+  { 5319, 0x8e97b78c1ULL },
+  { 5320, 0x9e86b77c1ULL },
+  { 5321, 0x1e75b7b56ULL },
+  { 5322, 0x1e58b7a97ULL },
+  { 5323, 0x8e61b7a71ULL },
+  { 5324, 0x1e66b7a06ULL },
+  { 5325, 0x1e58b77a9ULL },
+  { 5326, 0x9e96b77a1ULL },
+  { 5327, 0x8e51b71a6ULL },
+  { 5328, 0x9e51b7b13ULL },
+  { 5329, 0x7e61b7b03ULL },
+  { 5330, 0x1e35b7b16ULL },
+  { 5331, 0x1e39b7a78ULL },
+  { 5332, 0x1e63b7a03ULL },
+  { 5333, 0x5e36b7a16ULL },
+  { 5334, 0x1e39b78a7ULL },
+  { 5335, 0x5e36b76a1ULL },
+  { 5337, 0x7e03b73c1ULL },
+  { 5338, 0x1e63b73c1ULL },
+  { 5343, 0x5e33b73a1ULL },
+  { 5346, 0x4e5d9d081ULL },
+  { 5347, 0x5e8d4d061ULL },
+  { 5348, 0x1e4d51d06ULL },
+  { 5349, 0x9e8c1a4d4ULL },
+  { 5350, 0x6e5a4d4c1ULL },
+  { 5351, 0x5e4a6d1d6ULL },
+  { 5352, 0x9e4d8c4a1ULL },
+  { 5353, 0x9e4d8a6a1ULL },
+  { 5354, 0x8e4d4a1a6ULL },
+  { 5355, 0x3e811d453ULL },
+  { 5356, 0x3e6d8d441ULL },
+  { 5357, 0x1e436d436ULL },
+  { 5358, 0x5e3a4d8c1ULL },
+  { 5359, 0x6e3d6a1c4ULL },
+  { 5360, 0x6e4a3d1d6ULL },
+  { 5361, 0x5e4d8c1a3ULL },
+  { 5362, 0x6e3d6c1a4ULL },
+  { 5364, 0x8e51d03c4ULL },
+  { 5365, 0x6e4d8c3c1ULL },
+  { 5366, 0x8e4c1c3d6ULL },
+  { 5367, 0x5e4d8a3c1ULL },
+  { 5368, 0x4e6d6a3c1ULL },
+  { 5369, 0x6e4c1a3d6ULL },
+  { 5370, 0x5e4c3d3a1ULL },
+  { 5371, 0x6e81d63a4ULL },
+  { 5373, 0x7e411d897ULL },
+  { 5374, 0x4e491d677ULL },
+  { 5375, 0x4e761d866ULL },
+  { 5376, 0x9e7a4d8c1ULL },
+  { 5377, 0x7e6a4d1d4ULL },
+  { 5378, 0x7e4d4a1c6ULL },
+  { 5379, 0x7e4d8a4a1ULL },
+  { 5380, 0x6e7d7a4a1ULL },
+  { 5381, 0x7e41d41a6ULL },
+  { 5382, 0x7e7d3d741ULL },
+  { 5383, 0x6e3c71d43ULL },
+  { 5384, 0x5e431d076ULL },
+  { 5385, 0x7e4c1a1c3ULL },
+  { 5386, 0x6e4a71d43ULL },
+  { 5387, 0x7e3a61d46ULL },
+  { 5388, 0x4e3c7d7a1ULL },
+  { 5389, 0x7e4a3d6a1ULL },
+  { 5391, 0x1e374d374ULL },
+  { 5392, 0x6e71d43c3ULL },
+  { 5394, 0x7e4c1a3c1ULL },
+  { 5396, 0x7e4a1a3d6ULL },
+  { 5397, 0x5e71d43a3ULL },
+  { 5398, 0x6e71d43a4ULL },
+  { 5399, 0x8e71d43a6ULL },
+  { 5400, 0x4e71d71c4ULL },
+  { 5403, 0x5e4a17d17ULL },
+  { 5406, 0x4e91d75a1ULL },
+  { 5412, 0x4e3a17d17ULL },
+  { 5415, 0x4e71d71a3ULL },
+  { 5427, 0x4e4c1b1d8ULL },
+  { 5428, 0x4e681b091ULL },
+  { 5429, 0x5e4c41b16ULL },
+  { 5430, 0x8e4c1a1b5ULL },
+  { 5431, 0x6e6a1b4b5ULL },
+  { 5432, 0x1e4c1a9b6ULL },
+  { 5433, 0x8e4a1b1a4ULL },
+  { 5434, 0x6e6a5b1a4ULL },
+  { 5435, 0x6e4c1b4a6ULL },
+  { 5436, 0x1e3b14b54ULL },
+  { 5437, 0x8e6b13b54ULL },
+  { 5438, 0x1e4b85b36ULL },
+  { 5439, 0x4e3a3c1b4ULL },
+  { 5440, 0x3e6a15b84ULL },
+  { 5441, 0x5e3c1a4b6ULL },
+  { 5442, 0x4e3c1b4a3ULL },
+  { 5443, 0x3e4c1b6a1ULL },
+  { 5444, 0x4e3c1b1a6ULL },
+  { 5445, 0x8e4b1d3c4ULL },
+  { 5446, 0x1e6d6c3b4ULL },
+  { 5447, 0x4e81d63b6ULL },
+  { 5448, 0x1e4b3a3b5ULL },
+  { 5449, 0x6e4a4a3b1ULL },
+  { 5450, 0x1e4a6b3b6ULL },
+  { 5451, 0x5e4a3b3a1ULL },
+  { 5452, 0x1e6c1b3a4ULL },
+  { 5453, 0x5e4c1b3a6ULL },
+  { 5454, 0x7e7d48b91ULL },
+  { 5455, 0x7e6b16b47ULL },
+  { 5456, 0x7e706b416ULL },
+  { 5457, 0x4e7a7c1b4ULL },
+  { 5458, 0x6e4a5c1b7ULL },
+  { 5459, 0x4e7a8b1b6ULL },
+  { 5460, 0x4e7c1b4a7ULL },
+  { 5461, 0x7e4b1a6a4ULL },
+  { 5462, 0x9e4c1b7a6ULL },
+  { 5463, 0x7e3c11b04ULL },
+  { 5464, 0x8e4b16b37ULL },
+  { 5465, 0x7e41c4b36ULL },
+  { 5466, 0x4e7a5b1b3ULL },
+  { 5467, 0x6e3a4c1b7ULL },
+  { 5468, 0x7e4a3c1b6ULL },
+  { 5469, 0x7e3a1b1a4ULL },
+  { 5470, 0x6e4c1b7a3ULL },
+  { 5471, 0x7e3c1b4a6ULL },
+  { 5472, 0x1e5c4b3c7ULL },
+  { 5473, 0x7e631b341ULL },
+  { 5474, 0x4e71d43b6ULL },
+  { 5475, 0x7e4b8a3c1ULL },
+  { 5476, 0x6e7a4b3c1ULL },
+  { 5477, 0x7e4c1a3b6ULL },
+  { 5478, 0x7e4b1a3a7ULL },
+  { 5479, 0x7e6b4c3a1ULL },
+  { 5481, 0x4e4b17b97ULL },
+  { 5482, 0x1e6d87b41ULL },
+  { 5484, 0x1e4a47b17ULL },
+  { 5485, 0x1e4a97b67ULL },
+  { 5486, 0x4e8a17b76ULL },
+  { 5490, 0x3e4b17b87ULL },
+  { 5493, 0x7e35a74b1ULL },
+  { 5494, 0x6e4a17b37ULL },
+  { 5495, 0x3e41a71b6ULL },
+  { 5502, 0x1e43a73b4ULL },
+  { 5508, 0x5e49b11c9ULL },
+  { 5509, 0x8e46b4c81ULL },
+  { 5510, 0x4e46b1d86ULL },
+  { 5511, 0x8e48b1a19ULL },
+  { 5512, 0x1e49b9a68ULL },
+  { 5513, 0x8e45b1a16ULL },
+  { 5514, 0x8e48b19a1ULL },
+  { 5515, 0x8e45b16a1ULL },
+  { 5516, 0x6e41b41a6ULL },
+  { 5517, 0x1e43b1c53ULL },
+  { 5518, 0x8e63b11c4ULL },
+  { 5519, 0x3e46b1b86ULL },
+  { 5520, 0x1e05b8a34ULL },
+  { 5521, 0x6e63b1a14ULL },
+  { 5522, 0x4e06b3a16ULL },
+  { 5523, 0x4e31b31a4ULL },
+  { 5524, 0x1e35b64a8ULL },
+  { 5525, 0x1e35b84a6ULL },
+  { 5526, 0x1e43b53c1ULL },
+  { 5532, 0x5e03b43a1ULL },
+  { 5533, 0x4e33b63a1ULL },
+  { 5534, 0x4e33b13a6ULL },
+  { 5535, 0x5e47b1c97ULL },
+  { 5536, 0x8e66b1c47ULL },
+  { 5537, 0x7e75b1c46ULL },
+  { 5538, 0x1e47b1a47ULL },
+  { 5539, 0x6e47b9a17ULL },
+  { 5540, 0x1e76b4a46ULL },
+  { 5541, 0x1e47b47a1ULL },
+  { 5542, 0x6e96b47a1ULL },
+  { 5543, 0x1e47b96a6ULL },
+  { 5544, 0x3e43b1c73ULL },
+  { 5545, 0x9e46b1c37ULL },
+  { 5546, 0x7e41b3d36ULL },
+  { 5547, 0x7e83b4a14ULL },
+  { 5548, 0x7e31b6a41ULL },
+  { 5550, 0x7e83b44a1ULL },
+  { 5551, 0x4e37b67a1ULL },
+  { 5552, 0x7e31b41a6ULL },
+  { 5559, 0x1e73b43a4ULL },
+  { 5562, 0x9e98b7c41ULL },
+  { 5563, 0x4e06b7b17ULL },
+  { 5564, 0x4e05b7b16ULL },
+  { 5565, 0x4e71b7a41ULL },
+  { 5566, 0x6e51b7a41ULL },
+  { 5567, 0x4e46b7a16ULL },
+  { 5568, 0x4e71b71a4ULL },
+  { 5569, 0x4e46b76a1ULL },
+  { 5570, 0x9e41b71a6ULL },
+  { 5571, 0x4e78b7c31ULL },
+  { 5572, 0x4e36b76c1ULL },
+  { 5574, 0x4e31b7a01ULL },
+  { 5575, 0x6e41b7a31ULL },
+  { 5577, 0x8e31b71a4ULL },
+  { 5578, 0x6e41b71a3ULL },
+  { 5580, 0x4e33b73c1ULL },
+  { 5586, 0x4e43b73a1ULL },
+  { 5589, 0x4e541d085ULL },
+  { 5590, 0x4e641d485ULL },
+  { 5591, 0x1e046d046ULL },
+  { 5598, 0x3e841d444ULL },
+  { 5599, 0x1e643d643ULL },
+  { 5604, 0x3e04d08a1ULL },
+  { 5605, 0x3e34d68a1ULL },
+  { 5607, 0x1e341d341ULL },
+  { 5609, 0x1e346d346ULL },
+  { 5616, 0x5e841d047ULL },
+  { 5617, 0x4e441d675ULL },
+  { 5618, 0x1e746d746ULL },
+  { 5625, 0x1e743d743ULL },
+  { 5626, 0x5e641d037ULL },
+  { 5631, 0x3e74d49a1ULL },
+  { 5634, 0x1e347d347ULL },
+  { 5643, 0x1e74d74c1ULL },
+  { 5670, 0x5e441b941ULL },
+  { 5671, 0x8e641b451ULL },
+  { 5672, 0x6e546b156ULL },
+  { 5673, 0x1e44a15b8ULL },
+  { 5674, 0x6e94a15b8ULL },
+  { 5675, 0x5e04a14b6ULL },
+  { 5679, 0x5e341b841ULL },
+  { 5680, 0x6e341b941ULL },
+  { 5681, 0x1e346b446ULL },
+  { 5682, 0x1e94a15b3ULL },
+  { 5683, 0x8e64a14b3ULL },
+  { 5684, 0x8e34a14b6ULL },
+  { 5688, 0x9e441b351ULL },
+  { 5691, 0x8e04a33b1ULL },
+  { 5692, 0x9e64a83b1ULL },
+  { 5697, 0x8e741b551ULL },
+  { 5698, 0x9e741b651ULL },
+  { 5699, 0x1e746b846ULL },
+  { 5700, 0x1e74a45b8ULL },
+  { 5701, 0x6e04a14b7ULL },
+  { 5706, 0x4e341b741ULL },
+  { 5707, 0x1e643b743ULL },
+  { 5709, 0x7e54a14b3ULL },
+  { 5716, 0x7e641b351ULL },
+  { 5718, 0x7e04a43b1ULL },
+  { 5727, 0x1e74a74b1ULL },
+  { 5736, 0x1e54a74b3ULL },
+  { 5745, 0x4e04a73b1ULL },
+  { 5751, 0x9e54b1c45ULL },
+  { 5752, 0x8e64b1c45ULL },
+  { 5753, 0x9e84b4b16ULL },
+  { 5754, 0x8e44b1a15ULL },
+  { 5755, 0x6e94b4a15ULL },
+  { 5757, 0x8e44b15a1ULL },
+  { 5758, 0x9e64b15a4ULL },
+  { 5759, 0x9e84b15a6ULL },
+  { 5760, 0x5e34b1c84ULL },
+  { 5761, 0x3e34b1c64ULL },
+  { 5762, 0x9e94b3b16ULL },
+  { 5763, 0x1e34b1a34ULL },
+  { 5764, 0x3e64b8a14ULL },
+  { 5766, 0x9e34b15a1ULL },
+  { 5767, 0x6e84b35a1ULL },
+  { 5768, 0x4e34b14a6ULL },
+  { 5775, 0x1e04b83a3ULL },
+  { 5776, 0x1e64b93a8ULL },
+  { 5777, 0x1e04b53a6ULL },
+  { 5778, 0x7e04b1c74ULL },
+  { 5779, 0x9e74b1c65ULL },
+  { 5780, 0x9e74b5b16ULL },
+  { 5781, 0x8e74b4a15ULL },
+  { 5782, 0x7e04b6a14ULL },
+  { 5784, 0x8e74b45a1ULL },
+  { 5785, 0x7e04b64a1ULL },
+  { 5786, 0x7e04b14a6ULL },
+  { 5787, 0x7e34b1c05ULL },
+  { 5788, 0x6e54b3c71ULL },
+  { 5790, 0x5e34b1a74ULL },
+  { 5793, 0x7e74b35a1ULL },
+  { 5802, 0x1e04b43a7ULL },
+  { 5805, 0x1e94b7b75ULL },
+  { 5806, 0x1e64b74c1ULL },
+  { 5807, 0x9e54b7b16ULL },
+  { 5808, 0x8e04b7a14ULL },
+  { 5809, 0x1e64b7a04ULL },
+  { 5811, 0x8e04b74a1ULL },
+  { 5814, 0x4e34b74c1ULL },
+  { 5815, 0x6e54b71c3ULL },
+  { 5817, 0x5e34b7a14ULL },
+  { 5820, 0x5e34b74a1ULL },
+  { 5829, 0x1e04b73a4ULL },
+  { 5832, 0x5e1d81d09ULL },
+  { 5833, 0x6e1d51d09ULL },
+  { 5834, 0x6e1d11d66ULL },
+  { 5835, 0x9e1a1d8c1ULL },
+  { 5836, 0x6e1a1d5c1ULL },
+  { 5837, 0x8e1a1a1c6ULL },
+  { 5838, 0x9e1c1c8a1ULL },
+  { 5839, 0x8e1c1a6a1ULL },
+  { 5840, 0x9e1a1a1a6ULL },
+  { 5841, 0x3e1d31d93ULL },
+  { 5842, 0x1e1c63d63ULL },
+  { 5843, 0x1e1c36d36ULL },
+  { 5844, 0x8e1c3a5c1ULL },
+  { 5845, 0x9e1c3a6c1ULL },
+  { 5846, 0x9e1c3a1c6ULL },
+  { 5847, 0x9e1c1a5a3ULL },
+  { 5848, 0x6e1d3c1a3ULL },
+  { 5849, 0x9e1d3c1a6ULL },
+  { 5850, 0x3e1c1d3d9ULL },
+  { 5851, 0x6e1c6c3d3ULL },
+  { 5852, 0x6e1c3d3c6ULL },
+  { 5853, 0x8e1c5a3c1ULL },
+  { 5854, 0x6e1c3a3c1ULL },
+  { 5855, 0x5e1c3a3d6ULL },
+  { 5856, 0x8e1d1c3a5ULL },
+  { 5857, 0x6e1c1c3a3ULL },
+  { 5858, 0x9e1c1c3a6ULL },
+  { 5859, 0x7e1d11d77ULL },
+  { 5860, 0x7e1c6d6c7ULL },
+  { 5861, 0x6e1c7d7c6ULL },
+  { 5862, 0x9e1a1a7c1ULL },
+  { 5863, 0x8e1a6d6c7ULL },
+  { 5864, 0x8e1a7c6d6ULL },
+  { 5865, 0x9e1c1a7a1ULL },
+  { 5866, 0x7e1d1c6a1ULL },
+  { 5867, 0x7e1c1c1a6ULL },
+  { 5868, 0x1e1c73d73ULL },
+  { 5869, 0x6e1c31d87ULL },
+  { 5871, 0x3e1a53d07ULL },
+  { 5872, 0x7e1a3d6c3ULL },
+  { 5874, 0x3e1a7d7a1ULL },
+  { 5875, 0x7e1c3d6a5ULL },
+  { 5877, 0x7e1c3d3c7ULL },
+  { 5880, 0x7e1a3a3c1ULL },
+  { 5881, 0x7e1c6a3d3ULL },
+  { 5882, 0x7e1a3d3c6ULL },
+  { 5883, 0x7e1c3a3a1ULL },
+  { 5885, 0x7e1c3d3a6ULL },
+  { 5886, 0x7e11d77c1ULL },
+  { 5887, 0x1e1c67d67ULL },
+  { 5892, 0x8e11d77a1ULL },
+  { 5895, 0x1e1c37d37ULL },
+  { 5913, 0x8e1b1d1c9ULL },
+  { 5914, 0x5e1c68b19ULL },
+  { 5915, 0x8e1c16b96ULL },
+  { 5916, 0x1e1a1a9b8ULL },
+  { 5917, 0x6e1d9a8b5ULL },
+  { 5918, 0x5e1d8a9b6ULL },
+  { 5919, 0x9e1b5c1a5ULL },
+  { 5920, 0x8e1c6b9a5ULL },
+  { 5921, 0x9e1c5b8a6ULL },
+  { 5922, 0x5e1c3b1b9ULL },
+  { 5923, 0x6e1d3b1c9ULL },
+  { 5924, 0x3e1d3c1b6ULL },
+  { 5925, 0x1e1a3d9b3ULL },
+  { 5926, 0x3e1c1a6b8ULL },
+  { 5927, 0x8e1b3a1d6ULL },
+  { 5928, 0x3e1b3d9a1ULL },
+  { 5929, 0x8e1b6c1a3ULL },
+  { 5930, 0x8e1c3b5a6ULL },
+  { 5931, 0x5e1d1b3b9ULL },
+  { 5932, 0x5e1b6c3d3ULL },
+  { 5933, 0x5e1b3d3c6ULL },
+  { 5934, 0x9e1b1a3c3ULL },
+  { 5935, 0x8e1b6a3c1ULL },
+  { 5936, 0x6e1a3d3b6ULL },
+  { 5937, 0x9e1b3c3a1ULL },
+  { 5938, 0x9e1b6a3a1ULL },
+  { 5939, 0x8e1b1d3a6ULL },
+  { 5940, 0x1e1c7b1b9ULL },
+  { 5941, 0x6e1c56b17ULL },
+  { 5942, 0x9e1c85b76ULL },
+  { 5943, 0x7e1d5a7b9ULL },
+  { 5944, 0x8e1d7a6b7ULL },
+  { 5945, 0x7e1c7a6b6ULL },
+  { 5946, 0x9e1c5b7a7ULL },
+  { 5947, 0x7e1b6d6a7ULL },
+  { 5948, 0x6e1b7d7a6ULL },
+  { 5949, 0x7e1c13b83ULL },
+  { 5950, 0x6e1c78b39ULL },
+  { 5951, 0x7e1c65b36ULL },
+  { 5952, 0x5e1c3a7b9ULL },
+  { 5953, 0x6e1a9a7b3ULL },
+  { 5954, 0x7e1a36b96ULL },
+  { 5955, 0x7e1b3c1a5ULL },
+  { 5956, 0x6e1b3b7a3ULL },
+  { 5957, 0x7e1b3b5a6ULL },
+  { 5958, 0x7e1c3d3b8ULL },
+  { 5959, 0x6e1c3d3b7ULL },
+  { 5961, 0x7e1b5a3c1ULL },
+  { 5962, 0x6e1a1a3b7ULL },
+  { 5963, 0x7e13a03b6ULL },
+  { 5964, 0x7e1b1d3a5ULL },
+  { 5965, 0x6e1b3b3a7ULL },
+  { 5966, 0x7e1b1b3a6ULL },
+  { 5967, 0x8e1c17b97ULL },
+  { 5968, 0x9e1c67b58ULL },
+  { 5970, 0x9e1a77b58ULL },
+  { 5971, 0x6e1a17b67ULL },
+  { 5976, 0x5e1c37b87ULL },
+  { 5977, 0x6e1c37b97ULL },
+  { 5979, 0x3e1a57b77ULL },
+  { 5980, 0x6e1a37b87ULL },
+  { 5988, 0x1e13a73b7ULL },
+  { 5994, 0x9e18b9c01ULL },
+  { 5995, 0x9e18b6c51ULL },
+  { 5996, 0x8e16b1c96ULL },
+  { 5997, 0x5e19b8a88ULL },
+  { 5998, 0x6e16b9a85ULL },
+  { 5999, 0x5e16b5a16ULL },
+  { 6000, 0x5e19b88a8ULL },
+  { 6001, 0x6e16b95a8ULL },
+  { 6002, 0x1e19b68a6ULL },
+  { 6003, 0x3e15b3c81ULL },
+  { 6004, 0x6e15b3c91ULL },
+  { 6005, 0x9e15b3b36ULL },
+  { 6006, 0x3e19b9a58ULL },
+  { 6007, 0x1e16b9a35ULL },
+  { 6008, 0x3e16b3a16ULL },
+  { 6009, 0x1e19b98a3ULL },
+  { 6010, 0x1e16b95a3ULL },
+  { 6011, 0x3e16b85a6ULL },
+  { 6012, 0x8e13b93c1ULL },
+  { 6013, 0x5e13b63c1ULL },
+  { 6018, 0x5e13b53a1ULL },
+  { 6019, 0x6e13b63a1ULL },
+  { 6020, 0x5e13b03a6ULL },
+  { 6021, 0x9e17b1b18ULL },
+  { 6022, 0x9e17b5c61ULL },
+  { 6023, 0x7e16b1c86ULL },
+  { 6024, 0x5e18b9a77ULL },
+  { 6025, 0x6e18b8a97ULL },
+  { 6026, 0x5e17b9a76ULL },
+  { 6027, 0x5e18b97a7ULL },
+  { 6028, 0x6e17b86a9ULL },
+  { 6029, 0x1e17b66a6ULL },
+  { 6030, 0x3e17b1b57ULL },
+  { 6031, 0x7e17b6c31ULL },
+  { 6032, 0x7e15b3b16ULL },
+  { 6033, 0x1e18b9a37ULL },
+  { 6034, 0x8e17b6a37ULL },
+  { 6035, 0x7e16b5a36ULL },
+  { 6036, 0x1e18b97a3ULL },
+  { 6037, 0x7e16b56a3ULL },
+  { 6038, 0x3e17b86a6ULL },
+  { 6039, 0x7e13b83c1ULL },
+  { 6045, 0x9e13b33a7ULL },
+  { 6046, 0x6e13b03a7ULL },
+  { 6048, 0x7e18b7b59ULL },
+  { 6049, 0x9e16b7b77ULL },
+  { 6050, 0x7e15b7b56ULL },
+  { 6051, 0x5e18b7a97ULL },
+  { 6052, 0x1e16b7a55ULL },
+  { 6053, 0x7e16b7a16ULL },
+  { 6054, 0x5e18b77a9ULL },
+  { 6055, 0x7e16b76a1ULL },
+  { 6057, 0x1e13b7b93ULL },
+  { 6058, 0x3e16b7b17ULL },
+  { 6059, 0x3e15b7b16ULL },
+  { 6060, 0x3e19b7a78ULL },
+  { 6061, 0x6e13b7a03ULL },
+  { 6062, 0x9e16b7a36ULL },
+  { 6063, 0x3e19b78a7ULL },
+  { 6064, 0x9e16b76a3ULL },
+  { 6067, 0x6e13b73c1ULL },
+  { 6072, 0x7e13b73a1ULL },
+  { 6075, 0x1e1d4d1d4ULL },
+  { 6076, 0x4e1c6d6c4ULL },
+  { 6077, 0x4e1c51d06ULL },
+  { 6078, 0x9e1c5a1c4ULL },
+  { 6079, 0x6e1a1a1c4ULL },
+  { 6080, 0x5e1c4a6d6ULL },
+  { 6081, 0x9e1d5c1a4ULL },
+  { 6082, 0x6e1c1a4a1ULL },
+  { 6083, 0x8e1c4d8a6ULL },
+  { 6084, 0x1e1c43d43ULL },
+  { 6085, 0x6e1c4d8c3ULL },
+  { 6087, 0x3e1a1c4d8ULL },
+  { 6088, 0x3e1a34d68ULL },
+  { 6089, 0x4e1c3a6d6ULL },
+  { 6090, 0x8e1c4a1a3ULL },
+  { 6091, 0x4e1c6d6a3ULL },
+  { 6093, 0x4e1c3d3c4ULL },
+  { 6094, 0x3e161d384ULL },
+  { 6095, 0x8e1c4c3d6ULL },
+  { 6096, 0x4e1d1a3c1ULL },
+  { 6097, 0x6e1a4a3d3ULL },
+  { 6098, 0x6e1c4a3d6ULL },
+  { 6099, 0x4e1d1c3a1ULL },
+  { 6100, 0x6e1a3d3a4ULL },
+  { 6102, 0x7e1c7c4d4ULL },
+  { 6103, 0x4e1c91d67ULL },
+  { 6104, 0x4e1c71d86ULL },
+  { 6105, 0x8e1c7a4d4ULL },
+  { 6106, 0x7e1c6a4d4ULL },
+  { 6107, 0x7e1a4d4c6ULL },
+  { 6108, 0x8e1c4d4a7ULL },
+  { 6109, 0x6e1a7d7a4ULL },
+  { 6110, 0x7e1c4d4a6ULL },
+  { 6114, 0x7e1c3a4c1ULL },
+  { 6117, 0x7e1d4c1a3ULL },
+  { 6118, 0x7e1a3d6a4ULL },
+  { 6123, 0x7e1c4a3c1ULL },
+  { 6125, 0x7e1a4a3d6ULL },
+  { 6126, 0x7e1c1c3a4ULL },
+  { 6129, 0x1e1c47d47ULL },
+  { 6156, 0x4e1c4b1b9ULL },
+  { 6157, 0x1e1b84d69ULL },
+  { 6158, 0x1e1c46b56ULL },
+  { 6159, 0x4e1c1a5b8ULL },
+  { 6160, 0x6e1c8a6b4ULL },
+  { 6161, 0x4e1b4a6d6ULL },
+  { 6162, 0x8e1b4c1a5ULL },
+  { 6163, 0x9e1b6c1a4ULL },
+  { 6164, 0x6e1b4d4a6ULL },
+  { 6165, 0x3e1c83b14ULL },
+  { 6166, 0x3e1d64b94ULL },
+  { 6167, 0x3e16c1b46ULL },
+  { 6168, 0x4e1a53b83ULL },
+  { 6169, 0x3e1a3d6b4ULL },
+  { 6170, 0x4e1a3c1b6ULL },
+  { 6171, 0x9e1b3a4a3ULL },
+  { 6172, 0x5e1b3d6a4ULL },
+  { 6173, 0x4e1c3b1a6ULL },
+  { 6174, 0x4e1b3d3c5ULL },
+  { 6175, 0x6e1c6b3c4ULL },
+  { 6176, 0x4e1b3d3b6ULL },
+  { 6177, 0x4e1b4a3d3ULL },
+  { 6178, 0x6e1b4a3c1ULL },
+  { 6179, 0x4e1b3a3d6ULL },
+  { 6180, 0x9e1b4a3a3ULL },
+  { 6181, 0x6e1c1b3a4ULL },
+  { 6182, 0x5e1c4b3a6ULL },
+  { 6183, 0x7e1d48b19ULL },
+  { 6184, 0x6e1c86b47ULL },
+  { 6185, 0x7e1c75b46ULL },
+  { 6186, 0x7e1a4d4b7ULL },
+  { 6187, 0x7e1c9a6b4ULL },
+  { 6188, 0x4e1c7a9b6ULL },
+  { 6189, 0x7e1b4d4a7ULL },
+  { 6190, 0x6e1c5b4a7ULL },
+  { 6191, 0x7e1b4d8a6ULL },
+  { 6192, 0x4e1c73b14ULL },
+  { 6193, 0x9e1c73b64ULL },
+  { 6194, 0x4e1c36b76ULL },
+  { 6195, 0x7e1a7a4b3ULL },
+  { 6196, 0x7e1a6b4c3ULL },
+  { 6197, 0x3e1c4a7b6ULL },
+  { 6198, 0x7e1b3a4a1ULL },
+  { 6199, 0x6e1c4b7a3ULL },
+  { 6200, 0x7e1c3b4a6ULL },
+  { 6201, 0x7e1d5b3c4ULL },
+  { 6203, 0x7e1b4c3d6ULL },
+  { 6204, 0x1e1a4b3b7ULL },
+  { 6205, 0x7e1c6a3b4ULL },
+  { 6206, 0x7e1c4a3b6ULL },
+  { 6207, 0x7e1b4a3a1ULL },
+  { 6208, 0x6e1c4b3a7ULL },
+  { 6210, 0x5e1c47b97ULL },
+  { 6211, 0x8e1c67b48ULL },
+  { 6213, 0x8e1a47b18ULL },
+  { 6214, 0x6e1a47b97ULL },
+  { 6219, 0x3e1c47b77ULL },
+  { 6222, 0x7e15a74b3ULL },
+  { 6223, 0x4e1a37b67ULL },
+  { 6237, 0x9e15b4c51ULL },
+  { 6238, 0x6e18b4b19ULL },
+  { 6239, 0x5e11b4d46ULL },
+  { 6240, 0x1e19b8a48ULL },
+  { 6241, 0x1e16b8a45ULL },
+  { 6242, 0x4e16b5a06ULL },
+  { 6243, 0x1e19b88a4ULL },
+  { 6244, 0x1e16b85a4ULL },
+  { 6245, 0x1e15b64a6ULL },
+  { 6246, 0x4e13b1c53ULL },
+  { 6247, 0x3e16b61c4ULL },
+  { 6248, 0x8e15b4b36ULL },
+  { 6249, 0x8e13b4a53ULL },
+  { 6250, 0x9e13b6a43ULL },
+  { 6251, 0x3e16b4a06ULL },
+  { 6252, 0x1e15b94a3ULL },
+  { 6253, 0x6e15b45a3ULL },
+  { 6254, 0x3e15b84a6ULL },
+  { 6255, 0x3e13b43c1ULL },
+  { 6261, 0x4e13b43a1ULL },
+  { 6262, 0x6e13b43a3ULL },
+  { 6263, 0x9e13b43a6ULL },
+  { 6264, 0x4e18b5c71ULL },
+  { 6265, 0x4e17b6b18ULL },
+  { 6266, 0x7e15b6b46ULL },
+  { 6267, 0x1e18b8a47ULL },
+  { 6268, 0x9e17b6a47ULL },
+  { 6269, 0x7e16b4a46ULL },
+  { 6270, 0x1e18b87a4ULL },
+  { 6271, 0x7e16b46a4ULL },
+  { 6272, 0x4e17b96a6ULL },
+  { 6273, 0x4e17b3b87ULL },
+  { 6274, 0x7e13b8b64ULL },
+  { 6276, 0x7e13b4a43ULL },
+  { 6277, 0x6e17b4a37ULL },
+  { 6279, 0x3e17b07a4ULL },
+  { 6280, 0x6e17b47a3ULL },
+  { 6288, 0x7e13b43a4ULL },
+  { 6291, 0x7e19b7c41ULL },
+  { 6292, 0x7e16b71c4ULL },
+  { 6293, 0x6e15b7b46ULL },
+  { 6294, 0x5e15b7a94ULL },
+  { 6295, 0x4e16b7a85ULL },
+  { 6296, 0x4e17b7a86ULL },
+  { 6297, 0x4e19b78a8ULL },
+  { 6298, 0x4e16b75a8ULL },
+  { 6300, 0x5e13b7b34ULL },
+  { 6301, 0x6e13b7b44ULL },
+  { 6303, 0x3e15b7a74ULL },
+  { 6306, 0x3e15b74a7ULL },
+  { 6318, 0x1e14d1d14ULL },
+  { 6319, 0x4e141d465ULL },
+  { 6320, 0x1e146d146ULL },
+  { 6324, 0x5e14d14a4ULL },
+  { 6325, 0x6e14d14a5ULL },
+  { 6327, 0x1e143d143ULL },
+  { 6333, 0x4e14d14a3ULL },
+  { 6345, 0x5e141d507ULL },
+  { 6351, 0x8e14d14a7ULL },
+  { 6353, 0x7e14d14a6ULL },
+  { 6399, 0x8e14c1b94ULL },
+  { 6400, 0x5e14c1b64ULL },
+  { 6401, 0x4e146b546ULL },
+  { 6402, 0x5e14a44b8ULL },
+  { 6403, 0x6e14a04b5ULL },
+  { 6404, 0x6e14a14b6ULL },
+  { 6408, 0x8e143b943ULL },
+  { 6409, 0x5e143b643ULL },
+  { 6410, 0x3e146b446ULL },
+  { 6411, 0x3e14a14b3ULL },
+  { 6412, 0x6e14a34b8ULL },
+  { 6413, 0x4e14a34b6ULL },
+  { 6420, 0x9e14a33b1ULL },
+  { 6421, 0x8e14a63b3ULL },
+  { 6422, 0x9e14a83b6ULL },
+  { 6426, 0x9e147b057ULL },
+  { 6427, 0x6e14c1b74ULL },
+  { 6428, 0x6e146b746ULL },
+  { 6429, 0x8e14a04b7ULL },
+  { 6431, 0x7e14a04b6ULL },
+  { 6435, 0x7e143b843ULL },
+  { 6436, 0x6e143b743ULL },
+  { 6438, 0x5e14a34b7ULL },
+  { 6447, 0x7e14a53b1ULL },
+  { 6456, 0x1e14a74b7ULL },
+  { 6465, 0x3e14a74b9ULL },
+  { 6474, 0x5e14a73b1ULL },
+  { 6480, 0x8e14b94c1ULL },
+  { 6481, 0x6e14b1b84ULL },
+  { 6483, 0x8e14b5a44ULL },
+  { 6484, 0x6e14b6a14ULL },
+  { 6486, 0x8e14b54a4ULL },
+  { 6487, 0x6e14b64a1ULL },
+  { 6488, 0x5e14b04a6ULL },
+  { 6489, 0x3e14b1c44ULL },
+  { 6490, 0x6e14b3b05ULL },
+  { 6492, 0x1e14b9a33ULL },
+  { 6493, 0x3e14b8a63ULL },
+  { 6495, 0x3e14b34a1ULL },
+  { 6496, 0x6e14b44a3ULL },
+  { 6497, 0x8e14b34a6ULL },
+  { 6504, 0x1e14b93a3ULL },
+  { 6505, 0x3e14b63a8ULL },
+  { 6506, 0x1e14b63a6ULL },
+  { 6507, 0x7e14b1c84ULL },
+  { 6508, 0x6e14b1c74ULL },
+  { 6510, 0x7e14b8a04ULL },
+  { 6513, 0x7e14b44a4ULL },
+  { 6514, 0x6e14b04a7ULL },
+  { 6516, 0x3e14b3b74ULL },
+  { 6517, 0x7e14b3c61ULL },
+  { 6519, 0x1e14b5a73ULL },
+  { 6522, 0x7e14b54a3ULL },
+  { 6531, 0x1e14b53a7ULL },
+  { 6534, 0x1e14b7b94ULL },
+  { 6535, 0x6e14b74c1ULL },
+  { 6537, 0x7e14b7a14ULL },
+  { 6538, 0x6e14b7a04ULL },
+  { 6540, 0x7e14b74a1ULL },
+  { 6543, 0x3e14b7b15ULL },
+  { 6546, 0x1e14b7a53ULL },
+  { 6549, 0x9e14b74a3ULL },
+  { 6558, 0x1e14b73a5ULL },
+  { 8748, 0x85e92c02ULL },
+  { 8749, 0x65e02c82ULL },
+  { 8750, 0x62e52d056ULL },
+  { 8751, 0x85e2a2c82ULL },
+  { 8752, 0x56e9a82c2ULL },
+  { 8753, 0x8e2c9a26ULL },
+  { 8754, 0x98e5a28a2ULL },
+  { 8755, 0x96e2a56a2ULL },
+  { 8756, 0x562e952a6ULL },
+  { 8757, 0x858e22c93ULL },
+  { 8758, 0x605e22c32ULL },
+  { 8759, 0x303e2d606ULL },
+  { 8760, 0x53e3c2a92ULL },
+  { 8761, 0x63e9a2a52ULL },
+  { 8762, 0x336e8a526ULL },
+  { 8763, 0x93e8a82a3ULL },
+  { 8764, 0x83e9a62a3ULL },
+  { 8765, 0x63e8a22a6ULL },
+  { 8766, 0x8e2d23c5ULL },
+  { 8767, 0x66e033c2ULL },
+  { 8768, 0x9e2d03c6ULL },
+  { 8769, 0x92e82a3d3ULL },
+  { 8770, 0x96e5a23c2ULL },
+  { 8771, 0x83e02a3c6ULL },
+  { 8772, 0x93e2a53a2ULL },
+  { 8773, 0x63e253a8ULL },
+  { 8774, 0x533e923a6ULL },
+  { 8775, 0x82e5d02c7ULL },
+  { 8776, 0x82e72d657ULL },
+  { 8777, 0x72e52d576ULL },
+  { 8778, 0x98e57a2c7ULL },
+  { 8779, 0x77e8c6a92ULL },
+  { 8780, 0x87e7a2a96ULL },
+  { 8781, 0x97e2a57a2ULL },
+  { 8782, 0x77e9a66a2ULL },
+  { 8783, 0x78e2a97a6ULL },
+  { 8784, 0x77e22c53ULL },
+  { 8785, 0x687e3c262ULL },
+  { 8786, 0x92e32d766ULL },
+  { 8787, 0x77e9c5a23ULL },
+  { 8788, 0x372e5a862ULL },
+  { 8789, 0x37e5c2a36ULL },
+  { 8790, 0x73e9a52a3ULL },
+  { 8791, 0x63e6a32a7ULL },
+  { 8792, 0x38e5a27a6ULL },
+  { 8793, 0x978e3c392ULL },
+  { 8794, 0x676e833c2ULL },
+  { 8796, 0x57e9a33c2ULL },
+  { 8797, 0x672e3a372ULL },
+  { 8798, 0x576e2a376ULL },
+  { 8799, 0x73e52a3a9ULL },
+  { 8800, 0x963e263a7ULL },
+  { 8801, 0x67e2c53a6ULL },
+  { 8802, 0x2e5c7d82ULL },
+  { 8803, 0x62e7d7c62ULL },
+  { 8805, 0x79e2a7a88ULL },
+  { 8806, 0x66e7a7a25ULL },
+  { 8807, 0x67e7a7a26ULL },
+  { 8808, 0x779e579a2ULL },
+  { 8809, 0x976e776a2ULL },
+  { 8810, 0x582e972a6ULL },
+  { 8811, 0x32e7d7c32ULL },
+  { 8812, 0x63e9c7d82ULL },
+  { 8813, 0x72e3c7d36ULL },
+  { 8814, 0x97e8c7a32ULL },
+  { 8815, 0x56e6c7a32ULL },
+  { 8816, 0x38e3c7a26ULL },
+  { 8817, 0x872e572a3ULL },
+  { 8818, 0x63e7a72a2ULL },
+  { 8819, 0x972e372a6ULL },
+  { 8820, 0x57e573c2ULL },
+  { 8821, 0x657e873c2ULL },
+  { 8823, 0x77e3a73c2ULL },
+  { 8824, 0x67e2a73c2ULL },
+  { 8826, 0x573e373a2ULL },
+  { 8827, 0x873e673a2ULL },
+  { 8828, 0x873e273a6ULL },
+  { 8829, 0x52e2d8b92ULL },
+  { 8830, 0x68e5c2b69ULL },
+  { 8831, 0x5e9c2b86ULL },
+  { 8832, 0x58e29a9b2ULL },
+  { 8833, 0x65e26a8b2ULL },
+  { 8834, 0x65e2a8b26ULL },
+  { 8838, 0x32e2c8b93ULL },
+  { 8839, 0x62e3c9b35ULL },
+  { 8840, 0x95e2d8b36ULL },
+  { 8841, 0x52e3a8b03ULL },
+  { 8842, 0x62e3a3b62ULL },
+  { 8843, 0x95e2a3b06ULL },
+  { 8847, 0x892e5b303ULL },
+  { 8848, 0x852e5b362ULL },
+  { 8849, 0x826e5b336ULL },
+  { 8850, 0x53e92a3b9ULL },
+  { 8851, 0x95e06a3b2ULL },
+  { 8852, 0x62e32a3b6ULL },
+  { 8856, 0x797e5b208ULL },
+  { 8857, 0x76e2c6b97ULL },
+  { 8858, 0x795e5b206ULL },
+  { 8859, 0x57e28a9b2ULL },
+  { 8860, 0x96e2a8b57ULL },
+  { 8861, 0x76e7a2b26ULL },
+  { 8865, 0x327e9b237ULL },
+  { 8866, 0x96e2c2b37ULL },
+  { 8867, 0x726e8b536ULL },
+  { 8868, 0x37e2a9b08ULL },
+  { 8869, 0x67e28a9b3ULL },
+  { 8870, 0x86e3a2b76ULL },
+  { 8874, 0x872e5b382ULL },
+  { 8875, 0x772e6b382ULL },
+  { 8876, 0x726e6b336ULL },
+  { 8877, 0x97e08a3b2ULL },
+  { 8878, 0x96e07a3b2ULL },
+  { 8879, 0x3e72a3b6ULL },
+  { 8883, 0x92e8c7b58ULL },
+  { 8884, 0x52e7d7b62ULL },
+  { 8885, 0x72e5c7b26ULL },
+  { 8886, 0x78e2a7b29ULL },
+  { 8887, 0x62e7a7b62ULL },
+  { 8888, 0x55e2a7b06ULL },
+  { 8892, 0x93e2c7b35ULL },
+  { 8893, 0x36e2c7b77ULL },
+  { 8894, 0x82e5c7b36ULL },
+  { 8895, 0x88e2a7b39ULL },
+  { 8896, 0x62e3a7b03ULL },
+  { 8897, 0x85e3a7b26ULL },
+  { 8910, 0x89e2b5c02ULL },
+  { 8911, 0x89e6b2c25ULL },
+  { 8912, 0x55e9b2b66ULL },
+  { 8913, 0x58e9b2a29ULL },
+  { 8914, 0x68e2b6a28ULL },
+  { 8915, 0x65e8b2a26ULL },
+  { 8916, 0x58e9b29a2ULL },
+  { 8917, 0x65e8b26a2ULL },
+  { 8918, 0x52e9b82a6ULL },
+  { 8919, 0x53e2b2b93ULL },
+  { 8920, 0x52e6b2b33ULL },
+  { 8921, 0x36e3b2b86ULL },
+  { 8922, 0x92e8b5a23ULL },
+  { 8923, 0x62e3b6a32ULL },
+  { 8924, 0x95e3b2a06ULL },
+  { 8925, 0x39e2b39a2ULL },
+  { 8926, 0x65e9b36a2ULL },
+  { 8927, 0x92e3b62a6ULL },
+  { 8928, 0x95e5b23c2ULL },
+  { 8929, 0x96e3b63c2ULL },
+  { 8934, 0x92e8b23a5ULL },
+  { 8935, 0x63e5b93a2ULL },
+  { 8936, 0x53e3b23a6ULL },
+  { 8937, 0x87e9b5b29ULL },
+  { 8938, 0x66e7b2b57ULL },
+  { 8939, 0x95e7b2b86ULL },
+  { 8940, 0x57e9b2a28ULL },
+  { 8941, 0x96e8b5a27ULL },
+  { 8942, 0x55e7b2a06ULL },
+  { 8943, 0x57e9b28a2ULL },
+  { 8944, 0x96e8b57a2ULL },
+  { 8945, 0x72e8b92a6ULL },
+  { 8946, 0x78e9b3c23ULL },
+  { 8947, 0x66e8b2c73ULL },
+  { 8948, 0x32e7b2d06ULL },
+  { 8949, 0x73e2b2a73ULL },
+  { 8950, 0x67e9b2a38ULL },
+  { 8951, 0x76e3b8a26ULL },
+  { 8952, 0x87e3b97a2ULL },
+  { 8953, 0x66e9b27a3ULL },
+  { 8954, 0x37e2b96a6ULL },
+  { 8955, 0x75e3b03c2ULL },
+  { 8956, 0x76e5b63c2ULL },
+  { 8961, 0x82e7b23a3ULL },
+  { 8962, 0x72e6b03a3ULL },
+  { 8963, 0x92e7b03a6ULL },
+  { 8964, 0x87e7b7b29ULL },
+  { 8965, 0x95e6b7b27ULL },
+  { 8966, 0x75e2b7b66ULL },
+  { 8967, 0x52e9b7a72ULL },
+  { 8968, 0x72e6b7a62ULL },
+  { 8969, 0x56e2b7a06ULL },
+  { 8970, 0x52e9b72a7ULL },
+  { 8971, 0x6e9b76a2ULL },
+  { 8972, 0x82e5b72a6ULL },
+  { 8973, 0x83e7b7b25ULL },
+  { 8974, 0x32e6b7b63ULL },
+  { 8975, 0x35e2b7b26ULL },
+  { 8976, 0x32e9b7a52ULL },
+  { 8977, 0x3e6b7a92ULL },
+  { 8978, 0x66e3b7a26ULL },
+  { 8979, 0x32e9b72a5ULL },
+  { 8980, 0x36e2b75a8ULL },
+  { 8981, 0x3e3b72a6ULL },
+  { 8983, 0x96e5b73c2ULL },
+  { 8988, 0x73e2b73a2ULL },
+  { 8989, 0x63e3b73a2ULL },
+  { 8991, 0x848e424c2ULL },
+  { 8992, 0x869e484c2ULL },
+  { 8993, 0x46e2d2c46ULL },
+  { 8994, 0x89e2a4c42ULL },
+  { 8995, 0x65e8a42c2ULL },
+  { 8996, 0x4e82a2c6ULL },
+  { 8997, 0x94e2a24a5ULL },
+  { 8998, 0x65e8a64a2ULL },
+  { 8999, 0x65e2a84a6ULL },
+  { 9000, 0x429e33c82ULL },
+  { 9001, 0x468e42c63ULL },
+  { 9002, 0x343e2d686ULL },
+  { 9003, 0x44e3c5a92ULL },
+  { 9004, 0x44e6a6a23ULL },
+  { 9005, 0x436e9a526ULL },
+  { 9006, 0x84e34a2a3ULL },
+  { 9007, 0x63e3a92a4ULL },
+  { 9008, 0x43e5a32a6ULL },
+  { 9009, 0x429e803c3ULL },
+  { 9010, 0x486e243c2ULL },
+  { 9011, 0x42e8d23c6ULL },
+  { 9012, 0x54e93a3c2ULL },
+  { 9013, 0x642e3a342ULL },
+  { 9014, 0x546e2a346ULL },
+  { 9015, 0x34e2a23a9ULL },
+  { 9016, 0x64e9a53a2ULL },
+  { 9017, 0x44e6a23a6ULL },
+  { 9018, 0x458e724c2ULL },
+  { 9019, 0x92e62d457ULL },
+  { 9020, 0x42e72d846ULL },
+  { 9021, 0x78e7c9a42ULL },
+  { 9022, 0x67e25a6c4ULL },
+  { 9023, 0x47e2c5a46ULL },
+  { 9024, 0x85e7a94a2ULL },
+  { 9025, 0x47e7a56a2ULL },
+  { 9026, 0x48e2a67a6ULL },
+  { 9027, 0x477e3c852ULL },
+  { 9028, 0x467e2c283ULL },
+  { 9029, 0x422e3d276ULL },
+  { 9030, 0x74e7a8a23ULL },
+  { 9031, 0x64e7a2a73ULL },
+  { 9032, 0x47e3a2a96ULL },
+  { 9033, 0x83e7a42a7ULL },
+  { 9034, 0x37e7a26a4ULL },
+  { 9035, 0x73e7a42a6ULL },
+  { 9036, 0x487e293c2ULL },
+  { 9037, 0x427e263c2ULL },
+  { 9038, 0x45e72c3d6ULL },
+  { 9039, 0x42e7a332ULL },
+  { 9040, 0x47e6a43c2ULL },
+  { 9041, 0x54e72a3c6ULL },
+  { 9042, 0x44e2a53a7ULL },
+  { 9043, 0x54e7a63a2ULL },
+  { 9044, 0x54e7a23a6ULL },
+  { 9045, 0x845e472c2ULL },
+  { 9046, 0x42e6c7d82ULL },
+  { 9048, 0x44e8a7a92ULL },
+  { 9049, 0x46e2a7a55ULL },
+  { 9050, 0x47e2c7a06ULL },
+  { 9051, 0x85e9a74a2ULL },
+  { 9052, 0x69e2c74a2ULL },
+  { 9053, 0x82e472a6ULL },
+  { 9054, 0x438e872c3ULL },
+  { 9055, 0x645e372c2ULL },
+  { 9056, 0x45e3d72c6ULL },
+  { 9057, 0x84e2c7a43ULL },
+  { 9058, 0x64e7a7a23ULL },
+  { 9059, 0x37e2a7a46ULL },
+  { 9060, 0x83e7a72a4ULL },
+  { 9061, 0x63e5a72a4ULL },
+  { 9063, 0x447e273c2ULL },
+  { 9064, 0x647e373c2ULL },
+  { 9069, 0x473e273a2ULL },
+  { 9070, 0x673e473a2ULL },
+  { 9071, 0x54e2a73a6ULL },
+  { 9072, 0x429e4b829ULL },
+  { 9073, 0x42e8c4b65ULL },
+  { 9074, 0x45e2c4b26ULL },
+  { 9075, 0x42e8a9b52ULL },
+  { 9076, 0x64e2a8b25ULL },
+  { 9077, 0x46e2a2b46ULL },
+  { 9081, 0x93e2d8b34ULL },
+  { 9082, 0x634e2b834ULL },
+  { 9083, 0x436e8b246ULL },
+  { 9084, 0x93e2a8b54ULL },
+  { 9085, 0x63e2a9b34ULL },
+  { 9086, 0x43e23a4b6ULL },
+  { 9090, 0x942e4b352ULL },
+  { 9091, 0x952e4b362ULL },
+  { 9092, 0x926e4b336ULL },
+  { 9093, 0x43e92a3b8ULL },
+  { 9094, 0x46e56a3b2ULL },
+  { 9095, 0x54e24a3b6ULL },
+  { 9099, 0x447e8b257ULL },
+  { 9100, 0x457e8b267ULL },
+  { 9101, 0x45e7c2b86ULL },
+  { 9102, 0x74e25a7b2ULL },
+  { 9103, 0x46e26a5b7ULL },
+  { 9104, 0x47e9a2b76ULL },
+  { 9108, 0x324e7b034ULL },
+  { 9109, 0x92e6c3b74ULL },
+  { 9110, 0x74e5c3b26ULL },
+  { 9111, 0x43e73a5b2ULL },
+  { 9112, 0x62e7a4b32ULL },
+  { 9113, 0x74e34a2b6ULL },
+  { 9117, 0x972e4b382ULL },
+  { 9118, 0x732e6b342ULL },
+  { 9120, 0x47e57a3b2ULL },
+  { 9121, 0x64e74a3b2ULL },
+  { 9126, 0x42e8c7b08ULL },
+  { 9127, 0x62e2c7b04ULL },
+  { 9128, 0x64e2c7b06ULL },
+  { 9129, 0x74e2a7b25ULL },
+  { 9130, 0x42e6a7b52ULL },
+  { 9131, 0x46e9a7b26ULL },
+  { 9135, 0x42e3c7b54ULL },
+  { 9136, 0x52e3c7b64ULL },
+  { 9137, 0x94e2c7b36ULL },
+  { 9138, 0x83e3a7b24ULL },
+  { 9139, 0x32e6a7b42ULL },
+  { 9153, 0x89e2b4c52ULL },
+  { 9154, 0x68e2b2c44ULL },
+  { 9155, 0x84e5b9b26ULL },
+  { 9156, 0x84e8b2a45ULL },
+  { 9157, 0x84e6b2a25ULL },
+  { 9158, 0x46e2b4a26ULL },
+  { 9159, 0x84e8b45a2ULL },
+  { 9160, 0x84e6b25a2ULL },
+  { 9161, 0x5e2b64a6ULL },
+  { 9162, 0x34e3b2b84ULL },
+  { 9163, 0x62e6b2b43ULL },
+  { 9164, 0x46e3b2b96ULL },
+  { 9165, 0x43e2b2a43ULL },
+  { 9166, 0x63e8b2a24ULL },
+  { 9167, 0x36e3b4a26ULL },
+  { 9168, 0x53e9b24a2ULL },
+  { 9169, 0x63e9b24a3ULL },
+  { 9170, 0x54e3b24a6ULL },
+  { 9171, 0x95e9b43c2ULL },
+  { 9172, 0x56e3b43c2ULL },
+  { 9177, 0x43e2b43a2ULL },
+  { 9178, 0x3e6b43a2ULL },
+  { 9179, 0x43e2b03a6ULL },
+  { 9180, 0x98e5b2c74ULL },
+  { 9181, 0x64e8b2c72ULL },
+  { 9182, 0x94e7b6b26ULL },
+  { 9183, 0x74e7b2a25ULL },
+  { 9184, 0x67e2b4a47ULL },
+  { 9185, 0x95e7b2a46ULL },
+  { 9186, 0x74e7b25a2ULL },
+  { 9187, 0x96e7b47a2ULL },
+  { 9188, 0x42e7b52a6ULL },
+  { 9189, 0x38e7b2c54ULL },
+  { 9190, 0x56e7b42c3ULL },
+  { 9191, 0x45e7b2b36ULL },
+  { 9192, 0x83e7b2a34ULL },
+  { 9193, 0x72e3b6a42ULL },
+  { 9195, 0x83e7b24a3ULL },
+  { 9196, 0x72e3b62a4ULL },
+  { 9197, 0x72e3b42a6ULL },
+  { 9198, 0x47e2b83c2ULL },
+  { 9204, 0x43e7b93a2ULL },
+  { 9207, 0x92e8b7b44ULL },
+  { 9208, 0x64e8b72c2ULL },
+  { 9209, 0x94e6b7b26ULL },
+  { 9210, 0x48e2b7a97ULL },
+  { 9211, 0x62e5b7a42ULL },
+  { 9212, 0x46e5b7a26ULL },
+  { 9213, 0x48e2b77a9ULL },
+  { 9214, 0x46e5b76a2ULL },
+  { 9215, 0x42e9b72a6ULL },
+  { 9216, 0x92e7b7b34ULL },
+  { 9217, 0x42e5b7b63ULL },
+  { 9218, 0x45e2b7b36ULL },
+  { 9219, 0x34e2b7a83ULL },
+  { 9220, 0x42e6b7a32ULL },
+  { 9222, 0x84e2b74a3ULL },
+  { 9223, 0x64e3b74a2ULL },
+  { 9231, 0x43e5b73a2ULL },
+  { 9234, 0x42e4d84c2ULL },
+  { 9235, 0x62e4d4c62ULL },
+  { 9236, 0x62e42d426ULL },
+  { 9237, 0x49e4a54c2ULL },
+  { 9238, 0x65e4c8a42ULL },
+  { 9239, 0x86e4c2a06ULL },
+  { 9240, 0x49e48a8a2ULL },
+  { 9241, 0x46e4a85a2ULL },
+  { 9242, 0x68e4c02a6ULL },
+  { 9243, 0x32e4d4c32ULL },
+  { 9244, 0x46e4d8c23ULL },
+  { 9245, 0x2e43d086ULL },
+  { 9246, 0x43e4a8a22ULL },
+  { 9247, 0x83e4c3a62ULL },
+  { 9248, 0x63e4a2d46ULL },
+  { 9249, 0x53e4a82a3ULL },
+  { 9250, 0x63e4a92a3ULL },
+  { 9251, 0x89e4c32a6ULL },
+  { 9252, 0x42e4d23c3ULL },
+  { 9253, 0x46e4d23c8ULL },
+  { 9254, 0x84e4d23c6ULL },
+  { 9255, 0x52e42a3d3ULL },
+  { 9256, 0x46e4a03c2ULL },
+  { 9257, 0x62e42a3d6ULL },
+  { 9258, 0x53e42a3a8ULL },
+  { 9259, 0x63e4a03a2ULL },
+  { 9260, 0x33e42a3a6ULL },
+  { 9261, 0x72e4d4c72ULL },
+  { 9262, 0x42e42d675ULL },
+  { 9263, 0x72e42d846ULL },
+  { 9264, 0x89e48a7c2ULL },
+  { 9265, 0x67e47a2d4ULL },
+  { 9266, 0x87e4c4a26ULL },
+  { 9267, 0x4e4a92a7ULL },
+  { 9268, 0x47e4a26a8ULL },
+  { 9269, 0x42e4d27a6ULL },
+  { 9270, 0x3e42d027ULL },
+  { 9271, 0x63e4c3d72ULL },
+  { 9273, 0x58e4a3c72ULL },
+  { 9274, 0x67e4a3c42ULL },
+  { 9275, 0x73e4a2d66ULL },
+  { 9276, 0x43e4a32a7ULL },
+  { 9277, 0x37e46a7a2ULL },
+  { 9278, 0x47e43c2a6ULL },
+  { 9280, 0x72e4d63c3ULL },
+  { 9282, 0x7e4a33c2ULL },
+  { 9283, 0x67e4a63c2ULL },
+  { 9285, 0x97e47a3a2ULL },
+  { 9286, 0x67e42c3a4ULL },
+  { 9287, 0x87e42c3a6ULL },
+  { 9288, 0x42e4c7d24ULL },
+  { 9291, 0x55e4c7a72ULL },
+  { 9292, 0x45e4c7a62ULL },
+  { 9293, 0x9e4c7a26ULL },
+  { 9294, 0x4e4a72a9ULL },
+  { 9297, 0x2e4c7d53ULL },
+  { 9300, 0x43e4a7a32ULL },
+  { 9301, 0x63e4a7a52ULL },
+  { 9302, 0x37e4a7a26ULL },
+  { 9303, 0x38e4a77a2ULL },
+  { 9304, 0x36e4a75a2ULL },
+  { 9305, 0x73e4a72a6ULL },
+  { 9309, 0x87e4a73c2ULL },
+  { 9312, 0x34e4a73a2ULL },
+  { 9315, 0x92e4c4b54ULL },
+  { 9316, 0x62e4c6b05ULL },
+  { 9317, 0x45e4c2b26ULL },
+  { 9318, 0x82e4a5b92ULL },
+  { 9319, 0x62e4a6b82ULL },
+  { 9320, 0x46e4a2b26ULL },
+  { 9324, 0x3e4c2b83ULL },
+  { 9325, 0x2e4c4b63ULL },
+  { 9326, 0x83e4c6b26ULL },
+  { 9327, 0x82e4a9b33ULL },
+  { 9328, 0x82e4a6b03ULL },
+  { 9329, 0x36e4a3b26ULL },
+  { 9336, 0x52e42a3b4ULL },
+  { 9337, 0x36e46a3b2ULL },
+  { 9342, 0x72e4d8b92ULL },
+  { 9343, 0x66e4c2b47ULL },
+  { 9344, 0x75e4c2b56ULL },
+  { 9345, 0x77e48a9b2ULL },
+  { 9346, 0x76e4a9b27ULL },
+  { 9347, 0x75e4a9b26ULL },
+  { 9351, 0x72e4c2b53ULL },
+  { 9352, 0x6e4c3b27ULL },
+  { 9353, 0x72e4c9b36ULL },
+  { 9354, 0x93e43a2b7ULL },
+  { 9355, 0x72e4a3b62ULL },
+  { 9356, 0x32e42a7b6ULL },
+  { 9363, 0x37e47a3b2ULL },
+  { 9365, 0x72e42a3b6ULL },
+  { 9369, 0x72e4c7b55ULL },
+  { 9370, 0x62e4c7b45ULL },
+  { 9372, 0x42e4a7b72ULL },
+  { 9373, 0x62e4a7b92ULL },
+  { 9374, 0x95e4a7b26ULL },
+  { 9378, 0x52e4c7b35ULL },
+  { 9380, 0x43e4c7b26ULL },
+  { 9381, 0x2e4a7b32ULL },
+  { 9382, 0x32e4a7b62ULL },
+  { 9396, 0x48e4b22c4ULL },
+  { 9397, 0x64e4b2c52ULL },
+  { 9398, 0x45e4b2b06ULL },
+  { 9399, 0x92e4b8a52ULL },
+  { 9400, 0x42e4b6a22ULL },
+  { 9401, 0x85e4b2a06ULL },
+  { 9402, 0x92e4b82a5ULL },
+  { 9403, 0x85e4b06a2ULL },
+  { 9404, 0x82e4b62a6ULL },
+  { 9405, 0x53e4b3b24ULL },
+  { 9406, 0x3e4b2b63ULL },
+  { 9407, 0x55e4b3b26ULL },
+  { 9408, 0x3e4b9a52ULL },
+  { 9409, 0x3e4b8a62ULL },
+  { 9410, 0x36e4b5a26ULL },
+  { 9411, 0x42e4b52a3ULL },
+  { 9412, 0x36e4b56a2ULL },
+  { 9413, 0x52e4b32a6ULL },
+  { 9415, 0x65e4b03c2ULL },
+  { 9420, 0x82e4b03a2ULL },
+  { 9421, 0x43e4b63a2ULL },
+  { 9422, 0x43e4b23a6ULL },
+  { 9423, 0x47e4b2b08ULL },
+  { 9424, 0x67e4b4c02ULL },
+  { 9425, 0x72e4b2d26ULL },
+  { 9426, 0x72e4b4a72ULL },
+  { 9427, 0x47e4b6a27ULL },
+  { 9428, 0x76e4b9a26ULL },
+  { 9429, 0x72e4b42a7ULL },
+  { 9430, 0x76e4b96a2ULL },
+  { 9431, 0x72e4b52a6ULL },
+  { 9432, 0x72e4b3b43ULL },
+  { 9433, 0x56e4b3b27ULL },
+  { 9434, 0x75e4b2b36ULL },
+  { 9435, 0x73e4b9a23ULL },
+  { 9436, 0x62e4b3a72ULL },
+  { 9438, 0x37e4b57a2ULL },
+  { 9439, 0x62e4b32a7ULL },
+  { 9441, 0x47e4b93c2ULL },
+  { 9447, 0x73e4b93a2ULL },
+  { 9450, 0x5e4b72c2ULL },
+  { 9453, 0x72e4b7a42ULL },
+  { 9454, 0x92e4b7a62ULL },
+  { 9455, 0x56e4b7a26ULL },
+  { 9456, 0x72e4b72a4ULL },
+  { 9457, 0x56e4b76a2ULL },
+  { 9458, 0x92e4b72a6ULL },
+  { 9459, 0x32e4b7b43ULL },
+  { 9460, 0x52e4b7b63ULL },
+  { 9462, 0x32e4b7a02ULL },
+  { 9463, 0x62e4b7a32ULL },
+  { 9465, 0x3e4b72a7ULL },
+  { 9466, 0x62e4b72a3ULL },
+  { 9468, 0x7e4b73c2ULL },
+  { 9474, 0x53e4b73a2ULL },
+  { 9477, 0x29e511c8ULL },
+  { 9478, 0x612e81c21ULL },
+  { 9479, 0x85e21d696ULL },
+  { 9480, 0x92e1a1c82ULL },
+  { 9481, 0x82e6a11c2ULL },
+  { 9482, 0x18e9a21c6ULL },
+  { 9483, 0x82e1a81a9ULL },
+  { 9484, 0x62e6a81a2ULL },
+  { 9485, 0x52e11a8a6ULL },
+  { 9486, 0x3e1d2c51ULL },
+  { 9487, 0x636e212c3ULL },
+  { 9488, 0x3e12d036ULL },
+  { 9489, 0x33e9a21c2ULL },
+  { 9490, 0x63e6a2c51ULL },
+  { 9491, 0x36e15a2c6ULL },
+  { 9492, 0x13e1a82a2ULL },
+  { 9493, 0x52e6a61a3ULL },
+  { 9494, 0x52e3a61a6ULL },
+  { 9495, 0x9e51c3c2ULL },
+  { 9496, 0x663e2c381ULL },
+  { 9497, 0x12e33d396ULL },
+  { 9498, 0x52e91a3c2ULL },
+  { 9499, 0x56e3a13c2ULL },
+  { 9500, 0x82e01a3c6ULL },
+  { 9501, 0x83e5a13a2ULL },
+  { 9502, 0x12e61a3a2ULL },
+  { 9503, 0x93e2a13a6ULL },
+  { 9504, 0x72e81c51ULL },
+  { 9505, 0x627e6c121ULL },
+  { 9506, 0x627e11c66ULL },
+  { 9507, 0x98e5a21c7ULL },
+  { 9508, 0x17e26a9c1ULL },
+  { 9509, 0x17e9c1a26ULL },
+  { 9510, 0x72e8a21a7ULL },
+  { 9511, 0x17e2a26a7ULL },
+  { 9512, 0x92e61a7a6ULL },
+  { 9513, 0x72e31d153ULL },
+  { 9514, 0x67e83c2c1ULL },
+  { 9515, 0x91e33d726ULL },
+  { 9516, 0x73e7a51c2ULL },
+  { 9517, 0x33e7a62c1ULL },
+  { 9518, 0x57e3a21c6ULL },
+  { 9519, 0x32e1a51a7ULL },
+  { 9520, 0x62e3a61a7ULL },
+  { 9521, 0x62e31a7a6ULL },
+  { 9522, 0x918e3c372ULL },
+  { 9523, 0x87e62c3c1ULL },
+  { 9525, 0x17e1a53c2ULL },
+  { 9526, 0x96e7a13c2ULL },
+  { 9527, 0x26e7a316ULL },
+  { 9528, 0x93e1c23a7ULL },
+  { 9529, 0x67e52c3a1ULL },
+  { 9530, 0x62e71a3a6ULL },
+  { 9531, 0x528e57c11ULL },
+  { 9532, 0x672e672c1ULL },
+  { 9533, 0x81e9d72c6ULL },
+  { 9534, 0x19e7a7c21ULL },
+  { 9535, 0x68e2a7c21ULL },
+  { 9536, 0x57e2c7a16ULL },
+  { 9537, 0x78e5c71a2ULL },
+  { 9538, 0x62e7a71a2ULL },
+  { 9539, 0x52e2a71a6ULL },
+  { 9540, 0x318e172c3ULL },
+  { 9541, 0x678e37c21ULL },
+  { 9542, 0x81e2c7d36ULL },
+  { 9543, 0x39e2a7c31ULL },
+  { 9544, 0x32e1c7a61ULL },
+  { 9545, 0x11e2a7d36ULL },
+  { 9546, 0x53e7a72a1ULL },
+  { 9547, 0x63e8a72a1ULL },
+  { 9548, 0x32e1c71a6ULL },
+  { 9552, 0x57e1a73c2ULL },
+  { 9555, 0x373e273a1ULL },
+  { 9558, 0x18e2c5b19ULL },
+  { 9559, 0x52e69b121ULL },
+  { 9560, 0x12e8c5b16ULL },
+  { 9561, 0x81e2a9b52ULL },
+  { 9562, 0x61e2a2b61ULL },
+  { 9563, 0x16e1a2b26ULL },
+  { 9567, 0x32e89b121ULL },
+  { 9568, 0x96e35b221ULL },
+  { 9569, 0x32e13b9c6ULL },
+  { 9570, 0x12e3a3b12ULL },
+  { 9571, 0x62e1a3b82ULL },
+  { 9572, 0x12e32a8b6ULL },
+  { 9576, 0x89e52b321ULL },
+  { 9577, 0x19e26b351ULL },
+  { 9578, 0x816e5b326ULL },
+  { 9579, 0x92e13a3b1ULL },
+  { 9580, 0x62e82a3b1ULL },
+  { 9581, 0x51e21a3b6ULL },
+  { 9585, 0x77e25b921ULL },
+  { 9586, 0x96e85b721ULL },
+  { 9587, 0x716e8b526ULL },
+  { 9588, 0x12e7a5b91ULL },
+  { 9589, 0x67e18a7b2ULL },
+  { 9590, 0x16e2a8b76ULL },
+  { 9594, 0x73e19b821ULL },
+  { 9595, 0x76e27b931ULL },
+  { 9596, 0x92e31b7c6ULL },
+  { 9597, 0x12e72a9b3ULL },
+  { 9598, 0x72e23a6b1ULL },
+  { 9599, 0x73e23a1b6ULL },
+  { 9603, 0x37e05b321ULL },
+  { 9604, 0x79e62b321ULL },
+  { 9605, 0x716e6b326ULL },
+  { 9606, 0x72e92a3b1ULL },
+  { 9607, 0x61e71a3b2ULL },
+  { 9608, 0x2e71a3b6ULL },
+  { 9612, 0x57e1c7b28ULL },
+  { 9613, 0x1e6c7b25ULL },
+  { 9614, 0x55e1c7b26ULL },
+  { 9615, 0x91e5a7b12ULL },
+  { 9616, 0x68e2a7b19ULL },
+  { 9617, 0x65e2a7b16ULL },
+  { 9621, 0x11e3c7b23ULL },
+  { 9622, 0x61e1c7b32ULL },
+  { 9623, 0x31e7c7b26ULL },
+  { 9624, 0x32e9a7b12ULL },
+  { 9625, 0x62e2a7b13ULL },
+  { 9639, 0x12e8b1c92ULL },
+  { 9640, 0x61e6b1c22ULL },
+  { 9641, 0x16e2b5b86ULL },
+  { 9642, 0x81e9b2a52ULL },
+  { 9643, 0x61e2b6a21ULL },
+  { 9644, 0x85e5b2a16ULL },
+  { 9645, 0x81e9b52a2ULL },
+  { 9646, 0x61e2b61a2ULL },
+  { 9647, 0x91e8b12a6ULL },
+  { 9648, 0x32e8b1c13ULL },
+  { 9649, 0x32e3b1c62ULL },
+  { 9650, 0x36e2b1c56ULL },
+  { 9651, 0x12e3b3a12ULL },
+  { 9652, 0x62e3b8a12ULL },
+  { 9653, 0x6e3b2a16ULL },
+  { 9654, 0x12e3b91a5ULL },
+  { 9655, 0x62e3b12a8ULL },
+  { 9656, 0x32e1b81a6ULL },
+  { 9657, 0x92e1b03c1ULL },
+  { 9658, 0x62e5b13c1ULL },
+  { 9663, 0x82e5b13a2ULL },
+  { 9664, 0x82e6b33a1ULL },
+  { 9665, 0x92e8b13a6ULL },
+  { 9666, 0x71e7b2c21ULL },
+  { 9667, 0x76e5b1c27ULL },
+  { 9668, 0x76e2b1c96ULL },
+  { 9669, 0x72e1b1a72ULL },
+  { 9670, 0x67e7b1a28ULL },
+  { 9671, 0x76e1b6a26ULL },
+  { 9672, 0x72e1b12a7ULL },
+  { 9673, 0x77e6b18a2ULL },
+  { 9674, 0x91e7b02a6ULL },
+  { 9675, 0x72e8b1c53ULL },
+  { 9676, 0x31e7b6b62ULL },
+  { 9677, 0x67e2b31c6ULL },
+  { 9678, 0x72e1b3a52ULL },
+  { 9679, 0x72e6b2a13ULL },
+  { 9681, 0x12e7b32a5ULL },
+  { 9682, 0x71e6b02a3ULL },
+  { 9683, 0x71e2b31a6ULL },
+  { 9684, 0x72e5b23c1ULL },
+  { 9685, 0x72e6b33c1ULL },
+  { 9690, 0x72e5b13a1ULL },
+  { 9691, 0x62e7b23a1ULL },
+  { 9692, 0x73e1b23a6ULL },
+  { 9693, 0x71e5b7b92ULL },
+  { 9694, 0x82e6b71c2ULL },
+  { 9695, 0x15e2b7b06ULL },
+  { 9696, 0x12e5b7a91ULL },
+  { 9697, 0x19e2b7a68ULL },
+  { 9698, 0x86e1b7a26ULL },
+  { 9699, 0x12e5b71a9ULL },
+  { 9700, 0x86e1b76a2ULL },
+  { 9701, 0x17e2b76a6ULL },
+  { 9702, 0x35e1b72c2ULL },
+  { 9703, 0x1e6b7b32ULL },
+  { 9705, 0x92e1b7a32ULL },
+  { 9706, 0x61e3b7a21ULL },
+  { 9708, 0x12e3b71a7ULL },
+  { 9709, 0x61e3b71a2ULL },
+  { 9710, 0x2e3b71a6ULL },
+  { 9711, 0x92e8b73c1ULL },
+  { 9717, 0x83e1b73a2ULL },
+  { 9718, 0x63e2b73a1ULL },
+  { 9720, 0x84e21c4c1ULL },
+  { 9721, 0x624e624c1ULL },
+  { 9722, 0x426e1c426ULL },
+  { 9723, 0x48e2a14c2ULL },
+  { 9724, 0x62e8a4a41ULL },
+  { 9725, 0x81e2a4d46ULL },
+  { 9726, 0x42e2a81a4ULL },
+  { 9727, 0x62e8a41a4ULL },
+  { 9728, 0x42e6a21a6ULL },
+  { 9729, 0x483e23c21ULL },
+  { 9730, 0x628e314c2ULL },
+  { 9731, 0x413e2d826ULL },
+  { 9732, 0x34e5a91c2ULL },
+  { 9733, 0x43e6a41c2ULL },
+  { 9734, 0x346e2a146ULL },
+  { 9735, 0x43e9a42a1ULL },
+  { 9736, 0x32e3a61a4ULL },
+  { 9737, 0x32e3a41a6ULL },
+  { 9738, 0x324e1c324ULL },
+  { 9739, 0x86e2c43c1ULL },
+  { 9740, 0x42e21c3d6ULL },
+  { 9741, 0x14e53a3c2ULL },
+  { 9742, 0x462e1a362ULL },
+  { 9743, 0x426e1a326ULL },
+  { 9744, 0x14e1c93a2ULL },
+  { 9745, 0x64e14a3a2ULL },
+  { 9746, 0x15e24a3a6ULL },
+  { 9747, 0x827e25c41ULL },
+  { 9748, 0x868e7c421ULL },
+  { 9749, 0x447e21c26ULL },
+  { 9750, 0x15e2a2a74ULL },
+  { 9751, 0x72e7a6a41ULL },
+  { 9752, 0x17e2a5a46ULL },
+  { 9753, 0x15e2a24a7ULL },
+  { 9754, 0x72e71a6a4ULL },
+  { 9755, 0x42e7a11a6ULL },
+  { 9756, 0x434e712c2ULL },
+  { 9757, 0x433e2c761ULL },
+  { 9758, 0x703e2d416ULL },
+  { 9759, 0x14e7a2a23ULL },
+  { 9760, 0x43e7a6a12ULL },
+  { 9761, 0x136e7a426ULL },
+  { 9762, 0x14e23a2a7ULL },
+  { 9763, 0x43e6a12a7ULL },
+  { 9764, 0x43e72a1a6ULL },
+  { 9765, 0x71e2d43c1ULL },
+  { 9766, 0x643e2c371ULL },
+  { 9768, 0x74e14a3c2ULL },
+  { 9771, 0x14e2a23a7ULL },
+  { 9772, 0x76e12c3a4ULL },
+  { 9774, 0x49e2c74c1ULL },
+  { 9775, 0x468e27c21ULL },
+  { 9777, 0x19e7c7a24ULL },
+  { 9778, 0x42e6a7a11ULL },
+  { 9780, 0x14e2c71a7ULL },
+  { 9781, 0x42e6a71a1ULL },
+  { 9782, 0x42e1a71a6ULL },
+  { 9783, 0x843e471c2ULL },
+  { 9784, 0x643e371c2ULL },
+  { 9786, 0x14e3c7a02ULL },
+  { 9787, 0x43e6a7a12ULL },
+  { 9789, 0x31e3d72a4ULL },
+  { 9790, 0x43e6a72a1ULL },
+  { 9791, 0x43e1a72a6ULL },
+  { 9792, 0x47e2c73c1ULL },
+  { 9798, 0x4e2a73a1ULL },
+  { 9801, 0x44e18b521ULL },
+  { 9802, 0x44e28b621ULL },
+  { 9803, 0x45e8c1b26ULL },
+  { 9804, 0x41e2a2b41ULL },
+  { 9805, 0x41e61a4b2ULL },
+  { 9806, 0x45e2a9b16ULL },
+  { 9810, 0x33e1c9b24ULL },
+  { 9811, 0x43e68b021ULL },
+  { 9812, 0x34e9c2b16ULL },
+  { 9813, 0x43e2a9b14ULL },
+  { 9814, 0x42e6a3b12ULL },
+  { 9815, 0x46e3a1b26ULL },
+  { 9819, 0x43e98b321ULL },
+  { 9820, 0x16e24b301ULL },
+  { 9821, 0x916e4b326ULL },
+  { 9822, 0x31e21a3b4ULL },
+  { 9823, 0x42e62a3b1ULL },
+  { 9824, 0x42e12a3b6ULL },
+  { 9828, 0x74e87b521ULL },
+  { 9829, 0x67e27b841ULL },
+  { 9830, 0x716e4b126ULL },
+  { 9831, 0x41e7a5b21ULL },
+  { 9832, 0x64e14a2b7ULL },
+  { 9833, 0x74e24a1b6ULL },
+  { 9837, 0x43e78b121ULL },
+  { 9838, 0x46e36b721ULL },
+  { 9839, 0x726e4b136ULL },
+  { 9840, 0x13e8a4b72ULL },
+  { 9841, 0x73e24a6b1ULL },
+  { 9842, 0x14e73a2b6ULL },
+  { 9846, 0x87e54b321ULL },
+  { 9847, 0x77e64b321ULL },
+  { 9855, 0x71e1c7b42ULL },
+  { 9857, 0x74e2c7b16ULL },
+  { 9858, 0x41e9a7b21ULL },
+  { 9859, 0x14e6a7b24ULL },
+  { 9864, 0x42e1c7b13ULL },
+  { 9866, 0x14e3c7b26ULL },
+  { 9867, 0x42e1a7b03ULL },
+  { 9868, 0x63e2a7b14ULL },
+  { 9882, 0x51e9b1c42ULL },
+  { 9883, 0x81e6b1c42ULL },
+  { 9884, 0x46e2b1d66ULL },
+  { 9885, 0x14e2b2a14ULL },
+  { 9886, 0x61e2b4a41ULL },
+  { 9887, 0x45e9b2a16ULL },
+  { 9888, 0x14e2b14a2ULL },
+  { 9889, 0x91e6b42a1ULL },
+  { 9890, 0x42e1b91a6ULL },
+  { 9891, 0x42e8b1c23ULL },
+  { 9892, 0x33e6b2b14ULL },
+  { 9893, 0x31e2b4d06ULL },
+  { 9894, 0x42e8b1a13ULL },
+  { 9895, 0x92e6b4a13ULL },
+  { 9896, 0x36e2b4a16ULL },
+  { 9897, 0x81e9b42a3ULL },
+  { 9898, 0x46e1b36a2ULL },
+  { 9899, 0x42e3b12a6ULL },
+  { 9900, 0x42e9b33c1ULL },
+  { 9901, 0x42e6b03c1ULL },
+  { 9906, 0x53e1b43a2ULL },
+  { 9907, 0x92e6b43a1ULL },
+  { 9909, 0x78e1b44c2ULL },
+  { 9910, 0x61e7b4b72ULL },
+  { 9911, 0x45e7b1b26ULL },
+  { 9912, 0x71e2b4a51ULL },
+  { 9913, 0x64e7b2a15ULL },
+  { 9914, 0x17e2b9a46ULL },
+  { 9915, 0x71e2b41a5ULL },
+  { 9916, 0x14e7b64a2ULL },
+  { 9917, 0x74e1b24a6ULL },
+  { 9918, 0x43e7b1b24ULL },
+  { 9919, 0x72e6b1b43ULL },
+  { 9921, 0x42e7b1a03ULL },
+  { 9922, 0x73e6b2a14ULL },
+  { 9924, 0x37e2b47a1ULL },
+  { 9925, 0x73e6b24a1ULL },
+  { 9927, 0x42e7b13c1ULL },
+  { 9928, 0x76e1b43c2ULL },
+  { 9933, 0x42e7b03a1ULL },
+  { 9934, 0x14e2b63a7ULL },
+  { 9936, 0x41e7b7b82ULL },
+  { 9937, 0x61e1b7b42ULL },
+  { 9938, 0x45e1b7b26ULL },
+  { 9939, 0x2e1b7a41ULL },
+  { 9940, 0x64e2b7a14ULL },
+  { 9942, 0x2e1b71a4ULL },
+  { 9943, 0x64e2b74a1ULL },
+  { 9944, 0x15e2b74a6ULL },
+  { 9945, 0x41e3b7b42ULL },
+  { 9946, 0x62e1b7b43ULL },
+  { 9948, 0x3e1b7a42ULL },
+  { 9949, 0x14e2b7a63ULL },
+  { 9951, 0x3e1b72a4ULL },
+  { 9962, 0x14e2b73a6ULL },
+  { 9963, 0x42e42c1c1ULL },
+  { 9964, 0x61e41d422ULL },
+  { 9965, 0x81e4d21c6ULL },
+  { 9966, 0x4e4a2c81ULL },
+  { 9967, 0x68e4a14c2ULL },
+  { 9968, 0x66e4a1c26ULL },
+  { 9969, 0x92e4a42a1ULL },
+  { 9970, 0x62e4a81a4ULL },
+  { 9971, 0x2e41c1a6ULL },
+  { 9972, 0x81e4d42c3ULL },
+  { 9973, 0x61e42d483ULL },
+  { 9974, 0x34e41d206ULL },
+  { 9975, 0x12e4a3a41ULL },
+  { 9976, 0x63e4c6a21ULL },
+  { 9977, 0x3e42a1c6ULL },
+  { 9978, 0x13e4a42a3ULL },
+  { 9979, 0x62e4a91a3ULL },
+  { 9980, 0x32e4a31a6ULL },
+  { 9981, 0x48e41c3c2ULL },
+  { 9982, 0x61e4d23c2ULL },
+  { 9983, 0x82e41c3d6ULL },
+  { 9984, 0x2e41a3c2ULL },
+  { 9985, 0x63e4a23c1ULL },
+  { 9987, 0x91e41a3a2ULL },
+  { 9988, 0x11e4d63a2ULL },
+  { 9989, 0x41e4d23a6ULL },
+  { 9990, 0x81e4d1d27ULL },
+  { 9991, 0x82e4d61c7ULL },
+  { 9992, 0x84e41d276ULL },
+  { 9993, 0x72e4c2a91ULL },
+  { 9994, 0x67e4a6c21ULL },
+  { 9995, 0x76e4a2a16ULL },
+  { 9996, 0x72e4a91a4ULL },
+  { 9997, 0x17e46a5a2ULL },
+  { 9998, 0x72e41a7a6ULL },
+  { 9999, 0x12e43d417ULL },
+  { 10000, 0x31e47d269ULL },
+  { 10002, 0x72e4a1c32ULL },
+  { 10003, 0x76e4a3c12ULL },
+  { 10004, 0x17e4c2a36ULL },
+  { 10005, 0x73e43a2a1ULL },
+  { 10011, 0x72e42a3c1ULL },
+  { 10014, 0x73e4a23a1ULL },
+  { 10018, 0x61e4c7d82ULL },
+  { 10020, 0x4e4c7a21ULL },
+  { 10021, 0x62e4a7a51ULL },
+  { 10023, 0x82e4a71a7ULL },
+  { 10024, 0x62e4a71a5ULL },
+  { 10025, 0x72e4a71a6ULL },
+  { 10029, 0x32e4a7a21ULL },
+  { 10032, 0x32e4a71a2ULL },
+  { 10044, 0x54e48b921ULL },
+  { 10045, 0x16e46b521ULL },
+  { 10046, 0x92e4c8b16ULL },
+  { 10047, 0x12e4a4b12ULL },
+  { 10048, 0x91e4a6b12ULL },
+  { 10049, 0x12e42a9b6ULL },
+  { 10053, 0x13e4d4b23ULL },
+  { 10054, 0x68e43b021ULL },
+  { 10055, 0x35e4c2b16ULL },
+  { 10056, 0x13e4a1b82ULL },
+  { 10057, 0x62e43a9b1ULL },
+  { 10058, 0x36e4a2b16ULL },
+  { 10062, 0x98e42b311ULL },
+  { 10063, 0x96e45b321ULL },
+  { 10065, 0x31e41a3b2ULL },
+  { 10071, 0x17e45b521ULL },
+  { 10072, 0x67e44b021ULL },
+  { 10073, 0x82e41b7c6ULL },
+  { 10074, 0x71e42a8b1ULL },
+  { 10075, 0x17e46a2b9ULL },
+  { 10076, 0x17e4a2b96ULL },
+  { 10080, 0x78e43b121ULL },
+  { 10081, 0x36e46b721ULL },
+  { 10083, 0x82e43a7b1ULL },
+  { 10089, 0x97e42b301ULL },
+  { 10098, 0x41e4c7b24ULL },
+  { 10101, 0x71e4a7b02ULL },
+  { 10107, 0x32e4c7b15ULL },
+  { 10110, 0x82e4a7b13ULL },
+  { 10125, 0x2e4b1c42ULL },
+  { 10126, 0x61e4b2c01ULL },
+  { 10127, 0x85e4b1c26ULL },
+  { 10128, 0x12e4b4a12ULL },
+  { 10129, 0x41e4b6a21ULL },
+  { 10130, 0x95e4b2a16ULL },
+  { 10131, 0x12e4b42a1ULL },
+  { 10132, 0x62e4b92a1ULL },
+  { 10133, 0x41e4b21a6ULL },
+  { 10134, 0x32e4b1b82ULL },
+  { 10135, 0x62e4b3c01ULL },
+  { 10137, 0x92e4b2a13ULL },
+  { 10138, 0x32e4b6a12ULL },
+  { 10139, 0x16e4b3a26ULL },
+  { 10140, 0x91e4b02a3ULL },
+  { 10141, 0x16e4b36a2ULL },
+  { 10142, 0x32e4b12a6ULL },
+  { 10143, 0x82e4b23c1ULL },
+  { 10144, 0x62e4b03c1ULL },
+  { 10149, 0x92e4b23a1ULL },
+  { 10152, 0x87e4b14c2ULL },
+  { 10153, 0x86e4b27c1ULL },
+  { 10154, 0x75e4b1b26ULL },
+  { 10155, 0x71e4b9a21ULL },
+  { 10156, 0x96e4b2a17ULL },
+  { 10158, 0x97e4b28a1ULL },
+  { 10159, 0x96e4b27a1ULL },
+  { 10161, 0x32e4b1c72ULL },
+  { 10164, 0x17e4b3a27ULL },
+  { 10167, 0x17e4b37a2ULL },
+  { 10170, 0x72e4b13c1ULL },
+  { 10176, 0x72e4b03a1ULL },
+  { 10179, 0x8e4b7c21ULL },
+  { 10180, 0x51e4b7b62ULL },
+  { 10181, 0x15e4b7b26ULL },
+  { 10182, 0x51e4b7a21ULL },
+  { 10185, 0x51e4b71a2ULL },
+  { 10188, 0x32e4b72c1ULL },
+  { 10191, 0x13e4b7a82ULL },
+  { 10194, 0x13e4b72a8ULL },
+  { 10206, 0x511e8d029ULL },
+  { 10207, 0x801e2d612ULL },
+  { 10208, 0x21e5d006ULL },
+  { 10209, 0x181e29a98ULL },
+  { 10210, 0x811e22a69ULL },
+  { 10211, 0x151e98a26ULL },
+  { 10212, 0x121e911a2ULL },
+  { 10213, 0x161e951a2ULL },
+  { 10214, 0x521e911a6ULL },
+  { 10215, 0x951e2d813ULL },
+  { 10216, 0x811e2d632ULL },
+  { 10217, 0x321e5d516ULL },
+  { 10218, 0x511e38a23ULL },
+  { 10219, 0x521e68a93ULL },
+  { 10220, 0x351e29a16ULL },
+  { 10221, 0x131e921a2ULL },
+  { 10222, 0x561e361a2ULL },
+  { 10223, 0x921e321a6ULL },
+  { 10224, 0x21e8c3c5ULL },
+  { 10225, 0x121e3d363ULL },
+  { 10227, 0x131e8a321ULL },
+  { 10228, 0x621e3a321ULL },
+  { 10233, 0x521e7d578ULL },
+  { 10234, 0x721e6d267ULL },
+  { 10236, 0x901e22a78ULL },
+  { 10237, 0x161e28a97ULL },
+  { 10238, 0x711e55a26ULL },
+  { 10239, 0x521e811a7ULL },
+  { 10240, 0x961e761a2ULL },
+  { 10241, 0x721e121a6ULL },
+  { 10242, 0x971e2d853ULL },
+  { 10243, 0x621e3d873ULL },
+  { 10244, 0x721e5d536ULL },
+  { 10245, 0x911e23a78ULL },
+  { 10246, 0x321e73a68ULL },
+  { 10247, 0x21e75a36ULL },
+  { 10248, 0x931e731a2ULL },
+  { 10249, 0x321e611a7ULL },
+  { 10250, 0x321e711a6ULL },
+  { 10251, 0x921e7d309ULL },
+  { 10252, 0x621e6c3c7ULL },
+  { 10253, 0x621e7c3c6ULL },
+  { 10254, 0x21e7a311ULL },
+  { 10263, 0x71e87a29ULL },
+  { 10264, 0x101e67a52ULL },
+  { 10266, 0x971e771a2ULL },
+  { 10267, 0x871e671a2ULL },
+  { 10268, 0x871e271a6ULL },
+  { 10272, 0x31e87a25ULL },
+  { 10273, 0x921e67a35ULL },
+  { 10274, 0x531e37a26ULL },
+  { 10275, 0x371e271a1ULL },
+  { 10287, 0x121e8b921ULL },
+  { 10288, 0x611e9b521ULL },
+  { 10296, 0x311e9b221ULL },
+  { 10297, 0x921e6b531ULL },
+  { 10305, 0x811e5b321ULL },
+  { 10306, 0x161e2b361ULL },
+  { 10314, 0x711e8b521ULL },
+  { 10315, 0x761e2b961ULL },
+  { 10323, 0x821e7b531ULL },
+  { 10324, 0x921e7b631ULL },
+  { 10332, 0x171e2b371ULL },
+  { 10333, 0x711e6b321ULL },
+  { 10449, 0x411e2d822ULL },
+  { 10450, 0x421e4d694ULL },
+  { 10451, 0x551e4d026ULL },
+  { 10452, 0x921e58a44ULL },
+  { 10453, 0x601e22a48ULL },
+  { 10454, 0x21e65a46ULL },
+  { 10455, 0x151e941a2ULL },
+  { 10456, 0x21e611a4ULL },
+  { 10457, 0x21e411a6ULL },
+  { 10458, 0x401e3d213ULL },
+  { 10459, 0x431e2d862ULL },
+  { 10460, 0x351e4d216ULL },
+  { 10461, 0x521e28a34ULL },
+  { 10462, 0x631e48a25ULL },
+  { 10463, 0x301e24a16ULL },
+  { 10464, 0x341e241a1ULL },
+  { 10465, 0x31e621a4ULL },
+  { 10466, 0x31e421a6ULL },
+  { 10467, 0x141e3d324ULL },
+  { 10470, 0x421e1a321ULL },
+  { 10476, 0x181e4d427ULL },
+  { 10477, 0x601e7d247ULL },
+  { 10478, 0x751e4d826ULL },
+  { 10479, 0x911e74a27ULL },
+  { 10480, 0x811e24a67ULL },
+  { 10481, 0x901e74a26ULL },
+  { 10482, 0x941e741a2ULL },
+  { 10485, 0x731e2d472ULL },
+  { 10486, 0x761e2d433ULL },
+  { 10487, 0x371e4d296ULL },
+  { 10488, 0x721e44a38ULL },
+  { 10489, 0x601e43a27ULL },
+  { 10490, 0x721e46a36ULL },
+  { 10491, 0x131e721a4ULL },
+  { 10497, 0x721e4a321ULL },
+  { 10506, 0x911e77a24ULL },
+  { 10507, 0x421e87a64ULL },
+  { 10508, 0x41e87a26ULL },
+  { 10509, 0x471e271a2ULL },
+  { 10510, 0x671e471a2ULL },
+  { 10515, 0x511e37a24ULL },
+  { 10516, 0x601e47a23ULL },
+  { 10517, 0x431e27a26ULL },
+  { 10530, 0x421e5b921ULL },
+  { 10531, 0x611e8b421ULL },
+  { 10539, 0x931e3b241ULL },
+  { 10540, 0x621e4b031ULL },
+  { 10548, 0x911e4b321ULL },
+  { 10557, 0x741e5b251ULL },
+  { 10558, 0x861e4b271ULL },
+  { 10566, 0x721e4b131ULL },
+  { 10935, 0x5e5c82d82ULL },
+  { 10936, 0x8e8c62d62ULL },
+  { 10937, 0x6e2c22d66ULL },
+  { 10938, 0x9e5a22d88ULL },
+  { 10939, 0x9e8a62d62ULL },
+  { 10940, 0x8e5a2a6d6ULL },
+  { 10941, 0x9e22d88a5ULL },
+  { 10942, 0x8e22d66a5ULL },
+  { 10943, 0x9e22d66a6ULL },
+  { 10944, 0x8e32d29c2ULL },
+  { 10945, 0x6e23d69c2ULL },
+  { 10946, 0x3e232d696ULL },
+  { 10947, 0x5e3a92d85ULL },
+  { 10948, 0x9e2d6a2c3ULL },
+  { 10949, 0x5e2a32d96ULL },
+  { 10950, 0x8e3d9c2a2ULL },
+  { 10951, 0x8e3a2d6a2ULL },
+  { 10952, 0x9e3d3a2a6ULL },
+  { 10953, 0x9e2d2c3c3ULL },
+  { 10954, 0x3e2d6c3d3ULL },
+  { 10955, 0x6e23d23c6ULL },
+  { 10956, 0x5e2a3d3c3ULL },
+  { 10957, 0x9e2d6a3c2ULL },
+  { 10958, 0x6e2c2a3d6ULL },
+  { 10959, 0x8e2a3d3a5ULL },
+  { 10960, 0x9e2d6a3a3ULL },
+  { 10961, 0x9e2d2c3a6ULL },
+  { 10962, 0x8e7d5d082ULL },
+  { 10963, 0x6e6d7d252ULL },
+  { 10964, 0x7e7c26d26ULL },
+  { 10965, 0x9e7a2d2d8ULL },
+  { 10966, 0x9e7a62d25ULL },
+  { 10967, 0x7e6a26d26ULL },
+  { 10968, 0x9e2d2c7a2ULL },
+  { 10969, 0x7e6d6c5a2ULL },
+  { 10970, 0x9e62d87a6ULL },
+  { 10971, 0x7e32d32c7ULL },
+  { 10972, 0x3e262d687ULL },
+  { 10973, 0x3e522d576ULL },
+  { 10974, 0x5e3a7d7c2ULL },
+  { 10975, 0x5e3a63d27ULL },
+  { 10976, 0x3e2a76d76ULL },
+  { 10977, 0x7e3d9a2a2ULL },
+  { 10978, 0x7e3d6a2a3ULL },
+  { 10979, 0x7e32d32a6ULL },
+  { 10980, 0x7e23d23c7ULL },
+  { 10981, 0x6e7d7c3c2ULL },
+  { 10982, 0x7e7c2d3d6ULL },
+  { 10983, 0x9e2a7c3d3ULL },
+  { 10984, 0x7e6d6a3c2ULL },
+  { 10985, 0x7e3a2a3d6ULL },
+  { 10986, 0x5e7d7c3a2ULL },
+  { 10987, 0x7e3d6a3a2ULL },
+  { 10988, 0x7e23d23a6ULL },
+  { 10989, 0x5e72d72c5ULL },
+  { 10990, 0x6e92d78c2ULL },
+  { 10991, 0x6e72d72c6ULL },
+  { 10992, 0x8e7a27d27ULL },
+  { 10993, 0x6e5a27d27ULL },
+  { 10995, 0x5e92d78a2ULL },
+  { 10996, 0x6e72d72a5ULL },
+  { 10997, 0x7e72d72a6ULL },
+  { 10998, 0x3e72d72c3ULL },
+  { 11001, 0x3e2a07d07ULL },
+  { 11002, 0x3e2a67d67ULL },
+  { 11004, 0x3e72d72a2ULL },
+  { 11005, 0x3e76d76a2ULL },
+  { 11013, 0x3e73d73a2ULL },
+  { 11016, 0x5e582b092ULL },
+  { 11017, 0x6e9b2d6c5ULL },
+  { 11018, 0x8e2c92b66ULL },
+  { 11019, 0x5e2c2a8b9ULL },
+  { 11020, 0x6e2a5a9b8ULL },
+  { 11021, 0x5e2b9a8b6ULL },
+  { 11022, 0x5e2a8b2a9ULL },
+  { 11023, 0x9e6b2a8a5ULL },
+  { 11024, 0x9e5b6a2a6ULL },
+  { 11025, 0x3e2c82b95ULL },
+  { 11026, 0x6e2b58b39ULL },
+  { 11027, 0x3e236b536ULL },
+  { 11028, 0x3e2a2b5b8ULL },
+  { 11029, 0x9e6a2a2b3ULL },
+  { 11030, 0x3e5a2b6b6ULL },
+  { 11031, 0x9e3b2a2a8ULL },
+  { 11032, 0x6e3a2b2a3ULL },
+  { 11033, 0x3e2c6b9a6ULL },
+  { 11034, 0x8e592b303ULL },
+  { 11035, 0x6e6b2c3c2ULL },
+  { 11036, 0x8e8b2b3c6ULL },
+  { 11037, 0x9e8a2a3b2ULL },
+  { 11038, 0x6e2a5b3c3ULL },
+  { 11039, 0x9e2b8a3b6ULL },
+  { 11040, 0x5e9b2c3a8ULL },
+  { 11041, 0x8e6a3b3a2ULL },
+  { 11042, 0x8e3b2a3a6ULL },
+  { 11043, 0x7e597b208ULL },
+  { 11044, 0x7e2b78b69ULL },
+  { 11045, 0x7e2b85b76ULL },
+  { 11046, 0x7e2a2a5b8ULL },
+  { 11047, 0x6e2a5a8b7ULL },
+  { 11048, 0x7e2a5a6b6ULL },
+  { 11049, 0x7e5b2a2a8ULL },
+  { 11050, 0x6e9b6a2a7ULL },
+  { 11051, 0x6e9b7a2a6ULL },
+  { 11052, 0x3e927b237ULL },
+  { 11053, 0x6e3c32b57ULL },
+  { 11054, 0x9e2c72b36ULL },
+  { 11055, 0x7e3c2a2b3ULL },
+  { 11056, 0x6e2a8a7b3ULL },
+  { 11057, 0x7e3b6a2b6ULL },
+  { 11058, 0x9e3b3a2a7ULL },
+  { 11059, 0x7e6b2a8a3ULL },
+  { 11060, 0x7e3c2b7a6ULL },
+  { 11061, 0x5e2c3d3b7ULL },
+  { 11062, 0x7e682b392ULL },
+  { 11063, 0x9e7b2b3c6ULL },
+  { 11064, 0x9e7a3a3b2ULL },
+  { 11065, 0x7e6a3d3b2ULL },
+  { 11066, 0x8e7a2b3b6ULL },
+  { 11067, 0x7e5a3b3a2ULL },
+  { 11068, 0x6e7b2a3a8ULL },
+  { 11069, 0x7e5b2c3a6ULL },
+  { 11070, 0x9e7b27b88ULL },
+  { 11071, 0x7e6b27b58ULL },
+  { 11072, 0x5e72d72b6ULL },
+  { 11073, 0x9e2a57b28ULL },
+  { 11074, 0x6e6a27b27ULL },
+  { 11075, 0x5e9a27b86ULL },
+  { 11079, 0x3e3b27b87ULL },
+  { 11080, 0x6e3d27b03ULL },
+  { 11081, 0x3e92d78b6ULL },
+  { 11082, 0x3e2a87b97ULL },
+  { 11083, 0x3e2a57b67ULL },
+  { 11084, 0x3e9a27b66ULL },
+  { 11091, 0x3e83a73b2ULL },
+  { 11097, 0x8e05b2c92ULL },
+  { 11098, 0x8e56b9b28ULL },
+  { 11099, 0x5e25b9b66ULL },
+  { 11100, 0x9e58b2a29ULL },
+  { 11101, 0x6e28b2a68ULL },
+  { 11102, 0x6e85b2a26ULL },
+  { 11103, 0x9e58b29a2ULL },
+  { 11104, 0x8e65b26a2ULL },
+  { 11105, 0x5e92b82a6ULL },
+  { 11106, 0x5e23b2b93ULL },
+  { 11107, 0x6e52b2b33ULL },
+  { 11108, 0x3e26b3b86ULL },
+  { 11109, 0x9e82b5a23ULL },
+  { 11110, 0x6e32b6a32ULL },
+  { 11111, 0x9e35b2a06ULL },
+  { 11112, 0x3e29b39a2ULL },
+  { 11113, 0x6e95b36a2ULL },
+  { 11114, 0x9e32b62a6ULL },
+  { 11115, 0x9e55b23c2ULL },
+  { 11116, 0x9e36b63c2ULL },
+  { 11121, 0x9e82b23a5ULL },
+  { 11122, 0x6e53b93a2ULL },
+  { 11123, 0x5e33b23a6ULL },
+  { 11124, 0x8e97b5b29ULL },
+  { 11125, 0x6e76b2b57ULL },
+  { 11126, 0x9e65b2b76ULL },
+  { 11127, 0x9e57b2a28ULL },
+  { 11128, 0x9e86b5a27ULL },
+  { 11129, 0x7e55b2a06ULL },
+  { 11130, 0x9e57b28a2ULL },
+  { 11131, 0x9e86b57a2ULL },
+  { 11132, 0x7e72b82a6ULL },
+  { 11133, 0x7e98b3c23ULL },
+  { 11134, 0x6e86b2c73ULL },
+  { 11135, 0x3e72b2d06ULL },
+  { 11136, 0x7e72b2a23ULL },
+  { 11137, 0x6e97b2a38ULL },
+  { 11138, 0x7e36b8a26ULL },
+  { 11139, 0x8e37b97a2ULL },
+  { 11140, 0x6e96b27a3ULL },
+  { 11141, 0x3e27b96a6ULL },
+  { 11142, 0x7e35b03c2ULL },
+  { 11143, 0x7e36b53c2ULL },
+  { 11148, 0x7e52b03a2ULL },
+  { 11149, 0x7e62b03a3ULL },
+  { 11150, 0x9e72b03a6ULL },
+  { 11151, 0x8e75b7b27ULL },
+  { 11152, 0x9e65b7b27ULL },
+  { 11153, 0x7e25b7b66ULL },
+  { 11154, 0x9e52b7a72ULL },
+  { 11155, 0x7e62b7a62ULL },
+  { 11156, 0x5e26b7a06ULL },
+  { 11157, 0x9e52b72a7ULL },
+  { 11158, 0x8e62b72a7ULL },
+  { 11159, 0x8e52b72a6ULL },
+  { 11160, 0x8e73b7b25ULL },
+  { 11161, 0x3e62b7b63ULL },
+  { 11162, 0x3e25b7b26ULL },
+  { 11163, 0x7e32b7a32ULL },
+  { 11164, 0x6e03b7a92ULL },
+  { 11165, 0x6e36b7a26ULL },
+  { 11166, 0x3e92b72a5ULL },
+  { 11167, 0x3e26b75a8ULL },
+  { 11168, 0x3e03b72a6ULL },
+  { 11170, 0x9e56b73c2ULL },
+  { 11175, 0x9e03b73a2ULL },
+  { 11176, 0x6e33b73a2ULL },
+  { 11178, 0x4e4d2d8c4ULL },
+  { 11179, 0x4e8d8d652ULL },
+  { 11180, 0x4e4c26d26ULL },
+  { 11181, 0x8e4a2d2c4ULL },
+  { 11182, 0x6e2a2c4d8ULL },
+  { 11183, 0x5e2d4a2d6ULL },
+  { 11184, 0x9e2d2c5a4ULL },
+  { 11185, 0x6e2c4d8a2ULL },
+  { 11186, 0x9e4d4a2a6ULL },
+  { 11187, 0x4e322d298ULL },
+  { 11188, 0x6e2c3c4d4ULL },
+  { 11189, 0x3e802d426ULL },
+  { 11190, 0x5e3a22d44ULL },
+  { 11191, 0x6e4a32d64ULL },
+  { 11192, 0x6e4a23d46ULL },
+  { 11193, 0x9e2d4a4a3ULL },
+  { 11194, 0x4e43d86a2ULL },
+  { 11195, 0x8e32d64a6ULL },
+  { 11196, 0x4e2c3d3c2ULL },
+  { 11197, 0x6e4d4c3c2ULL },
+  { 11198, 0x4e2d4c3d6ULL },
+  { 11199, 0x4e2a3d3c2ULL },
+  { 11200, 0x6e4a3d3c2ULL },
+  { 11201, 0x8e4a2a3d6ULL },
+  { 11202, 0x5e4d4c3a2ULL },
+  { 11203, 0x6e4d4a3a2ULL },
+  { 11205, 0x7e7c4d2d8ULL },
+  { 11206, 0x7e7d6d492ULL },
+  { 11208, 0x7e5a22d44ULL },
+  { 11209, 0x7e6a42d42ULL },
+  { 11210, 0x7e4a02d06ULL },
+  { 11211, 0x7e4d4c2a5ULL },
+  { 11212, 0x7e6d6a4a2ULL },
+  { 11213, 0x7e42d42a6ULL },
+  { 11214, 0x3e852d477ULL },
+  { 11215, 0x4e2c83d67ULL },
+  { 11216, 0x3e422d276ULL },
+  { 11217, 0x7e3c2a4d4ULL },
+  { 11218, 0x7e4a23d69ULL },
+  { 11219, 0x7e5a23d46ULL },
+  { 11220, 0x7e4d8a2a3ULL },
+  { 11221, 0x7e23d69a4ULL },
+  { 11226, 0x7e4d4a3c2ULL },
+  { 11229, 0x7e2d4a3a2ULL },
+  { 11232, 0x4e72d72c4ULL },
+  { 11235, 0x5e4a27d27ULL },
+  { 11238, 0x5e72d72a4ULL },
+  { 11244, 0x4e3a27d27ULL },
+  { 11247, 0x4e72d72a3ULL },
+  { 11259, 0x4e2d28b54ULL },
+  { 11260, 0x6e2d68b94ULL },
+  { 11261, 0x4e2b26b86ULL },
+  { 11262, 0x4e9a2b5b2ULL },
+  { 11263, 0x6e8a2b4b4ULL },
+  { 11264, 0x4e2a2a6b6ULL },
+  { 11265, 0x9e2b4a2a5ULL },
+  { 11266, 0x4e8b6a2a4ULL },
+  { 11267, 0x4e6b2a2a6ULL },
+  { 11268, 0x3e2c32b94ULL },
+  { 11269, 0x6e2d45b33ULL },
+  { 11270, 0x4e3b5b2c6ULL },
+  { 11271, 0x3e2c2a5b4ULL },
+  { 11272, 0x6e2a5a4b3ULL },
+  { 11273, 0x3e4a2b5b6ULL },
+  { 11274, 0x3e5b2a2a4ULL },
+  { 11275, 0x6e3b3a2a4ULL },
+  { 11276, 0x3e4c2b5a6ULL },
+  { 11277, 0x4e932b342ULL },
+  { 11278, 0x4e2b6c3d3ULL },
+  { 11279, 0x4e2c3d3b6ULL },
+  { 11280, 0x4e2a3a3b2ULL },
+  { 11281, 0x6e2a8b3c4ULL },
+  { 11282, 0x4e3a2b3b6ULL },
+  { 11283, 0x4e4b3a3a2ULL },
+  { 11284, 0x6e2a4b3a5ULL },
+  { 11285, 0x4e3b2b3a6ULL },
+  { 11286, 0x7e574b284ULL },
+  { 11287, 0x6e2d28b74ULL },
+  { 11288, 0x8e7b74b26ULL },
+  { 11289, 0x4e7a4a9b2ULL },
+  { 11290, 0x7e7a4a6b2ULL },
+  { 11291, 0x7e4b7a2b6ULL },
+  { 11292, 0x7e4b5a2a4ULL },
+  { 11293, 0x7e6b2a4a7ULL },
+  { 11294, 0x7e7b4c2a6ULL },
+  { 11295, 0x7e4b23b34ULL },
+  { 11296, 0x7e2b46b37ULL },
+  { 11297, 0x7e726b436ULL },
+  { 11298, 0x7e2a4a2b3ULL },
+  { 11299, 0x3e7a6b2b4ULL },
+  { 11300, 0x7e3a2a4b6ULL },
+  { 11301, 0x7e2b3a2a4ULL },
+  { 11302, 0x7e2a4b6a3ULL },
+  { 11303, 0x7e4b3a2a6ULL },
+  { 11304, 0x7e4c2b3c5ULL },
+  { 11305, 0x7e632b342ULL },
+  { 11306, 0x4e7c2b3c6ULL },
+  { 11307, 0x7e4a3b3c2ULL },
+  { 11308, 0x6e2b7a3b4ULL },
+  { 11310, 0x8e4b2a3a7ULL },
+  { 11311, 0x7e4b6a3a2ULL },
+  { 11312, 0x7e4b2a3a6ULL },
+  { 11313, 0x8e2d47b54ULL },
+  { 11314, 0x7e4d67b62ULL },
+  { 11316, 0x4e2a27b47ULL },
+  { 11317, 0x4e2a47b67ULL },
+  { 11318, 0x4e9a27b76ULL },
+  { 11322, 0x3e2b47b97ULL },
+  { 11323, 0x3e4d67b22ULL },
+  { 11325, 0x4e2a37b57ULL },
+  { 11326, 0x3e62a72b4ULL },
+  { 11327, 0x3e42a72b6ULL },
+  { 11334, 0x4e93a73b2ULL },
+  { 11340, 0x4e45b92c2ULL },
+  { 11341, 0x6e49b52c4ULL },
+  { 11342, 0x4e82b2d46ULL },
+  { 11343, 0x9e02b5a42ULL },
+  { 11344, 0x4e48b6a28ULL },
+  { 11345, 0x4e46b6a26ULL },
+  { 11346, 0x9e02b52a4ULL },
+  { 11347, 0x4e26b85a8ULL },
+  { 11348, 0x8e42b62a6ULL },
+  { 11349, 0x4e33b5b24ULL },
+  { 11350, 0x4e03b2b63ULL },
+  { 11351, 0x3e46b2b96ULL },
+  { 11352, 0x4e23b2a43ULL },
+  { 11353, 0x4e43b6a23ULL },
+  { 11354, 0x3e36b4a26ULL },
+  { 11355, 0x4e33b92a8ULL },
+  { 11356, 0x3e36b46a2ULL },
+  { 11357, 0x5e42b32a6ULL },
+  { 11358, 0x9e95b43c2ULL },
+  { 11359, 0x6e46b53c2ULL },
+  { 11364, 0x4e23b43a2ULL },
+  { 11365, 0x4e43b63a2ULL },
+  { 11366, 0x4e23b03a6ULL },
+  { 11367, 0x9e78b4c42ULL },
+  { 11368, 0x4e67b2c04ULL },
+  { 11369, 0x7e42b2d26ULL },
+  { 11370, 0x9e77b2a48ULL },
+  { 11371, 0x4e47b6a27ULL },
+  { 11372, 0x7e95b4a26ULL },
+  { 11373, 0x7e97b48a2ULL },
+  { 11374, 0x7e96b47a2ULL },
+  { 11375, 0x4e27b07a6ULL },
+  { 11376, 0x7e47b2b38ULL },
+  { 11377, 0x7e56b42c3ULL },
+  { 11378, 0x7e45b2b36ULL },
+  { 11379, 0x7e23b4a53ULL },
+  { 11380, 0x7e32b6a42ULL },
+  { 11382, 0x7e83b24a3ULL },
+  { 11383, 0x7e32b62a4ULL },
+  { 11384, 0x7e32b42a6ULL },
+  { 11385, 0x4e27b83c2ULL },
+  { 11391, 0x7e92b43a2ULL },
+  { 11394, 0x9e58b74c2ULL },
+  { 11395, 0x7e62b7b04ULL },
+  { 11396, 0x5e25b7b46ULL },
+  { 11397, 0x4e28b7a97ULL },
+  { 11398, 0x6e52b7a42ULL },
+  { 11399, 0x5e46b7a26ULL },
+  { 11400, 0x4e28b77a9ULL },
+  { 11401, 0x5e46b76a2ULL },
+  { 11402, 0x9e42b72a6ULL },
+  { 11403, 0x4e72b7b83ULL },
+  { 11404, 0x5e42b7b63ULL },
+  { 11405, 0x4e25b7b36ULL },
+  { 11406, 0x3e42b7a02ULL },
+  { 11407, 0x6e42b7a32ULL },
+  { 11409, 0x8e32b72a4ULL },
+  { 11410, 0x6e42b72a3ULL },
+  { 11412, 0x4e07b73c2ULL },
+  { 11418, 0x5e43b73a2ULL },
+  { 11421, 0x4e24d48c2ULL },
+  { 11422, 0x4e242d869ULL },
+  { 11423, 0x6e24d24c6ULL },
+  { 11427, 0x4e24d48a2ULL },
+  { 11428, 0x4e64d29a2ULL },
+  { 11429, 0x8e24d48a6ULL },
+  { 11430, 0x3e24d24c3ULL },
+  { 11431, 0x4e34d68c2ULL },
+  { 11436, 0x5e24d48a3ULL },
+  { 11437, 0x3e64d64a2ULL },
+  { 11448, 0x4e74d49c2ULL },
+  { 11449, 0x4e442d679ULL },
+  { 11454, 0x4e74d49a2ULL },
+  { 11455, 0x7e64d29a5ULL },
+  { 11456, 0x7e24d24a6ULL },
+  { 11457, 0x3e342d927ULL },
+  { 11458, 0x3e242d627ULL },
+  { 11490, 0x3e74d74a2ULL },
+  { 11502, 0x5e442b942ULL },
+  { 11503, 0x6e842b452ULL },
+  { 11504, 0x4e246b646ULL },
+  { 11505, 0x5e94a25b8ULL },
+  { 11506, 0x6e24a04b4ULL },
+  { 11507, 0x8e24a04b6ULL },
+  { 11511, 0x5e342b842ULL },
+  { 11512, 0x6e342b942ULL },
+  { 11513, 0x3e246b546ULL },
+  { 11514, 0x3e44a34b2ULL },
+  { 11515, 0x5e64a34b2ULL },
+  { 11516, 0x5e24a34b6ULL },
+  { 11520, 0x9e442b352ULL },
+  { 11523, 0x9e54a83b2ULL },
+  { 11524, 0x9e24a63b3ULL },
+  { 11525, 0x9e24a93b6ULL },
+  { 11529, 0x7e742b452ULL },
+  { 11530, 0x7e64c2b99ULL },
+  { 11531, 0x5e246b746ULL },
+  { 11532, 0x7e94a44b2ULL },
+  { 11538, 0x3e742b052ULL },
+  { 11541, 0x3e84a25b7ULL },
+  { 11542, 0x6e74a34b2ULL },
+  { 11543, 0x7e34a24b6ULL },
+  { 11548, 0x7e642b352ULL },
+  { 11550, 0x7e34a83b2ULL },
+  { 11559, 0x4e94a74b2ULL },
+  { 11568, 0x3e84a74b2ULL },
+  { 11577, 0x8e24a73b3ULL },
+  { 11583, 0x4e24b2d29ULL },
+  { 11584, 0x8e44b2c62ULL },
+  { 11585, 0x8e94b5b26ULL },
+  { 11586, 0x4e84b2a05ULL },
+  { 11587, 0x6e84b2a25ULL },
+  { 11589, 0x4e84b05a2ULL },
+  { 11590, 0x6e64b05a2ULL },
+  { 11591, 0x4e24b04a6ULL },
+  { 11592, 0x3e34b2d29ULL },
+  { 11593, 0x5e34b2d69ULL },
+  { 11595, 0x3e34b4a24ULL },
+  { 11596, 0x6e94b3a25ULL },
+  { 11598, 0x3e34b44a2ULL },
+  { 11599, 0x9e64b35a2ULL },
+  { 11600, 0x5e34b24a6ULL },
+  { 11607, 0x4e24b83a8ULL },
+  { 11608, 0x3e24b63a9ULL },
+  { 11609, 0x3e24b93a6ULL },
+  { 11610, 0x7e94b2b85ULL },
+  { 11611, 0x6e74b2b55ULL },
+  { 11612, 0x9e74b6b26ULL },
+  { 11613, 0x7e04b5a24ULL },
+  { 11616, 0x7e04b54a2ULL },
+  { 11619, 0x7e34b2c52ULL },
+  { 11622, 0x7e34b8a24ULL },
+  { 11623, 0x7e24b6a34ULL },
+  { 11625, 0x8e74b35a2ULL },
+  { 11626, 0x6e34b24a7ULL },
+  { 11627, 0x7e24b34a6ULL },
+  { 11634, 0x3e24b83a7ULL },
+  { 11637, 0x9e24b7b85ULL },
+  { 11638, 0x6e84b72c2ULL },
+  { 11639, 0x9e64b7b26ULL },
+  { 11640, 0x5e24b7a04ULL },
+  { 11643, 0x5e44b74a2ULL },
+  { 11646, 0x3e24b7b25ULL },
+  { 11649, 0x3e24b7a83ULL },
+  { 11650, 0x6e34b7a24ULL },
+  { 11652, 0x8e24b74a3ULL },
+  { 11653, 0x6e34b74a2ULL },
+  { 11661, 0x3e24b73a8ULL },
+  { 11664, 0x8e511d029ULL },
+  { 11665, 0x9e6d2d801ULL },
+  { 11666, 0x5e221d016ULL },
+  { 11667, 0x5e2c2a1c1ULL },
+  { 11668, 0x8e2a6c1d1ULL },
+  { 11669, 0x8e2c1a1c6ULL },
+  { 11670, 0x9e2a2c1a5ULL },
+  { 11671, 0x6e2d8a1a1ULL },
+  { 11672, 0x8e2d2a1a6ULL },
+  { 11673, 0x8e5d3d021ULL },
+  { 11674, 0x6e3d9d261ULL },
+  { 11675, 0x1e3d12d36ULL },
+  { 11676, 0x5e2a3d9c1ULL },
+  { 11677, 0x6e2d6a1c3ULL },
+  { 11678, 0x5e3a13d26ULL },
+  { 11679, 0x8e3c1d2a2ULL },
+  { 11680, 0x6e3c1a2a1ULL },
+  { 11681, 0x8e31d62a6ULL },
+  { 11682, 0x1e321d321ULL },
+  { 11683, 0x9e2d6c3c1ULL },
+  { 11684, 0x1e326d326ULL },
+  { 11685, 0x5e2c1a3c1ULL },
+  { 11686, 0x6e2a1a3c1ULL },
+  { 11687, 0x5e2a1a3d6ULL },
+  { 11688, 0x8e3a1c3a2ULL },
+  { 11689, 0x6e2c1a3a1ULL },
+  { 11690, 0x8e61d23a6ULL },
+  { 11691, 0x8e7d2d211ULL },
+  { 11692, 0x6e721d267ULL },
+  { 11693, 0x1e726d726ULL },
+  { 11694, 0x7e2c1a1c5ULL },
+  { 11695, 0x7e6a2d2c1ULL },
+  { 11696, 0x7e2d2a1c6ULL },
+  { 11697, 0x7e5c1d1a2ULL },
+  { 11698, 0x7e2d2c6a1ULL },
+  { 11699, 0x7e21d21a6ULL },
+  { 11700, 0x3e921d783ULL },
+  { 11701, 0x3e62d1d87ULL },
+  { 11702, 0x3e702d126ULL },
+  { 11703, 0x7e2c3a1d1ULL },
+  { 11704, 0x7e5a31d62ULL },
+  { 11705, 0x7e5a13d26ULL },
+  { 11706, 0x7e3a1c2a2ULL },
+  { 11707, 0x7e3a2d6a1ULL },
+  { 11709, 0x1e372d372ULL },
+  { 11712, 0x7e2a2a3c1ULL },
+  { 11715, 0x7e2c1c3a1ULL },
+  { 11716, 0x7e2d6a3a1ULL },
+  { 11718, 0x1e72d72c1ULL },
+  { 11719, 0x6e91d75c2ULL },
+  { 11724, 0x5e91d75a2ULL },
+  { 11727, 0x3e92d78c1ULL },
+  { 11730, 0x3e2a17d17ULL },
+  { 11733, 0x3e71d71a2ULL },
+  { 11745, 0x1e9b5c1d2ULL },
+  { 11746, 0x5e691b102ULL },
+  { 11747, 0x1e9b25b26ULL },
+  { 11748, 0x1e9a5c2b2ULL },
+  { 11749, 0x6e2a1c1b5ULL },
+  { 11750, 0x1e2a5b2b6ULL },
+  { 11751, 0x1e5c2b2a9ULL },
+  { 11752, 0x5e6b1a8a2ULL },
+  { 11753, 0x9e2a1b2a6ULL },
+  { 11754, 0x8e2b12b13ULL },
+  { 11755, 0x6e6b31b52ULL },
+  { 11756, 0x3e2c1b1b6ULL },
+  { 11757, 0x3e2a1b1b3ULL },
+  { 11758, 0x6e8a3b1b2ULL },
+  { 11759, 0x5e3a1b2d6ULL },
+  { 11760, 0x9e3a1b2a5ULL },
+  { 11761, 0x3e6b1a6a2ULL },
+  { 11762, 0x3e5b2c1a6ULL },
+  { 11763, 0x8e591b302ULL },
+  { 11764, 0x1e63d63b2ULL },
+  { 11765, 0x8e516b326ULL },
+  { 11766, 0x1e2a1b3b3ULL },
+  { 11767, 0x1e6b8a3b2ULL },
+  { 11768, 0x1e2b1a3d6ULL },
+  { 11769, 0x5e2b1a3a3ULL },
+  { 11770, 0x1e6b2c3a1ULL },
+  { 11771, 0x8e2b1a3a6ULL },
+  { 11772, 0x7e9b1d8c2ULL },
+  { 11773, 0x5e6c21b77ULL },
+  { 11774, 0x7e2b25b16ULL },
+  { 11775, 0x1e7a5b2b1ULL },
+  { 11776, 0x1e2a7b6c1ULL },
+  { 11777, 0x1e2a1d7b6ULL },
+  { 11778, 0x7e5a1b2a1ULL },
+  { 11779, 0x6e7b6c2a1ULL },
+  { 11780, 0x1e7c2b9a6ULL },
+  { 11781, 0x1e3c71b25ULL },
+  { 11782, 0x7e6b31b62ULL },
+  { 11783, 0x1e3c22b76ULL },
+  { 11784, 0x3e7a5b1b2ULL },
+  { 11785, 0x3e7a6c1b2ULL },
+  { 11786, 0x7e3a2c1b6ULL },
+  { 11787, 0x7e7a3b1a2ULL },
+  { 11788, 0x6e3b7c1a2ULL },
+  { 11789, 0x7e2b3c1a6ULL },
+  { 11790, 0x8e517b327ULL },
+  { 11791, 0x7e691b302ULL },
+  { 11792, 0x7e616b326ULL },
+  { 11793, 0x1e7b9a3b2ULL },
+  { 11794, 0x6e7c1a3b2ULL },
+  { 11795, 0x7e23a13b6ULL },
+  { 11796, 0x7e2a1b3a3ULL },
+  { 11798, 0x7e2c1b3a6ULL },
+  { 11799, 0x9e2b17b28ULL },
+  { 11800, 0x1e6b27b97ULL },
+  { 11802, 0x1e8a97b27ULL },
+  { 11803, 0x6e5a17b27ULL },
+  { 11804, 0x1e8a27b56ULL },
+  { 11808, 0x1e3d87b72ULL },
+  { 11809, 0x3e2b17b67ULL },
+  { 11811, 0x1e52a72b3ULL },
+  { 11812, 0x6e23a72b1ULL },
+  { 11817, 0x1e73d73b2ULL },
+  { 11820, 0x1e92a73b9ULL },
+  { 11821, 0x1e63a73b2ULL },
+  { 11822, 0x1e23a73b6ULL },
+  { 11826, 0x1e82b1c92ULL },
+  { 11827, 0x9e61b1c52ULL },
+  { 11828, 0x9e25b1c16ULL },
+  { 11829, 0x8e51b1a22ULL },
+  { 11830, 0x5e02b6a91ULL },
+  { 11831, 0x8e55b2a16ULL },
+  { 11832, 0x8e51b22a1ULL },
+  { 11833, 0x1e06b95a2ULL },
+  { 11834, 0x9e81b12a6ULL },
+  { 11835, 0x3e82b1c13ULL },
+  { 11836, 0x3e32b1c62ULL },
+  { 11837, 0x9e35b1d26ULL },
+  { 11838, 0x9e32b1a13ULL },
+  { 11839, 0x9e82b6a13ULL },
+  { 11840, 0x3e06b2a16ULL },
+  { 11841, 0x9e51b12a3ULL },
+  { 11842, 0x6e91b22a3ULL },
+  { 11843, 0x5e31b21a6ULL },
+  { 11844, 0x8e32b13c1ULL },
+  { 11845, 0x6e52b13c1ULL },
+  { 11850, 0x8e52b23a1ULL },
+  { 11851, 0x8e62b13a3ULL },
+  { 11852, 0x9e82b13a6ULL },
+  { 11853, 0x7e71b2c21ULL },
+  { 11854, 0x7e56b1c27ULL },
+  { 11855, 0x7e55b1c26ULL },
+  { 11856, 0x7e91b1a52ULL },
+  { 11857, 0x6e77b1a28ULL },
+  { 11858, 0x6e75b2a16ULL },
+  { 11859, 0x7e91b12a5ULL },
+  { 11860, 0x7e67b18a2ULL },
+  { 11861, 0x9e71b02a6ULL },
+  { 11862, 0x7e82b1c53ULL },
+  { 11863, 0x7e31b6b62ULL },
+  { 11864, 0x6e27b31c6ULL },
+  { 11865, 0x7e72b3a13ULL },
+  { 11866, 0x7e62b2a13ULL },
+  { 11868, 0x3e72b92a1ULL },
+  { 11869, 0x7e61b02a3ULL },
+  { 11870, 0x7e21b31a6ULL },
+  { 11871, 0x7e52b23c1ULL },
+  { 11872, 0x7e62b33c1ULL },
+  { 11877, 0x7e52b13a1ULL },
+  { 11878, 0x6e72b23a1ULL },
+  { 11879, 0x1e73b23a6ULL },
+  { 11880, 0x9e52b71c2ULL },
+  { 11881, 0x6e21b7b52ULL },
+  { 11882, 0x1e25b7b06ULL },
+  { 11883, 0x1e52b7a91ULL },
+  { 11884, 0x6e02b7a91ULL },
+  { 11885, 0x6e26b7a16ULL },
+  { 11886, 0x1e52b71a9ULL },
+  { 11887, 0x6e02b71a9ULL },
+  { 11888, 0x1e27b76a6ULL },
+  { 11889, 0x1e35b72c2ULL },
+  { 11890, 0x6e01b7b32ULL },
+  { 11892, 0x3e32b7a91ULL },
+  { 11893, 0x6e31b7a21ULL },
+  { 11895, 0x3e52b72a1ULL },
+  { 11896, 0x6e31b71a2ULL },
+  { 11897, 0x3e02b71a6ULL },
+  { 11898, 0x9e82b73c1ULL },
+  { 11904, 0x9e92b73a1ULL },
+  { 11905, 0x6e23b73a1ULL },
+  { 11907, 0x4e2d1d4c2ULL },
+  { 11908, 0x4e412d658ULL },
+  { 11909, 0x4e251d806ULL },
+  { 11910, 0x8e2c2a1d4ULL },
+  { 11911, 0x6e4c1a2d4ULL },
+  { 11912, 0x8e2d4a1c6ULL },
+  { 11913, 0x8e2a1c4a2ULL },
+  { 11914, 0x6e2d1d4a4ULL },
+  { 11915, 0x9e2d4a1a6ULL },
+  { 11916, 0x1e423d423ULL },
+  { 11917, 0x6e21d42c3ULL },
+  { 11918, 0x8e4c13d26ULL },
+  { 11919, 0x5e3a2d1d4ULL },
+  { 11920, 0x4e3d6a1c2ULL },
+  { 11921, 0x4e2a13d26ULL },
+  { 11922, 0x9e4c1a2a3ULL },
+  { 11923, 0x4e32d96a1ULL },
+  { 11925, 0x4e51d03c2ULL },
+  { 11926, 0x4e61d23c2ULL },
+  { 11927, 0x4e2c1c3d6ULL },
+  { 11928, 0x9e4a2a3c1ULL },
+  { 11930, 0x4e2c1a3d6ULL },
+  { 11931, 0x9e4c1a3a2ULL },
+  { 11932, 0x4e21d63a1ULL },
+  { 11934, 0x4e281d827ULL },
+  { 11935, 0x6e921d477ULL },
+  { 11936, 0x4e751d826ULL },
+  { 11937, 0x7e4a1a1d2ULL },
+  { 11938, 0x7e2d6a4c1ULL },
+  { 11939, 0x7e4a2d1d6ULL },
+  { 11940, 0x7e4c1a2a1ULL },
+  { 11941, 0x7e2d6c1a4ULL },
+  { 11943, 0x3e42d1d27ULL },
+  { 11945, 0x4e371d296ULL },
+  { 11946, 0x4e2a71d43ULL },
+  { 11947, 0x7e4a21d63ULL },
+  { 11948, 0x7e4a12d36ULL },
+  { 11949, 0x7e3c2d4a1ULL },
+  { 11952, 0x4e71d43c2ULL },
+  { 11958, 0x7e2d4c3a1ULL },
+  { 11959, 0x7e21d63a4ULL },
+  { 11961, 0x1e21d7d48ULL },
+  { 11967, 0x4e92d78a1ULL },
+  { 11988, 0x4e412b812ULL },
+  { 11989, 0x6e2d4b8c1ULL },
+  { 11990, 0x4e8b1d2c6ULL },
+  { 11991, 0x1e2b1a2b4ULL },
+  { 11992, 0x6e2a1a1b4ULL },
+  { 11993, 0x4e2a1b2d6ULL },
+  { 11994, 0x4e2b1a4a1ULL },
+  { 11995, 0x4e2b1b6a1ULL },
+  { 11996, 0x4e5b2a1a6ULL },
+  { 11997, 0x3e2c12b54ULL },
+  { 11998, 0x6e2c41b43ULL },
+  { 11999, 0x1e326b426ULL },
+  { 12000, 0x1e2a4c1b3ULL },
+  { 12001, 0x1e6a4c2b3ULL },
+  { 12002, 0x3e2a4b1b6ULL },
+  { 12003, 0x3e3c1b4a2ULL },
+  { 12004, 0x6e3b4c2a1ULL },
+  { 12005, 0x4e3b1b2a6ULL },
+  { 12006, 0x4e2b1d3c2ULL },
+  { 12007, 0x1e264b364ULL },
+  { 12008, 0x9e416b326ULL },
+  { 12009, 0x3e4c1a3b2ULL },
+  { 12010, 0x1e4b6a3b2ULL },
+  { 12011, 0x1e4b2a3b6ULL },
+  { 12012, 0x4e2c1b3a3ULL },
+  { 12013, 0x6e2b4a3a1ULL },
+  { 12014, 0x1e4c2b3a6ULL },
+  { 12015, 0x7e4b11b22ULL },
+  { 12016, 0x4e6b71b72ULL },
+  { 12017, 0x7e4b15b26ULL },
+  { 12018, 0x7e2c2a1b4ULL },
+  { 12019, 0x7e2a14b64ULL },
+  { 12020, 0x1e7b4a2b6ULL },
+  { 12021, 0x4e2c2b1a7ULL },
+  { 12022, 0x6e4b7a2a1ULL },
+  { 12023, 0x7e2b1b4a6ULL },
+  { 12024, 0x7e3c21b34ULL },
+  { 12025, 0x7e6b12b43ULL },
+  { 12026, 0x7e426b136ULL },
+  { 12027, 0x1e4a03b72ULL },
+  { 12028, 0x1e7a24b63ULL },
+  { 12029, 0x1e73a24b6ULL },
+  { 12033, 0x9e417b327ULL },
+  { 12034, 0x7e614b324ULL },
+  { 12036, 0x1e72a03b4ULL },
+  { 12042, 0x4e2b17b77ULL },
+  { 12043, 0x6e9d27b41ULL },
+  { 12045, 0x4e21a71b9ULL },
+  { 12046, 0x6e25a74b1ULL },
+  { 12047, 0x1e9a27b46ULL },
+  { 12051, 0x4e8d27b31ULL },
+  { 12052, 0x3e2d67b14ULL },
+  { 12054, 0x4e3a17b27ULL },
+  { 12069, 0x4e42b1c82ULL },
+  { 12070, 0x4e82b61c2ULL },
+  { 12071, 0x4e26b1d66ULL },
+  { 12072, 0x4e52b8a12ULL },
+  { 12073, 0x6e21b4a41ULL },
+  { 12074, 0x4e95b2a16ULL },
+  { 12075, 0x4e52b82a1ULL },
+  { 12076, 0x6e91b12a4ULL },
+  { 12077, 0x4e21b01a6ULL },
+  { 12078, 0x3e42b1b82ULL },
+  { 12079, 0x4e23b1c63ULL },
+  { 12080, 0x3e21b4d06ULL },
+  { 12081, 0x8e42b1a13ULL },
+  { 12082, 0x9e62b4a13ULL },
+  { 12083, 0x3e26b4a16ULL },
+  { 12084, 0x3e42b91a8ULL },
+  { 12085, 0x1e46b36a2ULL },
+  { 12086, 0x4e32b12a6ULL },
+  { 12087, 0x9e42b33c1ULL },
+  { 12088, 0x6e42b03c1ULL },
+  { 12093, 0x8e42b13a1ULL },
+  { 12094, 0x9e62b43a1ULL },
+  { 12096, 0x4e71b4b52ULL },
+  { 12097, 0x4e76b1b27ULL },
+  { 12098, 0x7e45b1b26ULL },
+  { 12099, 0x4e71b2a91ULL },
+  { 12100, 0x9e46b2a17ULL },
+  { 12101, 0x1e27b9a46ULL },
+  { 12102, 0x4e71b21a9ULL },
+  { 12103, 0x9e46b27a1ULL },
+  { 12105, 0x3e42b1c72ULL },
+  { 12106, 0x7e62b1b43ULL },
+  { 12108, 0x7e42b1a03ULL },
+  { 12109, 0x7e63b2a14ULL },
+  { 12111, 0x3e27b47a1ULL },
+  { 12112, 0x7e63b24a1ULL },
+  { 12114, 0x7e42b13c1ULL },
+  { 12115, 0x1e76b43c2ULL },
+  { 12120, 0x7e42b03a1ULL },
+  { 12123, 0x7e41b7b82ULL },
+  { 12124, 0x4e61b7b72ULL },
+  { 12125, 0x1e45b7b26ULL },
+  { 12126, 0x4e42b7a12ULL },
+  { 12127, 0x1e25b7a64ULL },
+  { 12129, 0x4e42b72a1ULL },
+  { 12131, 0x1e25b74a6ULL },
+  { 12132, 0x4e21b7b32ULL },
+  { 12133, 0x1e62b7b43ULL },
+  { 12135, 0x1e03b7a42ULL },
+  { 12138, 0x1e03b72a4ULL },
+  { 12150, 0x4e841d295ULL },
+  { 12151, 0x1e642d642ULL },
+  { 12152, 0x1e246d246ULL },
+  { 12159, 0x1e243d243ULL },
+  { 12160, 0x3e241d624ULL },
+  { 12165, 0x3e24d48a1ULL },
+  { 12166, 0x3e64d29a1ULL },
+  { 12168, 0x1e342d342ULL },
+  { 12177, 0x5e241d017ULL },
+  { 12178, 0x6e741d288ULL },
+  { 12186, 0x4e341d275ULL },
+  { 12231, 0x1e842b942ULL },
+  { 12232, 0x6e241b841ULL },
+  { 12233, 0x9e246b156ULL },
+  { 12234, 0x1e94a05b2ULL },
+  { 12235, 0x6e54a14b2ULL },
+  { 12240, 0x9e341b251ULL },
+  { 12241, 0x1e64d29b3ULL },
+  { 12243, 0x3e24a14b2ULL },
+  { 12249, 0x1e241b341ULL },
+  { 12251, 0x1e246b346ULL },
+  { 12252, 0x9e04a23b1ULL },
+  { 12258, 0x7e442b152ULL },
+  { 12259, 0x1e642b742ULL },
+  { 12261, 0x8e74a14b2ULL },
+  { 12262, 0x6e74a24b1ULL },
+  { 12263, 0x7e24a14b6ULL },
+  { 12267, 0x1e34c2b78ULL },
+  { 12276, 0x1e247b347ULL },
+  { 12280, 0x7e24a63b1ULL },
+  { 12285, 0x1e74d74b2ULL },
+  { 12289, 0x1e64a74b2ULL },
+  { 12290, 0x1e24a74b6ULL },
+  { 12307, 0x6e24a73b1ULL },
+  { 12312, 0x4e84b1c25ULL },
+  { 12313, 0x6e24b1c84ULL },
+  { 12315, 0x4e94b2a15ULL },
+  { 12316, 0x5e24b6a14ULL },
+  { 12318, 0x8e54b25a1ULL },
+  { 12319, 0x1e64b54a2ULL },
+  { 12320, 0x5e24b14a6ULL },
+  { 12321, 0x3e24b1c54ULL },
+  { 12322, 0x6e24b3c61ULL },
+  { 12324, 0x1e04b9a23ULL },
+  { 12327, 0x3e04b24a1ULL },
+  { 12336, 0x1e04b93a2ULL },
+  { 12339, 0x5e24b1c74ULL },
+  { 12340, 0x1e74b2d69ULL },
+  { 12342, 0x7e24b8a14ULL },
+  { 12343, 0x1e74b6a24ULL },
+  { 12345, 0x7e24b84a1ULL },
+  { 12346, 0x6e74b25a1ULL },
+  { 12347, 0x1e74b24a6ULL },
+  { 12348, 0x9e24b3c71ULL },
+  { 12352, 0x1e24b6a73ULL },
+  { 12364, 0x1e24b63a7ULL },
+  { 12366, 0x5e24b74c1ULL },
+  { 12369, 0x1e84b7a24ULL },
+  { 12370, 0x6e24b7a14ULL },
+  { 12372, 0x1e84b74a2ULL },
+  { 12373, 0x6e24b74a1ULL },
+  { 12375, 0x9e24b71c3ULL },
+  { 12379, 0x1e24b7a63ULL },
+  { 12392, 0x1e24b73a6ULL },
+  { 12393, 0x8e1d2c2c2ULL },
+  { 12394, 0x1e1c62d62ULL },
+  { 12395, 0x6e1c2d2c6ULL },
+  { 12396, 0x5e1a2c2c1ULL },
+  { 12397, 0x8e1c6a2c1ULL },
+  { 12398, 0x8e1d2a1c6ULL },
+  { 12399, 0x5e1d2c2a1ULL },
+  { 12400, 0x8e1d1c6a2ULL },
+  { 12401, 0x8e1d2c1a6ULL },
+  { 12402, 0x1e1c32d32ULL },
+  { 12403, 0x6e1d3c1c2ULL },
+  { 12404, 0x3e1c12d36ULL },
+  { 12405, 0x5e1c3a1d2ULL },
+  { 12406, 0x3e1a31d62ULL },
+  { 12407, 0x6e1c3a2d6ULL },
+  { 12408, 0x5e1c1d2a3ULL },
+  { 12409, 0x6e1c3a1a2ULL },
+  { 12410, 0x8e13d26a6ULL },
+  { 12412, 0x6e1d2c3c1ULL },
+  { 12413, 0x3e112d336ULL },
+  { 12414, 0x5e1c2a3d9ULL },
+  { 12415, 0x6e1a2a3c1ULL },
+  { 12416, 0x5e1a2a3d6ULL },
+  { 12417, 0x8e1c3a3a2ULL },
+  { 12418, 0x6e1c2a3a1ULL },
+  { 12420, 0x1e1c72d72ULL },
+  { 12421, 0x6e1c21d27ULL },
+  { 12423, 0x7e1d2a5c1ULL },
+  { 12424, 0x7e1a2d6c2ULL },
+  { 12425, 0x7e1a2d2c6ULL },
+  { 12426, 0x7e1d5c1a2ULL },
+  { 12428, 0x7e1c2d2a6ULL },
+  { 12429, 0x3e1c72d18ULL },
+  { 12430, 0x3e1c62d87ULL },
+  { 12432, 0x7e1a3c2c1ULL },
+  { 12433, 0x3e1a63d27ULL },
+  { 12434, 0x7e1a3a2d6ULL },
+  { 12435, 0x7e1c3c2a1ULL },
+  { 12436, 0x7e1a2d6a3ULL },
+  { 12438, 0x3e172d318ULL },
+  { 12439, 0x3e162d387ULL },
+  { 12441, 0x7e1a2c3c1ULL },
+  { 12444, 0x7e1c2c3a1ULL },
+  { 12447, 0x1e1c27d27ULL },
+  { 12453, 0x9e11d77a2ULL },
+  { 12474, 0x9e1b1d5c2ULL },
+  { 12475, 0x6e1d2b1b9ULL },
+  { 12476, 0x5e1c2d2b6ULL },
+  { 12477, 0x8e1a2c1b9ULL },
+  { 12478, 0x6e1c2a1b5ULL },
+  { 12479, 0x5e1a2c1b6ULL },
+  { 12480, 0x9e1b8c1a2ULL },
+  { 12481, 0x6e1b1c2a5ULL },
+  { 12482, 0x6e1b1b2a6ULL },
+  { 12483, 0x9e1c22b13ULL },
+  { 12484, 0x9e1d62b53ULL },
+  { 12485, 0x3e1c2b1b6ULL },
+  { 12486, 0x3e1a3a2b1ULL },
+  { 12487, 0x8e1a6a2b3ULL },
+  { 12488, 0x8e1a3a2b6ULL },
+  { 12489, 0x5e1b3a2a1ULL },
+  { 12490, 0x5e1c3b6a2ULL },
+  { 12491, 0x5e1c3b2a6ULL },
+  { 12492, 0x1e1d2b3c1ULL },
+  { 12493, 0x6e1b2b3c3ULL },
+  { 12494, 0x1e1c2b3b6ULL },
+  { 12495, 0x8e1a2b3c3ULL },
+  { 12496, 0x5e1c6a3b2ULL },
+  { 12497, 0x5e1c2a3b6ULL },
+  { 12498, 0x1e1b3b3a2ULL },
+  { 12499, 0x6e1b2c3a1ULL },
+  { 12500, 0x8e1a2b3a6ULL },
+  { 12501, 0x7e1d9b8c2ULL },
+  { 12502, 0x6e1b7b7c2ULL },
+  { 12503, 0x7e1c55b26ULL },
+  { 12504, 0x7e1b2a1b7ULL },
+  { 12505, 0x6e1a2c1b7ULL },
+  { 12506, 0x7e1c2a1b6ULL },
+  { 12507, 0x7e1b1a5a2ULL },
+  { 12508, 0x7e1b6c1a2ULL },
+  { 12509, 0x7e1b2c1a6ULL },
+  { 12510, 0x8e1c72b53ULL },
+  { 12511, 0x9e1d72b63ULL },
+  { 12512, 0x5e13c2b76ULL },
+  { 12513, 0x3e1b7a5b2ULL },
+  { 12514, 0x3e1c7a6b2ULL },
+  { 12515, 0x7e1c3a2b6ULL },
+  { 12516, 0x7e1b3c2a2ULL },
+  { 12517, 0x6e1c3b7a2ULL },
+  { 12519, 0x7e1c2b3c3ULL },
+  { 12522, 0x7e1c8a3b2ULL },
+  { 12523, 0x6e1c7a3b2ULL },
+  { 12525, 0x7e1b3a3a2ULL },
+  { 12527, 0x7e1c2b3a6ULL },
+  { 12528, 0x7e1c27b97ULL },
+  { 12529, 0x6e1c67b28ULL },
+  { 12531, 0x8e1a27b97ULL },
+  { 12532, 0x6e18a77b2ULL },
+  { 12537, 0x3e1c97b28ULL },
+  { 12538, 0x3e1b27b67ULL },
+  { 12540, 0x5e13a72b1ULL },
+  { 12541, 0x6e13a72b2ULL },
+  { 12555, 0x8e12b1c92ULL },
+  { 12556, 0x5e12b62c1ULL },
+  { 12557, 0x6e15b5b26ULL },
+  { 12558, 0x5e12b8a81ULL },
+  { 12559, 0x6e12b9a81ULL },
+  { 12560, 0x6e16b5a26ULL },
+  { 12561, 0x5e12b81a8ULL },
+  { 12562, 0x9e16b86a2ULL },
+  { 12563, 0x1e12b61a6ULL },
+  { 12564, 0x1e12b3b52ULL },
+  { 12565, 0x8e12b6b53ULL },
+  { 12566, 0x8e15b3b26ULL },
+  { 12567, 0x1e13b9a32ULL },
+  { 12568, 0x3e12b8a61ULL },
+  { 12569, 0x3e16b2a26ULL },
+  { 12570, 0x1e13b92a3ULL },
+  { 12571, 0x3e12b61a8ULL },
+  { 12572, 0x3e12b81a6ULL },
+  { 12573, 0x9e12b03c1ULL },
+  { 12574, 0x5e16b33c2ULL },
+  { 12579, 0x9e13b23a8ULL },
+  { 12580, 0x6e13b53a2ULL },
+  { 12582, 0x7e12b1c82ULL },
+  { 12583, 0x6e17b2b97ULL },
+  { 12584, 0x7e15b2b06ULL },
+  { 12585, 0x5e12b9a71ULL },
+  { 12586, 0x6e17b5a27ULL },
+  { 12587, 0x7e16b6a26ULL },
+  { 12588, 0x5e12b91a7ULL },
+  { 12589, 0x6e17b57a2ULL },
+  { 12590, 0x7e11b21a6ULL },
+  { 12591, 0x7e12b5b33ULL },
+  { 12592, 0x3e17b2b67ULL },
+  { 12594, 0x7e12b5a32ULL },
+  { 12595, 0x7e13b6a23ULL },
+  { 12597, 0x7e12b52a3ULL },
+  { 12600, 0x5e17b83c2ULL },
+  { 12601, 0x1e17b63c2ULL },
+  { 12606, 0x8e13b23a7ULL },
+  { 12607, 0x7e13b63a2ULL },
+  { 12608, 0x7e13b23a6ULL },
+  { 12609, 0x7e11b7b52ULL },
+  { 12610, 0x6e12b72c1ULL },
+  { 12612, 0x5e12b7a91ULL },
+  { 12613, 0x6e12b7a02ULL },
+  { 12614, 0x8e16b7a26ULL },
+  { 12615, 0x5e12b71a9ULL },
+  { 12616, 0x8e16b76a2ULL },
+  { 12618, 0x5e11b7b32ULL },
+  { 12619, 0x8e12b7b63ULL },
+  { 12621, 0x1e13b7a52ULL },
+  { 12624, 0x1e13b72a5ULL },
+  { 12627, 0x3e17b73c2ULL },
+  { 12633, 0x8e13b73a2ULL },
+  { 12636, 0x4e1d1d2c2ULL },
+  { 12637, 0x4e1c42d69ULL },
+  { 12639, 0x5e1a2c2d4ULL },
+  { 12640, 0x6e1d4a2c1ULL },
+  { 12641, 0x4e1a2d1d6ULL },
+  { 12642, 0x8e1c2a4a2ULL },
+  { 12643, 0x6e1d1c4a2ULL },
+  { 12644, 0x8e1c2d4a6ULL },
+  { 12645, 0x3e1c41d24ULL },
+  { 12646, 0x4e1c3d6c2ULL },
+  { 12648, 0x3e1a2d1d4ULL },
+  { 12649, 0x4e1a21d63ULL },
+  { 12650, 0x4e1a12d36ULL },
+  { 12651, 0x3e1d4d4a2ULL },
+  { 12652, 0x4e1c3d6a2ULL },
+  { 12654, 0x3e182d348ULL },
+  { 12656, 0x4e1c2c3d6ULL },
+  { 12657, 0x4e1a2a3d3ULL },
+  { 12659, 0x4e1c2a3d6ULL },
+  { 12660, 0x9e1c4a3a2ULL },
+  { 12663, 0x4e1c81d27ULL },
+  { 12666, 0x7e1a4a2c1ULL },
+  { 12667, 0x4e1a62d87ULL },
+  { 12668, 0x7e1c4a2d6ULL },
+  { 12669, 0x7e1c2a1a4ULL },
+  { 12670, 0x7e1c2d6a4ULL },
+  { 12672, 0x3e1c42d27ULL },
+  { 12675, 0x7e1a2d4c3ULL },
+  { 12678, 0x7e12d48a3ULL },
+  { 12679, 0x7e12d36a4ULL },
+  { 12717, 0x4e1c2b2b8ULL },
+  { 12718, 0x6e1c81b42ULL },
+  { 12719, 0x4e1d2b1c6ULL },
+  { 12720, 0x4e1c4a2b2ULL },
+  { 12721, 0x4e1c6a4b2ULL },
+  { 12722, 0x4e1c2a4b6ULL },
+  { 12723, 0x4e1c2b4a2ULL },
+  { 12724, 0x4e1d4b6a2ULL },
+  { 12725, 0x4e1c4b2a6ULL },
+  { 12726, 0x3e1c93b24ULL },
+  { 12727, 0x6e1d42b03ULL },
+  { 12728, 0x4e13d26b6ULL },
+  { 12729, 0x3e1a2c1b4ULL },
+  { 12730, 0x6e1a4a2b3ULL },
+  { 12731, 0x3e1a26b46ULL },
+  { 12732, 0x4e1b2d4a3ULL },
+  { 12733, 0x4e1b3b6a2ULL },
+  { 12734, 0x4e1b3b2a6ULL },
+  { 12735, 0x4e1c2b3c2ULL },
+  { 12738, 0x4e1c5a3b2ULL },
+  { 12739, 0x4e1b6a3b2ULL },
+  { 12740, 0x4e1b2a3b6ULL },
+  { 12741, 0x4e1b1c3a2ULL },
+  { 12742, 0x6e1a2b3a4ULL },
+  { 12744, 0x7e1b2c1d4ULL },
+  { 12745, 0x7e1b4b6c2ULL },
+  { 12746, 0x7e1b45b26ULL },
+  { 12747, 0x4e1c7a5b2ULL },
+  { 12748, 0x4e1a2a6b7ULL },
+  { 12749, 0x7e1b4a2b6ULL },
+  { 12750, 0x7e1c4b9a2ULL },
+  { 12751, 0x6e1a4b7a2ULL },
+  { 12752, 0x7e1b2b4a6ULL },
+  { 12753, 0x4e1c72b13ULL },
+  { 12754, 0x7e1b62b43ULL },
+  { 12755, 0x4e12c3b76ULL },
+  { 12756, 0x7e1a42b03ULL },
+  { 12757, 0x7e1a63b24ULL },
+  { 12771, 0x4e1c87b28ULL },
+  { 12772, 0x4e1c27b67ULL },
+  { 12774, 0x4e1a27b57ULL },
+  { 12775, 0x6e15a74b2ULL },
+  { 12783, 0x8e13a72b4ULL },
+  { 12798, 0x5e19b4c42ULL },
+  { 12799, 0x6e11b4b12ULL },
+  { 12800, 0x1e16b2b46ULL },
+  { 12801, 0x1e12b8a41ULL },
+  { 12802, 0x4e12b9a61ULL },
+  { 12803, 0x5e16b4a26ULL },
+  { 12804, 0x1e12b81a4ULL },
+  { 12805, 0x9e12b62a4ULL },
+  { 12806, 0x4e12b91a6ULL },
+  { 12807, 0x3e12b4b82ULL },
+  { 12808, 0x6e12b4b13ULL },
+  { 12809, 0x1e13b2d46ULL },
+  { 12810, 0x1e13b4a82ULL },
+  { 12811, 0x6e12b4a32ULL },
+  { 12812, 0x4e16b3a26ULL },
+  { 12813, 0x1e13b82a4ULL },
+  { 12814, 0x4e16b36a2ULL },
+  { 12815, 0x4e13b92a6ULL },
+  { 12822, 0x4e13b33a2ULL },
+  { 12825, 0x9e17b4c02ULL },
+  { 12826, 0x7e11b6b42ULL },
+  { 12827, 0x7e15b4b26ULL },
+  { 12828, 0x7e12b4a42ULL },
+  { 12831, 0x5e17b47a2ULL },
+  { 12834, 0x4e13b2b73ULL },
+  { 12835, 0x7e12b6b43ULL },
+  { 12837, 0x4e17b3a27ULL },
+  { 12840, 0x4e17b37a2ULL },
+  { 12844, 0x7e16b43c2ULL },
+  { 12852, 0x4e17b7b28ULL },
+  { 12853, 0x6e11b7b42ULL },
+  { 12854, 0x4e15b7b26ULL },
+  { 12855, 0x4e12b7a81ULL },
+  { 12858, 0x4e12b71a8ULL },
+  { 12861, 0x4e12b7b23ULL },
+  { 12862, 0x6e12b7b43ULL },
+  { 12864, 0x4e13b7a82ULL },
+  { 12867, 0x4e13b72a8ULL },
+  { 12879, 0x1e142d142ULL },
+  { 12880, 0x4e142d469ULL },
+  { 12885, 0x4e14d28a2ULL },
+  { 12886, 0x6e14d28a4ULL },
+  { 12887, 0x8e14d28a6ULL },
+  { 12889, 0x6e14d28c3ULL },
+  { 12894, 0x3e14d28a1ULL },
+  { 12897, 0x3e141d324ULL },
+  { 12912, 0x7e14d28a5ULL },
+  { 12924, 0x3e142d327ULL },
+  { 12960, 0x9e142b052ULL },
+  { 12961, 0x4e14c2b68ULL },
+  { 12962, 0x1e146b246ULL },
+  { 12963, 0x1e14a24b2ULL },
+  { 12965, 0x5e14a24b6ULL },
+  { 12969, 0x1e14d28b3ULL },
+  { 12972, 0x3e14a04b2ULL },
+  { 12981, 0x9e14a43b2ULL },
+  { 12987, 0x7e142b842ULL },
+  { 12988, 0x6e142b742ULL },
+  { 12990, 0x7e14a24b8ULL },
+  { 12991, 0x6e14a24b7ULL },
+  { 13009, 0x7e14a63b2ULL },
+  { 13036, 0x6e14a73b2ULL },
+  { 13041, 0x1e14b1c24ULL },
+  { 13042, 0x6e14b2b94ULL },
+  { 13044, 0x5e14b4a24ULL },
+  { 13045, 0x6e14b5a24ULL },
+  { 13047, 0x5e14b44a2ULL },
+  { 13048, 0x6e14b54a2ULL },
+  { 13050, 0x3e14b2c22ULL },
+  { 13051, 0x3e14b2b64ULL },
+  { 13053, 0x3e14b2a24ULL },
+  { 13056, 0x3e14b24a2ULL },
+  { 13068, 0x7e14b4c21ULL },
+  { 13069, 0x7e14b2d69ULL },
+  { 13071, 0x8e14b2a74ULL },
+  { 13072, 0x7e14b6a24ULL },
+  { 13074, 0x8e14b24a7ULL },
+  { 13075, 0x7e14b64a2ULL },
+  { 13076, 0x7e14b24a6ULL },
+  { 13095, 0x4e14b7b25ULL },
+  { 13098, 0x8e14b7a24ULL },
+  { 13101, 0x8e14b74a2ULL },
+  { 15309, 0x25e2d25c2ULL },
+  { 15310, 0x295e2c692ULL },
+  { 15311, 0x22e2c6d66ULL },
+  { 15312, 0x29e5c2a28ULL },
+  { 15313, 0x26e8c5a22ULL },
+  { 15314, 0x28e9a8a56ULL },
+  { 15315, 0x29e5a28a5ULL },
+  { 15316, 0x28e8a96a5ULL },
+  { 15317, 0x22e5d08a6ULL },
+  { 15318, 0x29e2d8c32ULL },
+  { 15319, 0x235e2c662ULL },
+  { 15320, 0x22e03d066ULL },
+  { 15321, 0x25e5a8a93ULL },
+  { 15322, 0x26e9c3a53ULL },
+  { 15323, 0x29e9c3a56ULL },
+  { 15324, 0x25e2d89a3ULL },
+  { 15325, 0x23e3d96a9ULL },
+  { 15326, 0x25e2c32a6ULL },
+  { 15327, 0x23e2d23c2ULL },
+  { 15328, 0x256e623c2ULL },
+  { 15329, 0x25e62c3d6ULL },
+  { 15330, 0x203e9a392ULL },
+  { 15331, 0x26e83a3c8ULL },
+  { 15332, 0x236e9a326ULL },
+  { 15333, 0x25e8a53a9ULL },
+  { 15334, 0x23e62a3a3ULL },
+  { 15335, 0x25e8a83a6ULL },
+  { 15336, 0x27e2d27c2ULL },
+  { 15337, 0x275e62c22ULL },
+  { 15338, 0x252e7c6c6ULL },
+  { 15339, 0x28e5a5a27ULL },
+  { 15340, 0x27e6a9a75ULL },
+  { 15341, 0x27e7a5a06ULL },
+  { 15342, 0x29e8a97a5ULL },
+  { 15343, 0x27e6a95a7ULL },
+  { 15344, 0x27e95a7a6ULL },
+  { 15345, 0x25e3d87c2ULL },
+  { 15346, 0x269e73c62ULL },
+  { 15348, 0x283e7a573ULL },
+  { 15349, 0x25e7a9a63ULL },
+  { 15350, 0x27e3c2a66ULL },
+  { 15351, 0x28e3a27a7ULL },
+  { 15352, 0x27e7a26a3ULL },
+  { 15353, 0x28e3a37a6ULL },
+  { 15354, 0x27e27c3d3ULL },
+  { 15355, 0x276e633c2ULL },
+  { 15356, 0x27e3d63c6ULL },
+  { 15357, 0x208e9a397ULL },
+  { 15358, 0x27e6a33c2ULL },
+  { 15359, 0x276e9a366ULL },
+  { 15360, 0x25e7a83a7ULL },
+  { 15361, 0x273e563a7ULL },
+  { 15362, 0x27e2c33a6ULL },
+  { 15363, 0x22e7d77c2ULL },
+  { 15364, 0x255e672c2ULL },
+  { 15365, 0x26e7d7c26ULL },
+  { 15366, 0x27e8a7a75ULL },
+  { 15367, 0x29e6c7a05ULL },
+  { 15368, 0x28e9a7a66ULL },
+  { 15369, 0x27e8a75a7ULL },
+  { 15370, 0x286e576a7ULL },
+  { 15371, 0x27e9a75a6ULL },
+  { 15372, 0x23e8c7d82ULL },
+  { 15374, 0x27e8c7d36ULL },
+  { 15375, 0x28e7c7a33ULL },
+  { 15376, 0x27e6c7a03ULL },
+  { 15377, 0x27e3a7a26ULL },
+  { 15378, 0x28e2a77a3ULL },
+  { 15379, 0x26e2a75a3ULL },
+  { 15382, 0x257e673c2ULL },
+  { 15384, 0x28e8a73c2ULL },
+  { 15387, 0x283e573a7ULL },
+  { 15388, 0x25e6a73a9ULL },
+  { 15389, 0x283e673a6ULL },
+  { 15390, 0x25e8c5b29ULL },
+  { 15391, 0x26e9c2b08ULL },
+  { 15392, 0x25e8c2b86ULL },
+  { 15393, 0x29e5a2b98ULL },
+  { 15394, 0x26e65a2b8ULL },
+  { 15395, 0x28e58a9b6ULL },
+  { 15399, 0x23e2c9b05ULL },
+  { 15400, 0x23e9c6b68ULL },
+  { 15401, 0x226e8b036ULL },
+  { 15402, 0x23e8a5b92ULL },
+  { 15403, 0x23e6a9b53ULL },
+  { 15404, 0x26e5a3b06ULL },
+  { 15411, 0x25e35a3b2ULL },
+  { 15412, 0x26e36a3b2ULL },
+  { 15413, 0x23e92a3b6ULL },
+  { 15417, 0x22e7c9b58ULL },
+  { 15418, 0x26e7c5b79ULL },
+  { 15419, 0x22e9c5b76ULL },
+  { 15420, 0x28e57a2b9ULL },
+  { 15421, 0x27e6a6b27ULL },
+  { 15422, 0x27e9a5b86ULL },
+  { 15426, 0x23e9c5b77ULL },
+  { 15427, 0x25e8c3b67ULL },
+  { 15428, 0x25e5c3b76ULL },
+  { 15429, 0x27e3a3b27ULL },
+  { 15430, 0x26e7a3b85ULL },
+  { 15431, 0x27e9a3b66ULL },
+  { 15438, 0x27e37a3b2ULL },
+  { 15439, 0x26e85a3b7ULL },
+  { 15440, 0x27e96a3b6ULL },
+  { 15444, 0x22e5c7b75ULL },
+  { 15445, 0x26e2c7b67ULL },
+  { 15446, 0x25e2c7b66ULL },
+  { 15447, 0x25e7a7b25ULL },
+  { 15449, 0x26e7a7b26ULL },
+  { 15453, 0x25e3c7b37ULL },
+  { 15454, 0x22e2c7b63ULL },
+  { 15455, 0x26e7d7b36ULL },
+  { 15456, 0x23e7a7b23ULL },
+  { 15457, 0x22e6a7b32ULL },
+  { 15458, 0x26e6a7b36ULL },
+  { 15471, 0x29e8b5c02ULL },
+  { 15472, 0x25e6b92c2ULL },
+  { 15473, 0x26e5b2b96ULL },
+  { 15474, 0x29e2b9a58ULL },
+  { 15475, 0x26e2b8a65ULL },
+  { 15476, 0x26e9b6a56ULL },
+  { 15477, 0x29e2b98a5ULL },
+  { 15478, 0x26e2b65a8ULL },
+  { 15479, 0x26e2b85a6ULL },
+  { 15480, 0x23e5b2b93ULL },
+  { 15481, 0x28e6b5b39ULL },
+  { 15482, 0x26e3b3b86ULL },
+  { 15483, 0x23e5b9a82ULL },
+  { 15484, 0x23e9b6a53ULL },
+  { 15485, 0x26e3b5a06ULL },
+  { 15486, 0x23e5b92a8ULL },
+  { 15487, 0x26e9b36a8ULL },
+  { 15488, 0x23e2b82a6ULL },
+  { 15489, 0x25e8b03c2ULL },
+  { 15490, 0x26e2b23c2ULL },
+  { 15495, 0x23e9b83a3ULL },
+  { 15496, 0x23e9b63a5ULL },
+  { 15497, 0x23e6b23a6ULL },
+  { 15498, 0x27e2b5b97ULL },
+  { 15499, 0x26e9b5b67ULL },
+  { 15500, 0x25e9b6b76ULL },
+  { 15501, 0x28e2b9a57ULL },
+  { 15502, 0x27e6b6a27ULL },
+  { 15503, 0x27e5b9a86ULL },
+  { 15504, 0x28e2b57a9ULL },
+  { 15505, 0x27e2b96a5ULL },
+  { 15506, 0x27e2b86a6ULL },
+  { 15507, 0x27e3b3b87ULL },
+  { 15508, 0x27e5b6b38ULL },
+  { 15509, 0x25e7b3b26ULL },
+  { 15510, 0x27e3b3a27ULL },
+  { 15511, 0x28e3b9a67ULL },
+  { 15512, 0x26e7b6a36ULL },
+  { 15513, 0x27e3b37a2ULL },
+  { 15514, 0x26e3b85a7ULL },
+  { 15515, 0x27e3b96a6ULL },
+  { 15516, 0x29e7b33c3ULL },
+  { 15517, 0x27e6b93c2ULL },
+  { 15522, 0x23e7b03a9ULL },
+  { 15523, 0x23e7b63a3ULL },
+  { 15524, 0x23e7b33a6ULL },
+  { 15525, 0x27e8b7b78ULL },
+  { 15526, 0x26e7b7b67ULL },
+  { 15527, 0x25e7b7b66ULL },
+  { 15528, 0x29e2b7a78ULL },
+  { 15529, 0x26e2b7a75ULL },
+  { 15530, 0x26e5b7a06ULL },
+  { 15531, 0x28e2b77a7ULL },
+  { 15532, 0x26e7b76a2ULL },
+  { 15534, 0x22e8b7b73ULL },
+  { 15535, 0x22e6b7b53ULL },
+  { 15536, 0x25e3b7b26ULL },
+  { 15537, 0x23e3b7a82ULL },
+  { 15538, 0x26e3b7a85ULL },
+  { 15539, 0x26e8b7a36ULL },
+  { 15540, 0x28e3b77a8ULL },
+  { 15541, 0x26e8b76a3ULL },
+  { 15543, 0x27e2b73c2ULL },
+  { 15549, 0x23e7b73a2ULL },
+  { 15552, 0x242e2d484ULL },
+  { 15553, 0x298e644c2ULL },
+  { 15554, 0x24e6d24c6ULL },
+  { 15555, 0x29e2a54c2ULL },
+  { 15556, 0x26e2c9a44ULL },
+  { 15557, 0x28e9c2a46ULL },
+  { 15558, 0x24e5a92a8ULL },
+  { 15559, 0x26e6a84a8ULL },
+  { 15560, 0x29e28a4a6ULL },
+  { 15561, 0x298e322c4ULL },
+  { 15562, 0x23e8d46c4ULL },
+  { 15563, 0x23e2c4d46ULL },
+  { 15564, 0x253e8a443ULL },
+  { 15565, 0x24e6c3a42ULL },
+  { 15566, 0x246e8a436ULL },
+  { 15567, 0x24e03a8a4ULL },
+  { 15568, 0x25e6a34a3ULL },
+  { 15569, 0x29e2c34a6ULL },
+  { 15570, 0x298e4c322ULL },
+  { 15571, 0x296e643c2ULL },
+  { 15572, 0x24e5d53c6ULL },
+  { 15573, 0x205e9a394ULL },
+  { 15574, 0x24e63a3c2ULL },
+  { 15575, 0x246e9a336ULL },
+  { 15576, 0x24e53a3a4ULL },
+  { 15577, 0x24e6a23a4ULL },
+  { 15578, 0x243e633a6ULL },
+  { 15579, 0x252e9c7c4ULL },
+  { 15580, 0x27e6c2d42ULL },
+  { 15581, 0x27e9c8d46ULL },
+  { 15582, 0x29e27a4c5ULL },
+  { 15583, 0x27e5c6a24ULL },
+  { 15584, 0x27e6a2a46ULL },
+  { 15585, 0x205e594a7ULL },
+  { 15586, 0x26e64a7a9ULL },
+  { 15587, 0x26e7a94a6ULL },
+  { 15588, 0x287e32c43ULL },
+  { 15589, 0x297e3c462ULL },
+  { 15591, 0x24e72a5c3ULL },
+  { 15592, 0x27e63a9c4ULL },
+  { 15593, 0x27e3c4a06ULL },
+  { 15594, 0x25e3a24a7ULL },
+  { 15595, 0x27e3a46a5ULL },
+  { 15596, 0x247e637a6ULL },
+  { 15597, 0x279e4c342ULL },
+  { 15598, 0x27e2d63c4ULL },
+  { 15600, 0x284e9a374ULL },
+  { 15601, 0x274e9a364ULL },
+  { 15603, 0x24e3a23a7ULL },
+  { 15604, 0x273e863a4ULL },
+  { 15606, 0x24e7d7c24ULL },
+  { 15607, 0x259e674c2ULL },
+  { 15609, 0x24e8a7a72ULL },
+  { 15610, 0x24e9a7a62ULL },
+  { 15612, 0x24e7a72a8ULL },
+  { 15613, 0x26e7a74a8ULL },
+  { 15614, 0x24e9a72a6ULL },
+  { 15615, 0x228e472c3ULL },
+  { 15618, 0x24e3a7a23ULL },
+  { 15621, 0x284e974a3ULL },
+  { 15630, 0x24e3a73a2ULL },
+  { 15633, 0x294e8b005ULL },
+  { 15634, 0x254e8b064ULL },
+  { 15635, 0x24e9c2b06ULL },
+  { 15636, 0x25e9a5b84ULL },
+  { 15637, 0x25e64a2b8ULL },
+  { 15638, 0x25e84a2b6ULL },
+  { 15642, 0x232e8b042ULL },
+  { 15643, 0x23e6c2b44ULL },
+  { 15644, 0x24e8c3b66ULL },
+  { 15645, 0x24e9a5b83ULL },
+  { 15646, 0x24e6a3b93ULL },
+  { 15647, 0x26e3a4b36ULL },
+  { 15654, 0x24e34a3b2ULL },
+  { 15655, 0x24e63a3b9ULL },
+  { 15656, 0x24e93a3b6ULL },
+  { 15660, 0x247e8b057ULL },
+  { 15661, 0x24e6c6b87ULL },
+  { 15662, 0x246e5b746ULL },
+  { 15663, 0x25e74a2b7ULL },
+  { 15664, 0x26e76a9b4ULL },
+  { 15665, 0x26e7a9b46ULL },
+  { 15669, 0x23e5c3b74ULL },
+  { 15670, 0x23e7c2b64ULL },
+  { 15671, 0x23e7c4b06ULL },
+  { 15672, 0x23e7a9b43ULL },
+  { 15673, 0x24e64a7b3ULL },
+  { 15674, 0x24e34a7b6ULL },
+  { 15681, 0x24e83a3b7ULL },
+  { 15687, 0x24e5c7b77ULL },
+  { 15688, 0x24e2c7b65ULL },
+  { 15689, 0x22e6c7b46ULL },
+  { 15690, 0x24e7a7b24ULL },
+  { 15692, 0x26e5a7b46ULL },
+  { 15696, 0x22e3c7b34ULL },
+  { 15697, 0x23e2c7b64ULL },
+  { 15698, 0x24e3c7b36ULL },
+  { 15699, 0x23e5a7b43ULL },
+  { 15700, 0x24e6a7b34ULL },
+  { 15714, 0x28e8b2c54ULL },
+  { 15715, 0x28e6b4c22ULL },
+  { 15716, 0x25e6b6b46ULL },
+  { 15717, 0x25e5b9a84ULL },
+  { 15718, 0x25e2b8a64ULL },
+  { 15719, 0x26e6b4a46ULL },
+  { 15720, 0x25e5b94a8ULL },
+  { 15721, 0x25e2b64a8ULL },
+  { 15722, 0x25e2b84a6ULL },
+  { 15723, 0x24e3b3b84ULL },
+  { 15724, 0x22e6b6b43ULL },
+  { 15725, 0x25e9b3b46ULL },
+  { 15726, 0x24e3b3a24ULL },
+  { 15727, 0x24e2b8a63ULL },
+  { 15728, 0x26e5b4a36ULL },
+  { 15729, 0x24e9b84a3ULL },
+  { 15730, 0x24e6b54a3ULL },
+  { 15731, 0x25e3b94a6ULL },
+  { 15733, 0x26e6b43c2ULL },
+  { 15738, 0x24e2b93a5ULL },
+  { 15739, 0x23e6b43a4ULL },
+  { 15740, 0x23e8b43a6ULL },
+  { 15741, 0x27e8b4c02ULL },
+  { 15742, 0x26e9b4b57ULL },
+  { 15743, 0x25e7b5b46ULL },
+  { 15744, 0x25e9b4a75ULL },
+  { 15745, 0x27e6b4a47ULL },
+  { 15746, 0x26e7b5a46ULL },
+  { 15747, 0x25e9b45a7ULL },
+  { 15748, 0x26e7b46a5ULL },
+  { 15749, 0x27e8b47a6ULL },
+  { 15750, 0x23e7b4b34ULL },
+  { 15751, 0x23e9b6b74ULL },
+  { 15752, 0x25e7b4b36ULL },
+  { 15753, 0x23e7b5a43ULL },
+  { 15754, 0x24e7b6a34ULL },
+  { 15756, 0x27e5b47a3ULL },
+  { 15757, 0x24e7b64a3ULL },
+  { 15758, 0x24e7b34a6ULL },
+  { 15765, 0x23e7b53a4ULL },
+  { 15768, 0x24e8b7b75ULL },
+  { 15769, 0x24e6b7b55ULL },
+  { 15770, 0x25e5b7b46ULL },
+  { 15771, 0x25e2b7a74ULL },
+  { 15773, 0x26e9b7a46ULL },
+  { 15774, 0x25e2b74a7ULL },
+  { 15775, 0x26e9b76a4ULL },
+  { 15777, 0x22e5b7b43ULL },
+  { 15778, 0x23e6b7b54ULL },
+  { 15780, 0x24e2b7a73ULL },
+  { 15783, 0x24e8b74a3ULL },
+  { 15792, 0x23e9b73a4ULL },
+  { 15795, 0x24e4d48c2ULL },
+  { 15796, 0x25e4d8c62ULL },
+  { 15797, 0x26e4d4c26ULL },
+  { 15798, 0x25e4a2c42ULL },
+  { 15799, 0x25e4a2a64ULL },
+  { 15800, 0x28e4c4a66ULL },
+  { 15801, 0x29e4a48a4ULL },
+  { 15802, 0x25e4a64a2ULL },
+  { 15803, 0x25e44a2a6ULL },
+  { 15804, 0x23e4c3d42ULL },
+  { 15805, 0x23e4d46c2ULL },
+  { 15806, 0x23e4c8d46ULL },
+  { 15807, 0x24e4c3a03ULL },
+  { 15808, 0x24e4a6a23ULL },
+  { 15809, 0x28e43a8c6ULL },
+  { 15810, 0x24e43a5a3ULL },
+  { 15811, 0x23e4a62a2ULL },
+  { 15812, 0x23e4a22a6ULL },
+  { 15813, 0x23e4d23c4ULL },
+  { 15816, 0x28e4a93c2ULL },
+  { 15818, 0x26e44a3c6ULL },
+  { 15819, 0x24e4a53a3ULL },
+  { 15820, 0x24e4a63a2ULL },
+  { 15821, 0x24e4a23a6ULL },
+  { 15822, 0x27e4d27c4ULL },
+  { 15823, 0x25e4c6d87ULL },
+  { 15824, 0x27e4d84c6ULL },
+  { 15825, 0x28e47a4c2ULL },
+  { 15826, 0x27e4c6a84ULL },
+  { 15827, 0x27e4c2a46ULL },
+  { 15828, 0x28e47a4a4ULL },
+  { 15829, 0x28e47a6a2ULL },
+  { 15830, 0x27e46a2a6ULL },
+  { 15831, 0x27e4c3d45ULL },
+  { 15832, 0x27e4d8c63ULL },
+  { 15834, 0x28e4c3a07ULL },
+  { 15835, 0x27e4c9a63ULL },
+  { 15836, 0x27e4c3a06ULL },
+  { 15837, 0x28e47a5a3ULL },
+  { 15838, 0x27e46a5a3ULL },
+  { 15840, 0x27e4d23c9ULL },
+  { 15841, 0x27e4d63c8ULL },
+  { 15843, 0x27e4a43c2ULL },
+  { 15845, 0x27e45a3c6ULL },
+  { 15846, 0x28e47a3a5ULL },
+  { 15847, 0x27e46a3a5ULL },
+  { 15852, 0x25e4c7a42ULL },
+  { 15854, 0x29e4c7a46ULL },
+  { 15859, 0x23e4c7d65ULL },
+  { 15862, 0x26e4c7a43ULL },
+  { 15876, 0x24e4c2b05ULL },
+  { 15877, 0x22e4c6b64ULL },
+  { 15878, 0x25e4c2b06ULL },
+  { 15879, 0x24e44a4b2ULL },
+  { 15880, 0x22e4a8b62ULL },
+  { 15881, 0x26e4a4b26ULL },
+  { 15885, 0x23e4c4b84ULL },
+  { 15886, 0x23e4c6b65ULL },
+  { 15887, 0x25e4c3b46ULL },
+  { 15888, 0x23e43a4b2ULL },
+  { 15889, 0x23e4a6b43ULL },
+  { 15890, 0x26e4a5b36ULL },
+  { 15903, 0x24e4c8b47ULL },
+  { 15904, 0x26e4c2b07ULL },
+  { 15906, 0x27e4a4b27ULL },
+  { 15907, 0x27e4a6b47ULL },
+  { 15908, 0x26e4a9b76ULL },
+  { 15912, 0x23e42b8c7ULL },
+  { 15913, 0x26e4c3b47ULL },
+  { 15915, 0x23e4a9b73ULL },
+  { 15930, 0x22e4c7b05ULL },
+  { 15931, 0x26e4c7b09ULL },
+  { 15933, 0x22e4a7b52ULL },
+  { 15935, 0x26e4a7b56ULL },
+  { 15941, 0x23e4c7b06ULL },
+  { 15942, 0x23e4a7b53ULL },
+  { 15957, 0x29e4b84c2ULL },
+  { 15958, 0x24e4b6b25ULL },
+  { 15959, 0x25e4b4b06ULL },
+  { 15960, 0x25e4b8a84ULL },
+  { 15961, 0x26e4b8a85ULL },
+  { 15962, 0x26e4b4a26ULL },
+  { 15963, 0x25e4b84a8ULL },
+  { 15964, 0x26e4b46a2ULL },
+  { 15965, 0x22e4b02a6ULL },
+  { 15966, 0x28e4b34c2ULL },
+  { 15967, 0x26e4b3c22ULL },
+  { 15968, 0x26e4b3b96ULL },
+  { 15969, 0x23e4b4a23ULL },
+  { 15970, 0x23e4b6a03ULL },
+  { 15971, 0x26e4b3a36ULL },
+  { 15972, 0x23e4b82a8ULL },
+  { 15973, 0x26e4b36a3ULL },
+  { 15975, 0x29e4b23c3ULL },
+  { 15976, 0x26e4b33c2ULL },
+  { 15981, 0x23e4b43a2ULL },
+  { 15983, 0x23e4b03a6ULL },
+  { 15984, 0x27e4b4b08ULL },
+  { 15985, 0x26e4b4b07ULL },
+  { 15987, 0x27e4b4a27ULL },
+  { 15988, 0x26e4b9a75ULL },
+  { 15989, 0x27e4b9a76ULL },
+  { 15990, 0x27e4b47a2ULL },
+  { 15991, 0x26e4b95a7ULL },
+  { 15992, 0x27e4b07a6ULL },
+  { 15993, 0x27e4b2c83ULL },
+  { 15996, 0x23e4b9a72ULL },
+  { 15999, 0x27e4b37a3ULL },
+  { 16002, 0x27e4b83c2ULL },
+  { 16008, 0x24e4b93a7ULL },
+  { 16014, 0x28e4b7a97ULL },
+  { 16015, 0x26e4b7a95ULL },
+  { 16016, 0x27e4b7a96ULL },
+  { 16017, 0x28e4b77a9ULL },
+  { 16018, 0x26e4b75a9ULL },
+  { 16020, 0x23e4b7b34ULL },
+  { 16021, 0x26e4b7b37ULL },
+  { 16022, 0x25e4b7b36ULL },
+  { 16023, 0x23e4b7a92ULL },
+  { 16026, 0x23e4b72a9ULL },
+  { 16035, 0x24e4b73a9ULL },
+  { 16038, 0x225e92c81ULL },
+  { 16039, 0x21e8d69c1ULL },
+  { 16040, 0x286e11c26ULL },
+  { 16041, 0x29e2a81c5ULL },
+  { 16042, 0x28e2a5c61ULL },
+  { 16043, 0x26e1c2a06ULL },
+  { 16044, 0x29e5c81a2ULL },
+  { 16045, 0x26e1a95a2ULL },
+  { 16046, 0x22e11a5a6ULL },
+  { 16047, 0x235e91c82ULL },
+  { 16048, 0x23e61c2c1ULL },
+  { 16049, 0x236e1c236ULL },
+  { 16050, 0x23e3a1d92ULL },
+  { 16051, 0x22e3a6a31ULL },
+  { 16052, 0x23e1a2d26ULL },
+  { 16053, 0x23e8a12a3ULL },
+  { 16054, 0x22e6a31a3ULL },
+  { 16055, 0x23e62c1a6ULL },
+  { 16056, 0x23e1c23c1ULL },
+  { 16057, 0x26e2c13c1ULL },
+  { 16058, 0x22e11c3d6ULL },
+  { 16059, 0x22e91a3d9ULL },
+  { 16060, 0x26e95a3c1ULL },
+  { 16061, 0x216e9a306ULL },
+  { 16062, 0x23e1d03a2ULL },
+  { 16063, 0x26e85a3a1ULL },
+  { 16064, 0x213e603a6ULL },
+  { 16065, 0x279e18c21ULL },
+  { 16066, 0x219e21c67ULL },
+  { 16067, 0x276e1d276ULL },
+  { 16068, 0x29e8a21c7ULL },
+  { 16069, 0x26e7a55c1ULL },
+  { 16070, 0x27e6c1a66ULL },
+  { 16071, 0x28e17a9a2ULL },
+  { 16072, 0x27e1a66a5ULL },
+  { 16073, 0x27e1c66a6ULL },
+  { 16074, 0x27e21c2c3ULL },
+  { 16075, 0x21e32d672ULL },
+  { 16076, 0x237e21c16ULL },
+  { 16077, 0x28e9a37c1ULL },
+  { 16078, 0x27e3a96c1ULL },
+  { 16079, 0x27e9c1a36ULL },
+  { 16080, 0x22e3a21a7ULL },
+  { 16081, 0x27e8a16a3ULL },
+  { 16082, 0x23e7a91a6ULL },
+  { 16083, 0x207e153c2ULL },
+  { 16084, 0x27e2c63c1ULL },
+  { 16086, 0x217e9a307ULL },
+  { 16087, 0x27e96a3c1ULL },
+  { 16089, 0x28e72c3a1ULL },
+  { 16090, 0x27e86a3a1ULL },
+  { 16092, 0x297e27c11ULL },
+  { 16093, 0x219e67c21ULL },
+  { 16095, 0x28e5a7c11ULL },
+  { 16096, 0x27e8c7a61ULL },
+  { 16097, 0x26e7d7a16ULL },
+  { 16098, 0x28e1c77a5ULL },
+  { 16099, 0x26e1c75a5ULL },
+  { 16101, 0x21e3c7d82ULL },
+  { 16102, 0x253e671c2ULL },
+  { 16104, 0x23e3c7a11ULL },
+  { 16105, 0x23e9a7a61ULL },
+  { 16106, 0x28e3c7a16ULL },
+  { 16107, 0x28e3c72a1ULL },
+  { 16108, 0x23e6a71a9ULL },
+  { 16109, 0x23e9a71a6ULL },
+  { 16110, 0x273e273c1ULL },
+  { 16116, 0x273e173a1ULL },
+  { 16119, 0x218e9b128ULL },
+  { 16120, 0x29e66b851ULL },
+  { 16121, 0x21e8c6b06ULL },
+  { 16122, 0x22e9a5b81ULL },
+  { 16123, 0x21e61a9b5ULL },
+  { 16124, 0x26e1a1b26ULL },
+  { 16128, 0x28e3c3b19ULL },
+  { 16129, 0x23e68b811ULL },
+  { 16130, 0x25e3c3b16ULL },
+  { 16131, 0x23e13a1b2ULL },
+  { 16132, 0x23e1a5b63ULL },
+  { 16133, 0x26e3a1b06ULL },
+  { 16137, 0x29e13b321ULL },
+  { 16138, 0x29e16b351ULL },
+  { 16139, 0x206e1b306ULL },
+  { 16140, 0x21e31a3b2ULL },
+  { 16141, 0x22e61a3b9ULL },
+  { 16142, 0x22e91a3b6ULL },
+  { 16146, 0x28e59b771ULL },
+  { 16147, 0x29e57b761ULL },
+  { 16148, 0x26e5c1b76ULL },
+  { 16149, 0x27e17a1b2ULL },
+  { 16150, 0x28e6a1b77ULL },
+  { 16151, 0x27e7a1b66ULL },
+  { 16155, 0x23e58b711ULL },
+  { 16156, 0x27e56b731ULL },
+  { 16157, 0x23e01b7c6ULL },
+  { 16158, 0x21e7a8b31ULL },
+  { 16159, 0x23e73a6b1ULL },
+  { 16160, 0x23e72a1b6ULL },
+  { 16164, 0x27e18b351ULL },
+  { 16165, 0x27e16b331ULL },
+  { 16166, 0x276e1b376ULL },
+  { 16167, 0x22e81a3b7ULL },
+  { 16173, 0x21e9c7b57ULL },
+  { 16174, 0x21e2c7b62ULL },
+  { 16175, 0x21e7c7b16ULL },
+  { 16176, 0x21e7a7b21ULL },
+  { 16178, 0x26e8a7b16ULL },
+  { 16182, 0x21e7d7b31ULL },
+  { 16185, 0x23e8a7b13ULL },
+  { 16186, 0x21e6a7b31ULL },
+  { 16200, 0x21e9b1b22ULL },
+  { 16201, 0x25e9b16c1ULL },
+  { 16202, 0x25e8b1d06ULL },
+  { 16203, 0x22e5b9a81ULL },
+  { 16204, 0x22e2b8a61ULL },
+  { 16205, 0x25e9b1a06ULL },
+  { 16206, 0x22e5b91a8ULL },
+  { 16207, 0x25e9b06a1ULL },
+  { 16208, 0x21e6b21a6ULL },
+  { 16209, 0x22e9b1c13ULL },
+  { 16210, 0x22e6b3b13ULL },
+  { 16211, 0x26e1b1c36ULL },
+  { 16212, 0x23e1b2a13ULL },
+  { 16213, 0x22e3b9a61ULL },
+  { 16214, 0x26e1b3a06ULL },
+  { 16215, 0x21e9b81a3ULL },
+  { 16216, 0x26e2b36a1ULL },
+  { 16217, 0x22e3b91a6ULL },
+  { 16218, 0x22e9b13c1ULL },
+  { 16219, 0x23e6b83c1ULL },
+  { 16224, 0x23e1b23a1ULL },
+  { 16225, 0x23e5b63a1ULL },
+  { 16226, 0x23e5b13a6ULL },
+  { 16227, 0x27e9b1c18ULL },
+  { 16228, 0x26e9b17c1ULL },
+  { 16229, 0x26e5b1c76ULL },
+  { 16230, 0x27e1b2a17ULL },
+  { 16231, 0x27e5b6a17ULL },
+  { 16232, 0x26e7b8a16ULL },
+  { 16233, 0x27e1b27a1ULL },
+  { 16234, 0x27e1b86a5ULL },
+  { 16235, 0x27e5b17a6ULL },
+  { 16236, 0x23e5b1c73ULL },
+  { 16237, 0x26e6b3b17ULL },
+  { 16238, 0x27e6b31c6ULL },
+  { 16239, 0x27e2b3a17ULL },
+  { 16240, 0x21e7b6a31ULL },
+  { 16242, 0x27e2b37a1ULL },
+  { 16243, 0x21e7b61a3ULL },
+  { 16244, 0x21e7b31a6ULL },
+  { 16245, 0x23e7b93c1ULL },
+  { 16251, 0x23e7b83a1ULL },
+  { 16252, 0x23e6b13a7ULL },
+  { 16254, 0x28e2b7b19ULL },
+  { 16255, 0x21e6b7b52ULL },
+  { 16256, 0x25e1b7b06ULL },
+  { 16257, 0x21e5b7a01ULL },
+  { 16258, 0x28e1b7a67ULL },
+  { 16259, 0x26e6b7a16ULL },
+  { 16260, 0x21e7b71a2ULL },
+  { 16261, 0x21e6b71a1ULL },
+  { 16262, 0x27e1b76a6ULL },
+  { 16263, 0x21e3b7b22ULL },
+  { 16266, 0x21e8b7a31ULL },
+  { 16267, 0x23e1b7a62ULL },
+  { 16269, 0x21e8b71a3ULL },
+  { 16271, 0x23e1b72a6ULL },
+  { 16272, 0x23e5b73c1ULL },
+  { 16279, 0x23e6b73a1ULL },
+  { 16281, 0x228e114c2ULL },
+  { 16282, 0x21e22d462ULL },
+  { 16283, 0x25e21d426ULL },
+  { 16284, 0x29e8a12c4ULL },
+  { 16285, 0x26e6c8a41ULL },
+  { 16286, 0x25e64a1c6ULL },
+  { 16287, 0x29e12c4a8ULL },
+  { 16288, 0x22e6a21a4ULL },
+  { 16289, 0x25e1c64a6ULL },
+  { 16290, 0x234e234c1ULL },
+  { 16291, 0x268e134c2ULL },
+  { 16292, 0x288e41c36ULL },
+  { 16293, 0x24e3c1a93ULL },
+  { 16294, 0x24e6c1a63ULL },
+  { 16295, 0x24e63a1c6ULL },
+  { 16296, 0x25e34c1a9ULL },
+  { 16297, 0x24e63a5a1ULL },
+  { 16298, 0x24e3c21a6ULL },
+  { 16299, 0x214e4c301ULL },
+  { 16300, 0x216e4c351ULL },
+  { 16301, 0x24e12c3d6ULL },
+  { 16302, 0x24e9a33c1ULL },
+  { 16303, 0x24e6a63c1ULL },
+  { 16305, 0x24e1a33a8ULL },
+  { 16306, 0x24e6a53a1ULL },
+  { 16307, 0x24e1c63a6ULL },
+  { 16308, 0x27e81c4c1ULL },
+  { 16309, 0x244e62c71ULL },
+  { 16310, 0x24e61d276ULL },
+  { 16311, 0x25e7a4a14ULL },
+  { 16312, 0x27e8a4c61ULL },
+  { 16313, 0x27e1c8a46ULL },
+  { 16314, 0x28e77a1a4ULL },
+  { 16315, 0x27e7a16a4ULL },
+  { 16316, 0x21e7d24a6ULL },
+  { 16317, 0x247e35c41ULL },
+  { 16318, 0x234e72c61ULL },
+  { 16320, 0x24e7c1a53ULL },
+  { 16321, 0x26e14a7c3ULL },
+  { 16323, 0x23e72a4a1ULL },
+  { 16326, 0x275e4c341ULL },
+  { 16327, 0x296e4c371ULL },
+  { 16329, 0x24e7a53c1ULL },
+  { 16330, 0x26e14a3c7ULL },
+  { 16332, 0x24e7a43a1ULL },
+  { 16335, 0x274e274c1ULL },
+  { 16336, 0x21e6c7d41ULL },
+  { 16338, 0x25e5a74c1ULL },
+  { 16339, 0x21e6a7d24ULL },
+  { 16340, 0x27e1a7a46ULL },
+  { 16341, 0x274e174a1ULL },
+  { 16342, 0x26e1a75a4ULL },
+  { 16344, 0x243e171c2ULL },
+  { 16345, 0x269e47c31ULL },
+  { 16347, 0x24e1c7a53ULL },
+  { 16348, 0x26e3c7a14ULL },
+  { 16350, 0x23e1a72a4ULL },
+  { 16353, 0x247e173c2ULL },
+  { 16356, 0x24e5a73c1ULL },
+  { 16359, 0x24e1c73a5ULL },
+  { 16362, 0x24e28b421ULL },
+  { 16363, 0x28e26b441ULL },
+  { 16364, 0x21e21b4c6ULL },
+  { 16365, 0x24e1a8b94ULL },
+  { 16366, 0x21e6a8b41ULL },
+  { 16367, 0x26e5a4b16ULL },
+  { 16371, 0x29e34b531ULL },
+  { 16372, 0x29e64b831ULL },
+  { 16373, 0x236e9b146ULL },
+  { 16374, 0x24e14a2b3ULL },
+  { 16376, 0x26e1a3b46ULL },
+  { 16380, 0x24e19b331ULL },
+  { 16381, 0x26e14b301ULL },
+  { 16382, 0x246e1b346ULL },
+  { 16383, 0x21e11a3b4ULL },
+  { 16384, 0x26e16a3b4ULL },
+  { 16389, 0x24e58b721ULL },
+  { 16390, 0x27e96b141ULL },
+  { 16392, 0x22e91a4b7ULL },
+  { 16393, 0x24e74a6b1ULL },
+  { 16394, 0x27e9a1b46ULL },
+  { 16398, 0x27e34b511ULL },
+  { 16399, 0x27e26b431ULL },
+  { 16401, 0x27e1a3b47ULL },
+  { 16402, 0x24e7a1b63ULL },
+  { 16403, 0x24e73a1b6ULL },
+  { 16407, 0x27e14b311ULL },
+  { 16410, 0x27e17a3b4ULL },
+  { 16416, 0x21e5c7b74ULL },
+  { 16417, 0x21e6c7b45ULL },
+  { 16419, 0x24e8a7b14ULL },
+  { 16443, 0x24e9b15c1ULL },
+  { 16444, 0x22e6b2c41ULL },
+  { 16445, 0x26e2b1d46ULL },
+  { 16446, 0x24e8b9a14ULL },
+  { 16447, 0x21e6b4a41ULL },
+  { 16449, 0x24e8b94a1ULL },
+  { 16450, 0x21e6b41a4ULL },
+  { 16451, 0x21e8b41a6ULL },
+  { 16452, 0x23e9b1c14ULL },
+  { 16453, 0x24e3b1b64ULL },
+  { 16454, 0x21e3b4d06ULL },
+  { 16455, 0x23e1b9a42ULL },
+  { 16457, 0x26e3b4a16ULL },
+  { 16458, 0x24e2b14a3ULL },
+  { 16459, 0x26e3b46a1ULL },
+  { 16461, 0x23e2b43c1ULL },
+  { 16467, 0x24e1b93a4ULL },
+  { 16470, 0x27e2b47c1ULL },
+  { 16471, 0x26e6b4c71ULL },
+  { 16472, 0x26e1b4b76ULL },
+  { 16473, 0x21e7b5a41ULL },
+  { 16474, 0x24e6b1a74ULL },
+  { 16475, 0x27e1b9a46ULL },
+  { 16476, 0x21e7b51a4ULL },
+  { 16477, 0x27e1b96a4ULL },
+  { 16479, 0x21e7b4b32ULL },
+  { 16482, 0x27e3b4a17ULL },
+  { 16483, 0x24e1b6a73ULL },
+  { 16485, 0x27e3b47a1ULL },
+  { 16495, 0x24e1b63a7ULL },
+  { 16497, 0x21e5b7b42ULL },
+  { 16498, 0x29e6b7c41ULL },
+  { 16500, 0x21e9b7a41ULL },
+  { 16501, 0x24e6b7a14ULL },
+  { 16503, 0x21e9b71a4ULL },
+  { 16504, 0x24e6b74a1ULL },
+  { 16505, 0x25e1b74a6ULL },
+  { 16506, 0x23e1b7b04ULL },
+  { 16510, 0x24e1b7a63ULL },
+  { 16523, 0x24e1b73a6ULL },
+  { 16524, 0x21e4d4c21ULL },
+  { 16525, 0x21e41d861ULL },
+  { 16526, 0x21e45d846ULL },
+  { 16527, 0x25e4a21c4ULL },
+  { 16528, 0x24e4c6a81ULL },
+  { 16529, 0x26e4d4a16ULL },
+  { 16530, 0x24e4c01a2ULL },
+  { 16531, 0x26e4c51a2ULL },
+  { 16532, 0x26e4c41a6ULL },
+  { 16533, 0x24e41c1c3ULL },
+  { 16534, 0x23e4d8c61ULL },
+  { 16536, 0x23e4a82c1ULL },
+  { 16537, 0x28e4a6c31ULL },
+  { 16538, 0x28e4a31c6ULL },
+  { 16539, 0x22e4a51a3ULL },
+  { 16542, 0x24e41c3c1ULL },
+  { 16545, 0x24e4a83c1ULL },
+  { 16547, 0x23e41a3c6ULL },
+  { 16548, 0x21e4d23a4ULL },
+  { 16549, 0x21e4d63a3ULL },
+  { 16551, 0x27e4c1c81ULL },
+  { 16552, 0x21e46d867ULL },
+  { 16554, 0x28e4a87c1ULL },
+  { 16555, 0x27e4a86c1ULL },
+  { 16556, 0x27e4c1a86ULL },
+  { 16557, 0x28e47a1a7ULL },
+  { 16558, 0x27e46a7a1ULL },
+  { 16560, 0x27e42c1c3ULL },
+  { 16563, 0x23e4a1a72ULL },
+  { 16566, 0x23e42a7a1ULL },
+  { 16569, 0x27e42c3c1ULL },
+  { 16575, 0x24e4a13a7ULL },
+  { 16578, 0x21e4c7d12ULL },
+  { 16581, 0x24e4c7a41ULL },
+  { 16582, 0x26e4a7a15ULL },
+  { 16583, 0x27e4a7a16ULL },
+  { 16584, 0x27e4c71a4ULL },
+  { 16585, 0x26e4a75a1ULL },
+  { 16590, 0x23e4a7a12ULL },
+  { 16593, 0x23e4a72a1ULL },
+  { 16602, 0x24e4a73a1ULL },
+  { 16605, 0x21e4c8b44ULL },
+  { 16606, 0x29e45b641ULL },
+  { 16607, 0x22e41b6c6ULL },
+  { 16608, 0x21e4a4b21ULL },
+  { 16609, 0x21e4a6b41ULL },
+  { 16610, 0x21e41a8b6ULL },
+  { 16614, 0x21e4d4b31ULL },
+  { 16615, 0x23e48b611ULL },
+  { 16617, 0x23e4a1b92ULL },
+  { 16619, 0x26e4a3b16ULL },
+  { 16626, 0x21e41a3b1ULL },
+  { 16627, 0x26e46a3b1ULL },
+  { 16632, 0x24e41b8c7ULL },
+  { 16633, 0x28e47b651ULL },
+  { 16635, 0x21e4a9b71ULL },
+  { 16636, 0x27e46a1b9ULL },
+  { 16637, 0x27e4a1b96ULL },
+  { 16642, 0x27e43b601ULL },
+  { 16644, 0x27e4a3b17ULL },
+  { 16653, 0x27e47a3b1ULL },
+  { 16659, 0x21e4c7b04ULL },
+  { 16662, 0x21e4a7b51ULL },
+  { 16686, 0x29e4b8c21ULL },
+  { 16687, 0x21e4b6d69ULL },
+  { 16688, 0x26e4b1d66ULL },
+  { 16689, 0x21e4b4a21ULL },
+  { 16690, 0x21e4b6a01ULL },
+  { 16691, 0x26e4b5a16ULL },
+  { 16692, 0x21e4b41a2ULL },
+  { 16693, 0x26e4b56a1ULL },
+  { 16694, 0x21e4b01a6ULL },
+  { 16695, 0x23e4b3c21ULL },
+  { 16696, 0x23e4b1c63ULL },
+  { 16698, 0x23e4b5a13ULL },
+  { 16701, 0x21e4b31a3ULL },
+  { 16705, 0x23e4b63c1ULL },
+  { 16710, 0x23e4b53a1ULL },
+  { 16713, 0x27e4b4c91ULL },
+  { 16714, 0x27e4b67c1ULL },
+  { 16715, 0x26e4b1b76ULL },
+  { 16716, 0x27e4b5a17ULL },
+  { 16719, 0x27e4b57a1ULL },
+  { 16722, 0x23e4b1b73ULL },
+  { 16743, 0x22e4b7a91ULL },
+  { 16746, 0x22e4b71a9ULL },
+  { 16749, 0x21e4b7b32ULL },
+  { 16767, 0x281e5d019ULL },
+  { 16768, 0x251e6d219ULL },
+  { 16769, 0x221e5d016ULL },
+  { 16770, 0x211e29a02ULL },
+  { 16771, 0x251e26a09ULL },
+  { 16772, 0x211e25a06ULL },
+  { 16773, 0x211e011a2ULL },
+  { 16774, 0x261e161a1ULL },
+  { 16775, 0x211e601a6ULL },
+  { 16776, 0x231e21c11ULL },
+  { 16777, 0x211e3d633ULL },
+  { 16778, 0x231e5d066ULL },
+  { 16779, 0x211e98a32ULL },
+  { 16780, 0x251e96a38ULL },
+  { 16781, 0x231e96a36ULL },
+  { 16782, 0x221e911a3ULL },
+  { 16783, 0x261e951a3ULL },
+  { 16784, 0x231e621a6ULL },
+  { 16785, 0x291e8c3c8ULL },
+  { 16786, 0x261e6c3c9ULL },
+  { 16787, 0x261e9c3c6ULL },
+  { 16788, 0x221e9a311ULL },
+  { 16789, 0x261e9a351ULL },
+  { 16794, 0x211e8c7c2ULL },
+  { 16795, 0x271e5d068ULL },
+  { 16796, 0x211e6d276ULL },
+  { 16797, 0x211e52a78ULL },
+  { 16798, 0x261e78a57ULL },
+  { 16799, 0x221e75a56ULL },
+  { 16800, 0x211e701a5ULL },
+  { 16801, 0x261e751a5ULL },
+  { 16802, 0x271e661a6ULL },
+  { 16804, 0x291e3d675ULL },
+  { 16806, 0x211e93a37ULL },
+  { 16807, 0x231e16a17ULL },
+  { 16808, 0x201e73a56ULL },
+  { 16809, 0x231e721a5ULL },
+  { 16810, 0x271e961a3ULL },
+  { 16815, 0x281e9a371ULL },
+  { 16816, 0x271e9a361ULL },
+  { 16821, 0x271e271c1ULL },
+  { 16824, 0x251e27a08ULL },
+  { 16825, 0x261e77a58ULL },
+  { 16827, 0x271e171a1ULL },
+  { 16829, 0x281e671a6ULL },
+  { 16833, 0x231e97a35ULL },
+  { 16834, 0x211e67a63ULL },
+  { 16835, 0x231e27a06ULL },
+  { 16836, 0x281e971a3ULL },
+  { 16848, 0x201e8b011ULL },
+  { 16849, 0x251e9b161ULL },
+  { 16857, 0x221e8b031ULL },
+  { 16858, 0x231e6b831ULL },
+  { 16866, 0x201e1b301ULL },
+  { 16867, 0x261e1b361ULL },
+  { 16875, 0x271e9b181ULL },
+  { 16876, 0x261e7b961ULL },
+  { 16884, 0x231e5b731ULL },
+  { 16893, 0x271e1b371ULL },
+  { 17010, 0x241e1c241ULL },
+  { 17011, 0x291e6c8c4ULL },
+  { 17012, 0x251e4d806ULL },
+  { 17013, 0x241e2a041ULL },
+  { 17014, 0x221e86a45ULL },
+  { 17015, 0x221e85a46ULL },
+  { 17016, 0x211e801a4ULL },
+  { 17017, 0x261e851a4ULL },
+  { 17018, 0x251e641a6ULL },
+  { 17019, 0x281e41c31ULL },
+  { 17020, 0x281e2d463ULL },
+  { 17022, 0x231e88a44ULL },
+  { 17023, 0x211e96a34ULL },
+  { 17024, 0x201e83a46ULL },
+  { 17025, 0x241e931a3ULL },
+  { 17027, 0x241e631a6ULL },
+  { 17031, 0x241e9a331ULL },
+  { 17037, 0x211e7c4c4ULL },
+  { 17038, 0x291e4d867ULL },
+  { 17039, 0x271e4d886ULL },
+  { 17040, 0x201e74a55ULL },
+  { 17041, 0x241e86a47ULL },
+  { 17042, 0x211e74a56ULL },
+  { 17043, 0x251e741a5ULL },
+  { 17044, 0x271e861a4ULL },
+  { 17046, 0x271e2d443ULL },
+  { 17049, 0x231e78a54ULL },
+  { 17050, 0x241e96a37ULL },
+  { 17052, 0x241e731a5ULL },
+  { 17067, 0x221e87a44ULL },
+  { 17068, 0x261e87a48ULL },
+  { 17069, 0x241e87a46ULL },
+  { 17070, 0x281e871a4ULL },
+  { 17076, 0x211e87a43ULL },
+  { 17078, 0x241e97a36ULL },
+  { 17091, 0x241e8b051ULL },
+  { 17092, 0x221e4b621ULL },
+  { 17100, 0x231e8b041ULL },
+  { 17101, 0x231e4b631ULL },
+  { 17109, 0x241e1b341ULL },
+  { 17118, 0x241e5b741ULL },
+  { 17119, 0x271e4b671ULL },
+  { 17496, 0x2e092d085ULL },
+  { 17497, 0x2e892d695ULL },
+  { 17498, 0x2e2c06d06ULL },
+  { 17499, 0x2e5d5a2d2ULL },
+  { 17500, 0x2e6d6a2d2ULL },
+  { 17501, 0x2e2d2a6d6ULL },
+  { 17505, 0x2e2d32d29ULL },
+  { 17506, 0x2e862d635ULL },
+  { 17507, 0x2e303d606ULL },
+  { 17508, 0x2e3d3a2d2ULL },
+  { 17510, 0x2e3d3a6d6ULL },
+  { 17514, 0x2e2c3d3d9ULL },
+  { 17515, 0x2e63d63c2ULL },
+  { 17516, 0x2e2d2c3d6ULL },
+  { 17517, 0x2e2d2a3d3ULL },
+  { 17518, 0x2e6d6a3d3ULL },
+  { 17523, 0x2e972d855ULL },
+  { 17524, 0x2e67d67c2ULL },
+  { 17525, 0x2e2c76d76ULL },
+  { 17526, 0x2e7d7a2d2ULL },
+  { 17527, 0x2e6d6a7d7ULL },
+  { 17528, 0x2e7d7a6d6ULL },
+  { 17532, 0x2e573d057ULL },
+  { 17533, 0x2e383d667ULL },
+  { 17534, 0x2e833d676ULL },
+  { 17535, 0x2e3d3a7d7ULL },
+  { 17543, 0x2e7d7c3d6ULL },
+  { 17544, 0x2e7d7a3d3ULL },
+  { 17550, 0x2e72d72c2ULL },
+  { 17551, 0x2e76d76c2ULL },
+  { 17559, 0x2e2c37d37ULL },
+  { 17568, 0x2e73d73c2ULL },
+  { 17577, 0x2e2b52b92ULL },
+  { 17578, 0x2e6d6b2b5ULL },
+  { 17579, 0x2e895b006ULL },
+  { 17580, 0x2e2b8a9b5ULL },
+  { 17581, 0x2e65a26b8ULL },
+  { 17582, 0x2e2b6a8b6ULL },
+  { 17583, 0x2e9b2b8a5ULL },
+  { 17584, 0x2e6c2b9a5ULL },
+  { 17585, 0x2e2c5b6a6ULL },
+  { 17586, 0x2e3c23b89ULL },
+  { 17587, 0x2e6b52b33ULL },
+  { 17588, 0x2e826b036ULL },
+  { 17589, 0x2e8a3b5b2ULL },
+  { 17590, 0x2e6a2a9b3ULL },
+  { 17591, 0x2e3a5b2b6ULL },
+  { 17592, 0x2e5b3b2a8ULL },
+  { 17593, 0x2e3a9b6a2ULL },
+  { 17594, 0x2e9b3a2a6ULL },
+  { 17595, 0x2e5b2b3c3ULL },
+  { 17596, 0x2e6b8c3d3ULL },
+  { 17597, 0x2e8c2b3c6ULL },
+  { 17598, 0x2e9a3c3b2ULL },
+  { 17599, 0x2e9a6b3b2ULL },
+  { 17600, 0x2e2a3b3b6ULL },
+  { 17601, 0x2e8b2a3a5ULL },
+  { 17602, 0x2e6b3a3a2ULL },
+  { 17603, 0x2e9b2a3a6ULL },
+  { 17604, 0x2e7b7b2c8ULL },
+  { 17605, 0x2e857b067ULL },
+  { 17606, 0x2e7b85b76ULL },
+  { 17607, 0x2e5a2b8b7ULL },
+  { 17608, 0x2e6b8a7b7ULL },
+  { 17609, 0x2e7b5a2b6ULL },
+  { 17610, 0x2e8b2b7a5ULL },
+  { 17611, 0x2e7b6b8a7ULL },
+  { 17612, 0x2e5b7d7a6ULL },
+  { 17613, 0x2e7b82b73ULL },
+  { 17614, 0x2e763b963ULL },
+  { 17615, 0x2e3b75b26ULL },
+  { 17616, 0x2e37a97b8ULL },
+  { 17617, 0x2e6a38b97ULL },
+  { 17618, 0x2e3a76b66ULL },
+  { 17619, 0x2e5b3b7a3ULL },
+  { 17620, 0x2e6b2b7a3ULL },
+  { 17621, 0x2e7b3b6a6ULL },
+  { 17622, 0x2e5b7c3d3ULL },
+  { 17623, 0x2e7b6b3c5ULL },
+  { 17624, 0x2e7d7b3b6ULL },
+  { 17625, 0x2e7a5b3b3ULL },
+  { 17626, 0x2e6b7a3d3ULL },
+  { 17627, 0x2e7b6a3b6ULL },
+  { 17628, 0x2e3a7b3a3ULL },
+  { 17629, 0x2e6b2b3a7ULL },
+  { 17631, 0x2e5b27b97ULL },
+  { 17632, 0x2e7b67b58ULL },
+  { 17634, 0x2e7a57b07ULL },
+  { 17635, 0x2e6a67b27ULL },
+  { 17636, 0x2e9a57b86ULL },
+  { 17640, 0x2e3d57b72ULL },
+  { 17641, 0x2e6b57b38ULL },
+  { 17643, 0x2e7a87b37ULL },
+  { 17644, 0x2e5a67b37ULL },
+  { 17645, 0x2e9a37b66ULL },
+  { 17649, 0x2e73d73b3ULL },
+  { 17652, 0x2e73a73b2ULL },
+  { 17653, 0x2e63a73b3ULL },
+  { 17654, 0x2e33a73b6ULL },
+  { 17658, 0x2e89b5c02ULL },
+  { 17659, 0x2e65b92c2ULL },
+  { 17660, 0x2e56b2b96ULL },
+  { 17661, 0x2e29b9a58ULL },
+  { 17662, 0x2e26b8a65ULL },
+  { 17663, 0x2e96b6a56ULL },
+  { 17664, 0x2e29b98a5ULL },
+  { 17665, 0x2e26b65a8ULL },
+  { 17666, 0x2e26b85a6ULL },
+  { 17667, 0x2e53b2b93ULL },
+  { 17668, 0x2e03b6b83ULL },
+  { 17669, 0x2e02b3d66ULL },
+  { 17670, 0x2e53b9a82ULL },
+  { 17671, 0x2e93b6a53ULL },
+  { 17672, 0x2e36b5a06ULL },
+  { 17673, 0x2e09b98a3ULL },
+  { 17674, 0x2e06b95a3ULL },
+  { 17675, 0x2e03b62a6ULL },
+  { 17676, 0x2e85b03c2ULL },
+  { 17677, 0x2e26b23c2ULL },
+  { 17682, 0x2e93b83a3ULL },
+  { 17683, 0x2e93b63a5ULL },
+  { 17684, 0x2e63b23a6ULL },
+  { 17685, 0x2e27b5b97ULL },
+  { 17686, 0x2e96b5b67ULL },
+  { 17687, 0x2e95b6b76ULL },
+  { 17688, 0x2e28b9a57ULL },
+  { 17689, 0x2e67b6a27ULL },
+  { 17690, 0x2e57b9a86ULL },
+  { 17691, 0x2e28b57a9ULL },
+  { 17692, 0x2e27b96a5ULL },
+  { 17693, 0x2e07b66a6ULL },
+  { 17694, 0x2e37b3b87ULL },
+  { 17695, 0x2e76b3c32ULL },
+  { 17696, 0x2e75b3b26ULL },
+  { 17697, 0x2e08b3a97ULL },
+  { 17698, 0x2e38b9a67ULL },
+  { 17699, 0x2e76b6a36ULL },
+  { 17700, 0x2e08b37a9ULL },
+  { 17701, 0x2e07b96a3ULL },
+  { 17702, 0x2e37b96a6ULL },
+  { 17703, 0x2e79b33c3ULL },
+  { 17704, 0x2e07b63c2ULL },
+  { 17709, 0x2e73b03a9ULL },
+  { 17710, 0x2e73b63a3ULL },
+  { 17711, 0x2e73b33a6ULL },
+  { 17712, 0x2e88b7b79ULL },
+  { 17713, 0x2e76b7b67ULL },
+  { 17714, 0x2e75b7b66ULL },
+  { 17715, 0x2e29b7a78ULL },
+  { 17716, 0x2e06b7a55ULL },
+  { 17717, 0x2e56b7a06ULL },
+  { 17718, 0x2e08b77a5ULL },
+  { 17719, 0x2e76b76a2ULL },
+  { 17721, 0x2e82b7b73ULL },
+  { 17722, 0x2e62b7b53ULL },
+  { 17723, 0x2e35b7b26ULL },
+  { 17724, 0x2e33b7a82ULL },
+  { 17725, 0x2e36b7a85ULL },
+  { 17726, 0x2e86b7a36ULL },
+  { 17727, 0x2e38b77a8ULL },
+  { 17728, 0x2e86b76a3ULL },
+  { 17730, 0x2e27b73c2ULL },
+  { 17736, 0x2e73b73a2ULL },
+  { 17739, 0x2e454d809ULL },
+  { 17740, 0x2e462d825ULL },
+  { 17741, 0x2e2c46d46ULL },
+  { 17742, 0x2e4d4a2d2ULL },
+  { 17743, 0x2e6d6a4d4ULL },
+  { 17744, 0x2e4d4a6d6ULL },
+  { 17748, 0x2e2c43d43ULL },
+  { 17749, 0x2e324d648ULL },
+  { 17750, 0x2e203d406ULL },
+  { 17751, 0x2e3d3a4d4ULL },
+  { 17757, 0x2e43d43c2ULL },
+  { 17759, 0x2e4d4c3d6ULL },
+  { 17760, 0x2e4d4a3d3ULL },
+  { 17766, 0x2e474d849ULL },
+  { 17767, 0x2e674d259ULL },
+  { 17769, 0x2e7d7a4d4ULL },
+  { 17775, 0x2e473d847ULL },
+  { 17776, 0x2e463d827ULL },
+  { 17777, 0x2e723d456ULL },
+  { 17793, 0x2e2c47d47ULL },
+  { 17820, 0x2e2d45b92ULL },
+  { 17821, 0x2e2d68b54ULL },
+  { 17822, 0x2e2b4d8b6ULL },
+  { 17823, 0x2e5a4b8b9ULL },
+  { 17824, 0x2e6a25b84ULL },
+  { 17825, 0x2e4a6b2b6ULL },
+  { 17826, 0x2e2a8b4a4ULL },
+  { 17827, 0x2e4c2b6a4ULL },
+  { 17828, 0x2e6b4d8a6ULL },
+  { 17829, 0x2e3b34b84ULL },
+  { 17830, 0x2e634b834ULL },
+  { 17831, 0x2e9b35b46ULL },
+  { 17832, 0x2e3a5b4b8ULL },
+  { 17833, 0x2e6a3b4b3ULL },
+  { 17834, 0x2e3a3b4b6ULL },
+  { 17835, 0x2e2c3b4a4ULL },
+  { 17836, 0x2e4b3b6a3ULL },
+  { 17837, 0x2e5b3b4a6ULL },
+  { 17838, 0x2e2b4c3d3ULL },
+  { 17839, 0x2e4b6c3d3ULL },
+  { 17840, 0x2e4c3d3b6ULL },
+  { 17841, 0x2e3b4a3b4ULL },
+  { 17842, 0x2e4b6a3b3ULL },
+  { 17843, 0x2e4b3a3b6ULL },
+  { 17844, 0x2e4a8b3a3ULL },
+  { 17845, 0x2e6b4b3a9ULL },
+  { 17846, 0x2e4b3b3a6ULL },
+  { 17847, 0x2e257b457ULL },
+  { 17848, 0x2e4b96b57ULL },
+  { 17849, 0x2e7d7c4b6ULL },
+  { 17850, 0x2e4b7a9b8ULL },
+  { 17851, 0x2e4b6a7b7ULL },
+  { 17852, 0x2e4a76b56ULL },
+  { 17853, 0x2e7b4d8a7ULL },
+  { 17854, 0x2e6b4b7a5ULL },
+  { 17855, 0x2e7b4b7a6ULL },
+  { 17856, 0x2e7b43b34ULL },
+  { 17857, 0x2e6b93b74ULL },
+  { 17858, 0x2e7b45b36ULL },
+  { 17859, 0x2e7a4b4b3ULL },
+  { 17860, 0x2e6a74b34ULL },
+  { 17862, 0x2e4b3b7a2ULL },
+  { 17863, 0x2e6b3b7a4ULL },
+  { 17865, 0x2e4b3d3b7ULL },
+  { 17868, 0x2e7a4b3b2ULL },
+  { 17869, 0x2e6b7a3b4ULL },
+  { 17871, 0x2e7b4a3a2ULL },
+  { 17874, 0x2e4b47b08ULL },
+  { 17875, 0x2e2d67b04ULL },
+  { 17877, 0x2e4a97b77ULL },
+  { 17878, 0x2e4a67b47ULL },
+  { 17879, 0x2e8a07b46ULL },
+  { 17883, 0x2e4b37b97ULL },
+  { 17886, 0x2e3a47b37ULL },
+  { 17895, 0x2e53a73b4ULL },
+  { 17901, 0x2e45b2c82ULL },
+  { 17902, 0x2e68b4c22ULL },
+  { 17903, 0x2e46b2b86ULL },
+  { 17904, 0x2e05b8a44ULL },
+  { 17905, 0x2e25b6a84ULL },
+  { 17906, 0x2e46b4a26ULL },
+  { 17907, 0x2e05b84a4ULL },
+  { 17908, 0x2e06b45a8ULL },
+  { 17909, 0x2e05b64a6ULL },
+  { 17910, 0x2e82b4b43ULL },
+  { 17911, 0x2e62b6b43ULL },
+  { 17912, 0x2e95b3b46ULL },
+  { 17913, 0x2e03b8a42ULL },
+  { 17914, 0x2e83b6a43ULL },
+  { 17915, 0x2e46b3a36ULL },
+  { 17916, 0x2e05b94a3ULL },
+  { 17917, 0x2e46b36a3ULL },
+  { 17918, 0x2e35b94a6ULL },
+  { 17919, 0x2e49b23c3ULL },
+  { 17920, 0x2e46b33c2ULL },
+  { 17925, 0x2e43b43a2ULL },
+  { 17926, 0x2e63b43a4ULL },
+  { 17927, 0x2e43b03a6ULL },
+  { 17928, 0x2e47b4b08ULL },
+  { 17929, 0x2e67b4b28ULL },
+  { 17930, 0x2e75b5b46ULL },
+  { 17931, 0x2e97b4a77ULL },
+  { 17932, 0x2e67b4a47ULL },
+  { 17933, 0x2e07b8a46ULL },
+  { 17934, 0x2e97b47a7ULL },
+  { 17935, 0x2e07b86a4ULL },
+  { 17936, 0x2e47b07a6ULL },
+  { 17937, 0x2e97b3b48ULL },
+  { 17938, 0x2e93b6b74ULL },
+  { 17939, 0x2e75b4b36ULL },
+  { 17940, 0x2e93b4a73ULL },
+  { 17943, 0x2e47b37a3ULL },
+  { 17946, 0x2e47b83c2ULL },
+  { 17952, 0x2e73b53a4ULL },
+  { 17955, 0x2e29b74c2ULL },
+  { 17956, 0x2e56b7b47ULL },
+  { 17957, 0x2e55b7b46ULL },
+  { 17958, 0x2e48b7a97ULL },
+  { 17959, 0x2e46b7a95ULL },
+  { 17960, 0x2e96b7a46ULL },
+  { 17961, 0x2e48b77a9ULL },
+  { 17962, 0x2e96b76a4ULL },
+  { 17964, 0x2e43b7b34ULL },
+  { 17965, 0x2e63b7b54ULL },
+  { 17966, 0x2e45b7b36ULL },
+  { 17967, 0x2e43b7a92ULL },
+  { 17970, 0x2e35b74a8ULL },
+  { 17979, 0x2e93b73a4ULL },
+  { 17982, 0x2e244d488ULL },
+  { 17983, 0x2e642d294ULL },
+  { 17991, 0x2e34d34c2ULL },
+  { 17992, 0x2e342d684ULL },
+  { 17993, 0x2e243d486ULL },
+  { 18009, 0x2e742d494ULL },
+  { 18020, 0x2e743d496ULL },
+  { 18036, 0x2e74d74c2ULL },
+  { 18063, 0x2e54d09b4ULL },
+  { 18064, 0x2e64d29b4ULL },
+  { 18065, 0x2e246b446ULL },
+  { 18066, 0x2e84a05b4ULL },
+  { 18067, 0x2e64a25b8ULL },
+  { 18068, 0x2e64a05b6ULL },
+  { 18072, 0x2e243b443ULL },
+  { 18073, 0x2e443b643ULL },
+  { 18074, 0x2e346b546ULL },
+  { 18075, 0x2e34a44b3ULL },
+  { 18076, 0x2e54a64b3ULL },
+  { 18077, 0x2e94a35b6ULL },
+  { 18090, 0x2e847b057ULL },
+  { 18091, 0x2e447b647ULL },
+  { 18092, 0x2e546b746ULL },
+  { 18093, 0x2e04a54b7ULL },
+  { 18099, 0x2e543b743ULL },
+  { 18102, 0x2e74a84b3ULL },
+  { 18120, 0x2e74a74b2ULL },
+  { 18126, 0x2e74d74b3ULL },
+  { 18130, 0x2e64a74b3ULL },
+  { 18131, 0x2e34a74b6ULL },
+  { 18144, 0x2e54b2d49ULL },
+  { 18145, 0x2e64b6b45ULL },
+  { 18146, 0x2e94b9b06ULL },
+  { 18147, 0x2e44b4a24ULL },
+  { 18148, 0x2e84b6a44ULL },
+  { 18150, 0x2e44b24a4ULL },
+  { 18151, 0x2e64b44a4ULL },
+  { 18152, 0x2e44b04a6ULL },
+  { 18153, 0x2e34b3b84ULL },
+  { 18154, 0x2e64b5b35ULL },
+  { 18156, 0x2e04b9a33ULL },
+  { 18157, 0x2e34b9a63ULL },
+  { 18159, 0x2e44b34a3ULL },
+  { 18160, 0x2e64b54a3ULL },
+  { 18168, 0x2e54b93a8ULL },
+  { 18169, 0x2e24b63a8ULL },
+  { 18170, 0x2e04b63a6ULL },
+  { 18171, 0x2e04b5b74ULL },
+  { 18172, 0x2e74b6b55ULL },
+  { 18174, 0x2e94b4a74ULL },
+  { 18177, 0x2e74b54a4ULL },
+  { 18180, 0x2e34b2b74ULL },
+  { 18183, 0x2e84b3a74ULL },
+  { 18184, 0x2e74b6a34ULL },
+  { 18186, 0x2e84b34a7ULL },
+  { 18187, 0x2e74b64a3ULL },
+  { 18188, 0x2e74b34a6ULL },
+  { 18195, 0x2e04b53a7ULL },
+  { 18198, 0x2e04b7b94ULL },
+  { 18199, 0x2e64b7b55ULL },
+  { 18201, 0x2e54b7a04ULL },
+  { 18204, 0x2e74b74a2ULL },
+  { 18207, 0x2e34b7b25ULL },
+  { 18210, 0x2e84b7a34ULL },
+  { 18213, 0x2e84b74a3ULL },
+  { 18222, 0x2e04b73a5ULL },
+  { 18225, 0x2e901d812ULL },
+  { 18226, 0x2e62d25c1ULL },
+  { 18227, 0x2e2c6d1d6ULL },
+  { 18228, 0x2e2d2a1c1ULL },
+  { 18229, 0x2e6d6a1c1ULL },
+  { 18231, 0x2e52d52a1ULL },
+  { 18232, 0x2e26d26a1ULL },
+  { 18234, 0x2e511d032ULL },
+  { 18235, 0x2e811d632ULL },
+  { 18236, 0x2e813d636ULL },
+  { 18237, 0x2e3d3a1c1ULL },
+  { 18240, 0x2e31d31a1ULL },
+  { 18241, 0x2e36d36a1ULL },
+  { 18243, 0x2e51d03c1ULL },
+  { 18244, 0x2e61d23c1ULL },
+  { 18249, 0x2e03d03a1ULL },
+  { 18250, 0x2e63d63a1ULL },
+  { 18252, 0x2e8d7d211ULL },
+  { 18253, 0x2e9d7d621ULL },
+  { 18254, 0x2e2d71d86ULL },
+  { 18255, 0x2e7d7a1c1ULL },
+  { 18258, 0x2e07d07a1ULL },
+  { 18259, 0x2e67d67a1ULL },
+  { 18261, 0x2e93d1d87ULL },
+  { 18262, 0x2e653d217ULL },
+  { 18267, 0x2e37d37a1ULL },
+  { 18279, 0x2e71d71c2ULL },
+  { 18285, 0x2e71d71a1ULL },
+  { 18286, 0x2e76d76a1ULL },
+  { 18303, 0x2e73d73a1ULL },
+  { 18306, 0x2e8b1d5c2ULL },
+  { 18307, 0x2e6c1b1d8ULL },
+  { 18308, 0x2e2d6b1b6ULL },
+  { 18309, 0x2e9a8c1b1ULL },
+  { 18310, 0x2e6a9c1b5ULL },
+  { 18311, 0x2e5a9c1b6ULL },
+  { 18312, 0x2e9b5c2a1ULL },
+  { 18313, 0x2e5b1c6a1ULL },
+  { 18314, 0x2e5c1b1a6ULL },
+  { 18315, 0x2e3c1b1d5ULL },
+  { 18316, 0x2e3c81b65ULL },
+  { 18317, 0x2e3c1b1b6ULL },
+  { 18318, 0x2e3a2c1b1ULL },
+  { 18319, 0x2e5a6c1b3ULL },
+  { 18320, 0x2e3a16b06ULL },
+  { 18321, 0x2e2c1b1a3ULL },
+  { 18322, 0x2e8b1a6a3ULL },
+  { 18323, 0x2e8b3a1a6ULL },
+  { 18324, 0x2e3b1c3b8ULL },
+  { 18325, 0x2e6d6b3c1ULL },
+  { 18327, 0x2e2a1c3b3ULL },
+  { 18328, 0x2e63a53b1ULL },
+  { 18329, 0x2e2b1a3b6ULL },
+  { 18330, 0x2e3c1b3a2ULL },
+  { 18331, 0x2e3d6b3a1ULL },
+  { 18332, 0x2e8b1a3a6ULL },
+  { 18333, 0x2e7c11b97ULL },
+  { 18334, 0x2e2b91d67ULL },
+  { 18335, 0x2e716b916ULL },
+  { 18336, 0x2e7a7b2c1ULL },
+  { 18337, 0x2e7a18b67ULL },
+  { 18338, 0x2e76a17b6ULL },
+  { 18339, 0x2e7c1b8a1ULL },
+  { 18340, 0x2e6c1b7a1ULL },
+  { 18341, 0x2e7b2a1a6ULL },
+  { 18342, 0x2e7d7b1c3ULL },
+  { 18343, 0x2e7d36b11ULL },
+  { 18344, 0x2e5c31b76ULL },
+  { 18345, 0x2e7a8b1c3ULL },
+  { 18346, 0x2e6a7c1b3ULL },
+  { 18347, 0x2e3a7c1b6ULL },
+  { 18348, 0x2e7b3a1a5ULL },
+  { 18349, 0x2e7b6c1a3ULL },
+  { 18350, 0x2e7b3c1a6ULL },
+  { 18351, 0x2e7d7b3c1ULL },
+  { 18354, 0x2e3b7a3b1ULL },
+  { 18355, 0x2e73a63b1ULL },
+  { 18356, 0x2e72a13b6ULL },
+  { 18357, 0x2e7b5a3a1ULL },
+  { 18359, 0x2e7c1b3a6ULL },
+  { 18360, 0x2e7d07b21ULL },
+  { 18361, 0x2e6d87b51ULL },
+  { 18363, 0x2e71a71b2ULL },
+  { 18364, 0x2e6a57b17ULL },
+  { 18365, 0x2e8a17b56ULL },
+  { 18369, 0x2e7d77b31ULL },
+  { 18370, 0x2e3b17b67ULL },
+  { 18372, 0x2e3a17b07ULL },
+  { 18373, 0x2e61a71b3ULL },
+  { 18374, 0x2e31a71b6ULL },
+  { 18381, 0x2e83a73b1ULL },
+  { 18387, 0x2e82b2c51ULL },
+  { 18388, 0x2e95b16c1ULL },
+  { 18389, 0x2e85b1c06ULL },
+  { 18390, 0x2e52b9a81ULL },
+  { 18391, 0x2e22b8a61ULL },
+  { 18392, 0x2e95b1a06ULL },
+  { 18393, 0x2e52b91a8ULL },
+  { 18394, 0x2e95b06a1ULL },
+  { 18395, 0x2e61b21a6ULL },
+  { 18396, 0x2e82b1c03ULL },
+  { 18397, 0x2e61b3b12ULL },
+  { 18398, 0x2e36b1c56ULL },
+  { 18399, 0x2e02b9a31ULL },
+  { 18400, 0x2e32b9a61ULL },
+  { 18401, 0x2e26b3a16ULL },
+  { 18402, 0x2e02b91a3ULL },
+  { 18403, 0x2e26b36a1ULL },
+  { 18404, 0x2e32b91a6ULL },
+  { 18405, 0x2e82b03c1ULL },
+  { 18406, 0x2e63b83c1ULL },
+  { 18411, 0x2e92b03a1ULL },
+  { 18412, 0x2e53b63a1ULL },
+  { 18413, 0x2e53b13a6ULL },
+  { 18414, 0x2e97b1c18ULL },
+  { 18415, 0x2e96b17c1ULL },
+  { 18416, 0x2e56b1c76ULL },
+  { 18417, 0x2e97b1a08ULL },
+  { 18418, 0x2e57b6a17ULL },
+  { 18419, 0x2e76b8a16ULL },
+  { 18420, 0x2e97b08a1ULL },
+  { 18421, 0x2e96b07a1ULL },
+  { 18422, 0x2e57b17a6ULL },
+  { 18423, 0x2e53b1c73ULL },
+  { 18424, 0x2e67b6c31ULL },
+  { 18425, 0x2e67b31c6ULL },
+  { 18426, 0x2e73b8a13ULL },
+  { 18427, 0x2e71b6a31ULL },
+  { 18429, 0x2e27b37a1ULL },
+  { 18430, 0x2e71b61a3ULL },
+  { 18431, 0x2e71b31a6ULL },
+  { 18432, 0x2e73b93c1ULL },
+  { 18438, 0x2e73b83a1ULL },
+  { 18439, 0x2e63b13a7ULL },
+  { 18441, 0x2e81b7b72ULL },
+  { 18442, 0x2e56b76c1ULL },
+  { 18443, 0x2e25b7b16ULL },
+  { 18444, 0x2e51b7a01ULL },
+  { 18445, 0x2e61b7a11ULL },
+  { 18446, 0x2e66b7a16ULL },
+  { 18447, 0x2e71b71a2ULL },
+  { 18448, 0x2e61b71a1ULL },
+  { 18450, 0x2e31b7b22ULL },
+  { 18453, 0x2e81b7a31ULL },
+  { 18454, 0x2e63b7a13ULL },
+  { 18456, 0x2e81b71a3ULL },
+  { 18459, 0x2e53b73c1ULL },
+  { 18466, 0x2e63b73a1ULL },
+  { 18468, 0x2e214d428ULL },
+  { 18469, 0x2e2d41d65ULL },
+  { 18470, 0x2e2d61d46ULL },
+  { 18471, 0x2e4d4a1c1ULL },
+  { 18474, 0x2e4d2d8a1ULL },
+  { 18475, 0x2e46d46a1ULL },
+  { 18477, 0x2e491d883ULL },
+  { 18478, 0x2e261d423ULL },
+  { 18479, 0x2e213d426ULL },
+  { 18492, 0x2e43d43a1ULL },
+  { 18495, 0x2e752d415ULL },
+  { 18501, 0x2e47d47a1ULL },
+  { 18504, 0x2e471d843ULL },
+  { 18505, 0x2e761d433ULL },
+  { 18506, 0x2e703d416ULL },
+  { 18513, 0x2e71d43c1ULL },
+  { 18549, 0x2e2c1b4b8ULL },
+  { 18550, 0x2e4c11b64ULL },
+  { 18551, 0x2e4b11d66ULL },
+  { 18552, 0x2e4a4c1b2ULL },
+  { 18553, 0x2e4c1a6b4ULL },
+  { 18554, 0x2e4a8c1b6ULL },
+  { 18555, 0x2e4c1b4a2ULL },
+  { 18556, 0x2e6c1b4a4ULL },
+  { 18557, 0x2e8b4c1a6ULL },
+  { 18558, 0x2e3d3b1b4ULL },
+  { 18559, 0x2e3d6b1c4ULL },
+  { 18560, 0x2e936b146ULL },
+  { 18561, 0x2e4a1b4b3ULL },
+  { 18562, 0x2e46a36b1ULL },
+  { 18563, 0x2e4a36b16ULL },
+  { 18564, 0x2e2d4b1a3ULL },
+  { 18565, 0x2e6b4a1a3ULL },
+  { 18567, 0x2e4b1c3b9ULL },
+  { 18568, 0x2e61d23b4ULL },
+  { 18570, 0x2e4c1a3b1ULL },
+  { 18573, 0x2e4c1b3a3ULL },
+  { 18574, 0x2e6b4a3a1ULL },
+  { 18576, 0x2e4c81b47ULL },
+  { 18577, 0x2e417b617ULL },
+  { 18578, 0x2e4b16b76ULL },
+  { 18579, 0x2e4a9c1b7ULL },
+  { 18580, 0x2e7a15b64ULL },
+  { 18581, 0x2e7b4a1b6ULL },
+  { 18582, 0x2e9c1b7a4ULL },
+  { 18583, 0x2e7b1b6a4ULL },
+  { 18584, 0x2e7b1b4a6ULL },
+  { 18585, 0x2e7b13b04ULL },
+  { 18588, 0x2e47a37b1ULL },
+  { 18589, 0x2e7a14b63ULL },
+  { 18590, 0x2e73a14b6ULL },
+  { 18594, 0x2e71d43b4ULL },
+  { 18603, 0x2e4b17b77ULL },
+  { 18604, 0x2e6d27b41ULL },
+  { 18606, 0x2e51a71b4ULL },
+  { 18608, 0x2e9a17b46ULL },
+  { 18615, 0x2e4a37b17ULL },
+  { 18630, 0x2e28b4c12ULL },
+  { 18631, 0x2e28b6c41ULL },
+  { 18632, 0x2e46b1d66ULL },
+  { 18633, 0x2e02b8a41ULL },
+  { 18634, 0x2e61b4a41ULL },
+  { 18635, 0x2e46b5a16ULL },
+  { 18636, 0x2e02b81a4ULL },
+  { 18637, 0x2e46b56a1ULL },
+  { 18638, 0x2e41b01a6ULL },
+  { 18639, 0x2e43b2c81ULL },
+  { 18640, 0x2e43b1c63ULL },
+  { 18641, 0x2e31b4d06ULL },
+  { 18642, 0x2e43b5a13ULL },
+  { 18644, 0x2e36b4a16ULL },
+  { 18645, 0x2e51b41a3ULL },
+  { 18646, 0x2e36b46a1ULL },
+  { 18648, 0x2e23b43c1ULL },
+  { 18649, 0x2e43b63c1ULL },
+  { 18654, 0x2e33b43a1ULL },
+  { 18657, 0x2e47b4c91ULL },
+  { 18658, 0x2e66b4c71ULL },
+  { 18659, 0x2e46b1b76ULL },
+  { 18660, 0x2e71b5a41ULL },
+  { 18663, 0x2e47b57a1ULL },
+  { 18666, 0x2e71b4b32ULL },
+  { 18669, 0x2e37b4a17ULL },
+  { 18672, 0x2e37b47a1ULL },
+  { 18684, 0x2e51b7b42ULL },
+  { 18685, 0x2e69b7c41ULL },
+  { 18687, 0x2e91b7a41ULL },
+  { 18690, 0x2e91b71a4ULL },
+  { 18693, 0x2e41b7b32ULL },
+  { 18711, 0x2e24d48c1ULL },
+  { 18712, 0x2e64d29c1ULL },
+  { 18717, 0x2e04d04a1ULL },
+  { 18718, 0x2e64d64a1ULL },
+  { 18721, 0x2e34d68c1ULL },
+  { 18726, 0x2e34d34a1ULL },
+  { 18738, 0x2e74d49c1ULL },
+  { 18771, 0x2e74d74a1ULL },
+  { 18792, 0x2e041b241ULL },
+  { 18793, 0x2e441b641ULL },
+  { 18794, 0x2e946b156ULL },
+  { 18795, 0x2e94a15b4ULL },
+  { 18796, 0x2e64a54b1ULL },
+  { 18801, 0x2e341b541ULL },
+  { 18804, 0x2e34a24b1ULL },
+  { 18813, 0x2e04a93b1ULL },
+  { 18819, 0x2e541b741ULL },
+  { 18823, 0x2e74a64b1ULL },
+  { 18824, 0x2e74a15b6ULL },
+  { 18849, 0x2e84a74b1ULL },
+  { 18873, 0x2e24b4c11ULL },
+  { 18874, 0x2e64b84c1ULL },
+  { 18876, 0x2e94b1a05ULL },
+  { 18877, 0x2e54b6a14ULL },
+  { 18879, 0x2e94b05a1ULL },
+  { 18880, 0x2e54b64a1ULL },
+  { 18881, 0x2e54b14a6ULL },
+  { 18882, 0x2e04b3c41ULL },
+  { 18883, 0x2e64b3c61ULL },
+  { 18885, 0x2e24b3a14ULL },
+  { 18888, 0x2e24b34a1ULL },
+  { 18900, 0x2e54b1c74ULL },
+  { 18903, 0x2e74b8a14ULL },
+  { 18904, 0x2e64b1a74ULL },
+  { 18906, 0x2e74b84a1ULL },
+  { 18907, 0x2e64b14a7ULL },
+  { 18909, 0x2e94b3c71ULL },
+  { 18927, 0x2e54b74c1ULL },
+  { 18931, 0x2e64b7a14ULL },
+  { 18934, 0x2e64b74a1ULL },
+  { 18936, 0x2e94b71c3ULL },
+  { 18954, 0x2e1d1c2c1ULL },
+  { 18955, 0x2e1c62d25ULL },
+  { 18956, 0x2e1c2c6d6ULL },
+  { 18957, 0x2e1a2d2c1ULL },
+  { 18958, 0x2e1a61d61ULL },
+  { 18959, 0x2e1a6d1d6ULL },
+  { 18960, 0x2e1c1c1a1ULL },
+  { 18961, 0x2e1c6d6a1ULL },
+  { 18963, 0x2e1c51d03ULL },
+  { 18964, 0x2e1c31d62ULL },
+  { 18965, 0x2e11d3d66ULL },
+  { 18966, 0x2e1a3d1d3ULL },
+  { 18967, 0x2e1a63d63ULL },
+  { 18968, 0x2e1a36d36ULL },
+  { 18972, 0x2e1c3d3c2ULL },
+  { 18974, 0x2e1c1c3d6ULL },
+  { 18975, 0x2e1a3d3c1ULL },
+  { 18977, 0x2e1a2d3d6ULL },
+  { 18978, 0x2e1c3d3a1ULL },
+  { 18981, 0x2e1c7d7c2ULL },
+  { 18984, 0x2e1a7d7c1ULL },
+  { 18986, 0x2e1a76d76ULL },
+  { 18987, 0x2e1c7d7a1ULL },
+  { 18990, 0x2e1c53d07ULL },
+  { 18991, 0x2e1c63d27ULL },
+  { 18993, 0x2e1a73d73ULL },
+  { 19011, 0x2e1a07d07ULL },
+  { 19012, 0x2e1a67d67ULL },
+  { 19020, 0x2e1a37d37ULL },
+  { 19035, 0x2e1c1b5b8ULL },
+  { 19036, 0x2e1d6b1c8ULL },
+  { 19037, 0x2e1c2d8b6ULL },
+  { 19038, 0x2e1c9a8b1ULL },
+  { 19039, 0x2e1a6b2b9ULL },
+  { 19040, 0x2e1c1a5b6ULL },
+  { 19041, 0x2e1c8b9a1ULL },
+  { 19042, 0x2e1c5b6a1ULL },
+  { 19043, 0x2e1c5b1a6ULL },
+  { 19044, 0x2e1c1d1b3ULL },
+  { 19045, 0x2e1b21d63ULL },
+  { 19046, 0x2e1b3c1b6ULL },
+  { 19047, 0x2e1a1c2b3ULL },
+  { 19048, 0x2e1d5a6b3ULL },
+  { 19049, 0x2e1a26b36ULL },
+  { 19050, 0x2e1c2b1a3ULL },
+  { 19051, 0x2e1b3d6a1ULL },
+  { 19053, 0x2e11d33b5ULL },
+  { 19054, 0x2e161b361ULL },
+  { 19055, 0x2e1c1b3b6ULL },
+  { 19056, 0x2e1b2a3d3ULL },
+  { 19058, 0x2e1a2b3b6ULL },
+  { 19059, 0x2e1b3d3a2ULL },
+  { 19060, 0x2e1c6b3a5ULL },
+  { 19061, 0x2e1b6b3a6ULL },
+  { 19062, 0x2e1d7c1b9ULL },
+  { 19063, 0x2e1b62d87ULL },
+  { 19064, 0x2e1c56b76ULL },
+  { 19065, 0x2e1c1a7b8ULL },
+  { 19066, 0x2e1c1a6b7ULL },
+  { 19067, 0x2e1a66b76ULL },
+  { 19068, 0x2e1b7d7a2ULL },
+  { 19069, 0x2e1c6b7a1ULL },
+  { 19070, 0x2e1a7b2a6ULL },
+  { 19071, 0x2e1c7d7b3ULL },
+  { 19074, 0x2e1a5a7b3ULL },
+  { 19075, 0x2e1c6a7b3ULL },
+  { 19076, 0x2e1c3a7b6ULL },
+  { 19077, 0x2e1a7b5a3ULL },
+  { 19078, 0x2e1c7b6a3ULL },
+  { 19080, 0x2e1c2b3b7ULL },
+  { 19081, 0x2e167b367ULL },
+  { 19082, 0x2e176b376ULL },
+  { 19083, 0x2e1a3b3b7ULL },
+  { 19084, 0x2e13a63b7ULL },
+  { 19086, 0x2e1a7b3a5ULL },
+  { 19088, 0x2e1c7b3a6ULL },
+  { 19089, 0x2e1c07b27ULL },
+  { 19090, 0x2e1c67b87ULL },
+  { 19092, 0x2e1a17b27ULL },
+  { 19093, 0x2e1a57b67ULL },
+  { 19098, 0x2e1c17b37ULL },
+  { 19099, 0x2e1b37b67ULL },
+  { 19101, 0x2e1a27b37ULL },
+  { 19110, 0x2e13a73b8ULL },
+  { 19116, 0x2e11b9b22ULL },
+  { 19117, 0x2e11b2d62ULL },
+  { 19118, 0x2e15b8b16ULL },
+  { 19119, 0x2e12b8a51ULL },
+  { 19120, 0x2e16b8a55ULL },
+  { 19121, 0x2e16b2a16ULL },
+  { 19122, 0x2e12b81a5ULL },
+  { 19123, 0x2e16b26a1ULL },
+  { 19125, 0x2e11b3d93ULL },
+  { 19126, 0x2e16b12c3ULL },
+  { 19127, 0x2e16b1c36ULL },
+  { 19128, 0x2e13b8a52ULL },
+  { 19130, 0x2e16b3a06ULL },
+  { 19131, 0x2e13b82a5ULL },
+  { 19132, 0x2e16b06a3ULL },
+  { 19134, 0x2e13b33c1ULL },
+  { 19140, 0x2e13b23a1ULL },
+  { 19143, 0x2e17b2b57ULL },
+  { 19144, 0x2e16b8b17ULL },
+  { 19146, 0x2e17b2a17ULL },
+  { 19147, 0x2e18b6a77ULL },
+  { 19148, 0x2e17b8a56ULL },
+  { 19149, 0x2e17b27a1ULL },
+  { 19150, 0x2e17b86a5ULL },
+  { 19152, 0x2e17b37c1ULL },
+  { 19153, 0x2e17b3b67ULL },
+  { 19155, 0x2e17b3a07ULL },
+  { 19156, 0x2e13b6a72ULL },
+  { 19158, 0x2e17b07a3ULL },
+  { 19159, 0x2e13b62a7ULL },
+  { 19170, 0x2e17b7b08ULL },
+  { 19171, 0x2e16b7b07ULL },
+  { 19172, 0x2e15b7b06ULL },
+  { 19174, 0x2e18b7a67ULL },
+  { 19175, 0x2e17b7a66ULL },
+  { 19178, 0x2e17b76a6ULL },
+  { 19179, 0x2e12b7b03ULL },
+  { 19183, 0x2e13b7a62ULL },
+  { 19187, 0x2e13b72a6ULL },
+  { 19197, 0x2e1d42d84ULL },
+  { 19198, 0x2e1c64d29ULL },
+  { 19200, 0x2e1a4d2d8ULL },
+  { 19201, 0x2e1a64d64ULL },
+  { 19202, 0x2e1a46d46ULL },
+  { 19203, 0x2e1c4d4a1ULL },
+  { 19207, 0x2e1c32d64ULL },
+  { 19208, 0x2e1c23d46ULL },
+  { 19209, 0x2e1a43d43ULL },
+  { 19224, 0x2e1c72d45ULL },
+  { 19227, 0x2e1a74d74ULL },
+  { 19233, 0x2e1c71d43ULL },
+  { 19254, 0x2e1a47d47ULL },
+  { 19278, 0x2e1d2b1c4ULL },
+  { 19279, 0x2e1b61d84ULL },
+  { 19280, 0x2e1d4c1b6ULL },
+  { 19281, 0x2e1a1c4b5ULL },
+  { 19282, 0x2e1c4a6b4ULL },
+  { 19283, 0x2e1c4a8b6ULL },
+  { 19284, 0x2e1b4d4a2ULL },
+  { 19285, 0x2e1c6b4a4ULL },
+  { 19286, 0x2e1c8b4a6ULL },
+  { 19287, 0x2e1c93b14ULL },
+  { 19288, 0x2e1c3d6b4ULL },
+  { 19289, 0x2e13c2b46ULL },
+  { 19290, 0x2e1c3a5b4ULL },
+  { 19291, 0x2e1a4a6b3ULL },
+  { 19292, 0x2e1a36b46ULL },
+  { 19293, 0x2e1c3b4a1ULL },
+  { 19294, 0x2e1a6b4a3ULL },
+  { 19296, 0x2e1d4b3c2ULL },
+  { 19297, 0x2e164b364ULL },
+  { 19299, 0x2e1c4a3b1ULL },
+  { 19302, 0x2e1c4b3a3ULL },
+  { 19303, 0x2e1a6b3a4ULL },
+  { 19305, 0x2e1b4b7c1ULL },
+  { 19307, 0x2e1b46b76ULL },
+  { 19308, 0x2e1c5a7b4ULL },
+  { 19309, 0x2e1a64b74ULL },
+  { 19310, 0x2e1b4a7b6ULL },
+  { 19311, 0x2e1c7b5a4ULL },
+  { 19312, 0x2e1b7b6a4ULL },
+  { 19313, 0x2e1b7b4a6ULL },
+  { 19314, 0x2e1b43b73ULL },
+  { 19317, 0x2e17a37b4ULL },
+  { 19323, 0x2e174b374ULL },
+  { 19332, 0x2e1c27b47ULL },
+  { 19333, 0x2e1c47b67ULL },
+  { 19335, 0x2e1a47b57ULL },
+  { 19344, 0x2e1a37b47ULL },
+  { 19359, 0x2e11b4d25ULL },
+  { 19360, 0x2e12b2d64ULL },
+  { 19361, 0x2e16b1b46ULL },
+  { 19362, 0x2e12b9a41ULL },
+  { 19363, 0x2e16b9a45ULL },
+  { 19365, 0x2e12b91a4ULL },
+  { 19366, 0x2e16b95a4ULL },
+  { 19368, 0x2e13b1b43ULL },
+  { 19371, 0x2e13b9a42ULL },
+  { 19374, 0x2e13b92a4ULL },
+  { 19386, 0x2e17b1b47ULL },
+  { 19388, 0x2e16b4b76ULL },
+  { 19389, 0x2e18b9a47ULL },
+  { 19390, 0x2e15b6a74ULL },
+  { 19391, 0x2e17b9a46ULL },
+  { 19392, 0x2e18b97a4ULL },
+  { 19393, 0x2e17b96a4ULL },
+  { 19395, 0x2e13b4b73ULL },
+  { 19417, 0x2e15b7a64ULL },
+  { 19421, 0x2e15b74a6ULL },
+  { 19422, 0x2e13b7b04ULL },
+  { 19440, 0x2e14d1d28ULL },
+  { 19446, 0x2e14d14a1ULL },
+  { 19451, 0x2e143d286ULL },
+  { 19521, 0x2e14d28b4ULL },
+  { 19524, 0x2e14a04b1ULL },
+  { 19526, 0x2e14a54b6ULL },
+  { 19530, 0x2e14d14b3ULL },
+  { 19533, 0x2e14a24b3ULL },
+  { 19539, 0x2e141b341ULL },
+  { 19541, 0x2e146b346ULL },
+  { 19552, 0x2e14a64b7ULL },
+  { 19566, 0x2e147b347ULL },
+  { 19578, 0x2e14a74b8ULL },
+  { 19602, 0x2e14b2b54ULL },
+  { 19603, 0x2e14b6b94ULL },
+  { 19605, 0x2e14b2a14ULL },
+  { 19608, 0x2e14b24a1ULL },
+  { 19611, 0x2e14b34c1ULL },
+  { 19612, 0x2e14b3b64ULL },
+  { 19614, 0x2e14b9a43ULL },
+  { 19617, 0x2e14b04a3ULL },
+  { 19626, 0x2e14b93a4ULL },
+  { 19629, 0x2e14b4b74ULL },
+  { 19642, 0x2e14b6a73ULL },
+  { 19654, 0x2e14b63a7ULL },
+  { 19656, 0x2e14b7b05ULL },
+  { 19669, 0x2e14b7a63ULL },
+};
+
+static const struct opening openings[LIMIT_MAX_EQ_SZ + 1] = {
+  /* 3+1=4 */
+  [5] = { STRATEGY_PARTITION, 2048, 118, 0x4e1a3ULL, openings_second_5, 31 },
+  /* 28/7=4 */
+  [6] = { STRATEGY_PARTITION, 2048, 206, 0x4e7d82ULL, openings_second_6, 72 },
+  /* 5+26=31 */
+  [7] = { STRATEGY_PARTITION, 2048, 6183, 0x13e62a5ULL, openings_second_7, 604 },
+  /* 48-36=12 */
+  [8] = { STRATEGY_PARTITION, 2048, 16804, 0x21e63b84ULL, openings_second_8, 1643 },
+  /* 6+37-41=2 */
+  [9] = { STRATEGY_PARTITION, 2048, 258201, 0x2e14b73a6ULL, openings_second_9, 6675 },
+};
+
+#endif /* !__OPENINGS__ */
@@ -0,0 +1,173 @@
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "score.h"
+#include "feedback.h"
+#include "equation.h"
+#include "table.h"
+
+/**
+ * Number of guesses scored by a thread at once.
+ */
+#define BLOCK_SZ 16
+
+/**
+ * Scoring shared by the threads.
+ * The guesses and the answers are the candidates taken with a step,
+ * the answers are indexed to be partitioned (@c table_partition).
+ */
+struct scorer {
+  const uint64_t *eqs;
+  uint32_t sz;
+  enum strategy strategy;
+  uint64_t nr_guess;
+  uint64_t guess_step;
+  const struct table *answers;
+  uint64_t next; /* next guess to score */
+  /* Best guess */
+  pthread_mutex_t lock;
+  double best_cost;
+  uint64_t best;
+};
+
+/**
+ * Cost of a guess: the lower the better.
+ *  + entropy: sum(c * log2(c)) = N * (log2(N) - expected information).
+ *  + partition: sum(c * c) = N * expected number of candidates remaining.
+ * With c the number of answers by pattern.
+ */
+static double score_guess(const struct scorer *scorer, uint64_t guess,
+                          uint32_t *sizes, uint64_t *scratch)
+{
+  uint32_t nr_part = table_partition(scorer->answers, guess, sizes, scratch);
+  double cost = 0;
+
+  for (uint32_t i = 0; i < nr_part; ++i) {
+    double c = sizes[i];
+    cost += scorer->strategy == STRATEGY_ENTROPY ? c * log2(c) : c * c;
+  }
+  return cost;
+}
+
+static void* score_worker(void *arg)
+{
+  struct scorer *scorer = arg;
+  uint32_t *sizes = calloc(scorer->answers->nr, sizeof(*sizes));
+  uint64_t *scratch = calloc(table_partition_scratch(scorer->answers),
+                             sizeof(*scratch));
+  double best_cost = INFINITY;
+  uint64_t best = 0;
+  uint64_t first;
+
+  while ((first = __atomic_fetch_add(&scorer->next, BLOCK_SZ, __ATOMIC_RELAXED))
+         < scorer->nr_guess) {
+    uint64_t last = first + BLOCK_SZ;
+    if (last > scorer->nr_guess) {
+      last = scorer->nr_guess;
+    }
+    for (uint64_t i = first; i < last; ++i) {
+      uint64_t index = i * scorer->guess_step;
+      double cost = score_guess(scorer, scorer->eqs[index], sizes, scratch);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best = index;
+      }
+    }
+  }
+
+  /* Ties are broken by the lowest index, whatever the threads. */
+  pthread_mutex_lock(&scorer->lock);
+  if (best_cost < scorer->best_cost ||
+      (best_cost == scorer->best_cost && best < scorer->best)) {
+    scorer->best_cost = best_cost;
+    scorer->best = best;
+  }
+  pthread_mutex_unlock(&scorer->lock);
+
+  free(scratch);
+  free(sizes);
+  return NULL;
+}
+
+static uint64_t score_best_variance(const uint64_t *eqs, uint64_t nr, uint32_t sz)
+{
+  uint64_t best = 0;
+  uint32_t best_variance = 0;
+
+  for (uint64_t i = 0; i < nr; ++i) {
+    uint32_t variance = equation_packed_get_variance(eqs[i], sz);
+    if (variance > best_variance) {
+      best_variance = variance;
+      best = i;
+    }
+  }
+  return best;
+}
+
+enum strategy score_parse_strategy(const char *str)
+{
+  if (strcmp(str, "entropy") == 0) {
+    return STRATEGY_ENTROPY;
+  }
+  if (strcmp(str, "partition") == 0) {
+    return STRATEGY_PARTITION;
+  }
+  return STRATEGY_VARIANCE;
+}
+
+uint64_t score_best_guess(const uint64_t *eqs, uint64_t nr, uint32_t sz,
+                          enum strategy strategy, uint32_t sample,
+                          uint32_t nr_thread)
+{
+  if (strategy == STRATEGY_VARIANCE) {
+    return score_best_variance(eqs, nr, sz);
+  }
+
+  struct scorer scorer = {
+    .eqs = eqs,
+    .sz = sz,
+    .strategy = strategy,
+    .nr_guess = nr,
+    .guess_step = 1,
+    .best_cost = INFINITY,
+    .best = nr,
+  };
+  uint64_t nr_answer = nr;
+  uint64_t answer_step = 1;
+  if (sample != 0 && nr > sample) {
+    scorer.guess_step = answer_step = nr / sample;
+    scorer.nr_guess = nr_answer = sample;
+  }
+  uint64_t *answers = malloc(nr_answer * sizeof(uint64_t));
+  for (uint64_t i = 0; i < nr_answer; ++i) {
+    answers[i] = eqs[i * answer_step];
+  }
+  struct table *table = table_create(sz, answers, nr_answer);
+  scorer.answers = table;
+  if (nr_thread == 0) {
+    nr_thread = 1;
+  }
+
+  pthread_mutex_init(&scorer.lock, NULL);
+  pthread_t *threads = calloc(nr_thread, sizeof(*threads));
+  uint32_t nr_created = 0;
+  while (nr_created < nr_thread &&
+         pthread_create(&threads[nr_created], NULL, score_worker, &scorer) == 0) {
+    ++nr_created;
+  }
+  /* no thread created: serial */
+  if (nr_created == 0) {
+    score_worker(&scorer);
+  }
+  for (uint32_t i = 0; i < nr_created; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+  pthread_mutex_destroy(&scorer.lock);
+  table_destroy(table);
+  free(answers);
+
+  return scorer.best;
+}
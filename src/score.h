@@ -0,0 +1,46 @@
+#ifndef __SCORE__
+#define __SCORE__
+
+#include <stdint.h>
+
+/**
+ * Strategy used to select the next guess among the candidates.
+ */
+enum strategy {
+  STRATEGY_VARIANCE,  /* most different symbols */
+  STRATEGY_ENTROPY,   /* maximal expected information of the feedback */
+  STRATEGY_PARTITION, /* minimal expected number of candidates remaining */
+};
+
+/**
+ * Default maximal number of guesses (and answers) scored by round.
+ */
+#define DEFAULT_SAMPLE 2048
+
+/**
+ * Parse the name of a strategy (variance, entropy, partition).
+ *
+ * @param str name of the strategy.
+ * @return strategy, @c STRATEGY_VARIANCE if unknown.
+ */
+enum strategy score_parse_strategy(const char *str);
+
+/**
+ * Find the best guess among the candidates.
+ * For the strategies based on the feedback, each guess partitions the
+ * candidates (possible answers) by feedback pattern. Above @c sample
+ * candidates, guesses and answers are sampled with a constant step.
+ *
+ * @param eqs candidates (equations packed).
+ * @param nr number of candidates (> 0).
+ * @param sz size of the equations.
+ * @param strategy strategy of the selection.
+ * @param sample maximal number of guesses and answers (0: no sampling).
+ * @param nr_thread number of threads scoring the guesses.
+ * @return index of the best guess in @c eqs.
+ */
+uint64_t score_best_guess(const uint64_t *eqs, uint64_t nr, uint32_t sz,
+                          enum strategy strategy, uint32_t sample,
+                          uint32_t nr_thread);
+
+#endif /* !__SCORE__ */
@@ -0,0 +1,290 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "search.h"
+#include "dict.h"
+#include "feedback.h"
+#include "utils.h"
+
+struct search_cache* search_cache_create(uint32_t nr_bit)
+{
+  struct search_cache *cache = calloc(1, sizeof(*cache));
+
+  pthread_mutex_init(&cache->lock, NULL);
+  cache->mask = (1ULL << nr_bit) - 1;
+  cache->entries = calloc(cache->mask + 1, sizeof(*cache->entries));
+  return cache;
+}
+
+void search_cache_destroy(struct search_cache *cache)
+{
+  pthread_mutex_destroy(&cache->lock);
+  free(cache->entries);
+  free(cache);
+}
+
+void search_cache_dump(const struct search_cache *cache)
+{
+  uint64_t nr = cache->nr_hit + cache->nr_miss;
+
+  printf("[nerdle] search cache: %lu hits, %lu misses (%.1f%%)\n",
+         cache->nr_hit, cache->nr_miss,
+         nr > 0 ? 100.0 * cache->nr_hit / nr : 0);
+}
+
+/**
+ * Get the result of a node searched at least as deep.
+ */
+static bool search_cache_get(struct search_cache *cache, uint64_t key,
+                             uint32_t nr, uint32_t depth,
+                             struct search_entry *entry)
+{
+  bool found;
+
+  pthread_mutex_lock(&cache->lock);
+  *entry = cache->entries[key & cache->mask];
+  found = entry->key == key && entry->nr == nr && entry->depth >= depth;
+  if (found == true) {
+    ++cache->nr_hit;
+  } else {
+    ++cache->nr_miss;
+  }
+  pthread_mutex_unlock(&cache->lock);
+  return found;
+}
+
+/**
+ * Store the result of a node, unless the node is already searched deeper.
+ */
+static void search_cache_put(struct search_cache *cache,
+                             const struct search_entry *entry)
+{
+  pthread_mutex_lock(&cache->lock);
+  struct search_entry *slot = &cache->entries[entry->key & cache->mask];
+  if (slot->key != entry->key || slot->nr != entry->nr ||
+      slot->depth <= entry->depth) {
+    *slot = *entry;
+  }
+  pthread_mutex_unlock(&cache->lock);
+}
+
+/**
+ * Context of a search.
+ */
+struct context {
+  const struct search *search;
+  uint32_t win; /* pattern: all the locations RIGHT */
+  double deadline;
+  bool expired;
+  /* Memory of the nodes, rewound at the end of each node */
+  struct arena *scratch;
+};
+
+/**
+ * Candidate of a part (sorted by pattern, then by index).
+ */
+struct member {
+  uint32_t pattern;
+  uint32_t index;
+};
+
+static int compare_member(const void *a, const void *b)
+{
+  const struct member *m1 = a;
+  const struct member *m2 = b;
+
+  if (m1->pattern != m2->pattern) {
+    return m1->pattern < m2->pattern ? -1 : 1;
+  }
+  return m1->index < m2->index ? -1 : m1->index > m2->index;
+}
+
+/**
+ * Partition the candidates by feedback pattern of a guess.
+ */
+static void search_partition(const struct context *ctx, const uint64_t *eqs,
+                             uint64_t nr, uint64_t guess, struct member *members)
+{
+  for (uint64_t i = 0; i < nr; ++i) {
+    members[i].pattern = feedback_pattern(guess, eqs[i], ctx->search->sz);
+    members[i].index = i;
+  }
+  qsort(members, nr, sizeof(*members), compare_member);
+}
+
+/**
+ * Guess ranked by partition cost (sum of the squares of the parts).
+ */
+struct rank {
+  uint64_t cost;
+  uint32_t index;
+};
+
+/**
+ * Rank the candidates as guesses, keep the @c width best.
+ * Return the number of guesses kept.
+ */
+static uint32_t search_rank(const struct context *ctx, const uint64_t *eqs,
+                            uint64_t nr, struct member *members,
+                            struct rank *ranks)
+{
+  uint32_t width = ctx->search->width;
+  uint32_t nr_rank = 0;
+
+  for (uint64_t g = 0; g < nr; ++g) {
+    search_partition(ctx, eqs, nr, eqs[g], members);
+    struct rank rank = { 0, g };
+    for (uint64_t i = 0, j; i < nr; i = j) {
+      for (j = i + 1; j < nr && members[j].pattern == members[i].pattern; ++j) {
+      }
+      rank.cost += (j - i) * (j - i);
+    }
+
+    /* insertion, ties broken by the lowest index */
+    if (nr_rank == width && ranks[width - 1].cost <= rank.cost) {
+      continue;
+    }
+    uint32_t k = nr_rank < width ? nr_rank++ : width - 1;
+    for (; k > 0 && ranks[k - 1].cost > rank.cost; --k) {
+      ranks[k] = ranks[k - 1];
+    }
+    ranks[k] = rank;
+  }
+  return nr_rank;
+}
+
+static double search_node(struct context *ctx, const uint64_t *eqs,
+                          uint64_t nr, uint32_t depth, uint64_t *best);
+
+/**
+ * Expected number of rounds of a guess (stop above @c bound).
+ */
+static double search_guess(struct context *ctx, const uint64_t *eqs,
+                           uint64_t nr, uint64_t guess, uint32_t depth,
+                           double bound)
+{
+  struct arena_mark mark = arena_get_mark(ctx->scratch);
+  struct member *members = arena_alloc(ctx->scratch, nr * sizeof(*members));
+  uint64_t *part = arena_alloc(ctx->scratch, nr * sizeof(uint64_t));
+  double cost = 1;
+
+  search_partition(ctx, eqs, nr, guess, members);
+  for (uint64_t i = 0, j; i < nr && cost < bound; i = j) {
+    for (j = i + 1; j < nr && members[j].pattern == members[i].pattern; ++j) {
+    }
+    if (members[i].pattern == ctx->win) {
+      continue;
+    }
+
+    uint64_t m = j - i;
+    double sub;
+    if (depth == 0) {
+      sub = (2.0 * m - 1) / m;
+    } else {
+      uint64_t unused;
+      for (uint64_t k = 0; k < m; ++k) {
+        part[k] = eqs[members[i + k].index];
+      }
+      sub = search_node(ctx, part, m, depth - 1, &unused);
+      if (ctx->expired == true) {
+        break;
+      }
+    }
+    cost += (double)m / nr * sub;
+  }
+
+  arena_rewind(ctx->scratch, mark);
+  return cost;
+}
+
+/**
+ * Expected number of rounds to find the answer among the candidates
+ * with the best guess @c best.
+ */
+static double search_node(struct context *ctx, const uint64_t *eqs,
+                          uint64_t nr, uint32_t depth, uint64_t *best)
+{
+  struct search_cache *cache = ctx->search->cache;
+  struct search_entry entry;
+
+  *best = 0;
+  if (nr <= 2) {
+    return nr == 1 ? 1 : 1.5;
+  }
+  if (depth > 0 && utils_now() > ctx->deadline) {
+    ctx->expired = true;
+    return 0;
+  }
+
+  uint64_t key = dict_checksum(eqs, nr) | 1;
+  if (cache != NULL && search_cache_get(cache, key, nr, depth, &entry) == true) {
+    for (uint64_t i = 0; i < nr; ++i) {
+      if (eqs[i] == entry.guess) {
+        *best = i;
+        return entry.cost;
+      }
+    }
+  }
+
+  struct arena_mark mark = arena_get_mark(ctx->scratch);
+  struct member *members = arena_alloc(ctx->scratch, nr * sizeof(*members));
+  struct rank *ranks = arena_alloc(ctx->scratch,
+                                   ctx->search->width * sizeof(*ranks));
+  uint32_t nr_rank = search_rank(ctx, eqs, nr, members, ranks);
+  double best_cost = INFINITY;
+
+  for (uint32_t r = 0; r < nr_rank && ctx->expired == false; ++r) {
+    uint64_t g = ranks[r].index;
+    double cost = search_guess(ctx, eqs, nr, eqs[g], depth, best_cost);
+    if (ctx->expired == false && cost < best_cost) {
+      best_cost = cost;
+      *best = g;
+    }
+  }
+  arena_rewind(ctx->scratch, mark);
+
+  if (ctx->expired == false && cache != NULL) {
+    entry = (struct search_entry){ key, nr, depth, best_cost, eqs[*best] };
+    search_cache_put(cache, &entry);
+  }
+  return best_cost;
+}
+
+uint64_t search_best_guess(const struct search *search, const uint64_t *eqs,
+                           uint64_t nr, double *cost)
+{
+  struct context ctx = {
+    .search = search,
+    .win = feedback_nr_pattern(search->sz) - 1,
+    .deadline = search->budget > 0 ? utils_now() + search->budget : INFINITY,
+    .scratch = search->scratch,
+  };
+  struct arena arena;
+  uint64_t best = 0;
+  double best_cost = 0;
+
+  if (ctx.scratch == NULL) {
+    arena_init(&arena, 0);
+    ctx.scratch = &arena;
+  }
+
+  /* iterative deepening: the depth 0 is never out of time */
+  for (uint32_t depth = 0; depth < search->depth || depth == 0; ++depth) {
+    uint64_t index;
+    double c = search_node(&ctx, eqs, nr, depth, &index);
+    if (ctx.expired == true) {
+      break;
+    }
+    best = index;
+    best_cost = c;
+  }
+  if (ctx.scratch == &arena) {
+    arena_release(&arena);
+  }
+  if (cost != NULL) {
+    *cost = best_cost;
+  }
+  return best;
+}
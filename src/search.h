@@ -0,0 +1,106 @@
+#ifndef __SEARCH__
+#define __SEARCH__
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+/**
+ * Lookahead search of the next guess: the guess minimizing the expected
+ * number of rounds to find the answer (uniform among the candidates),
+ * the candidates being partitioned by feedback pattern of the guess,
+ * up to a depth. Below the depth, a part is estimated by its lower
+ * bound: one round if alone, (2n - 1) / n otherwise.
+ * Only the best guesses of a node by partition cost are searched
+ * (@c width), and the depth is deepened while the time budget allows.
+ */
+
+/**
+ * Maximal number of candidates searched (above: greedy).
+ */
+#define SEARCH_MAX_CANDIDATES 512
+
+/**
+ * Default number of guesses searched by node.
+ */
+#define SEARCH_DEFAULT_WIDTH 8
+
+/**
+ * Default log2 of the number of entries of a transposition table.
+ */
+#define SEARCH_CACHE_BIT 18
+
+/**
+ * Transposition table: the results of the nodes searched, keyed by the
+ * hash of the set of candidates, shared by the games (thread-safe).
+ */
+struct search_entry {
+  uint64_t key;   /* hash of the candidates (@c dict_checksum), 0: empty */
+  uint32_t nr;    /* number of candidates */
+  uint32_t depth; /* depth searched */
+  double cost;    /* expected number of rounds */
+  uint64_t guess; /* best guess (equation packed) */
+};
+
+struct search_cache {
+  pthread_mutex_t lock;
+  struct search_entry *entries;
+  uint64_t mask; /* number of entries - 1 */
+  uint64_t nr_hit;
+  uint64_t nr_miss;
+};
+
+/**
+ * Parameters of a search.
+ */
+struct search {
+  uint32_t sz;
+  /* Maximal depth (1: the next guess and the parts) */
+  uint32_t depth;
+  /* Number of guesses searched by node */
+  uint32_t width;
+  /* Time budget by move in seconds (0: no limit) */
+  double budget;
+  /* Transposition table (NULL: none) */
+  struct search_cache *cache;
+  /* Scratch memory of the nodes (NULL: an arena of the search) */
+  struct arena *scratch;
+};
+
+/**
+ * Create a transposition table.
+ *
+ * @param nr_bit log2 of the number of entries.
+ * @return cache handle allocated.
+ */
+struct search_cache* search_cache_create(uint32_t nr_bit);
+
+/**
+ * Destroy a transposition table previously allocated from
+ * @c search_cache_create.
+ *
+ * @param cache cache handle.
+ */
+void search_cache_destroy(struct search_cache *cache);
+
+/**
+ * Dump the hits and misses of a transposition table.
+ *
+ * @param cache cache handle.
+ */
+void search_cache_dump(const struct search_cache *cache);
+
+/**
+ * Find the best guess among the candidates.
+ *
+ * @param search parameters of the search.
+ * @param eqs candidates (equations packed, <= @c SEARCH_MAX_CANDIDATES).
+ * @param nr number of candidates (> 0).
+ * @param cost expected number of rounds output (NULL: ignored).
+ * @return index of the best guess in @c eqs.
+ */
+uint64_t search_best_guess(const struct search *search, const uint64_t *eqs,
+                           uint64_t nr, double *cost);
+
+#endif /* !__SEARCH__ */
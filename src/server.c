@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "server.h"
+#include "feedback.h"
+#include "utils.h"
+
+void server_init(struct server *server, uint32_t seed)
+{
+  memset(server, 0, sizeof(*server));
+  pthread_mutex_init(&server->lock, NULL);
+  server->seed = seed;
+}
+
+void server_release(struct server *server)
+{
+  for (uint32_t sz = 0; sz <= LIMIT_MAX_EQ_SZ; ++sz) {
+    if (server->answers[sz] != NULL) {
+      nerdle_destroy(server->answers[sz]);
+    }
+  }
+  pthread_mutex_destroy(&server->lock);
+}
+
+/**
+ * Choose a hidden equation of size sz.
+ */
+static uint64_t server_choose(struct server *server, uint32_t sz)
+{
+  pthread_mutex_lock(&server->lock);
+  if (server->answers[sz] == NULL) {
+    struct nerdle *nerdle = nerdle_create(sz, 0);
+    nerdle->verbose = false;
+    nerdle_generate_equations(nerdle);
+    server->answers[sz] = nerdle;
+  }
+  uint32_t seed = server->seed++;
+  const struct candidates *c = &server->answers[sz]->candidates;
+  pthread_mutex_unlock(&server->lock);
+
+  return c->eqs[rand_r(&seed) % c->nr];
+}
+
+/**
+ * State of a session.
+ */
+struct session {
+  uint32_t sz; /* 0: not started */
+  uint64_t answer;
+};
+
+static void session_start(struct server *server, struct session *session,
+                          const char *arg, FILE *out)
+{
+  uint32_t sz = atoi(arg);
+  if (sz < LIMIT_MIN_EQ_SZ || sz > LIMIT_MAX_EQ_SZ) {
+    fprintf(out, "ERROR invalid size\n");
+    return;
+  }
+  session->sz = sz;
+  session->answer = server_choose(server, sz);
+  fprintf(out, "OK\n");
+}
+
+static void session_guess(struct session *session, const char *arg, FILE *out)
+{
+  struct equation eq = { .sz = session->sz };
+  enum status status[LIMIT_MAX_EQ_SZ];
+  char str[LIMIT_MAX_EQ_SZ];
+
+  if (session->sz == 0) {
+    fprintf(out, "ERROR not started\n");
+    return;
+  }
+  if (strlen(arg) != session->sz) {
+    fprintf(out, "ERROR invalid size\n");
+    return;
+  }
+  if (utils_str_to_eq(arg, &eq, eq.sz) == false ||
+      equation_check_semantic(&eq) == false ||
+      equation_check_equality(&eq) == false) {
+    fprintf(out, "ERROR invalid equation\n");
+    return;
+  }
+  uint32_t pattern = feedback_pattern(equation_pack(&eq), session->answer,
+                                      session->sz);
+  feedback_get_status(pattern, session->sz, status);
+  feedback_to_str(status, session->sz, str);
+  fprintf(out, "FEEDBACK %.*s\n", session->sz, str);
+}
+
+void server_session(struct server *server, int fd_in, int fd_out)
+{
+  FILE *in = fdopen(fd_in, "r");
+  FILE *out = fdopen(fd_in == fd_out ? dup(fd_out) : fd_out, "w");
+  struct session session = { 0, 0 };
+  char *line = NULL;
+  size_t line_sz = 0;
+  ssize_t len;
+
+  while ((len = getline(&line, &line_sz, in)) > 0) {
+    if (line[len - 1] == '\n') {
+      line[--len] = '\0';
+    }
+    if (strncmp(line, "START ", 6) == 0) {
+      session_start(server, &session, line + 6, out);
+    } else if (strncmp(line, "GUESS ", 6) == 0) {
+      session_guess(&session, line + 6, out);
+    } else if (strcmp(line, "QUIT") == 0) {
+      break;
+    } else {
+      fprintf(out, "ERROR unknown command\n");
+    }
+    fflush(out);
+  }
+
+  free(line);
+  fclose(in);
+  fclose(out);
+}
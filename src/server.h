@@ -0,0 +1,50 @@
+#ifndef __SERVER__
+#define __SERVER__
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "nerdle.h"
+
+/**
+ * Mock of the Nerdle site, one game by session.
+ * Line protocol (one command by line, one answer by command):
+ *   + START <size>: new hidden equation -> OK
+ *   + GUESS <equation>: -> FEEDBACK <status by location: R, W or D>
+ *   + QUIT: end of the session.
+ * An invalid command is answered by ERROR <message>.
+ */
+struct server {
+  pthread_mutex_t lock;
+  /* Hidden equations by size (generated on demand) */
+  struct nerdle *answers[LIMIT_MAX_EQ_SZ + 1];
+  /* Seed of the next session */
+  uint32_t seed;
+};
+
+/**
+ * Initialize a server.
+ *
+ * @param server server handle.
+ * @param seed seed of the choice of the hidden equations.
+ */
+void server_init(struct server *server, uint32_t seed);
+
+/**
+ * Release the resources of a server.
+ *
+ * @param server server handle.
+ */
+void server_release(struct server *server);
+
+/**
+ * Serve a session until QUIT or the end of the input.
+ * Sessions can be served concurrently.
+ *
+ * @param server server handle.
+ * @param fd_in input (closed at the end).
+ * @param fd_out output (closed at the end, can be @c fd_in).
+ */
+void server_session(struct server *server, int fd_in, int fd_out);
+
+#endif /* !__SERVER__ */
@@ -0,0 +1,124 @@
+#include <stdio.h>
+
+#include "sim.h"
+#include "feedback.h"
+#include "first_equations.h"
+#include "utils.h"
+
+void sim_run(struct nerdle *nerdle, struct sim_game *game)
+{
+  uint32_t sz = nerdle->sz;
+  uint32_t win = feedback_nr_pattern(sz) - 1; /* all the locations RIGHT */
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  game->nr_round = 0;
+  game->won = false;
+
+  double start = utils_now();
+  nerdle_set_first_equation(nerdle, &eq);
+  while (game->nr_round < SIM_MAX_ROUND) {
+    game->latency[game->nr_round++] = utils_now() - start;
+
+    uint32_t pattern = feedback_pattern(equation_pack(&eq), game->answer, sz);
+    if (pattern == win) {
+      game->won = true;
+      break;
+    }
+    feedback_get_status(pattern, sz, status);
+    nerdle_update_feedback(nerdle, &eq, status);
+
+    start = utils_now();
+    nerdle_find_best_equation(nerdle, &eq);
+  }
+
+  game->arena_high = nerdle->arena.high;
+  game->scratch_high = nerdle->scratch.high;
+}
+
+void sim_play(const struct nerdle *model, struct sim_game *game)
+{
+  struct nerdle *nerdle = nerdle_create(model->sz, model->limit);
+
+  nerdle->nr_thread = model->nr_thread;
+  nerdle->strategy = model->strategy;
+  nerdle->sample = model->sample;
+  nerdle->depth = model->depth;
+  nerdle->budget = model->budget;
+  nerdle->cache = model->cache;
+  nerdle->decisions = model->decisions;
+  nerdle->verbose = false;
+  if (model->table != NULL) {
+    nerdle_set_table(nerdle, model->table);
+  } else {
+    nerdle_set_equations(nerdle, model->candidates.eqs, model->candidates.nr);
+  }
+
+  sim_run(nerdle, game);
+  nerdle_destroy(nerdle);
+}
+
+void sim_stats_add(struct sim_stats *stats, const struct sim_game *game)
+{
+  ++stats->nr_game;
+  if (game->won == true) {
+    ++stats->histogram[game->nr_round];
+    if (game->nr_round <= MAX_NR_ROUND) {
+      ++stats->nr_win;
+    }
+  } else {
+    ++stats->histogram[0];
+  }
+
+  for (uint32_t round = 0; round < game->nr_round; ++round) {
+    double latency = game->latency[round];
+    ++stats->nr_latency[round];
+    stats->sum_latency[round] += latency;
+    if (latency > stats->max_latency[round]) {
+      stats->max_latency[round] = latency;
+    }
+  }
+  if (game->arena_high > stats->arena_high) {
+    stats->arena_high = game->arena_high;
+  }
+  if (game->scratch_high > stats->scratch_high) {
+    stats->scratch_high = game->scratch_high;
+  }
+}
+
+void sim_stats_dump(const struct sim_stats *stats)
+{
+  uint64_t nr_guess = 0;
+  uint64_t nr_failure = stats->nr_game - stats->nr_win;
+
+  for (uint32_t round = 1; round <= SIM_MAX_ROUND; ++round) {
+    nr_guess += round * stats->histogram[round];
+  }
+
+  printf("[nerdle] games:%lu, wins:%lu, failures:%lu (%.2f%%)\n",
+         stats->nr_game, stats->nr_win, nr_failure,
+         stats->nr_game != 0 ? 100.0 * nr_failure / stats->nr_game : 0.0);
+  printf("[nerdle] guesses by game won: %.3f\n",
+         stats->nr_game != stats->histogram[0] ?
+         (double)nr_guess / (stats->nr_game - stats->histogram[0]) : 0.0);
+
+  printf("[nerdle] histogram [");
+  for (uint32_t round = 1; round <= SIM_MAX_ROUND; ++round) {
+    if (stats->histogram[round] != 0) {
+      printf("{%u: %lu}, ", round, stats->histogram[round]);
+    }
+  }
+  printf("{never: %lu}]\n", stats->histogram[0]);
+
+  for (uint32_t round = 0; round < SIM_MAX_ROUND; ++round) {
+    if (stats->nr_latency[round] == 0) {
+      continue;
+    }
+    printf("[nerdle] round %u: %lu games, latency mean:%.3fms max:%.3fms\n",
+           round, stats->nr_latency[round],
+           1e3 * stats->sum_latency[round] / stats->nr_latency[round],
+           1e3 * stats->max_latency[round]);
+  }
+  printf("[nerdle] memory by game: high-water arena:%.1fKB scratch:%.1fKB\n",
+         stats->arena_high / 1024.0, stats->scratch_high / 1024.0);
+}
@@ -0,0 +1,84 @@
+#ifndef __SIM__
+#define __SIM__
+
+#include <stdint.h>
+
+#include "nerdle.h"
+
+/**
+ * Headless game: the solver plays against a hidden equation and the
+ * feedback is computed locally (@c feedback_pattern), no display needed.
+ */
+
+/**
+ * Maximum number of rounds played by a game (a game not won in
+ * @c MAX_NR_ROUND rounds is a failure but is still played).
+ */
+#define SIM_MAX_ROUND 16
+
+struct sim_game {
+  /* Hidden equation packed */
+  uint64_t answer;
+  /* Number of rounds played (number of guesses if won) */
+  uint32_t nr_round;
+  bool won;
+  /* Time to find the guess of each round (seconds) */
+  double latency[SIM_MAX_ROUND];
+  /* High-water marks of the arenas of the solver (bytes) */
+  size_t arena_high;
+  size_t scratch_high;
+};
+
+/**
+ * Statistics of the games played.
+ */
+struct sim_stats {
+  uint64_t nr_game;
+  /* Games won in at most MAX_NR_ROUND rounds */
+  uint64_t nr_win;
+  /* histogram[i]: games won in i rounds (0: never won) */
+  uint64_t histogram[SIM_MAX_ROUND + 1];
+  /* Latency by round: number of games, sum and maximum (seconds) */
+  uint64_t nr_latency[SIM_MAX_ROUND];
+  double sum_latency[SIM_MAX_ROUND];
+  double max_latency[SIM_MAX_ROUND];
+  /* Maximal high-water marks of the arenas of a game (bytes) */
+  size_t arena_high;
+  size_t scratch_high;
+};
+
+/**
+ * Play a game with a solver ready (configured, equations set).
+ *
+ * @param nerdle nerdle handle (updated by the rounds played).
+ * @param game game handle (answer set by the caller).
+ */
+void sim_run(struct nerdle *nerdle, struct sim_game *game);
+
+/**
+ * Play a game: the solver is configured as @c model (size, strategy,
+ * sample, threads, search, decisions) and starts from the candidates of @c model,
+ * sharing its table if built (@c nerdle_get_table).
+ *
+ * @param model nerdle handle with all the candidates (not modified).
+ * @param game game handle (answer set by the caller).
+ */
+void sim_play(const struct nerdle *model, struct sim_game *game);
+
+/**
+ * Add a game played to the statistics.
+ *
+ * @param stats statistics handle (zeroed before the first game).
+ * @param game game played.
+ */
+void sim_stats_add(struct sim_stats *stats, const struct sim_game *game);
+
+/**
+ * Dump the statistics: histogram of the guesses, failure rate,
+ * latency by round and high-water marks of the memory of a game.
+ *
+ * @param stats statistics handle.
+ */
+void sim_stats_dump(const struct sim_stats *stats);
+
+#endif /* !__SIM__ */
@@ -0,0 +1,214 @@
+#include <stdlib.h>
+
+#include "table.h"
+
+struct table* table_create(uint32_t sz, const uint64_t *eqs, uint64_t nr)
+{
+  struct table *table = calloc(1, sizeof(*table));
+
+  table->sz = sz;
+  table->eqs = eqs;
+  table->nr = nr;
+  table->nr_word = (nr + 63) / 64;
+  table->positions = calloc(sz * SYMBOL_END * table->nr_word,
+                            sizeof(uint64_t));
+  table->counts = calloc(SYMBOL_END * sz * table->nr_word, sizeof(uint64_t));
+
+  for (uint64_t i = 0; i < nr; ++i) {
+    uint64_t bit = 1ULL << (i % 64);
+    uint64_t word = i / 64;
+    uint32_t count[SYMBOL_END] = { 0 };
+    for (uint32_t pos = 0; pos < sz; ++pos) {
+      enum symbol symbol = equation_packed_symbol(eqs[i], pos);
+      uint32_t k = count[symbol]++;
+      table->positions[(pos * SYMBOL_END + symbol) * table->nr_word + word] |= bit;
+      table->counts[(symbol * sz + k) * table->nr_word + word] |= bit;
+    }
+  }
+  return table;
+}
+
+void table_destroy(struct table *table)
+{
+  free(table->counts);
+  free(table->positions);
+  free(table);
+}
+
+/**
+ * Levels of the partition of a guess: a binary split by level.
+ *  + sz levels by position: the symbol of the guess is at the position.
+ *  + then for each symbol of the guess occurring n times, n levels by
+ *    number of occurrences k = 1..n: at least k occurrences.
+ */
+#define MAX_LEVEL (2 * LIMIT_MAX_EQ_SZ)
+
+struct partition {
+  const struct table *table;
+  uint32_t nr_level;
+  const uint64_t *bits[MAX_LEVEL];
+  /* position levels: symbol, count levels: symbol and k */
+  enum symbol symbol[MAX_LEVEL];
+  uint32_t k[MAX_LEVEL];
+  /* first level of the next symbol (count levels) */
+  uint32_t next[MAX_LEVEL];
+  /* number of occurrences of the symbols at the right positions */
+  uint32_t right[SYMBOL_END];
+  uint32_t *sizes;
+  uint32_t nr_part;
+  uint64_t *scratch;
+  /* posting list of the sparse nodes */
+  uint32_t *list;
+};
+
+/**
+ * Below this number of equations by word of bitset, a node is split as
+ * a posting list (one bit test by equation) rather than as a bitset
+ * (one AND by word).
+ */
+#define LIST_RATIO 4
+
+/**
+ * Skip the count levels already decided by the right positions:
+ * the equations of the node have at least as many occurrences.
+ */
+static uint32_t partition_skip(const struct partition *p, uint32_t level)
+{
+  while (level < p->nr_level && level >= p->table->sz &&
+         p->k[level] <= p->right[p->symbol[level]]) {
+    ++level;
+  }
+  return level;
+}
+
+static bool partition_leaf(struct partition *p, uint32_t level, uint64_t nr_node)
+{
+  if (nr_node <= 1 || level == p->nr_level) {
+    if (nr_node > 0) {
+      p->sizes[p->nr_part++] = nr_node;
+    }
+    return true;
+  }
+  return false;
+}
+
+static void partition_list_rec(struct partition *p, uint32_t level,
+                               uint32_t *ids, uint64_t nr_node)
+{
+  level = partition_skip(p, level);
+  if (partition_leaf(p, level, nr_node) == true) {
+    return;
+  }
+
+  /* in place: the equations in the bitset first */
+  const uint64_t *bits = p->bits[level];
+  uint64_t nr_in = 0;
+  for (uint64_t i = 0; i < nr_node; ++i) {
+    uint32_t id = ids[i];
+    if (((bits[id / 64] >> (id % 64)) & 1) == 1) {
+      ids[i] = ids[nr_in];
+      ids[nr_in++] = id;
+    }
+  }
+
+  enum symbol symbol = p->symbol[level];
+  if (level < p->table->sz) {
+    ++p->right[symbol];
+    partition_list_rec(p, level + 1, ids, nr_in);
+    --p->right[symbol];
+    partition_list_rec(p, level + 1, &ids[nr_in], nr_node - nr_in);
+  } else {
+    partition_list_rec(p, level + 1, ids, nr_in);
+    partition_list_rec(p, p->next[level], &ids[nr_in], nr_node - nr_in);
+  }
+}
+
+static void partition_rec(struct partition *p, uint32_t level,
+                          const uint64_t *node, uint64_t nr_node)
+{
+  const struct table *table = p->table;
+
+  level = partition_skip(p, level);
+  if (partition_leaf(p, level, nr_node) == true) {
+    return;
+  }
+  if (nr_node < LIST_RATIO * table->nr_word) {
+    uint64_t nr = 0;
+    for (uint64_t w = 0; w < table->nr_word; ++w) {
+      for (uint64_t b = node[w]; b != 0; b &= b - 1) {
+        p->list[nr++] = w * 64 + __builtin_ctzll(b);
+      }
+    }
+    partition_list_rec(p, level, p->list, nr);
+    return;
+  }
+
+  const uint64_t *bits = p->bits[level];
+  uint64_t *in = &p->scratch[2 * level * table->nr_word];
+  uint64_t *out = in + table->nr_word;
+  uint64_t nr_in = 0;
+  for (uint64_t w = 0; w < table->nr_word; ++w) {
+    in[w] = node[w] & bits[w];
+    out[w] = node[w] & ~bits[w];
+    nr_in += __builtin_popcountll(in[w]);
+  }
+
+  enum symbol symbol = p->symbol[level];
+  if (level < table->sz) {
+    ++p->right[symbol];
+    partition_rec(p, level + 1, in, nr_in);
+    --p->right[symbol];
+    partition_rec(p, level + 1, out, nr_node - nr_in);
+  } else {
+    /* out: exactly k - 1 occurrences, no more level for the symbol */
+    partition_rec(p, level + 1, in, nr_in);
+    partition_rec(p, p->next[level], out, nr_node - nr_in);
+  }
+}
+
+uint64_t table_partition_scratch(const struct table *table)
+{
+  /* two bitsets by level, all the equations and the posting list */
+  return (2 * MAX_LEVEL + 1) * table->nr_word + (table->nr + 1) / 2;
+}
+
+uint32_t table_partition(const struct table *table, uint64_t guess,
+                         uint32_t *sizes, uint64_t *scratch)
+{
+  struct partition p = {
+    .table = table,
+    .sizes = sizes,
+    .scratch = scratch,
+    .list = (uint32_t*)&scratch[(2 * MAX_LEVEL + 1) * table->nr_word],
+  };
+  uint32_t count[SYMBOL_END] = { 0 };
+
+  for (uint32_t pos = 0; pos < table->sz; ++pos) {
+    enum symbol symbol = equation_packed_symbol(guess, pos);
+    p.bits[p.nr_level] = table_get_position(table, pos, symbol);
+    p.symbol[p.nr_level++] = symbol;
+    ++count[symbol];
+  }
+  for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+    uint32_t first = p.nr_level;
+    for (uint32_t k = 1; k <= count[s]; ++k) {
+      p.bits[p.nr_level] = table_get_count(table, s, k);
+      p.symbol[p.nr_level] = s;
+      p.k[p.nr_level++] = k;
+    }
+    for (uint32_t l = first; l < p.nr_level; ++l) {
+      p.next[l] = p.nr_level;
+    }
+  }
+
+  /* all the equations of the table */
+  uint64_t *all = &scratch[2 * MAX_LEVEL * table->nr_word];
+  for (uint64_t w = 0; w < table->nr_word; ++w) {
+    all[w] = ~0ULL;
+  }
+  if (table->nr % 64 != 0) {
+    all[table->nr_word - 1] = (1ULL << (table->nr % 64)) - 1;
+  }
+  partition_rec(&p, 0, all, table->nr);
+  return p.nr_part;
+}
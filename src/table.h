@@ -0,0 +1,101 @@
+#ifndef __TABLE__
+#define __TABLE__
+
+#include <stdint.h>
+
+#include "equation.h"
+
+/**
+ * Immutable table of the equations packed of a size, inverted index of
+ * bitsets (bit i: equation i) by (position, symbol) and by (symbol,
+ * minimal number of occurrences). The constraints of a round (@c view)
+ * and the partitions of a guess (@c table_partition) are intersections
+ * of bitsets, word by word.
+ */
+struct table {
+  uint32_t sz;
+  /* Equations (not owned, outlive the table) */
+  const uint64_t *eqs;
+  uint64_t nr;
+  /* Number of words of a bitset */
+  uint64_t nr_word;
+  /* Bitset of the equations with the symbol s at the position p:
+     at (p * SYMBOL_END + s) * nr_word */
+  uint64_t *positions;
+  /* Bitset of the equations with at least k occurrences of the symbol s
+     (1 <= k <= sz): at (s * sz + k - 1) * nr_word */
+  uint64_t *counts;
+};
+
+/**
+ * Create a table.
+ *
+ * @param sz size of the equations.
+ * @param eqs equations packed (not copied, outlive the table).
+ * @param nr number of equations.
+ * @return table handle allocated.
+ */
+struct table* table_create(uint32_t sz, const uint64_t *eqs, uint64_t nr);
+
+/**
+ * Destroy a table previously allocated from @c table_create.
+ *
+ * @param table table handle.
+ */
+void table_destroy(struct table *table);
+
+/**
+ * Get the bitset of the equations with a symbol at a position.
+ *
+ * @param table table handle.
+ * @param pos position.
+ * @param symbol symbol.
+ * @return bitset (@c nr_word words).
+ */
+static inline const uint64_t* table_get_position(const struct table *table,
+                                                 uint32_t pos,
+                                                 enum symbol symbol)
+{
+  return &table->positions[(pos * SYMBOL_END + symbol) * table->nr_word];
+}
+
+/**
+ * Get the bitset of the equations with at least @c k occurrences of a symbol.
+ *
+ * @param table table handle.
+ * @param symbol symbol.
+ * @param k minimal number of occurrences (1 <= k <= sz).
+ * @return bitset (@c nr_word words).
+ */
+static inline const uint64_t* table_get_count(const struct table *table,
+                                              enum symbol symbol, uint32_t k)
+{
+  return &table->counts[(symbol * table->sz + k - 1) * table->nr_word];
+}
+
+/**
+ * Number of words of scratch needed by @c table_partition.
+ *
+ * @param table table handle.
+ * @return number of words.
+ */
+uint64_t table_partition_scratch(const struct table *table);
+
+/**
+ * Partition the equations of a table by the feedback pattern of a guess
+ * (@c feedback_pattern): the pattern of an equation only depends on the
+ * positions where it has the symbols of the guess and on its number of
+ * occurrences of these symbols (bounded by their occurrences in the
+ * guess), so each part is an intersection of bitsets of the table.
+ *
+ * @param table table handle.
+ * @param guess equation packed guessed.
+ * @param sizes output: number of equations of each part not empty
+ *        (room for @c nr equations).
+ * @param scratch scratch (@c table_partition_scratch words).
+ * @return number of parts not empty.
+ */
+uint32_t table_partition(const struct table *table, uint64_t guess,
+                         uint32_t *sizes, uint64_t *scratch);
+
+#endif /* !__TABLE__ */
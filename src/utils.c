@@ -1,3 +1,5 @@
+#include <time.h>
+
 #include "utils.h"
 
 void utils_eq_to_str(const struct equation *eq, char *str, uint32_t sz)
@@ -21,7 +23,7 @@ void utils_eq_to_str(const struct equation *eq, char *str, uint32_t sz)
   }
 }
 
-void utils_str_to_eq(const char *str, struct equation *eq, uint32_t sz)
+bool utils_str_to_eq(const char *str, struct equation *eq, uint32_t sz)
 {
   for (uint32_t i = 0; i < sz; ++i) {
     char c = str[i];
@@ -36,8 +38,24 @@ void utils_str_to_eq(const char *str, struct equation *eq, uint32_t sz)
         CASE_CHAR('/', SYMBOL_DIV);
         CASE_CHAR('=', SYMBOL_EQ);
 #undef CASE_CHAR
-        default:;
+        default:
+          return false;
       };
     }
   }
+  return true;
+}
+
+double utils_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+uint64_t utils_now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * UINT64_C(1000000) + ts.tv_nsec / 1000;
 }
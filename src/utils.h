@@ -18,7 +18,22 @@ void utils_eq_to_str(const struct equation *eq, char *str, uint32_t sz);
  * @param str string to convert.
  * @param eq output equation.
  * @param sz size of the equation.
+ * @return true if OK, false if a character is not a symbol.
  */
-void utils_str_to_eq(const char *str, struct equation *eq, uint32_t sz);
+bool utils_str_to_eq(const char *str, struct equation *eq, uint32_t sz);
+
+/**
+ * Get the time of the monotonic clock.
+ *
+ * @return time in seconds.
+ */
+double utils_now(void);
+
+/**
+ * Get the time of the monotonic clock in microseconds.
+ *
+ * @return time in microseconds.
+ */
+uint64_t utils_now_us(void);
 
 #endif /* !__UTILS__ */
@@ -0,0 +1,178 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "view.h"
+
+/**
+ * Initialize a view on a bitset allocated, all the equations alive.
+ */
+static void view_init_alive(struct view *view, const struct table *table,
+                            uint64_t *alive)
+{
+  uint64_t nr_word = table->nr_word;
+
+  view->table = table;
+  view->alive = alive;
+  memset(view->alive, 0xff, nr_word * sizeof(uint64_t));
+  /* bits beyond the last equation */
+  if (table->nr % 64 != 0) {
+    view->alive[nr_word - 1] = (1ULL << (table->nr % 64)) - 1;
+  }
+  view->nr_alive = table->nr;
+}
+
+void view_init(struct view *view, const struct table *table)
+{
+  view_init_alive(view, table, malloc(table->nr_word * sizeof(uint64_t)));
+  view->arena = NULL;
+}
+
+void view_init_arena(struct view *view, const struct table *table,
+                     struct arena *arena)
+{
+  view_init_alive(view, table,
+                  arena_alloc(arena, table->nr_word * sizeof(uint64_t)));
+  view->arena = arena;
+}
+
+void view_init_copy(struct view *view, const struct view *from)
+{
+  view->table = from->table;
+  view->alive = malloc(from->table->nr_word * sizeof(uint64_t));
+  view->arena = NULL;
+  view_copy(view, from);
+}
+
+void view_copy(struct view *view, const struct view *from)
+{
+  assert(view->table == from->table);
+  memcpy(view->alive, from->alive, from->table->nr_word * sizeof(uint64_t));
+  view->nr_alive = from->nr_alive;
+}
+
+void view_release(struct view *view)
+{
+  if (view->arena == NULL) {
+    free(view->alive);
+  }
+  view->alive = NULL;
+}
+
+/**
+ * Kill the equations with a symbol not allowed at a position.
+ */
+static void view_filter_position(struct view *view, uint32_t pos,
+                                 uint16_t allowed)
+{
+  const struct table *table = view->table;
+  uint64_t *alive = view->alive;
+  uint32_t nr_allowed = __builtin_popcount(allowed);
+
+  if (nr_allowed == SYMBOL_END) {
+    return;
+  }
+
+  /* the fewest passes: keep the allowed symbols or kill the others */
+  if (nr_allowed <= SYMBOL_END - nr_allowed) {
+    const uint64_t *bits[SYMBOL_END];
+    uint32_t nr = 0;
+    for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+      if (((allowed >> s) & 1) == 1) {
+        bits[nr++] = table_get_position(table, pos, s);
+      }
+    }
+    for (uint64_t w = 0; w < table->nr_word; ++w) {
+      uint64_t keep = 0;
+      for (uint32_t i = 0; i < nr; ++i) {
+        keep |= bits[i][w];
+      }
+      alive[w] &= keep;
+    }
+  } else {
+    for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+      if (((allowed >> s) & 1) == 0) {
+        const uint64_t *bits = table_get_position(table, pos, s);
+        for (uint64_t w = 0; w < table->nr_word; ++w) {
+          alive[w] &= ~bits[w];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Kill the equations with too few or too many occurrences of a symbol.
+ */
+static void view_filter_count(struct view *view, enum symbol symbol,
+                              uint32_t min, uint32_t max)
+{
+  const struct table *table = view->table;
+  uint64_t *alive = view->alive;
+
+  if (min > 0) {
+    const uint64_t *bits = table_get_count(table, symbol, min);
+    for (uint64_t w = 0; w < table->nr_word; ++w) {
+      alive[w] &= bits[w];
+    }
+  }
+  if (max < table->sz) {
+    const uint64_t *bits = table_get_count(table, symbol, max + 1);
+    for (uint64_t w = 0; w < table->nr_word; ++w) {
+      alive[w] &= ~bits[w];
+    }
+  }
+}
+
+void view_filter(struct view *view, const struct constraints *constraints)
+{
+  const struct table *table = view->table;
+  uint64_t nr_alive = 0;
+
+  for (uint32_t pos = 0; pos < table->sz; ++pos) {
+    view_filter_position(view, pos,
+                         constraints->allowed[pos] & ((1 << SYMBOL_END) - 1));
+  }
+  for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+    view_filter_count(view, s, constraints->min[s], constraints->max[s]);
+  }
+
+  for (uint64_t w = 0; w < table->nr_word; ++w) {
+    nr_alive += __builtin_popcountll(view->alive[w]);
+  }
+  view->nr_alive = nr_alive;
+}
+
+uint64_t view_get_equations(const struct view *view, uint64_t *eqs)
+{
+  const struct table *table = view->table;
+  uint64_t nr = 0;
+
+  for (uint64_t w = 0; w < table->nr_word; ++w) {
+    for (uint64_t bits = view->alive[w]; bits != 0; bits &= bits - 1) {
+      eqs[nr++] = table->eqs[w * 64 + __builtin_ctzll(bits)];
+    }
+  }
+  return nr;
+}
+
+void view_remove_nth(struct view *view, uint64_t k)
+{
+  assert(k < view->nr_alive);
+
+  for (uint64_t w = 0; ; ++w) {
+    uint64_t bits = view->alive[w];
+    uint32_t nr = __builtin_popcountll(bits);
+    if (k >= nr) {
+      k -= nr;
+      continue;
+    }
+    /* k-th bit set of the word */
+    for (; k > 0; --k) {
+      bits &= bits - 1;
+    }
+    view->alive[w] &= ~(bits & -bits);
+    --view->nr_alive;
+    return;
+  }
+}
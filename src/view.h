@@ -0,0 +1,93 @@
+#ifndef __VIEW__
+#define __VIEW__
+
+#include <stdint.h>
+
+#include "arena.h"
+#include "filter.h"
+#include "table.h"
+
+/**
+ * View of a table shared by several games (or several branches of a
+ * search): a bitset of the equations alive (bit i: equation i).
+ * Copying a view is cheap (undo, branching).
+ */
+struct view {
+  const struct table *table;
+  /* Bitset of the equations alive (table->nr_word words) */
+  uint64_t *alive;
+  uint64_t nr_alive;
+  /* Arena of the bitset (NULL: allocated) */
+  struct arena *arena;
+};
+
+/**
+ * Initialize a view, all the equations alive.
+ *
+ * @param view view handle.
+ * @param table table (outlive the view).
+ */
+void view_init(struct view *view, const struct table *table);
+
+/**
+ * Same as @c view_init, the bitset allocated from an arena
+ * (released with the arena).
+ *
+ * @param view view handle.
+ * @param table table (outlive the view).
+ * @param arena arena handle (outlive the view).
+ */
+void view_init_arena(struct view *view, const struct table *table,
+                     struct arena *arena);
+
+/**
+ * Initialize a view as a copy of another view.
+ *
+ * @param view view handle.
+ * @param from view to copy.
+ */
+void view_init_copy(struct view *view, const struct view *from);
+
+/**
+ * Copy the equations alive of a view of the same table (undo).
+ *
+ * @param view view handle.
+ * @param from view to copy.
+ */
+void view_copy(struct view *view, const struct view *from);
+
+/**
+ * Release the bitset of a view.
+ *
+ * @param view view handle.
+ */
+void view_release(struct view *view);
+
+/**
+ * Kill the equations not respecting the constraints, word by word with
+ * the bitsets of the table: the symbols allowed by position and the
+ * bounds of the number of occurrences of the symbols.
+ *
+ * @param view view handle.
+ * @param constraints constraints handle.
+ */
+void view_filter(struct view *view, const struct constraints *constraints);
+
+/**
+ * Copy the equations alive, in order.
+ *
+ * @param view view handle.
+ * @param eqs output (room for @c nr_alive equations).
+ * @return number of equations copied (@c nr_alive).
+ */
+uint64_t view_get_equations(const struct view *view, uint64_t *eqs);
+
+/**
+ * Kill the k-th equation alive.
+ *
+ * @param view view handle.
+ * @param k rank of the equation alive (< @c nr_alive).
+ */
+void view_remove_nth(struct view *view, uint64_t k);
+
+#endif /* !__VIEW__ */
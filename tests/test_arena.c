@@ -0,0 +1,62 @@
+#include <stdlib.h>
+
+#include "arena.h"
+#include "test.h"
+
+TEST_F(arena, alloc)
+{
+  struct arena arena;
+
+  arena_init(&arena, 1024);
+  uint8_t *a = arena_alloc(&arena, 3);
+  uint8_t *b = arena_alloc(&arena, 100);
+  EXPECT_TRUE(((uintptr_t)a & 15) == 0 && ((uintptr_t)b & 15) == 0);
+  EXPECT_TRUE(b == a + 16);
+  EXPECT_TRUE(arena.used == 16 + 112);
+  EXPECT_TRUE(arena.reserved == 1024);
+
+  /* larger than a chunk: its own chunk */
+  uint64_t *c = arena_calloc(&arena, 4096 * sizeof(uint64_t));
+  EXPECT_TRUE(c[0] == 0 && c[4095] == 0);
+  EXPECT_TRUE(arena.reserved == 1024 + 4096 * sizeof(uint64_t));
+
+  arena_release(&arena);
+  EXPECT_TRUE(arena.reserved == 0 && arena.first == NULL);
+  return true;
+}
+
+TEST_F(arena, rewind)
+{
+  struct arena arena;
+
+  arena_init(&arena, 256);
+  arena_alloc(&arena, 64);
+  struct arena_mark mark = arena_get_mark(&arena);
+  void *a = arena_alloc(&arena, 128);
+  void *b = arena_alloc(&arena, 200); /* next chunk */
+  size_t reserved = arena.reserved;
+  size_t high = arena.high;
+
+  /* same allocations after a rewind: no new chunk */
+  arena_rewind(&arena, mark);
+  EXPECT_TRUE(arena.used == 64);
+  EXPECT_TRUE(arena_alloc(&arena, 128) == a);
+  EXPECT_TRUE(arena_alloc(&arena, 200) == b);
+  EXPECT_TRUE(arena.reserved == reserved);
+
+  /* reset: from the first chunk, the high-water mark is kept */
+  arena_reset(&arena);
+  EXPECT_TRUE(arena.used == 0 && arena.high == high);
+  arena_alloc(&arena, 16);
+  EXPECT_TRUE(arena.reserved == reserved);
+
+  arena_release(&arena);
+  return true;
+}
+
+const static struct test arena_tests[] = {
+  TEST(arena, alloc),
+  TEST(arena, rewind),
+};
+
+TEST_SUITE(arena);
@@ -0,0 +1,137 @@
+#include <pthread.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "backend.h"
+#include "server.h"
+#include "nerdle.h"
+#include "feedback.h"
+#include "utils.h"
+#include "first_equations.h"
+#include "test.h"
+
+struct session {
+  struct server *server;
+  int fd;
+};
+
+static void* session_worker(void *arg)
+{
+  struct session *session = arg;
+  server_session(session->server, session->fd, session->fd);
+  return NULL;
+}
+
+/**
+ * Connect the local backend to a session of the server served by a thread.
+ */
+static struct backend* connect_server(struct server *server,
+                                      struct session *session,
+                                      pthread_t *thread)
+{
+  int sv[2];
+  char arg[32];
+
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1) {
+    return NULL;
+  }
+  session->server = server;
+  session->fd = sv[1];
+  pthread_create(thread, NULL, session_worker, session);
+
+  snprintf(arg, sizeof(arg), "fd:%d", sv[0]);
+  struct backend_config config = { .arg = arg };
+  return backend_create(&backend_local_ops, &config);
+}
+
+TEST_F(backend, local_game)
+{
+  struct server server;
+  struct session session;
+  pthread_t thread;
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  server_init(&server, 42);
+  struct backend *backend = connect_server(&server, &session, &thread);
+  EXPECT_TRUE(backend != NULL);
+  EXPECT_FALSE(backend_start(backend, 3));
+  EXPECT_TRUE(backend_start(backend, 7));
+
+  struct nerdle *nerdle = nerdle_create(7, 0);
+  nerdle->verbose = false;
+  nerdle_set_first_equation(nerdle, &eq);
+
+  bool won = false;
+  for (uint32_t round = 0; round < 16 && won == false; ++round) {
+    EXPECT_TRUE(backend_submit(backend, round, &eq));
+    EXPECT_TRUE(backend_read_feedback(backend, round, 7, status));
+    won = feedback_from_status(status, 7) == feedback_nr_pattern(7) - 1;
+    if (won == false) {
+      nerdle_update_feedback(nerdle, &eq, status);
+      nerdle_find_best_equation(nerdle, &eq);
+    }
+  }
+  EXPECT_TRUE(won);
+
+  /* an invalid equation is not accepted */
+  utils_str_to_eq("1+1=3+4", &eq, 7);
+  EXPECT_TRUE(backend_submit(backend, 0, &eq));
+  EXPECT_FALSE(backend_read_feedback(backend, 0, 7, status));
+
+  backend_destroy(backend);
+  pthread_join(thread, NULL);
+  nerdle_destroy(nerdle);
+  server_release(&server);
+  return true;
+}
+
+/**
+ * Send a request to a session of the server and compare the start of
+ * the response.
+ */
+static bool session_request(FILE *file, const char *request,
+                            const char *response)
+{
+  char line[64];
+
+  fprintf(file, "%s\n", request);
+  fflush(file);
+  return fgets(line, sizeof(line), file) != NULL &&
+    strncmp(line, response, strlen(response)) == 0;
+}
+
+TEST_F(backend, server_guess)
+{
+  struct server server;
+  struct session session;
+  pthread_t thread;
+  int sv[2];
+
+  server_init(&server, 42);
+  EXPECT_TRUE(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == 0);
+  session.server = &server;
+  session.fd = sv[1];
+  pthread_create(&thread, NULL, session_worker, &session);
+
+  FILE *file = fdopen(sv[0], "r+");
+  EXPECT_TRUE(session_request(file, "START 7", "OK\n"));
+  EXPECT_TRUE(session_request(file, "GUESS 10+2=1", "ERROR invalid size\n"));
+  /* not read as "10+2=12" */
+  EXPECT_TRUE(session_request(file, "GUESS 1x+2=12",
+                              "ERROR invalid equation\n"));
+  EXPECT_TRUE(session_request(file, "GUESS 10+2=12", "FEEDBACK "));
+  fprintf(file, "QUIT\n");
+  fclose(file);
+
+  pthread_join(thread, NULL);
+  server_release(&server);
+  return true;
+}
+
+const static struct test backend_tests[] = {
+  TEST(backend, local_game),
+  TEST(backend, server_guess),
+};
+
+TEST_SUITE(backend);
@@ -0,0 +1,55 @@
+#include <stdlib.h>
+
+#include "batch.h"
+#include "feedback.h"
+#include "test.h"
+#include "test_common.h"
+
+TEST_F(batch, same_as_sim)
+{
+  struct nerdle *nerdle = generate_dictionary(7);
+  const struct candidates *c = &nerdle->candidates;
+  uint64_t nr = c->nr / 13;
+  struct batch_game *games = calloc(nr, sizeof(*games));
+
+  for (uint64_t i = 0; i < nr; ++i) {
+    games[i].game.answer = c->eqs[i * 13];
+  }
+  batch_solve(nerdle, games, nr, 4);
+
+  /* the games sharing the dictionary play as the games with a copy */
+  for (uint64_t i = 0; i < nr; ++i) {
+    struct sim_game game = { .answer = games[i].game.answer };
+    sim_play(nerdle, &game);
+    EXPECT_TRUE(game.won == games[i].game.won);
+    EXPECT_TRUE(game.nr_round == games[i].game.nr_round);
+  }
+  free(games);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+TEST_F(batch, transcript)
+{
+  struct nerdle *nerdle = generate_dictionary(7);
+  const struct candidates *c = &nerdle->candidates;
+  struct batch_game game = {};
+
+  /* next guess after one round, the answer is still a candidate */
+  uint64_t answer = c->eqs[c->nr / 2];
+  game.nr_guess = 1;
+  game.guesses[0] = c->eqs[0];
+  game.patterns[0] = feedback_pattern(c->eqs[0], answer, 7);
+  batch_solve(nerdle, &game, 1, 1);
+  EXPECT_TRUE(game.found);
+  EXPECT_TRUE(feedback_pattern(c->eqs[0], game.next, 7) == game.patterns[0]);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+const static struct test batch_tests[] = {
+  TEST(batch, same_as_sim),
+  TEST(batch, transcript),
+};
+
+TEST_SUITE(batch);
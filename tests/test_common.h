@@ -1,10 +1,37 @@
 #ifndef __TEST_COMMON_H__
 #define __TEST_COMMON_H__
 
+#include <string.h>
+
+#include "nerdle.h"
+#include "utils.h"
+
 #define P SYMBOL_PLUS
 #define M SYMBOL_MINUS
 #define T SYMBOL_MULT
 #define D SYMBOL_DIV
 #define E SYMBOL_EQ
 
+/**
+ * Pack an equation written as a string ("1+2=3").
+ */
+static inline uint64_t pack_str(const char *str)
+{
+  struct equation eq = { .sz = strlen(str) };
+  utils_str_to_eq(str, &eq, eq.sz);
+  return equation_pack(&eq);
+}
+
+/**
+ * Generate all the equations of a size, quietly.
+ * @warning the nerdle has to be destroyed.
+ */
+static inline struct nerdle* generate_dictionary(uint32_t sz)
+{
+  struct nerdle *nerdle = nerdle_create(sz, 0);
+  nerdle->verbose = false;
+  nerdle_generate_equations(nerdle);
+  return nerdle;
+}
+
 #endif /* !__TEST_COMMON_H__ */
@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "decision.h"
+#include "nerdle.h"
+#include "sim.h"
+#include "test.h"
+
+static void decision_path(char *path, size_t sz)
+{
+  snprintf(path, sz, "/tmp/nerdle_test_%d.decisions", getpid());
+}
+
+TEST_F(decision, persist)
+{
+  char path[64];
+  struct decision_header config = { .sz = 8, .nr_bit = 4, .checksum = 42 };
+  uint64_t guess;
+
+  decision_path(path, sizeof(path));
+  unlink(path);
+  struct decisions *decisions = decision_open(path, &config);
+  EXPECT_TRUE(decisions != NULL);
+  EXPECT_TRUE(decision_get(decisions, 0x1234, &guess) == false);
+  decision_put(decisions, 0x1234, 0xabcd);
+  decision_put(decisions, 0x1235, 0xabce); /* same key: bit 0 reserved */
+  decision_put(decisions, 0x1244, 0xdcba); /* same slot, probed */
+  EXPECT_TRUE(decisions->header->nr == 2);
+  /* locked while mapped */
+  EXPECT_TRUE(decision_open(path, &config) == NULL);
+  decision_close(decisions);
+
+  /* same configuration: kept */
+  decisions = decision_open(path, &config);
+  EXPECT_TRUE(decisions != NULL);
+  EXPECT_TRUE(decision_get(decisions, 0x1235, &guess) == true);
+  EXPECT_TRUE(guess == 0xabce);
+  EXPECT_TRUE(decision_get(decisions, 0x1244, &guess) == true);
+  EXPECT_TRUE(guess == 0xdcba);
+  EXPECT_TRUE(decisions->nr_hit == 2);
+  decision_close(decisions);
+
+  /* other configuration: reset */
+  config.checksum = 43;
+  decisions = decision_open(path, &config);
+  EXPECT_TRUE(decisions != NULL);
+  EXPECT_TRUE(decisions->header->nr == 0);
+  EXPECT_TRUE(decision_get(decisions, 0x1244, &guess) == false);
+  decision_put(decisions, 0x1244, 0xdcba);
+  decision_close(decisions);
+
+  /* other time budget: reset */
+  config.budget = 0.5;
+  decisions = decision_open(path, &config);
+  EXPECT_TRUE(decisions != NULL);
+  EXPECT_TRUE(decisions->header->nr == 0);
+  decision_close(decisions);
+
+  unlink(path);
+  return true;
+}
+
+TEST_F(decision, sim)
+{
+  char path[64];
+  struct nerdle *nerdle = nerdle_create(6, 0);
+  struct sim_game game;
+  uint32_t nr_round[64];
+
+  nerdle->verbose = false;
+  nerdle_generate_equations(nerdle);
+  nerdle_get_table(nerdle);
+  uint64_t nr = nerdle->candidates.nr < 64 ? nerdle->candidates.nr : 64;
+  for (uint64_t i = 0; i < nr; ++i) {
+    game.answer = nerdle->candidates.eqs[i];
+    sim_play(nerdle, &game);
+    nr_round[i] = game.nr_round;
+  }
+
+  decision_path(path, sizeof(path));
+  unlink(path);
+  /* stored by the first pass, read by the second one */
+  for (uint32_t pass = 0; pass < 2; ++pass) {
+    struct decisions *decisions = nerdle_open_decisions(nerdle, path);
+    EXPECT_TRUE(decisions != NULL);
+    for (uint64_t i = 0; i < nr; ++i) {
+      game.answer = nerdle->candidates.eqs[i];
+      sim_play(nerdle, &game);
+      EXPECT_TRUE(game.won == true && game.nr_round == nr_round[i]);
+    }
+    EXPECT_TRUE(pass == 0 || decisions->nr_miss == 0);
+    nerdle->decisions = NULL;
+    decision_close(decisions);
+  }
+
+  unlink(path);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+const static struct test decision_tests[] = {
+  TEST(decision, persist),
+  TEST(decision, sim),
+};
+
+TEST_SUITE(decision);
@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "dict.h"
+#include "nerdle.h"
+#include "utils.h"
+#include "test.h"
+
+static const char *eqs_str[] = {
+  "1+2=3",
+  "9-8=1",
+  "2*3=6",
+  "8/4=2",
+};
+
+#define NR_EQS (sizeof(eqs_str) / sizeof(eqs_str[0]))
+
+static void dict_path(char *path, size_t sz)
+{
+  snprintf(path, sz, "/tmp/nerdle_test_%d.dict", getpid());
+}
+
+static void pack_eqs(uint64_t *eqs)
+{
+  for (uint32_t i = 0; i < NR_EQS; ++i) {
+    struct equation eq = { .sz = 5 };
+    utils_str_to_eq(eqs_str[i], &eq, eq.sz);
+    eqs[i] = equation_pack(&eq);
+  }
+}
+
+TEST_F(dict, write_open)
+{
+  char path[64];
+  uint64_t eqs[NR_EQS];
+
+  dict_path(path, sizeof(path));
+  pack_eqs(eqs);
+  EXPECT_TRUE(dict_write(path, 5, eqs, NR_EQS));
+
+  struct dict *dict = dict_open(path);
+  EXPECT_TRUE(dict != NULL);
+  EXPECT_TRUE(dict->header->sz == 5);
+  EXPECT_TRUE(dict->header->nr == NR_EQS);
+  EXPECT_TRUE(memcmp(dict->eqs, eqs, sizeof(eqs)) == 0);
+  EXPECT_TRUE(dict_verify(dict) == true);
+  dict_close(dict);
+
+  unlink(path);
+  return true;
+}
+
+TEST_F(dict, writer)
+{
+  char path[64];
+  uint64_t eqs[NR_EQS];
+  struct dict_writer writer;
+
+  dict_path(path, sizeof(path));
+  pack_eqs(eqs);
+  EXPECT_TRUE(dict_writer_open(&writer, path, 5));
+  EXPECT_TRUE(dict_writer_add(&writer, eqs, 1));
+  EXPECT_TRUE(dict_writer_add(&writer, &eqs[1], NR_EQS - 1));
+  EXPECT_TRUE(dict_writer_close(&writer, path));
+
+  /* same as written at once */
+  struct dict *dict = dict_open(path);
+  EXPECT_TRUE(dict != NULL);
+  EXPECT_TRUE(dict->header->nr == NR_EQS);
+  EXPECT_TRUE(dict->header->checksum == dict_checksum(eqs, NR_EQS));
+  EXPECT_TRUE(memcmp(dict->eqs, eqs, sizeof(eqs)) == 0);
+  EXPECT_TRUE(dict_verify(dict) == true);
+  dict_close(dict);
+
+  unlink(path);
+  return true;
+}
+
+TEST_F(dict, corrupted)
+{
+  char path[64];
+  uint64_t eqs[NR_EQS];
+
+  dict_path(path, sizeof(path));
+  pack_eqs(eqs);
+  EXPECT_TRUE(dict_write(path, 5, eqs, NR_EQS));
+
+  /* flip one symbol of the last equation */
+  FILE *file = fopen(path, "r+b");
+  fseek(file, -1, SEEK_END);
+  fputc(0x1, file);
+  fclose(file);
+  struct dict *dict = dict_open(path);
+  EXPECT_TRUE(dict != NULL);
+  EXPECT_TRUE(dict_verify(dict) == false);
+  dict_close(dict);
+
+  /* truncated */
+  EXPECT_TRUE(truncate(path, sizeof(struct dict_header) + 4) == 0);
+  EXPECT_TRUE(dict_open(path) == NULL);
+
+  unlink(path);
+  EXPECT_TRUE(dict_open(path) == NULL);
+  return true;
+}
+
+TEST_F(dict, load)
+{
+  char path[64];
+  uint64_t eqs[NR_EQS];
+
+  dict_path(path, sizeof(path));
+  pack_eqs(eqs);
+  EXPECT_TRUE(dict_write(path, 5, eqs, NR_EQS));
+
+  struct nerdle *nerdle = nerdle_create(6, 0);
+  EXPECT_FALSE(nerdle_load_equations(nerdle, path));
+  nerdle_destroy(nerdle);
+
+  nerdle = nerdle_create(5, 0);
+  EXPECT_TRUE(nerdle_load_equations(nerdle, path));
+  EXPECT_TRUE(nerdle->candidates.nr == NR_EQS);
+  /* mapped, not copied */
+  EXPECT_TRUE(nerdle->dict != NULL &&
+              nerdle->candidates.eqs == nerdle->dict->eqs);
+  EXPECT_TRUE(memcmp(nerdle->candidates.eqs, eqs, sizeof(eqs)) == 0);
+  nerdle_destroy(nerdle);
+
+  unlink(path);
+  return true;
+}
+
+const static struct test dict_tests[] = {
+  TEST(dict, write_open),
+  TEST(dict, writer),
+  TEST(dict, corrupted),
+  TEST(dict, load),
+};
+
+TEST_SUITE(dict);
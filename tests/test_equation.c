@@ -42,6 +42,15 @@ TEST_F(equation, check_equality)
   TEST_CHECK_EQUALITY("1+2=4", false);
   TEST_CHECK_EQUALITY("12*10=120", true);
   TEST_CHECK_EQUALITY("12/6+2=4", true);
+  TEST_CHECK_EQUALITY("10-2*3=4", true);
+  TEST_CHECK_EQUALITY("1-2+3=2", true);
+  TEST_CHECK_EQUALITY("24/4/3=2", true);
+  TEST_CHECK_EQUALITY("7/2*2=7", false);
+  TEST_CHECK_EQUALITY("5/0=0", false);
+  TEST_CHECK_EQUALITY("1+1=2=2", false);
+  TEST_CHECK_EQUALITY("1+1=", false);
+  TEST_CHECK_EQUALITY("+1=1", false);
+  TEST_CHECK_EQUALITY("1+*1=2", false);
 
 #undef TEST_CHECK_EQUALITY
   return true;
@@ -69,10 +78,35 @@ TEST_F(equation, check_semantic)
   return true;
 }
 
+TEST_F(equation, pack)
+{
+#define TEST_PACK(STR)                                          \
+  ({                                                            \
+    struct equation eq;                                         \
+    struct equation unpacked;                                   \
+    uint32_t sz = sizeof(STR) - 1;                              \
+    memset(&eq, 0, sizeof(eq));                                 \
+    eq.sz = sz;                                                 \
+    utils_str_to_eq(STR, &eq, sz);                              \
+    equation_unpack(equation_pack(&eq), &unpacked, sz);         \
+    EXPECT_TRUE(unpacked.sz == sz);                             \
+    EXPECT_TRUE(memcmp(eq.symbols, unpacked.symbols,            \
+                       sz * sizeof(enum symbol)) == 0);         \
+  })
+
+  TEST_PACK("1+2=3");
+  TEST_PACK("12*49=588");
+  TEST_PACK("10+350/50=17");
+
+#undef TEST_PACK
+  return true;
+}
+
 const static struct test equation_tests[] = {
   TEST(equation, add_symbol),
   TEST(equation, check_semantic),
   TEST(equation, check_equality),
+  TEST(equation, pack),
 };
 
 TEST_SUITE(equation);
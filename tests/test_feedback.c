@@ -0,0 +1,67 @@
+#include "feedback.h"
+#include "test.h"
+#include "test_common.h"
+
+/* R: RIGHT, W: WRONG, D: DISCARDED */
+static void str_to_status(const char *str, enum status *status)
+{
+  for (uint32_t i = 0; str[i] != '\0'; ++i) {
+    status[i] = str[i] == 'R' ? RIGHT : str[i] == 'W' ? WRONG : DISCARDED;
+  }
+}
+
+TEST_F(feedback, pattern)
+{
+#define TEST_PATTERN(GUESS, ANSWER, EXPECTED)                           \
+  ({                                                                    \
+    enum status status[LIMIT_MAX_EQ_SZ];                                \
+    uint32_t sz = sizeof(GUESS) - 1;                                    \
+    str_to_status(EXPECTED, status);                                    \
+    uint32_t pattern = feedback_pattern(pack_str(GUESS),                \
+                                        pack_str(ANSWER), sz);          \
+    EXPECT_TRUE(pattern == feedback_from_status(status, sz));           \
+  })
+
+  TEST_PATTERN("9+8-3=14", "9+8-3=14", "RRRRRRRR");
+  TEST_PATTERN("9+8-3=14", "4*3+2=14", "DWDDWRRR");
+  TEST_PATTERN("12+21=33", "21+12=33", "WWRWWRRR");
+  /* the answer has no more '1' than the greens */
+  TEST_PATTERN("11+11=22", "10+12=22", "RDRRDRRR");
+  /* only the first '1' not at its location is WRONG */
+  TEST_PATTERN("11*1=11", "1+10=11", "RWDDRRR");
+
+#undef TEST_PATTERN
+  return true;
+}
+
+TEST_F(feedback, status)
+{
+  enum status status[LIMIT_MAX_EQ_SZ];
+  enum status expected[LIMIT_MAX_EQ_SZ];
+
+  EXPECT_TRUE(feedback_nr_pattern(8) == 6561);
+  str_to_status("RWDDRWDR", expected);
+  feedback_get_status(feedback_from_status(expected, 8), 8, status);
+  EXPECT_TRUE(memcmp(status, expected, 8 * sizeof(enum status)) == 0);
+  return true;
+}
+
+TEST_F(feedback, str)
+{
+  enum status status[LIMIT_MAX_EQ_SZ];
+  char str[LIMIT_MAX_EQ_SZ];
+
+  EXPECT_TRUE(feedback_from_str("RWDDRWDR", 8, status));
+  feedback_to_str(status, 8, str);
+  EXPECT_TRUE(memcmp(str, "RWDDRWDR", 8) == 0);
+  EXPECT_FALSE(feedback_from_str("RWDX", 4, status));
+  return true;
+}
+
+const static struct test feedback_tests[] = {
+  TEST(feedback, pattern),
+  TEST(feedback, status),
+  TEST(feedback, str),
+};
+
+TEST_SUITE(feedback);
@@ -0,0 +1,54 @@
+#include <assert.h>
+
+#include "filter.h"
+#include "test.h"
+#include "test_common.h"
+
+static void constraints_init(struct constraints *constraints, uint32_t sz)
+{
+  memset(constraints, 0, sizeof(*constraints));
+  constraints->sz = sz;
+  for (uint32_t i = 0; i < sz; ++i) {
+    constraints->allowed[i] = (1 << SYMBOL_END) - 1;
+  }
+  memset(constraints->max, sz, sizeof(constraints->max));
+}
+
+/**
+ * Check an equation written as a string, of the size of the constraints.
+ */
+static bool check_str(const struct constraints *constraints, const char *str)
+{
+  assert(strlen(str) == constraints->sz);
+  return filter_check(constraints, pack_str(str));
+}
+
+TEST_F(filter, check)
+{
+  struct constraints constraints;
+
+  constraints_init(&constraints, 8);
+  EXPECT_TRUE(check_str(&constraints, "9+8-3=14"));
+
+  /* '9' not allowed at the first position */
+  constraints.allowed[0] &= ~(1 << SYMBOL_9);
+  EXPECT_FALSE(check_str(&constraints, "9+8-3=14"));
+  EXPECT_TRUE(check_str(&constraints, "8+9-3=14"));
+
+  /* two '1' at least */
+  constraints.min[SYMBOL_1] = 2;
+  EXPECT_FALSE(check_str(&constraints, "8+9-3=14"));
+  EXPECT_TRUE(check_str(&constraints, "11-9+1=3"));
+
+  /* three '1' at most */
+  constraints.max[SYMBOL_1] = 3;
+  EXPECT_FALSE(check_str(&constraints, "21-10=11"));
+  EXPECT_TRUE(check_str(&constraints, "31-21=10"));
+  return true;
+}
+
+const static struct test filter_tests[] = {
+  TEST(filter, check),
+};
+
+TEST_SUITE(filter);
@@ -0,0 +1,273 @@
+#include <stdlib.h>
+
+#include "nerdle.h"
+#include "feedback.h"
+#include "test.h"
+
+static struct nerdle* generate(uint32_t sz, uint32_t limit, uint32_t nr_thread)
+{
+  struct nerdle *nerdle = nerdle_create(sz, limit);
+  nerdle->nr_thread = nr_thread;
+  nerdle_generate_equations(nerdle);
+  return nerdle;
+}
+
+static bool same_candidates(const struct nerdle *n1, const struct nerdle *n2)
+{
+  return n1->candidates.nr == n2->candidates.nr &&
+    memcmp(n1->candidates.eqs, n2->candidates.eqs,
+           n1->candidates.nr * sizeof(uint64_t)) == 0;
+}
+
+TEST_F(nerdle, generate_valid)
+{
+  /* number of equations of the sizes 5 and 6 */
+  static const uint64_t nr_eq[] = { [5] = 118, [6] = 206 };
+
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= 7; ++sz) {
+    struct nerdle *nerdle = generate(sz, 0, 1);
+    struct equation eq;
+    bool valid = true;
+
+    for (uint64_t i = 0; i < nerdle->candidates.nr && valid == true; ++i) {
+      equation_unpack(nerdle->candidates.eqs[i], &eq, sz);
+      valid = equation_check_semantic(&eq) == true &&
+        equation_check_equality(&eq) == true;
+    }
+    EXPECT_TRUE(valid);
+    if (sz < sizeof(nr_eq) / sizeof(nr_eq[0])) {
+      INFO("size %u: %lu equations", sz, nerdle->candidates.nr);
+      EXPECT_TRUE(nerdle->candidates.nr == nr_eq[sz]);
+    }
+    nerdle_destroy(nerdle);
+  }
+  return true;
+}
+
+TEST_F(nerdle, generate_threads)
+{
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= 7; ++sz) {
+    struct nerdle *serial = generate(sz, 0, 1);
+    struct nerdle *parallel = generate(sz, 0, 4);
+    EXPECT_TRUE(serial->candidates.nr > 0);
+    EXPECT_TRUE(same_candidates(serial, parallel));
+    nerdle_destroy(serial);
+    nerdle_destroy(parallel);
+  }
+  return true;
+}
+
+TEST_F(nerdle, generate_limit)
+{
+  static const uint32_t limits[] = { 1, 37, 1000 };
+
+  for (uint32_t i = 0; i < sizeof(limits) / sizeof(limits[0]); ++i) {
+    struct nerdle *serial = generate(7, limits[i], 1);
+    struct nerdle *parallel = generate(7, limits[i], 3);
+    EXPECT_TRUE(serial->candidates.nr == limits[i]);
+    EXPECT_TRUE(same_candidates(serial, parallel));
+    nerdle_destroy(serial);
+    nerdle_destroy(parallel);
+  }
+  return true;
+}
+
+TEST_F(nerdle, generate_generic)
+{
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= 8; ++sz) {
+    struct nerdle *specialized = generate(sz, 0, 1);
+    struct nerdle *generic = nerdle_create(sz, 0);
+    nerdle_set_generic_kernels(generic);
+    nerdle_generate_equations(generic);
+    EXPECT_TRUE(same_candidates(specialized, generic));
+
+    /* regeneration with a status */
+    enum status status[LIMIT_MAX_EQ_SZ];
+    struct equation eq;
+    uint64_t answer = specialized->candidates.eqs[specialized->candidates.nr / 3];
+    uint64_t guess = specialized->candidates.eqs[0];
+    equation_unpack(guess, &eq, sz);
+    feedback_get_status(feedback_pattern(guess, answer, sz), sz, status);
+    nerdle_update_feedback(specialized, &eq, status);
+    nerdle_update_feedback(generic, &eq, status);
+    specialized->candidates.nr = generic->candidates.nr = 0;
+    nerdle_generate_equations(specialized);
+    nerdle_generate_equations(generic);
+    EXPECT_TRUE(specialized->candidates.nr > 0);
+    EXPECT_TRUE(same_candidates(specialized, generic));
+
+    nerdle_destroy(specialized);
+    nerdle_destroy(generic);
+  }
+  return true;
+}
+
+TEST_F(nerdle, regenerate)
+{
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= 8; ++sz) {
+    struct nerdle *dict = generate(sz, 0, 1);
+    const struct candidates *c = &dict->candidates;
+    enum status status[LIMIT_MAX_EQ_SZ];
+    struct equation eq;
+
+    /* status of two guesses against a few answers */
+    for (uint64_t a = 0; a < c->nr; a += c->nr / 7) {
+      struct nerdle *nerdle = nerdle_create(sz, 0);
+      struct constraints constraints;
+      uint64_t guesses[] = { c->eqs[0], c->eqs[c->nr - 1] };
+      nerdle->verbose = false;
+      for (uint32_t g = 0; g < 2; ++g) {
+        equation_unpack(guesses[g], &eq, sz);
+        feedback_get_status(feedback_pattern(guesses[g], c->eqs[a], sz), sz, status);
+        nerdle_update_feedback(nerdle, &eq, status);
+      }
+
+      /* the equations respecting the constraints, no more */
+      nerdle_generate_equations(nerdle);
+      nerdle_get_constraints(nerdle, &constraints);
+      uint64_t nr = 0;
+      for (uint64_t i = 0; i < c->nr; ++i) {
+        if (filter_check(&constraints, c->eqs[i]) == true) {
+          EXPECT_TRUE(nr < nerdle->candidates.nr &&
+                      nerdle->candidates.eqs[nr] == c->eqs[i]);
+          ++nr;
+        }
+      }
+      EXPECT_TRUE(nr == nerdle->candidates.nr && nr > 0);
+      nerdle_destroy(nerdle);
+    }
+    nerdle_destroy(dict);
+  }
+  return true;
+}
+
+/**
+ * Visitor appending the equations enumerated, stopped after @c max.
+ */
+struct collect {
+  uint64_t *eqs;
+  uint64_t nr;
+  uint64_t max;
+  uint64_t nr_chunk;
+};
+
+static bool collect_visitor(void *arg, const uint64_t *eqs, uint64_t nr)
+{
+  struct collect *collect = arg;
+  memcpy(&collect->eqs[collect->nr], eqs, nr * sizeof(uint64_t));
+  collect->nr += nr;
+  ++collect->nr_chunk;
+  return collect->nr < collect->max;
+}
+
+TEST_F(nerdle, enumerate)
+{
+  struct nerdle *nerdle = generate(7, 0, 1);
+  uint64_t nr = nerdle->candidates.nr;
+  struct collect collect = { malloc(nr * sizeof(uint64_t)), 0, UINT64_MAX, 0 };
+  uint64_t chunk[7];
+
+  /* same equations, in chunks */
+  EXPECT_TRUE(nerdle_enumerate_equations(nerdle, chunk, 7, collect_visitor,
+                                         &collect) == true);
+  EXPECT_TRUE(collect.nr == nr && collect.nr_chunk == (nr + 6) / 7);
+  EXPECT_TRUE(memcmp(collect.eqs, nerdle->candidates.eqs,
+                     nr * sizeof(uint64_t)) == 0);
+
+  /* stopped by the visitor */
+  collect.nr = collect.nr_chunk = 0;
+  collect.max = 20;
+  EXPECT_TRUE(nerdle_enumerate_equations(nerdle, chunk, 7, collect_visitor,
+                                         &collect) == false);
+  EXPECT_TRUE(collect.nr == 21 && collect.nr_chunk == 3);
+
+  free(collect.eqs);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+TEST_F(nerdle, score_threads)
+{
+  struct nerdle *nerdle = generate(7, 0, 1);
+  const struct candidates *c = &nerdle->candidates;
+
+  for (enum strategy s = STRATEGY_ENTROPY; s <= STRATEGY_PARTITION; ++s) {
+    uint64_t serial = score_best_guess(c->eqs, c->nr, 7, s, 500, 1);
+    uint64_t parallel = score_best_guess(c->eqs, c->nr, 7, s, 500, 3);
+    EXPECT_TRUE(serial < c->nr);
+    EXPECT_TRUE(serial == parallel);
+  }
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+/**
+ * Guess the equations @c guesses with the answer @c answer and check the
+ * candidates remaining are exactly the equations with the same feedbacks.
+ */
+static bool check_feedback(const struct nerdle *all, const uint64_t *guesses,
+                           uint32_t nr_guess, uint64_t answer)
+{
+  uint32_t sz = all->sz;
+  struct nerdle *nerdle = nerdle_create(sz, 0);
+  nerdle->verbose = false;
+  nerdle_set_equations(nerdle, all->candidates.eqs, all->candidates.nr);
+
+  for (uint32_t g = 0; g < nr_guess; ++g) {
+    struct equation eq;
+    enum status status[LIMIT_MAX_EQ_SZ];
+    equation_unpack(guesses[g], &eq, sz);
+    feedback_get_status(feedback_pattern(guesses[g], answer, sz), sz, status);
+    nerdle_update_feedback(nerdle, &eq, status);
+  }
+  nerdle_check_candidates(nerdle);
+  uint64_t *alive = malloc(nerdle->view.nr_alive * sizeof(uint64_t));
+  uint64_t nr_alive = view_get_equations(&nerdle->view, alive);
+
+  uint64_t nr = 0;
+  bool ok = true;
+  for (uint64_t i = 0; i < all->candidates.nr && ok == true; ++i) {
+    uint64_t eq = all->candidates.eqs[i];
+    bool same = true;
+    for (uint32_t g = 0; g < nr_guess; ++g) {
+      same &= feedback_pattern(guesses[g], eq, sz) ==
+        feedback_pattern(guesses[g], answer, sz);
+    }
+    if (same == true) {
+      ok = nr < nr_alive && alive[nr++] == eq;
+    }
+  }
+  ok &= nr == nr_alive;
+  free(alive);
+  nerdle_destroy(nerdle);
+  return ok;
+}
+
+TEST_F(nerdle, update_feedback)
+{
+  struct nerdle *all = generate(7, 0, 1);
+  const struct candidates *c = &all->candidates;
+
+  for (uint64_t a = 0; a < c->nr; a += 97) {
+    uint64_t answer = c->eqs[a];
+    uint64_t guesses[2] = { c->eqs[(a * 31) % c->nr],
+                            c->eqs[(a * 7 + 1) % c->nr] };
+    EXPECT_TRUE(check_feedback(all, guesses, 1, answer));
+    EXPECT_TRUE(check_feedback(all, guesses, 2, answer));
+  }
+  nerdle_destroy(all);
+  return true;
+}
+
+const static struct test nerdle_tests[] = {
+  TEST(nerdle, generate_valid),
+  TEST(nerdle, generate_threads),
+  TEST(nerdle, generate_limit),
+  TEST(nerdle, generate_generic),
+  TEST(nerdle, regenerate),
+  TEST(nerdle, enumerate),
+  TEST(nerdle, score_threads),
+  TEST(nerdle, update_feedback),
+};
+
+TEST_SUITE(nerdle);
@@ -0,0 +1,101 @@
+#include <stdlib.h>
+
+#include "opening.h"
+#include "nerdle.h"
+#include "feedback.h"
+#include "test.h"
+
+/**
+ * Check the second guesses of an opening are the guesses found online.
+ */
+static bool check_opening(uint32_t sz, uint32_t step)
+{
+  const struct opening *opening = opening_get(sz);
+  struct nerdle *all = nerdle_create(sz, 0);
+  bool ok = true;
+
+  all->verbose = false;
+  nerdle_generate_equations(all);
+  ok &= opening->nr_eq == all->candidates.nr;
+
+  for (uint32_t i = 0; i < opening->nr_second && ok == true; i += step) {
+    const struct opening_second *second = &opening->second[i];
+    struct nerdle *nerdle = nerdle_create(sz, 0);
+    enum status status[LIMIT_MAX_EQ_SZ];
+    struct equation eq;
+
+    ok &= i == 0 || opening->second[i - 1].pattern < second->pattern;
+    nerdle->verbose = false;
+    nerdle->strategy = opening->strategy;
+    nerdle->sample = opening->sample;
+    nerdle_set_table(nerdle, nerdle_get_table(all));
+    equation_unpack(opening->first, &eq, sz);
+    feedback_get_status(second->pattern, sz, status);
+    nerdle_update_feedback(nerdle, &eq, status);
+    nerdle_check_candidates(nerdle);
+
+    uint64_t *eqs = malloc(nerdle->view.nr_alive * sizeof(uint64_t));
+    uint64_t nr = view_get_equations(&nerdle->view, eqs);
+    uint64_t best = score_best_guess(eqs, nr, sz, nerdle->strategy,
+                                     nerdle->sample, 1);
+    ok &= eqs[best] == second->eq;
+    free(eqs);
+    nerdle_destroy(nerdle);
+  }
+
+  nerdle_destroy(all);
+  return ok;
+}
+
+TEST_F(opening, second)
+{
+  for (uint32_t sz = LIMIT_MIN_EQ_SZ; sz <= 7; ++sz) {
+    EXPECT_TRUE(opening_get(sz) != NULL);
+    EXPECT_TRUE(check_opening(sz, sz < 7 ? 1 : 7));
+  }
+  return true;
+}
+
+TEST_F(opening, on_demand)
+{
+  const struct opening *opening = opening_get(6);
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  /* no dictionary: the candidates are generated from the feedback */
+  for (uint32_t i = 0; i < opening->nr_second; i += 5) {
+    struct nerdle *nerdle = nerdle_create(6, 0);
+    nerdle->verbose = false;
+    nerdle->strategy = opening->strategy;
+    nerdle->sample = opening->sample;
+    equation_unpack(opening->first, &eq, 6);
+    feedback_get_status(opening->second[i].pattern, 6, status);
+    nerdle_update_feedback(nerdle, &eq, status);
+    nerdle_find_best_equation(nerdle, &eq);
+    EXPECT_TRUE(equation_pack(&eq) == opening->second[i].eq);
+    nerdle_destroy(nerdle);
+  }
+  return true;
+}
+
+TEST_F(opening, lookup)
+{
+  const struct opening *opening = opening_get(6);
+  uint64_t eq;
+
+  EXPECT_TRUE(opening != NULL);
+  EXPECT_TRUE(opening_get_second(opening, opening->second[0].pattern, &eq));
+  EXPECT_TRUE(eq == opening->second[0].eq);
+  /* all the locations RIGHT: won, no second guess */
+  EXPECT_FALSE(opening_get_second(opening, feedback_nr_pattern(6) - 1, &eq));
+  EXPECT_TRUE(opening_get(LIMIT_MAX_EQ_SZ) == NULL);
+  return true;
+}
+
+const static struct test opening_tests[] = {
+  TEST(opening, second),
+  TEST(opening, on_demand),
+  TEST(opening, lookup),
+};
+
+TEST_SUITE(opening);
@@ -0,0 +1,103 @@
+#include <stdlib.h>
+
+#include "search.h"
+#include "nerdle.h"
+#include "feedback.h"
+#include "test.h"
+#include "test_common.h"
+
+/**
+ * Candidates of size 7 remaining after the feedback of a guess
+ * (less than @c SEARCH_MAX_CANDIDATES).
+ */
+static uint64_t get_candidates(uint64_t *eqs)
+{
+  struct nerdle *nerdle = generate_dictionary(7);
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  const struct candidates *c = &nerdle->candidates;
+  uint64_t guess = c->eqs[0];
+  equation_unpack(guess, &eq, 7);
+  feedback_get_status(feedback_pattern(guess, c->eqs[c->nr / 2], 7), 7, status);
+  nerdle_update_feedback(nerdle, &eq, status);
+  nerdle_check_candidates(nerdle);
+  uint64_t nr = view_get_equations(&nerdle->view, eqs);
+  nerdle_destroy(nerdle);
+  return nr;
+}
+
+TEST_F(search, pair)
+{
+  uint64_t eqs[2] = { 0x13e52a6ULL, 0x13e6b73ULL };
+  struct search search = { 7, 3, SEARCH_DEFAULT_WIDTH, 0, NULL };
+  double cost;
+
+  EXPECT_TRUE(search_best_guess(&search, eqs, 2, &cost) == 0);
+  EXPECT_TRUE(cost == 1.5);
+  return true;
+}
+
+TEST_F(search, depth)
+{
+  uint64_t *eqs = malloc(SEARCH_MAX_CANDIDATES * sizeof(uint64_t));
+  uint64_t nr = get_candidates(eqs);
+  double previous = 0;
+
+  INFO("%lu candidates", nr);
+  EXPECT_TRUE(nr > 2 && nr <= SEARCH_MAX_CANDIDATES);
+  /* the parts below the depth are lower bounds */
+  for (uint32_t depth = 1; depth <= 2; ++depth) {
+    struct search search = { 7, depth, SEARCH_DEFAULT_WIDTH, 0, NULL };
+    double cost;
+    uint64_t best = search_best_guess(&search, eqs, nr, &cost);
+    EXPECT_TRUE(best < nr);
+    EXPECT_TRUE(cost > 1 && cost >= previous);
+    previous = cost;
+  }
+
+  /* out of time: the depth 1 is searched anyway */
+  struct search quick = { 7, 3, SEARCH_DEFAULT_WIDTH, 1e-9, NULL };
+  struct search one = { 7, 1, SEARCH_DEFAULT_WIDTH, 0, NULL };
+  double cost_quick;
+  double cost_one;
+  EXPECT_TRUE(search_best_guess(&quick, eqs, nr, &cost_quick) ==
+              search_best_guess(&one, eqs, nr, &cost_one));
+  EXPECT_TRUE(cost_quick == cost_one);
+
+  free(eqs);
+  return true;
+}
+
+TEST_F(search, cache)
+{
+  uint64_t *eqs = malloc(SEARCH_MAX_CANDIDATES * sizeof(uint64_t));
+  uint64_t nr = get_candidates(eqs);
+  struct search_cache *cache = search_cache_create(12);
+  struct search none = { 7, 2, SEARCH_DEFAULT_WIDTH, 0, NULL };
+  struct search cached = { 7, 2, SEARCH_DEFAULT_WIDTH, 0, cache };
+  double cost;
+  double cost_cached;
+
+  uint64_t best = search_best_guess(&none, eqs, nr, &cost);
+  EXPECT_TRUE(search_best_guess(&cached, eqs, nr, &cost_cached) == best);
+  EXPECT_TRUE(cost_cached == cost);
+  uint64_t nr_hit = cache->nr_hit;
+
+  /* the root is found in the cache */
+  EXPECT_TRUE(search_best_guess(&cached, eqs, nr, &cost_cached) == best);
+  EXPECT_TRUE(cost_cached == cost);
+  EXPECT_TRUE(cache->nr_hit > nr_hit);
+
+  search_cache_destroy(cache);
+  free(eqs);
+  return true;
+}
+
+const static struct test search_tests[] = {
+  TEST(search, pair),
+  TEST(search, depth),
+  TEST(search, cache),
+};
+
+TEST_SUITE(search);
@@ -0,0 +1,52 @@
+#include "sim.h"
+#include "first_equations.h"
+#include "test.h"
+#include "test_common.h"
+
+TEST_F(sim, sweep)
+{
+  struct nerdle *nerdle = generate_dictionary(6);
+  struct sim_stats stats = {};
+  struct sim_game game;
+
+  for (uint64_t i = 0; i < nerdle->candidates.nr; ++i) {
+    game.answer = nerdle->candidates.eqs[i];
+    sim_play(nerdle, &game);
+    EXPECT_TRUE(game.won);
+    EXPECT_TRUE(game.nr_round >= 1);
+    sim_stats_add(&stats, &game);
+  }
+
+  uint64_t nr_won = 0;
+  for (uint32_t round = 1; round <= SIM_MAX_ROUND; ++round) {
+    nr_won += stats.histogram[round];
+  }
+  EXPECT_TRUE(stats.nr_game == nerdle->candidates.nr);
+  EXPECT_TRUE(nr_won == stats.nr_game);
+  EXPECT_TRUE(stats.nr_latency[0] == stats.nr_game);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+TEST_F(sim, first_guess)
+{
+  struct nerdle *nerdle = generate_dictionary(6);
+  struct sim_game game;
+  struct equation eq;
+
+  /* the answer is the first equation */
+  nerdle_set_first_equation(nerdle, &eq);
+  game.answer = equation_pack(&eq);
+  sim_play(nerdle, &game);
+  EXPECT_TRUE(game.won);
+  EXPECT_TRUE(game.nr_round == 1);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+const static struct test sim_tests[] = {
+  TEST(sim, sweep),
+  TEST(sim, first_guess),
+};
+
+TEST_SUITE(sim);
@@ -0,0 +1,97 @@
+#include <stdlib.h>
+
+#include "table.h"
+#include "nerdle.h"
+#include "feedback.h"
+#include "test.h"
+#include "test_common.h"
+
+static int compare_size(const void *a, const void *b)
+{
+  return *(const uint32_t*)a - *(const uint32_t*)b;
+}
+
+/**
+ * Sizes of the parts of the equations by feedback pattern of the guess,
+ * sorted, counted with @c feedback_pattern.
+ */
+static uint32_t partition_scalar(const uint64_t *eqs, uint64_t nr, uint32_t sz,
+                                 uint64_t guess, uint32_t *sizes)
+{
+  uint32_t *counts = calloc(feedback_nr_pattern(sz), sizeof(*counts));
+  uint32_t nr_part = 0;
+
+  for (uint64_t i = 0; i < nr; ++i) {
+    ++counts[feedback_pattern(guess, eqs[i], sz)];
+  }
+  for (uint32_t p = 0; p < feedback_nr_pattern(sz); ++p) {
+    if (counts[p] > 0) {
+      sizes[nr_part++] = counts[p];
+    }
+  }
+  free(counts);
+  qsort(sizes, nr_part, sizeof(*sizes), compare_size);
+  return nr_part;
+}
+
+TEST_F(table, counts)
+{
+  struct nerdle *nerdle = generate_dictionary(7);
+  const struct candidates *c = &nerdle->candidates;
+  struct table *table = table_create(7, c->eqs, c->nr);
+
+  for (uint64_t i = 0; i < c->nr; i += 13) {
+    struct equation eq;
+    uint32_t count[SYMBOL_END] = { 0 };
+    equation_unpack(c->eqs[i], &eq, 7);
+    for (uint32_t pos = 0; pos < 7; ++pos) {
+      ++count[eq.symbols[pos]];
+    }
+    for (enum symbol s = 0; s < SYMBOL_END; ++s) {
+      for (uint32_t k = 1; k <= 7; ++k) {
+        bool bit = (table_get_count(table, s, k)[i / 64] >> (i % 64)) & 1;
+        EXPECT_TRUE(bit == (count[s] >= k));
+      }
+    }
+  }
+
+  table_destroy(table);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+TEST_F(table, partition)
+{
+  struct nerdle *nerdle = generate_dictionary(8);
+  const struct candidates *c = &nerdle->candidates;
+  uint32_t *expected = malloc(c->nr * sizeof(uint32_t));
+  uint32_t *sizes = malloc(c->nr * sizeof(uint32_t));
+
+  /* the whole dictionary (bitsets) and a few equations (posting lists) */
+  for (uint64_t nr = c->nr; nr > 0; nr /= 37) {
+    struct table *table = table_create(8, c->eqs, nr);
+    uint64_t *scratch = malloc(table_partition_scratch(table) * sizeof(uint64_t));
+    for (uint64_t g = 0; g < c->nr; g += 1009) {
+      uint64_t guess = c->eqs[g];
+      uint32_t nr_expected = partition_scalar(c->eqs, nr, 8, guess, expected);
+      uint32_t nr_part = table_partition(table, guess, sizes, scratch);
+      qsort(sizes, nr_part, sizeof(*sizes), compare_size);
+      EXPECT_TRUE(nr_part == nr_expected);
+      EXPECT_TRUE(memcmp(sizes, expected, nr_part * sizeof(uint32_t)) == 0);
+    }
+    free(scratch);
+    table_destroy(table);
+  }
+
+  free(sizes);
+  free(expected);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+const static struct test table_tests[] = {
+  TEST(table, counts),
+  TEST(table, partition),
+};
+
+TEST_SUITE(table);
@@ -46,6 +46,10 @@ TEST_F(utils, str_to_eq)
   TEST_STR_TO_EQ("------", s3);
 
 #undef TEST_STR_TO_EQ
+
+  /* unknown character */
+  struct equation invalid;
+  EXPECT_FALSE(utils_str_to_eq("1x+2=12", &invalid, 7));
   return true;
 }
 
@@ -0,0 +1,111 @@
+#include <stdlib.h>
+
+#include "view.h"
+#include "nerdle.h"
+#include "feedback.h"
+#include "test.h"
+#include "test_common.h"
+
+/**
+ * Constraints of the feedback of @c guess with the answer @c answer.
+ */
+static void get_constraints(uint32_t sz, uint64_t guess, uint64_t answer,
+                            struct constraints *constraints)
+{
+  struct nerdle *nerdle = nerdle_create(sz, 0);
+  enum status status[LIMIT_MAX_EQ_SZ];
+  struct equation eq;
+
+  equation_unpack(guess, &eq, sz);
+  feedback_get_status(feedback_pattern(guess, answer, sz), sz, status);
+  nerdle_update_feedback(nerdle, &eq, status);
+  nerdle_get_constraints(nerdle, constraints);
+  nerdle_destroy(nerdle);
+}
+
+/**
+ * Check the equations alive of the view are the equations kept by
+ * @c filter_check.
+ */
+static bool same_equations(const struct view *view, const uint64_t *eqs,
+                           uint64_t nr)
+{
+  uint64_t *alive = malloc(view->table->nr * sizeof(uint64_t));
+  uint64_t nr_alive = view_get_equations(view, alive);
+  bool ok = nr_alive == nr && view->nr_alive == nr &&
+    memcmp(alive, eqs, nr * sizeof(uint64_t)) == 0;
+  free(alive);
+  return ok;
+}
+
+TEST_F(view, filter)
+{
+  struct nerdle *nerdle = generate_dictionary(8);
+  const struct candidates *c = &nerdle->candidates;
+  struct table *table = table_create(8, c->eqs, c->nr);
+  uint64_t *scalar = malloc(c->nr * sizeof(uint64_t));
+  struct view view;
+
+  view_init(&view, table);
+  EXPECT_TRUE(same_equations(&view, c->eqs, c->nr));
+  view_release(&view);
+  for (uint64_t a = 0; a < c->nr; a += 997) {
+    struct constraints constraints;
+    get_constraints(8, c->eqs[(a * 31) % c->nr], c->eqs[a], &constraints);
+
+    uint64_t nr = 0;
+    for (uint64_t i = 0; i < c->nr; ++i) {
+      if (filter_check(&constraints, c->eqs[i]) == true) {
+        scalar[nr++] = c->eqs[i];
+      }
+    }
+    view_init(&view, table);
+    view_filter(&view, &constraints);
+    EXPECT_TRUE(nr > 0);
+    EXPECT_TRUE(same_equations(&view, scalar, nr));
+    view_release(&view);
+  }
+
+  free(scalar);
+  table_destroy(table);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+TEST_F(view, copy)
+{
+  struct nerdle *nerdle = generate_dictionary(7);
+  const struct candidates *c = &nerdle->candidates;
+  struct table *table = table_create(7, c->eqs, c->nr);
+  struct constraints constraints;
+  struct view view;
+  struct view undo;
+
+  view_init(&view, table);
+  get_constraints(7, c->eqs[0], c->eqs[c->nr / 2], &constraints);
+  view_filter(&view, &constraints);
+  view_init_copy(&undo, &view);
+  uint64_t nr = view.nr_alive;
+  EXPECT_TRUE(nr > 1);
+
+  /* remove the last equation alive, then undo */
+  view_remove_nth(&view, nr - 1);
+  EXPECT_TRUE(view.nr_alive == nr - 1);
+  view_copy(&view, &undo);
+  EXPECT_TRUE(view.nr_alive == nr);
+  EXPECT_TRUE(memcmp(view.alive, undo.alive,
+                     table->nr_word * sizeof(uint64_t)) == 0);
+
+  view_release(&undo);
+  view_release(&view);
+  table_destroy(table);
+  nerdle_destroy(nerdle);
+  return true;
+}
+
+const static struct test view_tests[] = {
+  TEST(view, filter),
+  TEST(view, copy),
+};
+
+TEST_SUITE(view);